@@ -18,6 +18,8 @@
  */
 #include "joynr/LibjoynrSettings.h"
 
+#include <cstdint>
+
 #include "joynr/Logger.h"
 #include "joynr/Settings.h"
 
@@ -35,6 +37,9 @@ void LibjoynrSettings::checkSettings()
     if (!_settings.contains(SETTING_PARTICIPANT_IDS_PERSISTENCE_FILENAME())) {
         setParticipantIdsPersistenceFilename(DEFAULT_PARTICIPANT_IDS_PERSISTENCE_FILENAME());
     }
+    if (!_settings.contains(SETTING_PERSISTENCE_COALESCING_WINDOW_MS())) {
+        setPersistenceCoalescingWindowMs(DEFAULT_PERSISTENCE_COALESCING_WINDOW_MS());
+    }
 }
 
 const std::string& LibjoynrSettings::SETTING_PARTICIPANT_IDS_PERSISTENCE_FILENAME()
@@ -49,6 +54,17 @@ const std::string& LibjoynrSettings::DEFAULT_PARTICIPANT_IDS_PERSISTENCE_FILENAM
     return value;
 }
 
+const std::string& LibjoynrSettings::SETTING_PERSISTENCE_COALESCING_WINDOW_MS()
+{
+    static const std::string value("lib-joynr/persistence-coalescing-window-ms");
+    return value;
+}
+
+std::chrono::milliseconds LibjoynrSettings::DEFAULT_PERSISTENCE_COALESCING_WINDOW_MS()
+{
+    return std::chrono::milliseconds(100);
+}
+
 std::string LibjoynrSettings::getParticipantIdsPersistenceFilename() const
 {
     return _settings.get<std::string>(SETTING_PARTICIPANT_IDS_PERSISTENCE_FILENAME());
@@ -59,6 +75,17 @@ void LibjoynrSettings::setParticipantIdsPersistenceFilename(const std::string& f
     _settings.set(SETTING_PARTICIPANT_IDS_PERSISTENCE_FILENAME(), filename);
 }
 
+std::chrono::milliseconds LibjoynrSettings::getPersistenceCoalescingWindowMs() const
+{
+    return std::chrono::milliseconds(
+            _settings.get<std::int64_t>(SETTING_PERSISTENCE_COALESCING_WINDOW_MS()));
+}
+
+void LibjoynrSettings::setPersistenceCoalescingWindowMs(std::chrono::milliseconds coalescingWindow)
+{
+    _settings.set(SETTING_PERSISTENCE_COALESCING_WINDOW_MS(), coalescingWindow.count());
+}
+
 void LibjoynrSettings::printSettings() const
 {
 }
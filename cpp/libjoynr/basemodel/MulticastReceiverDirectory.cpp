@@ -93,6 +93,19 @@ std::vector<std::string> MulticastReceiverDirectory::getMulticastIds() const
     return multicastIds;
 }
 
+std::unordered_map<std::string, std::unordered_set<std::string>> MulticastReceiverDirectory::
+        getAllReceivers() const
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    std::unordered_map<std::string, std::unordered_set<std::string>> allReceivers;
+
+    for (const auto& multicastReceiver : _multicastReceivers) {
+        allReceivers.emplace(multicastReceiver.first._multicastId, multicastReceiver.second);
+    }
+
+    return allReceivers;
+}
+
 bool MulticastReceiverDirectory::contains(const std::string& multicastId)
 {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
@@ -19,8 +19,13 @@
 #ifndef ABSTRACTJOYNRMESSAGINGCONNECTOR_H
 #define ABSTRACTJOYNRMESSAGINGCONNECTOR_H
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
@@ -68,6 +73,49 @@ public:
     void operationOneWayRequest(OneWayRequest&& request,
                                 boost::optional<MessagingQos> qos = boost::none);
 
+    /**
+     * @brief Collects the requests of all following asynchronous operationRequest calls of the
+     * calling thread instead of sending them, until the same thread calls sendBatch.
+     * Requests of other threads, synchronous calls and fire-and-forget requests are sent
+     * immediately.
+     *
+     * Only providers which declare the ProviderQos custom parameter
+     * Message::CUSTOM_PARAMETER_BATCH_REQUESTS() understand batch requests. For all other
+     * providers no batch is started and the requests are sent one by one.
+     */
+    void startBatch();
+
+    /**
+     * @brief Sends the requests collected since startBatch by the calling thread to the provider
+     * in one batch request message and stops collecting. The replies are delivered to the reply
+     * callers of the single requests.
+     *
+     * The batch uses the messaging qos of its first request with the largest ttl of all
+     * requests. The ttl starts when the batch is sent.
+     */
+    void sendBatch();
+
+    /**
+     * @return true if the provider of the given discovery entry declares that it accepts
+     * batch requests
+     */
+    static bool supportsBatchRequests(const types::DiscoveryEntryWithMetaInfo& discoveryEntry);
+
+    /**
+     * @brief Marks the requests of the current thread as synchronous calls while it exists.
+     * A synchronous call waits for its reply, so its request is never added to a batch.
+     */
+    class JOYNR_EXPORT SyncCallScope
+    {
+    public:
+        SyncCallScope();
+        ~SyncCallScope();
+
+    private:
+        DISALLOW_COPY_AND_ASSIGN(SyncCallScope);
+        const bool _wasInSyncCall;
+    };
+
 protected:
     std::weak_ptr<IMessageSender> _messageSender;
     std::weak_ptr<ISubscriptionManager> _subscriptionManager;
@@ -81,6 +129,10 @@ protected:
 
 private:
     DISALLOW_COPY_AND_ASSIGN(AbstractJoynrMessagingConnector);
+    struct Batch;
+    std::mutex _batchMutex;
+    std::atomic<std::size_t> _numberOfBatches;
+    std::unordered_map<std::thread::id, std::unique_ptr<Batch>> _batches;
 };
 
 } // namespace joynr
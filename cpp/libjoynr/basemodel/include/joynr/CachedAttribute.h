@@ -0,0 +1,254 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef CACHEDATTRIBUTE_H
+#define CACHEDATTRIBUTE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include <boost/optional.hpp>
+
+#include "joynr/ISubscriptionListener.h"
+#include "joynr/Metrics.h"
+#include "joynr/OnChangeWithKeepAliveSubscriptionQos.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/UnicastSubscriptionQos.h"
+
+namespace joynr
+{
+
+/**
+ * Proxy side cache of the value of an attribute.
+ *
+ * While the cache is enabled, the connector keeps the value up to date with an
+ * OnChangeWithKeepAlive subscription created with createSubscriptionQos. The provider publishes
+ * every change and at least every half of the maximum age, so a getter can be answered locally
+ * as long as the last publication is not older than the maximum age. A missed publication, e.g.
+ * after the provider is gone, invalidates the value until the next publication arrives.
+ *
+ * While a setter is in flight, a publication may still carry the value from before the set.
+ * Every setter therefore starts a new generation with beginSet(); publications are discarded
+ * until the setters of all generations up to the current one have returned (endSet()).
+ */
+template <typename T>
+class CachedAttribute
+{
+public:
+    CachedAttribute()
+            : _mutex(),
+              _value(),
+              _updateTime(),
+              _maxAge(0),
+              _subscriptionId(),
+              _generation(0),
+              _returnedGeneration(0),
+              _hits(MetricsRegistry::instance().getCounter(metricName(),
+                                                           metricHelp(),
+                                                           "result=\"hit\"")),
+              _misses(MetricsRegistry::instance().getCounter(metricName(),
+                                                             metricHelp(),
+                                                             "result=\"miss\""))
+    {
+    }
+
+    /**
+     * Enables the cache. Getters are answered from the cache as soon as the first publication
+     * of the subscription has been received.
+     * @param maxAge the maximum age of a value served from the cache
+     * @param subscriptionId the id of the subscription keeping the cache up to date
+     */
+    void enable(std::chrono::milliseconds maxAge, const std::string& subscriptionId)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _maxAge = maxAge;
+        _subscriptionId = subscriptionId;
+        _value = boost::none;
+    }
+
+    /**
+     * Disables the cache and drops the cached value.
+     * @return the id of the subscription which kept the cache up to date, empty if the cache
+     * was not enabled
+     */
+    std::string disable()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::string subscriptionId = std::move(_subscriptionId);
+        _subscriptionId.clear();
+        _value = boost::none;
+        return subscriptionId;
+    }
+
+    bool isEnabled() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return !_subscriptionId.empty();
+    }
+
+    void update(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_subscriptionId.empty() || _returnedGeneration != _generation) {
+            return;
+        }
+        _value = value;
+        _updateTime = std::chrono::steady_clock::now();
+    }
+
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _value = boost::none;
+    }
+
+    /**
+     * Called before a setter is sent. Drops the cached value and discards publications until
+     * endSet() has been called with the returned generation.
+     * @return the generation of the setter
+     */
+    std::uint64_t beginSet()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _value = boost::none;
+        return ++_generation;
+    }
+
+    /**
+     * Called when the setter of the given generation has returned, successfully or not.
+     * Setters are processed by the provider in the order they are sent, so the return of a
+     * setter also completes the setters of all earlier generations.
+     */
+    void endSet(std::uint64_t generation)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _returnedGeneration = std::max(_returnedGeneration, generation);
+        _value = boost::none;
+    }
+
+    /**
+     * @return the cached value if the cache is enabled and the value is not older than the
+     * maximum age, otherwise the getter has to be sent to the provider
+     */
+    boost::optional<T> get()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_subscriptionId.empty()) {
+            return boost::none;
+        }
+        if (!_value || std::chrono::steady_clock::now() - _updateTime > _maxAge) {
+            lock.unlock();
+            _misses->increment();
+            return boost::none;
+        }
+        boost::optional<T> value = _value;
+        lock.unlock();
+        _hits->increment();
+        return value;
+    }
+
+    /**
+     * @return the qos of the subscription keeping a cache with the given maximum age up to date
+     */
+    static std::shared_ptr<OnChangeWithKeepAliveSubscriptionQos> createSubscriptionQos(
+            std::chrono::milliseconds maxAge)
+    {
+        const std::int64_t maxAgeMs = static_cast<std::int64_t>(maxAge.count());
+        const std::int64_t validityMs = -1;
+        const std::int64_t minIntervalMs = 0;
+        const std::int64_t maxIntervalMs =
+                std::max(maxAgeMs / 2, OnChangeWithKeepAliveSubscriptionQos::MIN_MAX_INTERVAL_MS());
+        return std::make_shared<OnChangeWithKeepAliveSubscriptionQos>(
+                validityMs,
+                UnicastSubscriptionQos::DEFAULT_PUBLICATION_TTL_MS(),
+                minIntervalMs,
+                maxIntervalMs,
+                std::max(maxAgeMs, maxIntervalMs));
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(CachedAttribute);
+
+    static const std::string& metricName()
+    {
+        static const std::string name("joynr_proxy_attribute_cache_lookups_total");
+        return name;
+    }
+
+    static const std::string& metricHelp()
+    {
+        static const std::string help("Attribute getters of proxies with enabled attribute cache");
+        return help;
+    }
+
+    mutable std::mutex _mutex;
+    boost::optional<T> _value;
+    std::chrono::steady_clock::time_point _updateTime;
+    std::chrono::milliseconds _maxAge;
+    std::string _subscriptionId;
+    std::uint64_t _generation;
+    std::uint64_t _returnedGeneration;
+    std::shared_ptr<MetricsCounter> _hits;
+    std::shared_ptr<MetricsCounter> _misses;
+};
+
+/**
+ * Subscription listener updating a CachedAttribute with the publications of the provider.
+ */
+template <typename T>
+class CachedAttributeListener : public ISubscriptionListener<T>
+{
+public:
+    explicit CachedAttributeListener(std::weak_ptr<CachedAttribute<T>> cache)
+            : _cache(std::move(cache))
+    {
+    }
+
+    void onReceive(const T& value) override
+    {
+        if (auto cache = _cache.lock()) {
+            cache->update(value);
+        }
+    }
+
+    void onError(const exceptions::JoynrRuntimeException& error) override
+    {
+        std::ignore = error;
+        // missed publication or failed subscription, the provider may be gone
+        if (auto cache = _cache.lock()) {
+            cache->invalidate();
+        }
+    }
+
+    void onSubscribed(const std::string& subscriptionId) override
+    {
+        std::ignore = subscriptionId;
+    }
+
+private:
+    std::weak_ptr<CachedAttribute<T>> _cache;
+};
+
+} // namespace joynr
+
+#endif // CACHEDATTRIBUTE_H
@@ -22,6 +22,7 @@
 #include "joynr/JoynrExport.h"
 #include "joynr/Logger.h"
 
+#include <chrono>
 #include <string>
 
 namespace joynr
@@ -34,6 +35,8 @@ class JOYNR_EXPORT LibjoynrSettings
 public:
     static const std::string& SETTING_PARTICIPANT_IDS_PERSISTENCE_FILENAME();
     static const std::string& DEFAULT_PARTICIPANT_IDS_PERSISTENCE_FILENAME();
+    static const std::string& SETTING_PERSISTENCE_COALESCING_WINDOW_MS();
+    static std::chrono::milliseconds DEFAULT_PERSISTENCE_COALESCING_WINDOW_MS();
 
     explicit LibjoynrSettings(Settings& settings);
     LibjoynrSettings(const LibjoynrSettings&) = default;
@@ -43,6 +46,8 @@ public:
 
     std::string getParticipantIdsPersistenceFilename() const;
     void setParticipantIdsPersistenceFilename(const std::string& filename);
+    std::chrono::milliseconds getPersistenceCoalescingWindowMs() const;
+    void setPersistenceCoalescingWindowMs(std::chrono::milliseconds coalescingWindow);
 
     void printSettings() const;
 
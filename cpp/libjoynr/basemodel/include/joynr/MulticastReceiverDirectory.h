@@ -23,6 +23,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "joynr/Logger.h"
 #include "joynr/MulticastMatcher.h"
@@ -46,6 +47,12 @@ public:
     std::unordered_set<std::string> getReceivers(const std::string& multicastId);
     std::vector<std::string> getMulticastIds() const;
 
+    /*
+     * Returns the receivers of each registered multicast ID, which may contain wildcards.
+     * Unlike getReceivers, the multicast IDs are not matched against each other.
+     */
+    std::unordered_map<std::string, std::unordered_set<std::string>> getAllReceivers() const;
+
     bool contains(const std::string& multicastId);
 
     bool contains(const std::string& multicastId, const std::string& receiverId);
@@ -20,10 +20,14 @@
 #define PUBLICATIONMANAGER_H
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -48,6 +52,9 @@ namespace joynr
 {
 
 class SubscriptionRequest;
+class SubscriptionAttributeListener;
+class LatencyHistogram;
+class MetricsCounter;
 class BroadcastSubscriptionRequest;
 class MulticastSubscriptionRequest;
 class SubscriptionInformation;
@@ -72,10 +79,33 @@ class SubscriptionQos;
 class JOYNR_EXPORT PublicationManager : public std::enable_shared_from_this<PublicationManager>
 {
 public:
+    /**
+     * Metrics of the ticks polling periodic subscriptions, see getSchedulerMetrics()
+     */
+    struct SchedulerMetrics {
+        std::uint64_t periodicTicks;
+        std::uint64_t polledSubscriptions;
+        /*! ticks which were skipped because a tick started more than one period late */
+        std::uint64_t missedTicks;
+        /*! delay between the planned and the actual start of a tick */
+        std::chrono::milliseconds averageLateness;
+        std::chrono::milliseconds maxLateness;
+    };
+
     PublicationManager(boost::asio::io_service& ioService,
                        std::weak_ptr<IMessageSender> messageSender,
                        std::uint64_t ttlUplift = 0,
                        int maxThreads = 1);
+    /**
+     * @brief Creates a PublicationManager using an existing scheduler, e.g. one which is
+     * shared with the SubscriptionManager.
+     * @param isSchedulerOwner if true, the scheduler is shut down by shutdown(); a shared
+     * scheduler must be shut down by its creator instead
+     */
+    PublicationManager(std::shared_ptr<DelayedScheduler> scheduler,
+                       std::weak_ptr<IMessageSender> messageSender,
+                       std::uint64_t ttlUplift = 0,
+                       bool isSchedulerOwner = true);
     virtual ~PublicationManager();
     /**
      * @brief Adds the SubscriptionRequest and starts runnable to poll attributes.
@@ -197,11 +227,30 @@ public:
     void selectiveBroadcastOccurred(const std::string& subscriptionId,
                                     const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
                                     const Ts&... values);
+
+    /**
+     * @brief Publishes a selective broadcast to several subscriptions of the same broadcast
+     *
+     * The filter chain is run once per distinct set of filter parameters, subscriptions with
+     * equal filter parameters share its result.
+     * @param subscriptionIds The subscriptions which are listening on the broadcast
+     * @param filters The broadcast filters
+     * @param values The broadcast values
+     */
+    template <typename BroadcastFilter, typename... Ts>
+    void selectiveBroadcastOccurred(const std::vector<std::string>& subscriptionIds,
+                                    const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+                                    const Ts&... values);
     void shutdown();
 
+    SchedulerMetrics getSchedulerMetrics() const;
+
 private:
     DISALLOW_COPY_AND_ASSIGN(PublicationManager);
 
+    // attribute listeners call attributeValueChanged() with their publication
+    friend class SubscriptionAttributeListener;
+
     // Used for multicast publication
     std::weak_ptr<IMessageSender> _messageSender;
 
@@ -218,6 +267,7 @@ private:
     std::mutex _fileWriteLock;
     // Publications are scheduled to run on a thread pool
     std::shared_ptr<DelayedScheduler> _delayedScheduler;
+    const bool _isSchedulerOwner;
 
     // Support for clean shutdowns
     std::mutex _shutDownMutex;
@@ -240,10 +290,6 @@ private:
     // Logging
     ADD_LOGGER(PublicationManager)
 
-    // List of subscriptionId's of runnables scheduled with delay <= qos.getMinIntervalMs_ms()
-    std::vector<std::string> _currentScheduledPublications;
-    std::mutex _currentScheduledPublicationsMutex;
-
     // Read/write lock for broadcast filters
     mutable ReadWriteLock _broadcastFilterLock;
 
@@ -258,8 +304,30 @@ private:
     // PublicationEndRunnables finish a publication
     class PublicationEndRunnable;
 
+    // PeriodicTickRunnables poll all periodic subscriptions with the same period
+    class PeriodicTickRunnable;
+
+    struct PeriodicTick {
+        std::set<std::string> subscriptionIds;
+        std::chrono::steady_clock::time_point nextTick;
+        DelayedScheduler::RunnableHandle runnableHandle;
+    };
+
+    // Periodic subscriptions keyed by their period in ms
+    std::map<std::int64_t, PeriodicTick> _periodicTicks;
+    mutable std::mutex _periodicTicksMutex;
+    std::uint64_t _periodicTickCount;
+    std::uint64_t _polledSubscriptionCount;
+    std::uint64_t _missedTickCount;
+    std::chrono::milliseconds _totalTickLateness;
+    std::chrono::milliseconds _maxTickLateness;
+    // exported counterparts of the tick lateness and the missed ticks, see MetricsRegistry
+    std::shared_ptr<LatencyHistogram> _tickLatenessHistogram;
+    std::shared_ptr<MetricsCounter> _missedTicksCounter;
+
     // Functions called by runnables
-    void pollSubscription(const std::string& subscriptionId);
+    void pollSubscription(const std::string& subscriptionId, bool isPeriodicTick = false);
+    void runPeriodicTick(std::int64_t periodMs);
     void removePublication(const std::string& subscriptionId);
     void removeAttributePublication(const std::string& subscriptionId);
     void removeBroadcastPublication(const std::string& subscriptionId);
@@ -284,9 +352,19 @@ private:
     bool publicationExists(const std::string& subscriptionId) const;
     void createPublishRunnable(const std::string& subscriptionId);
 
-    void reschedulePublication(const std::string& subscriptionId, std::int64_t nextPublication);
+    void reschedulePublication(std::shared_ptr<Publication> publication,
+                               const std::string& subscriptionId,
+                               std::int64_t nextPublication);
+
+    void scheduleNextPoll(const std::string& subscriptionId,
+                          std::shared_ptr<SubscriptionQos> qos,
+                          std::int64_t publicationInterval,
+                          bool isPeriodicTick);
+    void addToPeriodicTick(const std::string& subscriptionId, std::int64_t periodMs);
+    void removeFromPeriodicTick(const std::string& subscriptionId);
 
-    bool isPublicationAlreadyScheduled(const std::string& subscriptionId);
+    template <typename T>
+    void attributeValueChanged(std::shared_ptr<Publication> publication, const T& value);
 
     /**
      * @brief getTimeUntilNextPublication determines the time to wait until the next publication
@@ -347,6 +425,10 @@ private:
 
     void removePublicationEndRunnable(std::shared_ptr<Publication> publication);
 
+    // Returns a key which is equal for equal filter parameters of broadcast subscriptions
+    static std::string createFilterParametersKey(
+            const BroadcastSubscriptionRequestInformation& request);
+
     template <typename BroadcastFilter, typename... Ts>
     bool processFilterChain(
             std::shared_ptr<BroadcastSubscriptionRequestInformation> subscriptionRequest,
@@ -375,10 +457,18 @@ public:
     std::int64_t _timeOfLastPublication;
     std::weak_ptr<IPublicationSender> _sender;
     std::shared_ptr<RequestCaller> _requestCaller;
+    // only set for attribute subscriptions
+    std::shared_ptr<SubscriptionRequestInformation> _subscriptionRequest;
     std::shared_ptr<SubscriptionAttributeListener> _attributeListener;
     std::shared_ptr<UnicastBroadcastListener> _broadcastListener;
+    // only set for broadcast subscriptions, see createFilterParametersKey
+    std::string _filterParametersKey;
     std::recursive_mutex _mutex;
     DelayedScheduler::RunnableHandle _publicationEndRunnableHandle;
+    // true while a PublisherRunnable is scheduled which will send the current value
+    std::atomic<bool> _isPublicationScheduled;
+    // false once the publication has been removed, guarded by _mutex
+    bool _isActive;
 
 private:
     DISALLOW_COPY_AND_ASSIGN(Publication);
@@ -387,39 +477,52 @@ private:
 template <typename T>
 void PublicationManager::attributeValueChanged(const std::string& subscriptionId, const T& value)
 {
-    JOYNR_LOG_DEBUG(logger(), "attributeValueChanged for onChange subscription {}", subscriptionId);
-
-    // See if the subscription is still valid
-    std::unique_lock<std::mutex> publicationsLock(_publicationsMutex);
-    std::shared_ptr<Publication> publication = _publications.value(subscriptionId);
-    std::shared_ptr<SubscriptionRequestInformation> subscriptionRequest =
-            _subscriptionId2SubscriptionRequest.value(subscriptionId);
-    if (!publication || !subscriptionRequest) {
+    std::shared_ptr<Publication> publication;
+    {
+        std::lock_guard<std::mutex> publicationsLock(_publicationsMutex);
+        publication = _publications.value(subscriptionId);
+    }
+    if (!publication || !publication->_subscriptionRequest) {
         JOYNR_LOG_ERROR(logger(),
                         "attributeValueChanged called for non-existing subscription {}",
                         subscriptionId);
         return;
     }
+    attributeValueChanged(std::move(publication), value);
+}
 
-    {
-        std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
-        publicationsLock.unlock();
-        if (!isPublicationAlreadyScheduled(subscriptionId)) {
-            std::int64_t timeUntilNextPublication =
-                    getTimeUntilNextPublication(publication, subscriptionRequest->getQos());
+template <typename T>
+void PublicationManager::attributeValueChanged(std::shared_ptr<Publication> publication,
+                                               const T& value)
+{
+    // checked without lock first, the scheduled publication will send the latest value
+    if (publication->_isPublicationScheduled) {
+        return;
+    }
 
-            if (timeUntilNextPublication == 0) {
-                // Send the publication
-                BaseReply replyValue;
-                replyValue.setResponse(value);
-                sendPublication(publication,
-                                subscriptionRequest,
-                                subscriptionRequest,
-                                std::move(replyValue));
-            } else {
-                reschedulePublication(subscriptionId, timeUntilNextPublication);
-            }
-        }
+    std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
+    // See if the subscription is still valid
+    if (!publication->_isActive || publication->_isPublicationScheduled) {
+        return;
+    }
+    const std::shared_ptr<SubscriptionRequestInformation>& subscriptionRequest =
+            publication->_subscriptionRequest;
+    JOYNR_LOG_DEBUG(logger(),
+                    "attributeValueChanged for onChange subscription {}",
+                    subscriptionRequest->getSubscriptionId());
+
+    std::int64_t timeUntilNextPublication =
+            getTimeUntilNextPublication(publication, subscriptionRequest->getQos());
+
+    if (timeUntilNextPublication == 0) {
+        // Send the publication
+        BaseReply replyValue;
+        replyValue.setResponse(value);
+        sendPublication(
+                publication, subscriptionRequest, subscriptionRequest, std::move(replyValue));
+    } else {
+        reschedulePublication(
+                publication, subscriptionRequest->getSubscriptionId(), timeUntilNextPublication);
     }
 }
 
@@ -492,35 +595,65 @@ void PublicationManager::selectiveBroadcastOccurred(
         const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
         const Ts&... values)
 {
+    selectiveBroadcastOccurred(std::vector<std::string>{subscriptionId}, filters, values...);
+}
 
+template <typename BroadcastFilter, typename... Ts>
+void PublicationManager::selectiveBroadcastOccurred(
+        const std::vector<std::string>& subscriptionIds,
+        const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+        const Ts&... values)
+{
     JOYNR_LOG_DEBUG(logger(),
-                    "selectiveBroadcastOccurred for subscription {}.  Number of values: ",
-                    subscriptionId,
+                    "selectiveBroadcastOccurred for {} subscriptions.  Number of values: {}",
+                    subscriptionIds.size(),
                     sizeof...(Ts));
 
-    std::unique_lock<std::mutex> publicationsLock(_publicationsMutex);
-    std::shared_ptr<Publication> publication = _publications.value(subscriptionId);
-    std::shared_ptr<BroadcastSubscriptionRequestInformation> subscriptionRequest =
-            _subscriptionId2BroadcastSubscriptionRequest.value(subscriptionId);
-
-    // See if the subscription is still valid
-    if (!publication || !subscriptionRequest) {
-        JOYNR_LOG_ERROR(logger(),
-                        "broadcastOccurred called for non-existing subscription {}",
-                        subscriptionId);
-        return;
+    std::vector<std::pair<std::shared_ptr<Publication>,
+                          std::shared_ptr<BroadcastSubscriptionRequestInformation>>>
+            subscriptions;
+    subscriptions.reserve(subscriptionIds.size());
+    {
+        std::lock_guard<std::mutex> publicationsLock(_publicationsMutex);
+        for (const std::string& subscriptionId : subscriptionIds) {
+            std::shared_ptr<Publication> publication = _publications.value(subscriptionId);
+            std::shared_ptr<BroadcastSubscriptionRequestInformation> subscriptionRequest =
+                    _subscriptionId2BroadcastSubscriptionRequest.value(subscriptionId);
+            // See if the subscription is still valid
+            if (!publication || !subscriptionRequest) {
+                JOYNR_LOG_ERROR(logger(),
+                                "broadcastOccurred called for non-existing subscription {}",
+                                subscriptionId);
+                continue;
+            }
+            subscriptions.emplace_back(std::move(publication), std::move(subscriptionRequest));
+        }
     }
 
-    {
+    // result of the filter chain per filter parameters key
+    std::unordered_map<std::string, bool> filterResults;
+    for (const auto& subscription : subscriptions) {
+        const std::shared_ptr<Publication>& publication = subscription.first;
+        const std::shared_ptr<BroadcastSubscriptionRequestInformation>& subscriptionRequest =
+                subscription.second;
         std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
-        publicationsLock.unlock();
+        // the subscription may have been removed since the lookup
+        if (!publication->_isActive) {
+            continue;
+        }
         // Only proceed if publication can immediately be sent
         std::int64_t timeUntilNextPublication =
                 getTimeUntilNextPublication(publication, subscriptionRequest->getQos());
 
         if (timeUntilNextPublication == 0) {
-            // Execute broadcast filters
-            if (processFilterChain(subscriptionRequest, filters, values...)) {
+            // Execute broadcast filters once per filter parameters
+            auto filterResult = filterResults.find(publication->_filterParametersKey);
+            if (filterResult == filterResults.cend()) {
+                const bool forward = processFilterChain(subscriptionRequest, filters, values...);
+                filterResult =
+                        filterResults.emplace(publication->_filterParametersKey, forward).first;
+            }
+            if (filterResult->second) {
                 // Send the publication
                 BaseReply replyValues;
                 replyValues.setResponse(values...);
@@ -534,13 +667,13 @@ void PublicationManager::selectiveBroadcastOccurred(
                 JOYNR_LOG_DEBUG(logger(),
                                 "Omitting broadcast publication for subscription {} because of too "
                                 "short interval. Next publication possible in {} ms",
-                                subscriptionId,
+                                subscriptionRequest->getSubscriptionId(),
                                 timeUntilNextPublication);
             } else {
                 JOYNR_LOG_WARN(
                         logger(),
                         "Omitting broadcast publication for subscription {} because of error.",
-                        subscriptionId);
+                        subscriptionRequest->getSubscriptionId());
             }
         }
     }
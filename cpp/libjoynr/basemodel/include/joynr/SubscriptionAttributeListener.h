@@ -19,15 +19,15 @@
 #ifndef SUBSCRIPTIONATTRIBUTELISTENER_H
 #define SUBSCRIPTIONATTRIBUTELISTENER_H
 
+#include <memory>
 #include <string>
 
 #include "joynr/JoynrExport.h"
+#include "joynr/PublicationManager.h"
 
 namespace joynr
 {
 
-class PublicationManager;
-
 /**
  * An attribute listener used for onChange subscriptions
  */
@@ -37,9 +37,13 @@ public:
     /**
      * Create an attribute listener linked to a subscription
      */
-    SubscriptionAttributeListener(const std::string& subscriptionId,
-                                  std::weak_ptr<PublicationManager> publicationManager)
-            : _subscriptionId(subscriptionId), _publicationManager(std::move(publicationManager))
+    SubscriptionAttributeListener(
+            const std::string& subscriptionId,
+            std::weak_ptr<PublicationManager> publicationManager,
+            std::weak_ptr<PublicationManager::Publication> publication)
+            : _subscriptionId(subscriptionId),
+              _publicationManager(std::move(publicationManager)),
+              _publication(std::move(publication))
     {
     }
 
@@ -49,20 +53,17 @@ public:
 private:
     std::string _subscriptionId;
     std::weak_ptr<PublicationManager> _publicationManager;
+    // the state of the subscription, so that no lookup by subscriptionId is needed
+    std::weak_ptr<PublicationManager::Publication> _publication;
 };
 
-} // namespace joynr
-
-#include "joynr/PublicationManager.h"
-
-namespace joynr
-{
-
 template <typename T>
 void SubscriptionAttributeListener::attributeValueChanged(const T& value)
 {
-    if (auto publicationManagerSharedPtr = _publicationManager.lock()) {
-        publicationManagerSharedPtr->attributeValueChanged(_subscriptionId, value);
+    auto publicationManagerSharedPtr = _publicationManager.lock();
+    auto publicationSharedPtr = _publication.lock();
+    if (publicationManagerSharedPtr && publicationSharedPtr) {
+        publicationManagerSharedPtr->attributeValueChanged(std::move(publicationSharedPtr), value);
     }
 }
 
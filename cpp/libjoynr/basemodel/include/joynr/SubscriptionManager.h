@@ -72,8 +72,13 @@ public:
 
     SubscriptionManager(boost::asio::io_service& ioService,
                         std::shared_ptr<IMessageRouter> messageRouter);
+    /**
+     * @param isSchedulerOwner if true, the scheduler is shut down by shutdown() and the
+     * destructor; a shared scheduler must be shut down by its creator instead
+     */
     SubscriptionManager(std::shared_ptr<DelayedScheduler> scheduler,
-                        std::shared_ptr<IMessageRouter> messageRouter);
+                        std::shared_ptr<IMessageRouter> messageRouter,
+                        bool isSchedulerOwner = true);
 
     /**
      * @brief Subscribe to an attribute or broadcast. Modifies the subscription request to include
@@ -193,6 +198,7 @@ private:
     std::shared_ptr<IMessageRouter> _messageRouter;
 
     std::shared_ptr<DelayedScheduler> _missedPublicationScheduler;
+    const bool _isSchedulerOwner;
     ADD_LOGGER(SubscriptionManager)
     /**
      * @class SubscriptionManager::MissedPublicationRunnable
@@ -51,6 +51,16 @@ public:
     template <typename... Ts>
     void broadcastOccurred(const Ts&... values);
 
+    /**
+     * Informs the publication manager about a selective broadcast for all listeners at once,
+     * so that subscriptions with equal filter parameters share one run of the filter chain
+     */
+    template <typename BroadcastFilter, typename... Ts>
+    static void selectiveBroadcastOccurredForAll(
+            const std::vector<std::shared_ptr<UnicastBroadcastListener>>& listeners,
+            const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+            const Ts&... values);
+
 private:
     std::string _subscriptionId;
 };
@@ -72,6 +82,34 @@ void UnicastBroadcastListener::selectiveBroadcastOccurred(
     }
 }
 
+template <typename BroadcastFilter, typename... Ts>
+void UnicastBroadcastListener::selectiveBroadcastOccurredForAll(
+        const std::vector<std::shared_ptr<UnicastBroadcastListener>>& listeners,
+        const std::vector<std::shared_ptr<BroadcastFilter>>& filters,
+        const Ts&... values)
+{
+    // the listeners of a provider usually share one publication manager
+    std::shared_ptr<PublicationManager> publicationManager;
+    std::vector<std::string> subscriptionIds;
+    subscriptionIds.reserve(listeners.size());
+    for (const std::shared_ptr<UnicastBroadcastListener>& listener : listeners) {
+        std::shared_ptr<PublicationManager> listenerPublicationManager =
+                listener->_publicationManager.lock();
+        if (!listenerPublicationManager) {
+            continue;
+        }
+        if (publicationManager && publicationManager != listenerPublicationManager) {
+            publicationManager->selectiveBroadcastOccurred(subscriptionIds, filters, values...);
+            subscriptionIds.clear();
+        }
+        publicationManager = std::move(listenerPublicationManager);
+        subscriptionIds.push_back(listener->_subscriptionId);
+    }
+    if (publicationManager) {
+        publicationManager->selectiveBroadcastOccurred(subscriptionIds, filters, values...);
+    }
+}
+
 template <typename... Ts>
 void UnicastBroadcastListener::broadcastOccurred(const Ts&... values)
 {
@@ -18,11 +18,40 @@
  */
 #include "joynr/AbstractJoynrMessagingConnector.h"
 
+#include <utility>
+#include <vector>
+
 #include "joynr/IMessageSender.h"
+#include "joynr/IReplyCaller.h"
+#include "joynr/Message.h"
+#include "joynr/Request.h"
+#include "joynr/exceptions/JoynrException.h"
+#include "joynr/types/CustomParameter.h"
 
 namespace joynr
 {
 
+namespace
+{
+thread_local bool isInSyncCall = false;
+} // namespace
+
+AbstractJoynrMessagingConnector::SyncCallScope::SyncCallScope() : _wasInSyncCall(isInSyncCall)
+{
+    isInSyncCall = true;
+}
+
+AbstractJoynrMessagingConnector::SyncCallScope::~SyncCallScope()
+{
+    isInSyncCall = _wasInSyncCall;
+}
+
+struct AbstractJoynrMessagingConnector::Batch {
+    std::vector<Request> requests;
+    std::vector<std::shared_ptr<IReplyCaller>> replyCallers;
+    boost::optional<MessagingQos> qos;
+};
+
 AbstractJoynrMessagingConnector::AbstractJoynrMessagingConnector(
         std::weak_ptr<IMessageSender> messageSender,
         std::weak_ptr<ISubscriptionManager> subscriptionManager,
@@ -39,7 +68,10 @@ AbstractJoynrMessagingConnector::AbstractJoynrMessagingConnector(
           _proxyParticipantId(proxyParticipantId),
           _providerParticipantId(providerDiscoveryEntry.getParticipantId()),
           _qosSettings(qosSettings),
-          _providerDiscoveryEntry(providerDiscoveryEntry)
+          _providerDiscoveryEntry(providerDiscoveryEntry),
+          _batchMutex(),
+          _numberOfBatches(0),
+          _batches()
 {
 }
 
@@ -47,6 +79,22 @@ void AbstractJoynrMessagingConnector::operationRequest(std::shared_ptr<IReplyCal
                                                        Request&& request,
                                                        boost::optional<MessagingQos> qos)
 {
+    if (_numberOfBatches > 0 && !isInSyncCall) {
+        std::lock_guard<std::mutex> lock(_batchMutex);
+        auto batchIt = _batches.find(std::this_thread::get_id());
+        if (batchIt != _batches.end()) {
+            Batch& batch = *batchIt->second;
+            const MessagingQos& requestQos = qos ? *qos : _qosSettings;
+            if (!batch.qos) {
+                batch.qos = requestQos;
+            } else if (requestQos.getTtl() > batch.qos->getTtl()) {
+                batch.qos->setTtl(requestQos.getTtl());
+            }
+            batch.requests.push_back(std::move(request));
+            batch.replyCallers.push_back(std::move(replyCaller));
+            return;
+        }
+    }
     if (auto ptr = _messageSender.lock()) {
         ptr->sendRequest(_proxyParticipantId,
                          _providerParticipantId,
@@ -69,8 +117,83 @@ void AbstractJoynrMessagingConnector::operationOneWayRequest(OneWayRequest&& req
     }
 }
 
+bool AbstractJoynrMessagingConnector::supportsBatchRequests(
+        const types::DiscoveryEntryWithMetaInfo& discoveryEntry)
+{
+    for (const types::CustomParameter& parameter : discoveryEntry.getQos().getCustomParameters()) {
+        if (parameter.getName() == Message::CUSTOM_PARAMETER_BATCH_REQUESTS()) {
+            return parameter.getValue() == "true";
+        }
+    }
+    return false;
+}
+
+void AbstractJoynrMessagingConnector::startBatch()
+{
+    if (!supportsBatchRequests(_providerDiscoveryEntry)) {
+        JOYNR_LOG_WARN(logger(),
+                       "provider {} does not accept batch requests, requests are sent one by one",
+                       _providerParticipantId);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_batchMutex);
+    auto& batch = _batches[std::this_thread::get_id()];
+    if (!batch) {
+        batch = std::make_unique<Batch>();
+        ++_numberOfBatches;
+    }
+}
+
+void AbstractJoynrMessagingConnector::sendBatch()
+{
+    std::unique_ptr<Batch> batch;
+    {
+        std::lock_guard<std::mutex> lock(_batchMutex);
+        auto batchIt = _batches.find(std::this_thread::get_id());
+        if (batchIt != _batches.end()) {
+            batch = std::move(batchIt->second);
+            _batches.erase(batchIt);
+            --_numberOfBatches;
+        }
+    }
+    if (!batch) {
+        if (supportsBatchRequests(_providerDiscoveryEntry)) {
+            JOYNR_LOG_WARN(logger(), "sendBatch called without startBatch, ignoring");
+        }
+        return;
+    }
+    if (batch->requests.empty()) {
+        return;
+    }
+    auto ptr = _messageSender.lock();
+    if (!ptr) {
+        return;
+    }
+    if (batch->requests.size() == 1) {
+        ptr->sendRequest(_proxyParticipantId,
+                         _providerParticipantId,
+                         *batch->qos,
+                         batch->requests.front(),
+                         std::move(batch->replyCallers.front()),
+                         _providerDiscoveryEntry.getIsLocal());
+        return;
+    }
+    ptr->sendBatchRequest(_proxyParticipantId,
+                          _providerParticipantId,
+                          *batch->qos,
+                          batch->requests,
+                          batch->replyCallers,
+                          _providerDiscoveryEntry.getIsLocal());
+}
+
 AbstractJoynrMessagingConnector::~AbstractJoynrMessagingConnector()
 {
+    for (const auto& batch : _batches) {
+        for (const std::shared_ptr<IReplyCaller>& replyCaller : batch.second->replyCallers) {
+            replyCaller->returnError(std::make_shared<exceptions::JoynrRuntimeException>(
+                    "proxy was destroyed before the batch was sent"));
+        }
+    }
     if (auto ptr = _messageSender.lock()) {
         ptr->removeRoutingEntry(_proxyParticipantId);
     }
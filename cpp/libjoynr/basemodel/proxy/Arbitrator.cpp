@@ -26,6 +26,7 @@
 #include "joynr/Future.h"
 #include "joynr/Logger.h"
 #include "joynr/Semaphore.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/exceptions/NoCompatibleProviderFoundException.h"
@@ -115,6 +116,7 @@ void Arbitrator::startArbitration(
 
     _arbitrationThread = std::thread([thisWeakPtr =
                                               joynr::util::as_weak_ptr(shared_from_this())]() {
+        ThreadConfiguration::instance().applyToCurrentThread(ThreadConfiguration::ARBITRATION());
         auto thisSharedPtr = thisWeakPtr.lock();
         if (!thisSharedPtr) {
             return;
@@ -19,6 +19,7 @@
 
 #include "joynr/PublicationManager.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
@@ -33,6 +34,7 @@
 #include "joynr/IRequestInterpreter.h"
 #include "joynr/InterfaceRegistrar.h"
 #include "joynr/MessagingQos.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastSubscriptionRequest.h"
 #include "joynr/Reply.h"
 #include "joynr/Request.h"
@@ -40,6 +42,7 @@
 #include "joynr/Runnable.h"
 #include "joynr/SubscriptionRequest.h"
 #include "joynr/SubscriptionUtil.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/TimePoint.h"
 #include "joynr/UnicastSubscriptionQos.h"
@@ -88,6 +91,24 @@ private:
     std::string _subscriptionId;
 };
 
+class PublicationManager::PeriodicTickRunnable : public Runnable
+{
+public:
+    ~PeriodicTickRunnable() override = default;
+    PeriodicTickRunnable(std::weak_ptr<PublicationManager> publicationManager,
+                         std::int64_t periodMs);
+
+    void shutdown() override;
+
+    // Calls PublicationManager::runPeriodicTick()
+    void run() override;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(PeriodicTickRunnable);
+    std::weak_ptr<PublicationManager> _publicationManager;
+    std::int64_t _periodMs;
+};
+
 //------ PublicationManager ----------------------------------------------------
 
 PublicationManager::~PublicationManager()
@@ -107,8 +128,22 @@ void PublicationManager::shutdown()
         _shuttingDown = true;
     }
 
-    JOYNR_LOG_TRACE(logger(), "shutting down thread pool and scheduler ...");
-    _delayedScheduler->shutdown();
+    if (_isSchedulerOwner) {
+        JOYNR_LOG_TRACE(logger(), "shutting down thread pool and scheduler ...");
+        _delayedScheduler->shutdown();
+    }
+
+    const SchedulerMetrics metrics = getSchedulerMetrics();
+    if (metrics.periodicTicks > 0) {
+        JOYNR_LOG_INFO(logger(),
+                       "periodic publication ticks: {}, polled subscriptions: {}, missed ticks: "
+                       "{}, average lateness: {}ms, max lateness: {}ms",
+                       metrics.periodicTicks,
+                       metrics.polledSubscriptions,
+                       metrics.missedTicks,
+                       metrics.averageLateness.count(),
+                       metrics.maxLateness.count());
+    }
 
     // Remove all publications
     JOYNR_LOG_TRACE(logger(), "removing publications");
@@ -128,25 +163,49 @@ PublicationManager::PublicationManager(boost::asio::io_service& ioService,
                                        std::weak_ptr<IMessageSender> messageSender,
                                        std::uint64_t ttlUplift,
                                        int maxThreads)
+        : PublicationManager(
+                  std::make_shared<ThreadPoolDelayedScheduler>(maxThreads,
+                                                               ThreadConfiguration::SUBSCRIPTIONS(),
+                                                               ioService),
+                  std::move(messageSender),
+                  ttlUplift)
+{
+}
+
+PublicationManager::PublicationManager(std::shared_ptr<DelayedScheduler> scheduler,
+                                       std::weak_ptr<IMessageSender> messageSender,
+                                       std::uint64_t ttlUplift,
+                                       bool isSchedulerOwner)
         : _messageSender(messageSender),
           _publications(),
           _subscriptionId2SubscriptionRequest(),
           _subscriptionId2BroadcastSubscriptionRequest(),
           _fileWriteLock(),
-          _delayedScheduler(std::make_shared<ThreadPoolDelayedScheduler>(maxThreads,
-                                                                         "PubManager",
-                                                                         ioService)),
+          _delayedScheduler(std::move(scheduler)),
+          _isSchedulerOwner(isSchedulerOwner),
           _shutDownMutex(),
           _shuttingDown(false),
           _queuedSubscriptionRequests(),
           _queuedSubscriptionRequestsMutex(),
           _queuedBroadcastSubscriptionRequests(),
           _queuedBroadcastSubscriptionRequestsMutex(),
-          _currentScheduledPublications(),
-          _currentScheduledPublicationsMutex(),
           _broadcastFilterLock(),
           _ttlUplift(ttlUplift),
-          _publicationsMutex()
+          _publicationsMutex(),
+          _periodicTicks(),
+          _periodicTicksMutex(),
+          _periodicTickCount(0),
+          _polledSubscriptionCount(0),
+          _missedTickCount(0),
+          _totalTickLateness(0),
+          _maxTickLateness(0),
+          _tickLatenessHistogram(MetricsRegistry::instance().getHistogram(
+                  "joynr_publication_tick_lateness_seconds",
+                  "Delay between the planned and the actual start of periodic publication ticks")),
+          _missedTicksCounter(MetricsRegistry::instance().getCounter(
+                  "joynr_publication_missed_ticks_total",
+                  "Periodic publication ticks skipped because a tick started more than one "
+                  "period late"))
 {
 }
 
@@ -250,6 +309,7 @@ void PublicationManager::handleAttributeSubscriptionRequest(
 {
     const std::string& subscriptionId = requestInfo->getSubscriptionId();
     auto publication = std::make_shared<Publication>(publicationSender, requestCaller);
+    publication->_subscriptionRequest = requestInfo;
 
     if (publicationExists(subscriptionId)) {
         JOYNR_LOG_TRACE(logger(),
@@ -275,11 +335,7 @@ void PublicationManager::handleAttributeSubscriptionRequest(
         // check for a valid publication end date
         if (!isSubscriptionExpired(qos)) {
             addSubscriptionCleanupIfNecessary(publication, qos, subscriptionId);
-            {
-                std::lock_guard<std::mutex> currentScheduledLocker(
-                        _currentScheduledPublicationsMutex);
-                _currentScheduledPublications.push_back(subscriptionId);
-            }
+            publication->_isPublicationScheduled = true;
             sendSubscriptionReply(publicationSender,
                                   requestInfo->getProviderId(),
                                   requestInfo->getProxyId(),
@@ -314,7 +370,8 @@ void PublicationManager::addOnChangePublication(
 
         // Create an attribute listener to listen for onChange events
         std::shared_ptr<SubscriptionAttributeListener> attributeListener =
-                std::make_shared<SubscriptionAttributeListener>(subscriptionId, shared_from_this());
+                std::make_shared<SubscriptionAttributeListener>(
+                        subscriptionId, shared_from_this(), publication);
 
         // Register the attribute listener
         std::shared_ptr<RequestCaller> requestCaller = publication->_requestCaller;
@@ -344,6 +401,25 @@ void PublicationManager::addBroadcastPublication(
 
     // Make note of the attribute listener so that it can be unregistered
     publication->_broadcastListener = std::move(broadcastListener);
+    publication->_filterParametersKey = createFilterParametersKey(*request);
+}
+
+std::string PublicationManager::createFilterParametersKey(
+        const BroadcastSubscriptionRequestInformation& request)
+{
+    // missing filter parameters are filtered like empty ones, see processFilterChain
+    const boost::optional<BroadcastFilterParameters>& filterParameters =
+            request.getFilterParameters();
+    if (!filterParameters) {
+        return std::string();
+    }
+    // the parameters are ordered by name, prefixing the lengths keeps the key unambiguous
+    std::string key;
+    for (const auto& parameter : filterParameters->getFilterParameters()) {
+        key += std::to_string(parameter.first.size()) + ":" + parameter.first +
+               std::to_string(parameter.second.size()) + ":" + parameter.second;
+    }
+    return key;
 }
 
 void PublicationManager::add(const std::string& proxyParticipantId,
@@ -588,9 +664,11 @@ void PublicationManager::removeAttributePublication(const std::string& subscript
 
     if (publication && request) {
         std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
+        publication->_isActive = false;
         // Delete the onChange publication if needed
         removeOnChangePublication(subscriptionId, request, publication);
     }
+    removeFromPeriodicTick(subscriptionId);
 }
 
 void PublicationManager::removeBroadcastPublication(const std::string& subscriptionId)
@@ -606,6 +684,7 @@ void PublicationManager::removeBroadcastPublication(const std::string& subscript
 
     if (publication && request) {
         std::lock_guard<std::recursive_mutex> publicationLocker((publication->_mutex));
+        publication->_isActive = false;
         // Remove listener
         std::shared_ptr<RequestCaller> requestCaller = publication->_requestCaller;
         requestCaller->unregisterBroadcastListener(
@@ -720,11 +799,7 @@ void PublicationManager::sendSubscriptionPublication(
                                    std::chrono::system_clock::now().time_since_epoch())
                                    .count();
         publication->_timeOfLastPublication = now;
-
-        {
-            std::lock_guard<std::mutex> currentScheduledLocker(_currentScheduledPublicationsMutex);
-            util::removeAll(_currentScheduledPublications, request->getSubscriptionId());
-        }
+        publication->_isPublicationScheduled = false;
         JOYNR_LOG_TRACE(logger(), "sent publication @ {}", now);
     } else {
         JOYNR_LOG_ERROR(logger(),
@@ -750,7 +825,7 @@ void PublicationManager::sendPublication(
     JOYNR_LOG_TRACE(logger(), "sent subscription reply");
 }
 
-void PublicationManager::pollSubscription(const std::string& subscriptionId)
+void PublicationManager::pollSubscription(const std::string& subscriptionId, bool isPeriodicTick)
 {
     JOYNR_LOG_TRACE(logger(), "pollSubscription {}", subscriptionId);
 
@@ -774,8 +849,9 @@ void PublicationManager::pollSubscription(const std::string& subscriptionId)
                                    .count();
         std::int64_t publicationInterval = SubscriptionUtil::getPeriodicPublicationInterval(qos);
 
-        // check if the subscription qos needs a periodic publication
-        if (publicationInterval > 0) {
+        // check if the subscription qos needs a periodic publication;
+        // periodic ticks are already aligned to the publication interval
+        if (publicationInterval > 0 && !isPeriodicTick) {
             std::int64_t timeSinceLast = now - publication->_timeOfLastPublication;
             // publish only if not published in the current interval
             if (timeSinceLast < publicationInterval) {
@@ -818,23 +894,21 @@ void PublicationManager::pollSubscription(const std::string& subscriptionId)
                                                    qos,
                                                    subscriptionRequest,
                                                    this,
-                                                   subscriptionId](Reply&& response) {
+                                                   subscriptionId,
+                                                   isPeriodicTick](Reply&& response) {
             sendPublication(
                     publication, subscriptionRequest, subscriptionRequest, std::move(response));
-
-            // Reschedule the next poll
-            if (publicationInterval > 0 && (!isSubscriptionExpired(qos))) {
-                JOYNR_LOG_TRACE(
-                        logger(), "rescheduling runnable with delay: {}", publicationInterval);
-                _delayedScheduler->schedule(
-                        std::make_shared<PublisherRunnable>(shared_from_this(), subscriptionId),
-                        std::chrono::milliseconds(publicationInterval));
-            }
+            scheduleNextPoll(subscriptionId, qos, publicationInterval, isPeriodicTick);
         };
 
         std::function<void(const std::shared_ptr<exceptions::JoynrException>&)> onError =
-                [publication, publicationInterval, qos, subscriptionRequest, this, subscriptionId](
-                        const std::shared_ptr<exceptions::JoynrException>& exception) {
+                [publication,
+                 publicationInterval,
+                 qos,
+                 subscriptionRequest,
+                 this,
+                 subscriptionId,
+                 isPeriodicTick](const std::shared_ptr<exceptions::JoynrException>& exception) {
                     std::shared_ptr<exceptions::JoynrRuntimeException> runtimeError =
                             std::dynamic_pointer_cast<exceptions::JoynrRuntimeException>(exception);
                     assert(runtimeError);
@@ -842,16 +916,7 @@ void PublicationManager::pollSubscription(const std::string& subscriptionId)
                                          subscriptionRequest,
                                          subscriptionRequest,
                                          std::move(runtimeError));
-
-                    // Reschedule the next poll
-                    if (publicationInterval > 0 && (!isSubscriptionExpired(qos))) {
-                        JOYNR_LOG_TRACE(logger(),
-                                        "rescheduling runnable with delay: {}",
-                                        publicationInterval);
-                        _delayedScheduler->schedule(std::make_shared<PublisherRunnable>(
-                                                            shared_from_this(), subscriptionId),
-                                                    std::chrono::milliseconds(publicationInterval));
-                    }
+                    scheduleNextPoll(subscriptionId, qos, publicationInterval, isPeriodicTick);
                 };
 
         JOYNR_LOG_TRACE(logger(), "run: executing requestInterpreter= {}", attributeGetter);
@@ -865,6 +930,145 @@ void PublicationManager::pollSubscription(const std::string& subscriptionId)
     }
 }
 
+void PublicationManager::scheduleNextPoll(const std::string& subscriptionId,
+                                          std::shared_ptr<SubscriptionQos> qos,
+                                          std::int64_t publicationInterval,
+                                          bool isPeriodicTick)
+{
+    if (publicationInterval <= 0 || isSubscriptionExpired(qos)) {
+        return;
+    }
+    if (!SubscriptionUtil::isOnChangeSubscription(qos)) {
+        // periodic subscriptions are polled together with all other subscriptions
+        // of the same period, see runPeriodicTick()
+        if (!isPeriodicTick) {
+            addToPeriodicTick(subscriptionId, publicationInterval);
+        }
+        return;
+    }
+    JOYNR_LOG_TRACE(logger(), "rescheduling runnable with delay: {}", publicationInterval);
+    _delayedScheduler->schedule(
+            std::make_shared<PublisherRunnable>(shared_from_this(), subscriptionId),
+            std::chrono::milliseconds(publicationInterval));
+}
+
+void PublicationManager::addToPeriodicTick(const std::string& subscriptionId,
+                                           std::int64_t periodMs)
+{
+    std::lock_guard<std::mutex> periodicTicksLocker(_periodicTicksMutex);
+    // the subscription might have been removed while its first publication was sent
+    if (!publicationExists(subscriptionId)) {
+        return;
+    }
+    auto tick = _periodicTicks.find(periodMs);
+    if (tick == _periodicTicks.end()) {
+        const std::chrono::milliseconds period(periodMs);
+        tick = _periodicTicks.emplace(periodMs, PeriodicTick()).first;
+        tick->second.nextTick = std::chrono::steady_clock::now() + period;
+        tick->second.runnableHandle = _delayedScheduler->schedule(
+                std::make_shared<PeriodicTickRunnable>(shared_from_this(), periodMs), period);
+        JOYNR_LOG_DEBUG(logger(), "started periodic publication tick of {} ms", periodMs);
+    }
+    tick->second.subscriptionIds.insert(subscriptionId);
+}
+
+void PublicationManager::removeFromPeriodicTick(const std::string& subscriptionId)
+{
+    std::lock_guard<std::mutex> periodicTicksLocker(_periodicTicksMutex);
+    for (auto tick = _periodicTicks.begin(); tick != _periodicTicks.end(); ++tick) {
+        if (tick->second.subscriptionIds.erase(subscriptionId) == 0) {
+            continue;
+        }
+        if (tick->second.subscriptionIds.empty()) {
+            if (tick->second.runnableHandle != DelayedScheduler::_INVALID_RUNNABLE_HANDLE &&
+                !isShuttingDown()) {
+                _delayedScheduler->unschedule(tick->second.runnableHandle);
+            }
+            JOYNR_LOG_DEBUG(logger(), "stopped periodic publication tick of {} ms", tick->first);
+            _periodicTicks.erase(tick);
+        }
+        return;
+    }
+}
+
+void PublicationManager::runPeriodicTick(std::int64_t periodMs)
+{
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    if (isShuttingDown()) {
+        return;
+    }
+
+    std::vector<std::string> subscriptionIds;
+    {
+        std::lock_guard<std::mutex> periodicTicksLocker(_periodicTicksMutex);
+        auto tick = _periodicTicks.find(periodMs);
+        if (tick == _periodicTicks.end()) {
+            return;
+        }
+        const steady_clock::time_point now = steady_clock::now();
+        const milliseconds period(periodMs);
+        const std::chrono::microseconds exactLateness =
+                std::max(std::chrono::microseconds(0),
+                         std::chrono::duration_cast<std::chrono::microseconds>(
+                                 now - tick->second.nextTick));
+        const milliseconds lateness = std::chrono::duration_cast<milliseconds>(exactLateness);
+        ++_periodicTickCount;
+        _totalTickLateness += lateness;
+        _maxTickLateness = std::max(_maxTickLateness, lateness);
+        _tickLatenessHistogram->record(exactLateness);
+
+        // schedule relative to the planned start so that delays do not accumulate;
+        // ticks which are already overdue are skipped instead of being run back to back
+        tick->second.nextTick += period;
+        std::uint64_t missedTicks = 0;
+        while (tick->second.nextTick <= now) {
+            tick->second.nextTick += period;
+            ++missedTicks;
+        }
+        if (missedTicks > 0) {
+            _missedTickCount += missedTicks;
+            _missedTicksCounter->increment(missedTicks);
+        }
+        if (lateness > period) {
+            JOYNR_LOG_DEBUG(logger(),
+                            "periodic publication tick of {} ms started {} ms late",
+                            periodMs,
+                            lateness.count());
+        }
+        const milliseconds delay = std::max(
+                milliseconds(1),
+                std::chrono::duration_cast<milliseconds>(tick->second.nextTick - now));
+        tick->second.runnableHandle = _delayedScheduler->schedule(
+                std::make_shared<PeriodicTickRunnable>(shared_from_this(), periodMs), delay);
+
+        subscriptionIds.assign(
+                tick->second.subscriptionIds.cbegin(), tick->second.subscriptionIds.cend());
+        _polledSubscriptionCount += subscriptionIds.size();
+    }
+
+    for (const std::string& subscriptionId : subscriptionIds) {
+        pollSubscription(subscriptionId, true);
+    }
+}
+
+PublicationManager::SchedulerMetrics PublicationManager::getSchedulerMetrics() const
+{
+    std::lock_guard<std::mutex> periodicTicksLocker(_periodicTicksMutex);
+    const std::chrono::milliseconds averageLateness =
+            (_periodicTickCount == 0)
+                    ? std::chrono::milliseconds(0)
+                    : std::chrono::milliseconds(
+                              _totalTickLateness.count() /
+                              static_cast<std::chrono::milliseconds::rep>(_periodicTickCount));
+    return SchedulerMetrics{_periodicTickCount,
+                            _polledSubscriptionCount,
+                            _missedTickCount,
+                            averageLateness,
+                            _maxTickLateness};
+}
+
 void PublicationManager::removePublication(const std::string& subscriptionId)
 {
     if (_subscriptionId2SubscriptionRequest.contains(subscriptionId)) {
@@ -874,12 +1078,6 @@ void PublicationManager::removePublication(const std::string& subscriptionId)
     }
 }
 
-bool PublicationManager::isPublicationAlreadyScheduled(const std::string& subscriptionId)
-{
-    std::lock_guard<std::mutex> currentScheduledLocker(_currentScheduledPublicationsMutex);
-    return util::vectorContains(_currentScheduledPublications, subscriptionId);
-}
-
 std::int64_t PublicationManager::getTimeUntilNextPublication(
         std::shared_ptr<Publication> publication,
         const std::shared_ptr<SubscriptionQos> qos)
@@ -900,20 +1098,16 @@ std::int64_t PublicationManager::getTimeUntilNextPublication(
     return 0;
 }
 
-void PublicationManager::reschedulePublication(const std::string& subscriptionId,
+void PublicationManager::reschedulePublication(std::shared_ptr<Publication> publication,
+                                               const std::string& subscriptionId,
                                                std::int64_t nextPublication)
 {
-    if (nextPublication > 0) {
-        std::lock_guard<std::mutex> currentScheduledLocker(_currentScheduledPublicationsMutex);
-
-        // Schedule a publication so that the change is not forgotten
-        if (!util::vectorContains(_currentScheduledPublications, subscriptionId)) {
-            JOYNR_LOG_TRACE(logger(), "rescheduling runnable with delay: {}", nextPublication);
-            _currentScheduledPublications.push_back(subscriptionId);
-            _delayedScheduler->schedule(
-                    std::make_shared<PublisherRunnable>(shared_from_this(), subscriptionId),
-                    std::chrono::milliseconds(nextPublication));
-        }
+    // Schedule a publication so that the change is not forgotten
+    if (nextPublication > 0 && !publication->_isPublicationScheduled.exchange(true)) {
+        JOYNR_LOG_TRACE(logger(), "rescheduling runnable with delay: {}", nextPublication);
+        _delayedScheduler->schedule(
+                std::make_shared<PublisherRunnable>(shared_from_this(), subscriptionId),
+                std::chrono::milliseconds(nextPublication));
     }
 }
 
@@ -924,10 +1118,13 @@ PublicationManager::Publication::Publication(std::weak_ptr<IPublicationSender> p
         : _timeOfLastPublication(0),
           _sender(publicationSender),
           _requestCaller(std::move(requestCaller)),
+          _subscriptionRequest(nullptr),
           _attributeListener(nullptr),
           _broadcastListener(nullptr),
           _mutex(),
-          _publicationEndRunnableHandle(DelayedScheduler::_INVALID_RUNNABLE_HANDLE)
+          _publicationEndRunnableHandle(DelayedScheduler::_INVALID_RUNNABLE_HANDLE),
+          _isPublicationScheduled(false),
+          _isActive(true)
 {
 }
 
@@ -953,6 +1150,26 @@ void PublicationManager::PublisherRunnable::run()
     }
 }
 
+//------ PublicationManager::PeriodicTickRunnable ------------------------------
+
+PublicationManager::PeriodicTickRunnable::PeriodicTickRunnable(
+        std::weak_ptr<PublicationManager> publicationManager,
+        std::int64_t periodMs)
+        : Runnable(), _publicationManager(std::move(publicationManager)), _periodMs(periodMs)
+{
+}
+
+void PublicationManager::PeriodicTickRunnable::shutdown()
+{
+}
+
+void PublicationManager::PeriodicTickRunnable::run()
+{
+    if (auto publicationManagerSharedPtr = _publicationManager.lock()) {
+        publicationManagerSharedPtr->runPeriodicTick(_periodMs);
+    }
+}
+
 //------ PublicationManager::PublicationEndRunnable ----------------------------
 
 PublicationManager::PublicationEndRunnable::PublicationEndRunnable(
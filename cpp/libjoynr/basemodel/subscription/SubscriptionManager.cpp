@@ -32,6 +32,7 @@
 #include "joynr/SubscriptionQos.h"
 #include "joynr/SubscriptionRequest.h"
 #include "joynr/SubscriptionUtil.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -69,7 +70,9 @@ SubscriptionManager::~SubscriptionManager()
     // check if all missed publication runnables are deleted before
     // deleting the missed publication scheduler
 
-    _missedPublicationScheduler->shutdown();
+    if (_isSchedulerOwner) {
+        _missedPublicationScheduler->shutdown();
+    }
     _subscriptions.deleteAll();
 }
 
@@ -82,25 +85,32 @@ SubscriptionManager::SubscriptionManager(boost::asio::io_service& ioService,
           _multicastSubscribersMutex(),
           _messageRouter(messageRouter),
           _missedPublicationScheduler(
-                  std::make_shared<ThreadPoolDelayedScheduler>(1, "MissedPublications", ioService))
+                  std::make_shared<ThreadPoolDelayedScheduler>(1,
+                                                               ThreadConfiguration::SUBSCRIPTIONS(),
+                                                               ioService)),
+          _isSchedulerOwner(true)
 {
 }
 
 SubscriptionManager::SubscriptionManager(std::shared_ptr<DelayedScheduler> scheduler,
-                                         std::shared_ptr<IMessageRouter> messageRouter)
+                                         std::shared_ptr<IMessageRouter> messageRouter,
+                                         bool isSchedulerOwner)
         : ISubscriptionManager(),
           enable_shared_from_this<SubscriptionManager>(),
           _subscriptions(),
           _multicastSubscribers(),
           _multicastSubscribersMutex(),
           _messageRouter(messageRouter),
-          _missedPublicationScheduler(scheduler)
+          _missedPublicationScheduler(scheduler),
+          _isSchedulerOwner(isSchedulerOwner)
 {
 }
 
 void SubscriptionManager::shutdown()
 {
-    _missedPublicationScheduler->shutdown();
+    if (_isSchedulerOwner) {
+        _missedPublicationScheduler->shutdown();
+    }
 }
 
 void SubscriptionManager::registerSubscription(
@@ -18,11 +18,76 @@
  */
 #include "joynr/CapabilitiesRegistrar.h"
 
+#include <mutex>
+
+#include "joynr/MulticastBroadcastListener.h"
+
 namespace joynr
 {
 
 class PublicationManager;
 
+namespace
+{
+
+/*
+ * Result of a bulk registration or unregistration: onSuccess is called when all providers have
+ * succeeded, onError with the first error as soon as all providers have finished otherwise.
+ */
+class BulkResult
+{
+public:
+    BulkResult(std::size_t pending,
+               std::function<void()> onSuccess,
+               std::function<void(const exceptions::JoynrRuntimeException&)> onError)
+            : _mutex(),
+              _pending(pending),
+              _firstError(),
+              _onSuccess(std::move(onSuccess)),
+              _onError(std::move(onError))
+    {
+    }
+
+    void succeeded()
+    {
+        finished(nullptr);
+    }
+
+    void failed(const exceptions::JoynrRuntimeException& error)
+    {
+        finished(&error);
+    }
+
+private:
+    void finished(const exceptions::JoynrRuntimeException* error)
+    {
+        std::shared_ptr<exceptions::JoynrRuntimeException> firstError;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (error && !_firstError) {
+                _firstError.reset(error->clone());
+            }
+            if (--_pending > 0) {
+                return;
+            }
+            firstError = _firstError;
+        }
+        if (!firstError) {
+            _onSuccess();
+        } else if (_onError) {
+            _onError(*firstError);
+        }
+    }
+
+    std::mutex _mutex;
+    std::size_t _pending;
+    std::shared_ptr<exceptions::JoynrRuntimeException> _firstError;
+    std::function<void()> _onSuccess;
+    std::function<void(const exceptions::JoynrRuntimeException&)> _onError;
+};
+
+} // namespace
+
 CapabilitiesRegistrar::CapabilitiesRegistrar(
         std::shared_ptr<IDispatcher> dispatcher,
         std::shared_ptr<system::IDiscoveryAsync> discoveryProxy,
@@ -66,4 +131,184 @@ void CapabilitiesRegistrar::removeAsync(
     _discoveryProxy->removeAsync(participantId, std::move(onSuccessWrapper), std::move(onError));
 }
 
+std::vector<std::string> CapabilitiesRegistrar::addAsync(
+        std::vector<ProviderRegistration> providerRegistrations,
+        std::function<void()> onSuccess,
+        std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+{
+    std::vector<std::string> participantIds;
+    participantIds.reserve(providerRegistrations.size());
+    if (providerRegistrations.empty()) {
+        onSuccess();
+        return participantIds;
+    }
+    auto result = std::make_shared<BulkResult>(
+            providerRegistrations.size(), std::move(onSuccess), std::move(onError));
+
+    // providers whose request caller has been added and which still need a routing entry
+    struct PendingRegistration {
+        ProviderRegistration _registration;
+        std::shared_ptr<MulticastBroadcastListener> _multicastBroadcastListener;
+        types::DiscoveryEntry _entry;
+    };
+    auto pendingRegistrations = std::make_shared<std::vector<PendingRegistration>>();
+    pendingRegistrations->reserve(providerRegistrations.size());
+    std::vector<IMessageRouter::NextHop> nextHops;
+    nextHops.reserve(providerRegistrations.size());
+
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count();
+    for (ProviderRegistration& registration : providerRegistrations) {
+        const std::string participantId = _participantIdStorage->getProviderParticipantId(
+                registration._domain,
+                registration._interfaceName,
+                registration._providerVersion.getMajorVersion());
+        participantIds.push_back(participantId);
+
+        bool hasEmptyGbid = false;
+        for (const std::string& gbid : registration._gbids) {
+            hasEmptyGbid = hasEmptyGbid || gbid.empty();
+        }
+        if (hasEmptyGbid) {
+            result->failed(exceptions::JoynrRuntimeException("gbid(s) must not be empty"));
+            continue;
+        }
+
+        auto multicastBroadcastListener =
+                std::make_shared<MulticastBroadcastListener>(participantId, _publicationManager);
+        registration._provider->registerBroadcastListener(multicastBroadcastListener);
+        _dispatcher->addRequestCaller(participantId, registration._requestCaller);
+
+        constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+        const bool isGloballyVisible =
+                registration._providerQos.getScope() == types::ProviderScope::GLOBAL;
+        const bool isSticky = false;
+        nextHops.push_back(IMessageRouter::NextHop{
+                participantId, _dispatcherAddress, isGloballyVisible, expiryDateMs, isSticky});
+
+        const std::string defaultPublicKeyId("");
+        types::DiscoveryEntry entry(registration._providerVersion,
+                                    registration._domain,
+                                    registration._interfaceName,
+                                    participantId,
+                                    registration._providerQos,
+                                    now,
+                                    now + _defaultExpiryIntervalMs,
+                                    defaultPublicKeyId);
+        pendingRegistrations->push_back(PendingRegistration{
+                std::move(registration), std::move(multicastBroadcastListener), std::move(entry)});
+    }
+    if (nextHops.empty()) {
+        return participantIds;
+    }
+
+    // All routing entries are added at once and all participantIds are persisted with a single
+    // write before the providers are added to the discovery one by one.
+    _messageRouter->addNextHops(
+            std::move(nextHops),
+            [pendingRegistrations,
+             result,
+             participantIdStorage = util::as_weak_ptr(_participantIdStorage),
+             messageRouter = util::as_weak_ptr(_messageRouter),
+             discoveryProxy = util::as_weak_ptr(_discoveryProxy)](const std::vector<bool>& added) {
+                std::vector<ParticipantIdStorage::ProviderParticipantId> participantIdsToPersist;
+                for (std::size_t i = 0; i < pendingRegistrations->size(); ++i) {
+                    const PendingRegistration& pending = (*pendingRegistrations)[i];
+                    if (added[i] && pending._registration._persist) {
+                        participantIdsToPersist.push_back(
+                                ParticipantIdStorage::ProviderParticipantId{
+                                        pending._registration._domain,
+                                        pending._registration._interfaceName,
+                                        pending._registration._providerVersion.getMajorVersion(),
+                                        pending._entry.getParticipantId()});
+                    }
+                }
+                if (!participantIdsToPersist.empty()) {
+                    // Sync persistency to disk now that registration is done.
+                    if (auto participantIdStoragePtr = participantIdStorage.lock()) {
+                        participantIdStoragePtr->setProviderParticipantIds(participantIdsToPersist);
+                    }
+                }
+
+                auto discoveryProxyPtr = discoveryProxy.lock();
+                for (std::size_t i = 0; i < pendingRegistrations->size(); ++i) {
+                    const PendingRegistration& pending = (*pendingRegistrations)[i];
+                    const std::string participantId = pending._entry.getParticipantId();
+                    auto provider = pending._registration._provider;
+                    auto multicastBroadcastListener = pending._multicastBroadcastListener;
+                    auto onAddNextHopError = [provider, multicastBroadcastListener, result](
+                                                     const exceptions::JoynrRuntimeException&
+                                                             error) {
+                        provider->unregisterBroadcastListener(multicastBroadcastListener);
+                        result->failed(error);
+                    };
+                    if (!added[i]) {
+                        onAddNextHopError(exceptions::ProviderRuntimeException(
+                                "Failed to add next hop for participantId " + participantId));
+                        continue;
+                    }
+                    auto onDiscoveryError = [participantId, messageRouter, onAddNextHopError](
+                                                    const exceptions::JoynrRuntimeException&
+                                                            error) {
+                        if (auto messageRouterPtr = messageRouter.lock()) {
+                            messageRouterPtr->removeNextHop(participantId);
+                        }
+                        onAddNextHopError(error);
+                    };
+                    if (!discoveryProxyPtr) {
+                        onDiscoveryError(exceptions::JoynrRuntimeException(
+                                "runtime and required discovery proxy have been already "
+                                "destroyed"));
+                        continue;
+                    }
+                    const ProviderRegistration& registration = pending._registration;
+                    discoveryProxyPtr->addAsync(
+                            pending._entry,
+                            registration._awaitGlobalRegistration,
+                            registration._gbids,
+                            [participantId,
+                             domain = registration._domain,
+                             interfaceName = registration._interfaceName,
+                             result]() {
+                                JOYNR_LOG_INFO(logger(),
+                                               "Registered Provider: participantId: {}, "
+                                               "domain: {}, interfaceName: {}",
+                                               participantId,
+                                               domain,
+                                               interfaceName);
+                                result->succeeded();
+                            },
+                            [onDiscoveryError](const types::DiscoveryError::Enum& errorEnum) {
+                                onDiscoveryError(exceptions::JoynrRuntimeException(
+                                        "Registration failed with DiscoveryError " +
+                                        types::DiscoveryError::getLiteral(errorEnum)));
+                            },
+                            onDiscoveryError);
+                }
+            });
+
+    return participantIds;
+}
+
+void CapabilitiesRegistrar::removeAsync(
+        const std::vector<std::string>& participantIds,
+        std::function<void()> onSuccess,
+        std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+{
+    if (participantIds.empty()) {
+        onSuccess();
+        return;
+    }
+    auto result = std::make_shared<BulkResult>(
+            participantIds.size(), std::move(onSuccess), std::move(onError));
+    for (const std::string& participantId : participantIds) {
+        removeAsync(participantId,
+                    [result]() { result->succeeded(); },
+                    [result](const exceptions::JoynrRuntimeException& error) {
+                        result->failed(error);
+                    });
+    }
+}
+
 } // namespace joynr
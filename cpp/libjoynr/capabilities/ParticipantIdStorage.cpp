@@ -21,18 +21,26 @@
 #include <algorithm>
 #include <cassert>
 #include <exception>
+#include <utility>
 
 #include <boost/format.hpp>
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
+#include "joynr/AsyncFileWriter.h"
 #include "joynr/Util.h"
 
 namespace joynr
 {
 
-ParticipantIdStorage::ParticipantIdStorage(const std::string& filename)
-        : fileMutex(), storageMutex(), storage(), entriesWrittenToDisk(0), fileName(filename)
+ParticipantIdStorage::ParticipantIdStorage(const std::string& filename,
+                                           std::shared_ptr<AsyncFileWriter> asyncFileWriter)
+        : fileMutex(),
+          storageMutex(),
+          storage(),
+          entriesWrittenToDisk(0),
+          fileName(filename),
+          fileWriter(std::move(asyncFileWriter))
 {
     assert(!fileName.empty());
     loadEntriesFromFile();
@@ -98,6 +106,30 @@ void ParticipantIdStorage::setProviderParticipantId(const std::string& domain,
     }
 }
 
+void ParticipantIdStorage::setProviderParticipantIds(
+        const std::vector<ProviderParticipantId>& providerParticipantIds)
+{
+    bool fileNeedsUpdate = false;
+    {
+        WriteLocker lockAccessToStorage(storageMutex);
+        for (const ProviderParticipantId& providerParticipantId : providerParticipantIds) {
+            assert(!providerParticipantId.domain.empty());
+            assert(!providerParticipantId.interfaceName.empty());
+            assert(!providerParticipantId.participantId.empty());
+            StorageItem item{createProviderKey(providerParticipantId.domain,
+                                               providerParticipantId.interfaceName,
+                                               providerParticipantId.majorVersion),
+                             providerParticipantId.participantId};
+            auto retVal = storage.insert(std::move(item));
+            fileNeedsUpdate = retVal.second || fileNeedsUpdate;
+        }
+    }
+
+    if (fileNeedsUpdate) {
+        writeStoreToFile();
+    }
+}
+
 std::string ParticipantIdStorage::getProviderParticipantId(const std::string& domain,
                                                            const std::string& interfaceName,
                                                            std::int32_t majorVersion)
@@ -146,24 +178,27 @@ void ParticipantIdStorage::writeStoreToFile()
         JOYNR_LOG_TRACE(
                 logger(), "Writing {} new entries to file.", entries - entriesWrittenToDisk);
 
-        // write not present entries to File
-        size_t writtenToDisk = 0;
-        for (size_t i = entriesWrittenToDisk; i < entries; ++i, ++writtenToDisk) {
-            auto entry = writeIndex[i];
-            try {
-                // append to file and fsync it
-                joynr::util::appendStringToFile(fileName, entry.toIniForm(), true);
-            } catch (const std::runtime_error& ex) {
-                JOYNR_LOG_ERROR(logger(),
-                                "Cannot save ParticipantId to file {}. Next application lifecycle "
-                                "might not function correctly. Exception: {}",
-                                fileName,
-                                ex.what());
-                entriesWrittenToDisk += writtenToDisk;
-                return;
-            }
+        // write not present entries to File, all of them with a single fsync
+        std::string newEntries;
+        for (size_t i = entriesWrittenToDisk; i < entries; ++i) {
+            newEntries += writeIndex[i].toIniForm();
+        }
+        if (fileWriter) {
+            fileWriter->append(fileName, std::move(newEntries));
+            entriesWrittenToDisk = entries;
+            return;
+        }
+        try {
+            // append to file and fsync it
+            joynr::util::appendStringToFile(fileName, newEntries, true);
+        } catch (const std::runtime_error& ex) {
+            JOYNR_LOG_ERROR(logger(),
+                            "Cannot save ParticipantId to file {}. Next application lifecycle "
+                            "might not function correctly. Exception: {}",
+                            fileName,
+                            ex.what());
+            return;
         }
-        assert(entries == entriesWrittenToDisk + writtenToDisk);
         entriesWrittenToDisk = entries;
         JOYNR_LOG_TRACE(logger(), "Storage on file contains now {} entries.", entriesWrittenToDisk);
     } else if (entries < entriesWrittenToDisk) {
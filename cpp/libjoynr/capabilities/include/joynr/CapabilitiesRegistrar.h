@@ -36,6 +36,7 @@
 #include "joynr/MessagingQos.h"
 #include "joynr/ParticipantIdStorage.h"
 #include "joynr/PrivateCopyAssign.h"
+#include "joynr/ProviderRegistration.h"
 #include "joynr/RequestCallerFactory.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -280,11 +281,34 @@ public:
         return participantId;
     }
 
+    /**
+     * Registers several providers at once: their routing entries are added in one call to the
+     * message router and their participantIds are persisted with a single write before the
+     * providers are added to the discovery. onSuccess is called when all providers have been
+     * registered, otherwise onError is called with the first error once all providers have
+     * finished; the providers which have been registered successfully stay registered.
+     * @return the participantIds of the providers, in the order of providerRegistrations
+     */
+    std::vector<std::string> addAsync(
+            std::vector<ProviderRegistration> providerRegistrations,
+            std::function<void()> onSuccess,
+            std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                    onError) noexcept;
+
     void removeAsync(const std::string& participantId,
                      std::function<void()> onSuccess,
                      std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
                              onError) noexcept;
 
+    /**
+     * Unregisters several providers at once. onSuccess is called when all providers have been
+     * unregistered, otherwise onError is called with the first error once all have finished.
+     */
+    void removeAsync(const std::vector<std::string>& participantIds,
+                     std::function<void()> onSuccess,
+                     std::function<void(const joynr::exceptions::JoynrRuntimeException& error)>
+                             onError) noexcept;
+
     template <class T>
     std::string removeAsync(
             const std::string& domain,
@@ -21,8 +21,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/member.hpp>
@@ -39,6 +41,8 @@
 namespace joynr
 {
 
+class AsyncFileWriter;
+
 namespace participantIdStorageTags
 {
 struct write;
@@ -55,12 +59,22 @@ class JOYNR_EXPORT ParticipantIdStorage
 public:
     /**
      * Persist participant ids using the given file
+     * @param asyncFileWriter if set, new entries are written in the background, otherwise they
+     * are written and synced before the setter returns
      */
-    explicit ParticipantIdStorage(const std::string& filename);
+    explicit ParticipantIdStorage(const std::string& filename,
+                                  std::shared_ptr<AsyncFileWriter> asyncFileWriter = nullptr);
     virtual ~ParticipantIdStorage() = default;
 
     static const std::string& STORAGE_FORMAT_STRING();
 
+    struct ProviderParticipantId {
+        std::string domain;
+        std::string interfaceName;
+        std::int32_t majorVersion;
+        std::string participantId;
+    };
+
     /**
      * @brief setProviderParticipantId Sets a participant ID for a specific
      * provider. This is useful for provisioning of provider participant IDs.
@@ -74,6 +88,14 @@ public:
                                           int32_t majorVersion,
                                           const std::string& participantId);
 
+    /**
+     * @brief setProviderParticipantIds Sets the participant IDs of several providers at once.
+     * All new entries are persisted with a single write to the storage file.
+     * @param providerParticipantIds the providers and their participantIds to set.
+     */
+    virtual void setProviderParticipantIds(
+            const std::vector<ProviderParticipantId>& providerParticipantIds);
+
     /**
      * Get a provider participant id
      */
@@ -129,6 +151,7 @@ private:
     MultiIndexContainer storage;
     size_t entriesWrittenToDisk;
     std::string fileName;
+    std::shared_ptr<AsyncFileWriter> fileWriter;
 };
 
 } // namespace joynr
@@ -0,0 +1,75 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef PROVIDERREGISTRATION_H
+#define PROVIDERREGISTRATION_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "joynr/IJoynrProvider.h"
+#include "joynr/RequestCallerFactory.h"
+#include "joynr/types/ProviderQos.h"
+#include "joynr/types/Version.h"
+
+namespace joynr
+{
+
+class RequestCaller;
+
+/**
+ * A provider together with the parameters of its registration, used to register several
+ * providers of possibly different interfaces at once, see
+ * JoynrRuntime::registerProvidersAsync. The parameters have the same meaning as those of
+ * JoynrRuntime::registerProviderAsync.
+ */
+struct ProviderRegistration {
+    template <class TIntfProvider>
+    ProviderRegistration(const std::string& domain,
+                         std::shared_ptr<TIntfProvider> provider,
+                         const types::ProviderQos& providerQos,
+                         bool persist = true,
+                         bool awaitGlobalRegistration = false,
+                         std::vector<std::string> gbids = std::vector<std::string>())
+            : _domain(domain),
+              _interfaceName(TIntfProvider::INTERFACE_NAME()),
+              _providerVersion(TIntfProvider::MAJOR_VERSION, TIntfProvider::MINOR_VERSION),
+              _requestCaller(RequestCallerFactory::create<TIntfProvider>(provider)),
+              _provider(std::move(provider)),
+              _providerQos(providerQos),
+              _persist(persist),
+              _awaitGlobalRegistration(awaitGlobalRegistration),
+              _gbids(std::move(gbids))
+    {
+    }
+
+    std::string _domain;
+    std::string _interfaceName;
+    types::Version _providerVersion;
+    std::shared_ptr<RequestCaller> _requestCaller;
+    std::shared_ptr<IJoynrProvider> _provider;
+    types::ProviderQos _providerQos;
+    bool _persist;
+    bool _awaitGlobalRegistration;
+    std::vector<std::string> _gbids;
+};
+
+} // namespace joynr
+#endif // PROVIDERREGISTRATION_H
@@ -23,6 +23,7 @@
 #include <set>
 
 #include "joynr/Runnable.h"
+#include "joynr/ThreadConfiguration.h"
 
 namespace joynr
 {
@@ -41,18 +42,9 @@ ThreadPool::ThreadPool(const std::string& name, std::uint8_t numberOfThreads)
 void ThreadPool::init()
 {
     for (std::uint8_t i = 0; i < _numberOfThreads; ++i) {
-        _threads.emplace_back(std::bind(&ThreadPool::threadLifecycle, this, shared_from_this()));
+        _threads.emplace_back(
+                std::bind(&ThreadPool::threadLifecycle, this, shared_from_this(), i));
     }
-
-#if 0 // This is not working in g_SystemIntegrationTests
-#ifdef linux
-    if (name.c_str() != nullptr) {
-        for (auto thread = threads.begin(); thread != threads.end(); ++thread) {
-            pthread_setname_np(thread->native_handle(), name.c_str());
-        }
-    }
-#endif
-#endif
 }
 
 ThreadPool::~ThreadPool()
@@ -112,8 +104,10 @@ void ThreadPool::execute(std::shared_ptr<Runnable> runnable)
     _scheduler.add(runnable);
 }
 
-void ThreadPool::threadLifecycle(std::shared_ptr<ThreadPool> thisSharedPtr)
+void ThreadPool::threadLifecycle(std::shared_ptr<ThreadPool> thisSharedPtr, std::uint8_t index)
 {
+    // names the thread and applies the configured affinity and priority of the pool
+    ThreadConfiguration::instance().applyToCurrentThread(_name, index);
     JOYNR_LOG_TRACE(logger(), "Thread enters lifecycle");
 
     while (thisSharedPtr->_keepRunning) {
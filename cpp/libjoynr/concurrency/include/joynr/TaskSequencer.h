@@ -0,0 +1,427 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2020 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef TASK_SEQUENCER
+#define TASK_SEQUENCER
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "joynr/exceptions/JoynrException.h"
+
+#include "joynr/Future.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/SteadyTimer.h"
+#include "joynr/TimePoint.h"
+
+namespace joynr
+{
+
+/**
+ * @brief Queues async-tasks creating JOYNR Futures and processes them in sequence
+ *
+ * This class allows the sequential creation and processing of asynchronous tasks using JOYNR Future
+ * for monitoring task status. It does not own a thread: tasks are started on the threads of the
+ * given io_service as soon as the futures of the tasks they depend on have completed.
+ *
+ * Tasks with the same key are processed in the order they were added. Tasks with different keys
+ * are independent of each other and are processed concurrently, up to the configured maximum
+ * number of concurrent tasks. A task with an empty key is started after all tasks added before it
+ * have completed, and no task added after it is started before it has completed. Hence, if no keys
+ * are used, all tasks are processed strictly in sequence.
+ *
+ * @note
+ * To avoid implicit runtime changes in the sequence of DTOR calls on shutdown, the provided cancel
+ * method releases ownership of all shared memory captured by pending tasks or futures.
+ *
+ * @note
+ * The TaskSequencer cancels queued tasks as soon as they are expired: It calls the timeout()
+ * function provided in TaskWithExpiryDate and removes the expired tasks from the queue. Tasks which
+ * have already been started are not affected by their expiry date.
+ *
+ * @tparam Ts Future return types
+ */
+template <class... Ts>
+class TaskSequencer
+{
+public:
+    /** Shared JOYNR future */
+    using FutureSP = std::shared_ptr<Future<Ts...>>;
+
+    /**
+     * @brief Task function creating shared futures
+     * @return Shared future
+     */
+    using Task = std::function<FutureSP()>;
+
+    struct TaskWithExpiryDate {
+        Task _task;
+        TimePoint _expiryDate;
+        std::function<void()> _timeout;
+        /** Tasks with the same key are processed in sequence, see TaskSequencer */
+        std::string _key = std::string();
+    };
+
+    /**
+     * @brief Creates queue processor.
+     * @param ioService the io_service on which tasks are started and expired tasks are removed
+     * @param maxConcurrentTasks the maximum number of tasks with different keys whose futures may
+     * be pending at the same time, at least 1
+     */
+    explicit TaskSequencer(boost::asio::io_service& ioService, std::size_t maxConcurrentTasks = 1)
+            : _queue{std::make_shared<Queue>(ioService,
+                                             std::max<std::size_t>(maxConcurrentTasks, 1))}
+    {
+    }
+
+    /** Cancel processing of tasks. Drop all enqueued tasks silently. */
+    virtual ~TaskSequencer()
+    {
+        cancel();
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TaskSequencer);
+    DISALLOW_MOVE_AND_ASSIGN(TaskSequencer);
+
+    /**
+     * @brief add tasks to processor FIFO queue.
+     * @param taskWithExpiryDate New task with expiry date
+     */
+    virtual void add(const TaskWithExpiryDate& taskWithExpiryDate)
+    {
+        _queue->add(taskWithExpiryDate);
+    }
+
+    /**
+     * @brief Cancel all task processing. Pending futures are resolved with an error. Must not be
+     * called from within a task.
+     */
+    virtual void cancel()
+    {
+        _queue->cancel();
+    }
+
+private:
+    struct RunningTask {
+        std::uint64_t _id;
+        std::string _key;
+        FutureSP _future;
+    };
+
+    /**
+     * State shared with the handlers posted to the io_service and with the completion callbacks
+     * of the futures, which may run after the TaskSequencer has been destroyed.
+     */
+    class Queue : public std::enable_shared_from_this<Queue>
+    {
+    public:
+        Queue(boost::asio::io_service& ioService, std::size_t maxConcurrentTasks)
+                : _ioService(ioService),
+                  _maxConcurrentTasks(maxConcurrentTasks),
+                  _expiryTimer(ioService),
+                  _mutex(),
+                  _processingFinished(),
+                  _isRunning(true),
+                  _activeProcessing(0),
+                  _nextTaskId(0),
+                  _pendingTasks(),
+                  _runningTasks(),
+                  _timerExpiryDate(TimePoint::max())
+        {
+        }
+
+        void add(const TaskWithExpiryDate& taskWithExpiryDate)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_isRunning) {
+                    return;
+                }
+                _pendingTasks.push_back(taskWithExpiryDate);
+            }
+            postProcessQueue();
+        }
+
+        void cancel()
+        {
+            std::deque<TaskWithExpiryDate> releasePendingTasksMemory;
+            std::vector<RunningTask> releaseRunningTasksMemory;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (!_isRunning) {
+                    return;
+                }
+                _isRunning = false;
+                _processingFinished.wait(lock, [this] { return _activeProcessing == 0; });
+                _pendingTasks.swap(releasePendingTasksMemory);
+                _runningTasks.swap(releaseRunningTasksMemory);
+                _expiryTimer.cancel();
+            }
+            for (const RunningTask& runningTask : releaseRunningTasksMemory) {
+                if (runningTask._future &&
+                    runningTask._future->getStatus() != StatusCodeEnum::SUCCESS &&
+                    runningTask._future->getStatus() != StatusCodeEnum::ERROR) {
+                    runningTask._future->onError(
+                            std::make_shared<exceptions::JoynrRuntimeException>(
+                                    "All tasks have been canceled."));
+                }
+            }
+        }
+
+    private:
+        DISALLOW_COPY_AND_ASSIGN(Queue);
+
+        void postProcessQueue()
+        {
+            std::weak_ptr<Queue> thisWeakPtr = this->shared_from_this();
+            _ioService.post([thisWeakPtr]() {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->processQueue();
+                }
+            });
+        }
+
+        void processQueue()
+        {
+            std::vector<std::function<void()>> timeouts;
+            std::vector<std::pair<std::uint64_t, TaskWithExpiryDate>> tasksToStart;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_isRunning) {
+                    return;
+                }
+                ++_activeProcessing;
+                removeExpiredTasks(timeouts);
+                selectTasksToStart(tasksToStart);
+                scheduleExpiryTimer();
+            }
+
+            for (const auto& timeout : timeouts) {
+                if (timeout) {
+                    timeout();
+                }
+            }
+            for (auto& taskToStart : tasksToStart) {
+                startTask(taskToStart.first, taskToStart.second);
+            }
+            // release the memory captured by the tasks before cancel() may return
+            timeouts.clear();
+            tasksToStart.clear();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_activeProcessing;
+            _processingFinished.notify_all();
+        }
+
+        void removeExpiredTasks(std::vector<std::function<void()>>& timeouts)
+        {
+            const std::int64_t now = TimePoint::now().toMilliseconds();
+            for (auto it = _pendingTasks.begin(); it != _pendingTasks.end();) {
+                if (it->_expiryDate.toMilliseconds() <= now) {
+                    timeouts.push_back(std::move(it->_timeout));
+                    it = _pendingTasks.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        void selectTasksToStart(std::vector<std::pair<std::uint64_t, TaskWithExpiryDate>>& tasks)
+        {
+            // keys of pending tasks which have to wait for a task with the same key
+            std::unordered_set<std::string> blockedKeys;
+            for (auto it = _pendingTasks.begin(); it != _pendingTasks.end();) {
+                if (_runningTasks.size() >= _maxConcurrentTasks || isKeyRunning(std::string())) {
+                    return;
+                }
+                if (it->_key.empty()) {
+                    if (_runningTasks.empty() && blockedKeys.empty()) {
+                        tasks.emplace_back(startRunning(it->_key), std::move(*it));
+                        _pendingTasks.erase(it);
+                    }
+                    return;
+                }
+                if (blockedKeys.count(it->_key) != 0 || isKeyRunning(it->_key)) {
+                    blockedKeys.insert(it->_key);
+                    ++it;
+                    continue;
+                }
+                tasks.emplace_back(startRunning(it->_key), std::move(*it));
+                it = _pendingTasks.erase(it);
+            }
+        }
+
+        bool isKeyRunning(const std::string& key) const
+        {
+            return std::any_of(_runningTasks.cbegin(),
+                               _runningTasks.cend(),
+                               [&key](const RunningTask& runningTask) {
+                                   return runningTask._key == key;
+                               });
+        }
+
+        std::uint64_t startRunning(const std::string& key)
+        {
+            const std::uint64_t taskId = _nextTaskId++;
+            _runningTasks.push_back(RunningTask{taskId, key, nullptr});
+            return taskId;
+        }
+
+        void scheduleExpiryTimer()
+        {
+            TimePoint minExpiryDate = TimePoint::max();
+            for (const TaskWithExpiryDate& task : _pendingTasks) {
+                if (task._expiryDate < minExpiryDate) {
+                    minExpiryDate = task._expiryDate;
+                }
+            }
+            if (minExpiryDate == _timerExpiryDate) {
+                return;
+            }
+            _timerExpiryDate = minExpiryDate;
+            if (minExpiryDate == TimePoint::max()) {
+                _expiryTimer.cancel();
+                return;
+            }
+            _expiryTimer.expiresFromNow(minExpiryDate.relativeFromNow());
+            std::weak_ptr<Queue> thisWeakPtr = this->shared_from_this();
+            _expiryTimer.asyncWait([thisWeakPtr](const boost::system::error_code& error) {
+                if (error) {
+                    return;
+                }
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onExpiryTimer();
+                }
+            });
+        }
+
+        void onExpiryTimer()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _timerExpiryDate = TimePoint::max();
+            }
+            processQueue();
+        }
+
+        void startTask(std::uint64_t taskId, TaskWithExpiryDate& task)
+        {
+            FutureSP future;
+            try {
+                if (!task._task) {
+                    throw std::runtime_error("Dropping null-task.");
+                }
+                future = task._task();
+                if (!future) {
+                    throw std::runtime_error("Future factory created empty task.");
+                }
+            } catch (const std::exception& e) {
+                JOYNR_LOG_ERROR(
+                        logger(), "Task creation failed, continue with next task: {}", e.what());
+            } catch (...) {
+                JOYNR_LOG_ERROR(
+                        logger(),
+                        "Task creation failed for unknown reasons, continue with next task.");
+            }
+            if (!future) {
+                onTaskFinished(taskId);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto runningTask = findRunningTask(taskId);
+                if (runningTask == _runningTasks.end()) {
+                    return;
+                }
+                runningTask->_future = future;
+            }
+            std::weak_ptr<Queue> thisWeakPtr = this->shared_from_this();
+            future->onCompletion([thisWeakPtr, taskId]() {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->onTaskFinished(taskId);
+                }
+            });
+        }
+
+        void onTaskFinished(std::uint64_t taskId)
+        {
+            FutureSP releaseFutureMemory;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto runningTask = findRunningTask(taskId);
+                if (runningTask == _runningTasks.end()) {
+                    return;
+                }
+                releaseFutureMemory = std::move(runningTask->_future);
+                _runningTasks.erase(runningTask);
+                if (_pendingTasks.empty()) {
+                    return;
+                }
+            }
+            // do not start the next task in the thread completing the future
+            postProcessQueue();
+        }
+
+        typename std::vector<RunningTask>::iterator findRunningTask(std::uint64_t taskId)
+        {
+            return std::find_if(_runningTasks.begin(),
+                                _runningTasks.end(),
+                                [taskId](const RunningTask& runningTask) {
+                                    return runningTask._id == taskId;
+                                });
+        }
+
+        boost::asio::io_service& _ioService;
+        const std::size_t _maxConcurrentTasks;
+        SteadyTimer _expiryTimer;
+        std::mutex _mutex;
+        std::condition_variable _processingFinished;
+        bool _isRunning;
+        std::size_t _activeProcessing;
+        std::uint64_t _nextTaskId;
+        std::deque<TaskWithExpiryDate> _pendingTasks;
+        std::vector<RunningTask> _runningTasks;
+        TimePoint _timerExpiryDate;
+    };
+
+    std::shared_ptr<Queue> _queue;
+
+    ADD_LOGGER(TaskSequencer<Ts...>);
+};
+
+} // namespace joynr
+
+#endif // TASK_SEQUENCER
@@ -48,7 +48,8 @@ class JOYNR_EXPORT ThreadPool : public std::enable_shared_from_this<ThreadPool>
 public:
     /**
      * Constructor
-     * @param name Name of the hosted threads
+     * @param name Name of the hosted threads, also the name of the pool in the
+     * ThreadConfiguration
      * @param numberOfThreads Number of threads to be allocated and available
      */
     ThreadPool(const std::string& name, const std::uint8_t numberOfThreads);
@@ -88,7 +89,7 @@ private:
     DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
     /*! Lifecycle for @ref threads */
-    void threadLifecycle(std::shared_ptr<ThreadPool> thisSharedptr);
+    void threadLifecycle(std::shared_ptr<ThreadPool> thisSharedptr, std::uint8_t index);
 
 private:
     /*! Logger */
@@ -29,7 +29,12 @@ MessagingQos::MessagingQos(std::uint64_t ttl,
                            MessagingQosEffort::Enum effort,
                            bool encrypt,
                            bool compress)
-        : _ttl(ttl), _effort(effort), _encrypt(encrypt), _compress(compress), _messageHeaders()
+        : _ttl(ttl),
+          _effort(effort),
+          _encrypt(encrypt),
+          _compress(compress),
+          _compressionCodec(),
+          _messageHeaders()
 {
 }
 
@@ -83,6 +88,16 @@ void MessagingQos::setCompress(const bool compress)
     this->_compress = compress;
 }
 
+const std::string& MessagingQos::getCompressionCodec() const
+{
+    return _compressionCodec;
+}
+
+void MessagingQos::setCompressionCodec(const std::string& compressionCodec)
+{
+    this->_compressionCodec = compressionCodec;
+}
+
 void MessagingQos::putCustomMessageHeader(const std::string& key, const std::string& value)
 {
     checkCustomHeaderKeyValue(key, value);
@@ -121,6 +136,7 @@ bool MessagingQos::operator==(const MessagingQos& other) const
     return (this->getTtl() == other.getTtl() && this->getEffort() == other.getEffort() &&
             this->getEncrypt() == other.getEncrypt() &&
             this->getCompress() == other.getCompress() &&
+            this->getCompressionCodec() == other.getCompressionCodec() &&
             this->getCustomMessageHeaders() == other.getCustomMessageHeaders());
 }
 
@@ -132,6 +148,7 @@ std::string MessagingQos::toString() const
     msgQosAsString << "effort:" << MessagingQosEffort::getLiteral(this->getEffort());
     msgQosAsString << "encrypt:" << this->getEncrypt();
     msgQosAsString << "compress:" << this->getCompress();
+    msgQosAsString << "compressionCodec:" << this->getCompressionCodec();
     msgQosAsString << "}";
     return msgQosAsString.str();
 }
@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "joynr/JoynrExport.h"
 
@@ -47,6 +49,14 @@ class JoynrRuntimeException;
 class JOYNR_EXPORT IMessageRouter
 {
 public:
+    struct NextHop {
+        std::string _participantId;
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> _address;
+        bool _isGloballyVisible;
+        std::int64_t _expiryDateMs;
+        bool _isSticky;
+    };
+
     virtual ~IMessageRouter() = default;
 
     virtual void route(std::shared_ptr<ImmutableMessage> message, std::uint32_t tryCount = 0) = 0;
@@ -61,6 +71,14 @@ public:
             std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError =
                     nullptr) = 0;
 
+    /**
+     * Adds several next hops at once. onResult is called with one flag per next hop, in the order
+     * of nextHops, which tells whether the next hop has been added. It may be called after this
+     * method has returned.
+     */
+    virtual void addNextHops(std::vector<NextHop> nextHops,
+                             std::function<void(const std::vector<bool>& added)> onResult) = 0;
+
     virtual void removeNextHop(
             const std::string& participantId,
             std::function<void()> onSuccess = nullptr,
@@ -22,6 +22,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "joynr/IPublicationSender.h"
 
@@ -86,6 +87,17 @@ public:
                              std::shared_ptr<IReplyCaller> callback,
                              bool isLocalMessage) = 0;
 
+    /*
+     * Prepares and sends one message carrying several requests to the same provider.
+     * callbacks[i] receives the reply to requests[i].
+     */
+    virtual void sendBatchRequest(const std::string& senderParticipantId,
+                                  const std::string& receiverParticipantId,
+                                  const MessagingQos& qos,
+                                  const std::vector<Request>& requests,
+                                  const std::vector<std::shared_ptr<IReplyCaller>>& callbacks,
+                                  bool isLocalMessage) = 0;
+
     /*
      * Prepares and sends a single message
      */
@@ -104,6 +116,15 @@ public:
                            std::unordered_map<std::string, std::string> prefixedCustomHeaders,
                            const Reply& reply) = 0;
 
+    /*
+     * Prepares and sends one message carrying the replies to all requests of a batch request
+     */
+    virtual void sendBatchReply(const std::string& senderParticipantId,
+                                const std::string& receiverParticipantId,
+                                const MessagingQos& qos,
+                                std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+                                const std::vector<Reply>& replies) = 0;
+
     virtual void sendSubscriptionRequest(const std::string& senderParticipantId,
                                          const std::string& receiverParticipantId,
                                          const MessagingQos& qos,
@@ -122,6 +122,19 @@ public:
      */
     void setCompress(bool compress);
 
+    /**
+     * @brief Gets the id of the codec used to compress messages
+     * @return the codec id, empty for the default codec of the runtime
+     */
+    const std::string& getCompressionCodec() const;
+
+    /**
+     * @brief Sets the codec used to compress messages, only used if the compress flag is set.
+     * The codec must be known to the receiving runtime, see MessageCompression.
+     * @param compressionCodec the codec id, empty for the default codec of the runtime
+     */
+    void setCompressionCodec(const std::string& compressionCodec);
+
     /**
      * @brief Puts a header value for the given header key, replacing an existing value
      * if necessary.
@@ -164,6 +177,9 @@ private:
     /** @brief Specifies, whether messages will be sent compressed */
     bool _compress;
 
+    /** @brief The id of the codec used to compress messages */
+    std::string _compressionCodec;
+
     /** @brief The map of custom message headers */
     std::unordered_map<std::string, std::string> _messageHeaders;
 
@@ -18,6 +18,7 @@
  */
 #include "joynr/AbstractMessageRouter.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cfenv>
@@ -25,6 +26,7 @@
 #include <deque>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 #include <boost/asio/io_service.hpp>
 
@@ -38,9 +40,12 @@
 #include "joynr/Message.h"
 #include "joynr/MessageQueue.h"
 #include "joynr/MessagingQos.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastReceiverDirectory.h"
+#include "joynr/PoolAllocator.h"
 #include "joynr/Reply.h"
 #include "joynr/Request.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/TimePoint.h"
 #include "joynr/Util.h"
@@ -68,9 +73,13 @@ AbstractMessageRouter::AbstractMessageRouter(
           _multicastReceiverDirectory(),
           _messagingSettings(messagingSettings),
           _messagingStubFactory(std::move(messagingStubFactory)),
-          _messageScheduler(std::make_shared<ThreadPoolDelayedScheduler>(1,
-                                                                         "AbstractMessageRouter",
-                                                                         ioService)),
+          _messageScheduler(std::make_shared<ThreadPoolDelayedScheduler>(
+                  static_cast<std::uint8_t>(std::min<std::uint32_t>(
+                          ThreadConfiguration::instance().getNumberOfThreads(
+                                  ThreadConfiguration::MESSAGE_ROUTER(), 1),
+                          255)),
+                  ThreadConfiguration::MESSAGE_ROUTER(),
+                  ioService)),
           _messageQueue(std::move(messageQueue)),
           _messageSender(),
           _messageQueueRetryLock(),
@@ -83,6 +92,12 @@ AbstractMessageRouter::AbstractMessageRouter(
           _transportStatuses(std::move(transportStatuses)),
           _printRoutedMessages(false),
           _routedMessagePrintIntervalS(10u),
+          _messageQueueDepth(MetricsRegistry::instance().getGauge(
+                  "joynr_message_queue_depth",
+                  "Number of messages queued for participants without routing entry")),
+          _messageRunnableLatency(MetricsRegistry::instance().getHistogram(
+                  "joynr_message_runnable_duration_seconds",
+                  "Duration of the transmission of a message to a messaging stub")),
           _isShuttingDown(false),
           _numberOfRoutedMessages(0),
           _maxAclRetryIntervalMs(
@@ -170,7 +185,7 @@ AbstractMessageRouter::AddressUnorderedSet AbstractMessageRouter::getDestination
     std::ignore = messageQueueRetryReadLock;
     ReadLocker lock(_routingTableLock);
     AbstractMessageRouter::AddressUnorderedSet addresses;
-    if (message.getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+    if (message.getMessageType() == MessageType::MULTICAST) {
         const std::string& multicastId = message.getRecipient();
 
         // lookup local multicast receivers
@@ -225,6 +240,52 @@ void AbstractMessageRouter::route(std::shared_ptr<ImmutableMessage> message, std
     routeInternal(std::move(message), tryCount);
 }
 
+void AbstractMessageRouter::addNextHops(
+        std::vector<NextHop> nextHops,
+        std::function<void(const std::vector<bool>& added)> onResult)
+{
+    if (nextHops.empty()) {
+        if (onResult) {
+            onResult({});
+        }
+        return;
+    }
+
+    struct PendingNextHops {
+        std::mutex _mutex;
+        std::vector<bool> _added;
+        std::size_t _pending;
+        std::function<void(const std::vector<bool>& added)> _onResult;
+    };
+    auto pendingNextHops = std::make_shared<PendingNextHops>();
+    pendingNextHops->_added.resize(nextHops.size(), false);
+    pendingNextHops->_pending = nextHops.size();
+    pendingNextHops->_onResult = std::move(onResult);
+    auto onDone = [pendingNextHops](std::size_t index, bool added) {
+        {
+            std::lock_guard<std::mutex> lock(pendingNextHops->_mutex);
+            pendingNextHops->_added[index] = added;
+            if (--pendingNextHops->_pending > 0) {
+                return;
+            }
+        }
+        if (pendingNextHops->_onResult) {
+            pendingNextHops->_onResult(pendingNextHops->_added);
+        }
+    };
+
+    for (std::size_t i = 0; i < nextHops.size(); ++i) {
+        NextHop& nextHop = nextHops[i];
+        addNextHop(nextHop._participantId,
+                   nextHop._address,
+                   nextHop._isGloballyVisible,
+                   nextHop._expiryDateMs,
+                   nextHop._isSticky,
+                   [onDone, i]() { onDone(i, true); },
+                   [onDone, i](const exceptions::ProviderRuntimeException&) { onDone(i, false); });
+    }
+}
+
 // following method may be overridden by subclass
 void AbstractMessageRouter::setToKnown(const std::string& participantId)
 {
@@ -257,15 +318,23 @@ void AbstractMessageRouter::onMsgsDropped(
         auto droppedMessage = droppedMessages.back();
         droppedMessages.pop_back();
         if (droppedMessage) {
-            if (droppedMessage->getType() != Message::VALUE_MESSAGE_TYPE_REQUEST()) {
+            const MessageType messageType = droppedMessage->getMessageType();
+            const bool isBatchRequest = messageType == MessageType::BATCH_REQUEST;
+            if (messageType != MessageType::REQUEST && !isBatchRequest) {
                 continue;
             }
 
-            // deserialize the request
-            Request request;
+            // deserialize the request, a batch request is answered with one error per request
+            std::vector<Request> requests;
             try {
-                joynr::serializer::deserializeFromJson(
-                        request, droppedMessage->getUnencryptedBody());
+                if (isBatchRequest) {
+                    joynr::serializer::deserializeFromJson(
+                            requests, droppedMessage->getUnencryptedBody());
+                } else {
+                    requests.emplace_back();
+                    joynr::serializer::deserializeFromJson(
+                            requests.front(), droppedMessage->getUnencryptedBody());
+                }
             } catch (const std::invalid_argument& e) {
 
                 JOYNR_LOG_ERROR(logger(),
@@ -275,16 +344,19 @@ void AbstractMessageRouter::onMsgsDropped(
                                 e.what());
                 continue;
             }
+            if (requests.empty()) {
+                continue;
+            }
 
-            Reply reply;
-            const std::string& requestReplyId = request.getRequestReplyId();
-            TimePoint requestExpiryDate = droppedMessage->getExpiryDate();
-            reply.setRequestReplyId(requestReplyId);
             auto error = std::make_shared<joynr::exceptions::ProviderRuntimeException>(
                     "Request Message {" + droppedMessage->getTrackingInfo() +
                     "} dropped due to the exhaustion of the message queue.");
-
-            reply.setError(error);
+            std::vector<Reply> replies(requests.size());
+            for (std::size_t i = 0; i < requests.size(); ++i) {
+                replies[i].setRequestReplyId(requests[i].getRequestReplyId());
+                replies[i].setError(error);
+            }
+            TimePoint requestExpiryDate = droppedMessage->getExpiryDate();
 
             std::string senderId = droppedMessage->getSender();
             std::string receiverId = droppedMessage->getRecipient();
@@ -292,6 +364,7 @@ void AbstractMessageRouter::onMsgsDropped(
             const std::chrono::milliseconds ttl = requestExpiryDate.relativeFromNow();
             MessagingQos messagingQos(static_cast<std::uint64_t>(ttl.count()));
             messagingQos.setCompress(droppedMessage->isCompressed());
+            messagingQos.setCompressionCodec(droppedMessage->getCompressionCodec());
             const boost::optional<std::string> effort = droppedMessage->getEffort();
             if (effort) {
                 try {
@@ -309,16 +382,25 @@ void AbstractMessageRouter::onMsgsDropped(
                                 "Sending fake reply for the dropped request message. "
                                 "RequestReplyId: {}, "
                                 "sender of droppedMsg: {}, receiver of droppedMsg: {}",
-                                requestReplyId,
+                                replies.front().getRequestReplyId(),
                                 senderId,
                                 receiverId);
-                messageSenderSharedPtr->sendReply(
-                        receiverId, // the receiver of the dropped messasge is the sender of the
-                                    // reply
-                        senderId,   // the sender of the dropped message is the receiver of reply
-                        messagingQos,
-                        droppedMessage->getPrefixedCustomHeaders(),
-                        std::move(reply));
+                // the receiver of the dropped messasge is the sender of the reply
+                // the sender of the dropped message is the receiver of reply
+                if (isBatchRequest) {
+                    messageSenderSharedPtr->sendBatchReply(
+                            receiverId,
+                            senderId,
+                            messagingQos,
+                            droppedMessage->getPrefixedCustomHeaders(),
+                            replies);
+                } else {
+                    messageSenderSharedPtr->sendReply(receiverId,
+                                                      senderId,
+                                                      messagingQos,
+                                                      droppedMessage->getPrefixedCustomHeaders(),
+                                                      std::move(replies.front()));
+                }
             }
         }
     }
@@ -343,6 +425,9 @@ void AbstractMessageRouter::sendQueuedMessages(
     while (auto item = _messageQueue->getNextMessageFor(destinationPartId)) {
         messages.push_back(item);
     }
+    if (!messages.empty()) {
+        updateMessageQueueDepthMetric();
+    }
     // _messageQueueRetryLock must be released before calling sendMessage
     // to prevent deadlock in case the message cannot be sent (e.g. if the stub
     // creation fails) and it has to be queued again
@@ -352,6 +437,31 @@ void AbstractMessageRouter::sendQueuedMessages(
     }
 }
 
+void AbstractMessageRouter::sendQueuedMessages(const std::vector<NextHop>& nextHops,
+                                               const std::vector<bool>& added,
+                                               WriteLocker&& messageQueueRetryWriteLock)
+{
+    assert(messageQueueRetryWriteLock.owns_lock());
+    std::vector<std::pair<std::shared_ptr<ImmutableMessage>,
+                          std::shared_ptr<const joynr::system::RoutingTypes::Address>>> messages;
+    for (std::size_t i = 0; i < nextHops.size(); ++i) {
+        if (!added[i]) {
+            continue;
+        }
+        while (auto item = _messageQueue->getNextMessageFor(nextHops[i]._participantId)) {
+            messages.emplace_back(std::move(item), nextHops[i]._address);
+        }
+    }
+    if (!messages.empty()) {
+        updateMessageQueueDepthMetric();
+    }
+    // see sendQueuedMessages for a single participant
+    messageQueueRetryWriteLock.unlock();
+    for (const auto& message : messages) {
+        sendMessage(message.first, message.second);
+    }
+}
+
 void AbstractMessageRouter::scheduleMessage(
         std::shared_ptr<ImmutableMessage> message,
         std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress,
@@ -369,6 +479,7 @@ void AbstractMessageRouter::scheduleMessage(
                                     "Transport not available. Message queued: {}",
                                     message->getTrackingInfo());
 
+                    message->releaseInFlightCredit();
                     droppedMessagesToBeReplied = _transportNotAvailableQueue->queueMessage(
                             transportStatus, std::move(message));
                     if (droppedMessagesToBeReplied.empty()) {
@@ -387,14 +498,14 @@ void AbstractMessageRouter::scheduleMessage(
 
     auto stub = _messagingStubFactory->create(destAddress);
     if (stub) {
-        _messageScheduler->schedule(std::make_shared<MessageRunnable>(std::move(message),
-                                                                      std::move(stub),
-                                                                      std::move(destAddress),
-                                                                      shared_from_this(),
-                                                                      tryCount),
+        _messageScheduler->schedule(util::makePooledShared<MessageRunnable>(std::move(message),
+                                                                            std::move(stub),
+                                                                            std::move(destAddress),
+                                                                            shared_from_this(),
+                                                                            tryCount),
                                     delay);
     } else {
-        if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+        if (message->getMessageType() == MessageType::MULTICAST) {
             // do not queue a multicast message since it would get stored under
             // the multicast participantId so that it will never be unqueued
             // again.
@@ -406,7 +517,7 @@ void AbstractMessageRouter::scheduleMessage(
                             destAddress->toString());
             removeUnreachableMulticastReceivers(
                     message->getRecipient(), destAddress, message->getSender());
-        } else if (message->getType() == Message::VALUE_MESSAGE_TYPE_PUBLICATION()) {
+        } else if (message->getMessageType() == MessageType::PUBLICATION) {
             JOYNR_LOG_ERROR(logger(),
                             "Publication message {} could not be sent to recipient, {}. Stub "
                             "creation failed. => Discarding "
@@ -512,6 +623,7 @@ void AbstractMessageRouter::onMessageCleanerTimerExpired(
         WriteLocker lock(thisSharedPtr->_messageQueueRetryLock);
         thisSharedPtr->_messageQueue->removeOutdatedMessages();
         thisSharedPtr->_transportNotAvailableQueue->removeOutdatedMessages();
+        thisSharedPtr->updateMessageQueueDepthMetric();
         thisSharedPtr->activateMessageCleanerTimer();
     } else if (errorCode != boost::system::errc::operation_canceled) {
         JOYNR_LOG_ERROR(logger(),
@@ -542,15 +654,22 @@ void AbstractMessageRouter::queueMessage(std::shared_ptr<ImmutableMessage> messa
     assert(messageQueueRetryReadLock.owns_lock());
     std::ignore = messageQueueRetryReadLock;
     JOYNR_LOG_TRACE(logger(), "message queued: {}", message->getTrackingInfo());
+    message->releaseInFlightCredit();
     std::string recipient = message->getRecipient();
     auto droppedMessagesToBeReplied =
             _messageQueue->queueMessage(std::move(recipient), std::move(message));
     messageQueueRetryReadLock.unlock();
+    updateMessageQueueDepthMetric();
     if (!droppedMessagesToBeReplied.empty()) {
         onMsgsDropped(droppedMessagesToBeReplied);
     }
 }
 
+void AbstractMessageRouter::updateMessageQueueDepthMetric()
+{
+    _messageQueueDepth->set(static_cast<std::int64_t>(_messageQueue->getQueueLength()));
+}
+
 bool AbstractMessageRouter::addToRoutingTable(
         std::string participantId,
         bool isGloballyVisible,
@@ -564,55 +683,115 @@ bool AbstractMessageRouter::addToRoutingTable(
                         participantId);
         return false;
     }
-    {
-        WriteLocker lock(_routingTableLock);
-        auto oldRoutingEntry = _routingTable.lookupRoutingEntryByParticipantId(participantId);
-        if (oldRoutingEntry) {
-            const bool addressOrVisibilityOfRoutingEntryChanged =
-                    (!oldRoutingEntry->address->equals(*address, joynr::util::MAX_ULPS)) ||
-                    (oldRoutingEntry->isGloballyVisible != isGloballyVisible);
-            if (addressOrVisibilityOfRoutingEntryChanged) {
-                if (oldRoutingEntry->_isSticky) {
-                    JOYNR_LOG_ERROR(
-                            logger(),
-                            "unable to update participantId={} in routing table, since "
-                            "the participantId is already associated with STICKY routing entry {}.",
-                            participantId,
-                            oldRoutingEntry->toString());
-                    return false;
-                }
-                if (!allowRoutingEntryUpdate(*oldRoutingEntry, *address)) {
-                    JOYNR_LOG_WARN(logger(),
-                                   "unable to update participantId={} in routing table, since "
-                                   "the participantId is already associated with routing entry {}.",
-                                   participantId,
-                                   oldRoutingEntry->toString());
-                    return false;
-                }
-                JOYNR_LOG_TRACE(
-                        logger(), "updating participantId={} in routing table", participantId);
-            } else {
-                JOYNR_LOG_TRACE(
+    WriteLocker lock(_routingTableLock);
+    return addToRoutingTable(std::move(participantId),
+                             isGloballyVisible,
+                             std::move(address),
+                             expiryDateMs,
+                             isSticky,
+                             lock);
+}
+
+std::vector<bool> AbstractMessageRouter::addToRoutingTable(const std::vector<NextHop>& nextHops)
+{
+    std::vector<bool> added(nextHops.size(), false);
+    std::vector<bool> valid(nextHops.size(), false);
+    for (std::size_t i = 0; i < nextHops.size(); ++i) {
+        valid[i] = isValidForRoutingTable(nextHops[i]._address);
+        if (!valid[i]) {
+            JOYNR_LOG_TRACE(logger(),
+                            "participantId={} has an unsupported address within this process",
+                            nextHops[i]._participantId);
+        }
+    }
+    WriteLocker lock(_routingTableLock);
+    for (std::size_t i = 0; i < nextHops.size(); ++i) {
+        if (valid[i]) {
+            const NextHop& nextHop = nextHops[i];
+            added[i] = addToRoutingTable(nextHop._participantId,
+                                         nextHop._isGloballyVisible,
+                                         nextHop._address,
+                                         nextHop._expiryDateMs,
+                                         nextHop._isSticky,
+                                         lock);
+        }
+    }
+    return added;
+}
+
+bool AbstractMessageRouter::addToRoutingTable(
+        std::string participantId,
+        bool isGloballyVisible,
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> address,
+        std::int64_t expiryDateMs,
+        bool isSticky,
+        const WriteLocker& routingTableWriteLock)
+{
+    assert(routingTableWriteLock.owns_lock());
+    std::ignore = routingTableWriteLock;
+    auto oldRoutingEntry = _routingTable.lookupRoutingEntryByParticipantId(participantId);
+    if (oldRoutingEntry) {
+        const bool addressOrVisibilityOfRoutingEntryChanged =
+                (!oldRoutingEntry->address->equals(*address, joynr::util::MAX_ULPS)) ||
+                (oldRoutingEntry->isGloballyVisible != isGloballyVisible);
+        if (addressOrVisibilityOfRoutingEntryChanged) {
+            if (oldRoutingEntry->_isSticky) {
+                JOYNR_LOG_ERROR(
                         logger(),
-                        "Updating expiryDate and sticky-flag of participantId={} in routing table.",
-                        participantId);
+                        "unable to update participantId={} in routing table, since "
+                        "the participantId is already associated with STICKY routing entry {}.",
+                        participantId,
+                        oldRoutingEntry->toString());
+                return false;
             }
-            // keep longest lifetime
-            if (oldRoutingEntry->_expiryDateMs > expiryDateMs) {
-                expiryDateMs = oldRoutingEntry->_expiryDateMs;
-            }
-            if (oldRoutingEntry->_isSticky) {
-                isSticky = true;
+            if (!allowRoutingEntryUpdate(*oldRoutingEntry, *address)) {
+                JOYNR_LOG_WARN(logger(),
+                               "unable to update participantId={} in routing table, since "
+                               "the participantId is already associated with routing entry {}.",
+                               participantId,
+                               oldRoutingEntry->toString());
+                return false;
             }
+            JOYNR_LOG_TRACE(logger(), "updating participantId={} in routing table", participantId);
+        } else {
+            JOYNR_LOG_TRACE(
+                    logger(),
+                    "Updating expiryDate and sticky-flag of participantId={} in routing table.",
+                    participantId);
+        }
+        // keep longest lifetime
+        if (oldRoutingEntry->_expiryDateMs > expiryDateMs) {
+            expiryDateMs = oldRoutingEntry->_expiryDateMs;
+        }
+        if (oldRoutingEntry->_isSticky) {
+            isSticky = true;
         }
-        // manual removal of old entry is not required here since routingTable.add() automatically
-        // calls replace in case insert fails
-        _routingTable.add(
-                std::move(participantId), isGloballyVisible, address, expiryDateMs, isSticky);
     }
+    // manual removal of old entry is not required here since routingTable.add() automatically
+    // calls replace in case insert fails
+    _routingTable.add(std::move(participantId), isGloballyVisible, address, expiryDateMs, isSticky);
     return true;
 }
 
+bool AbstractMessageRouter::isRoutingEntryUpToDate(
+        const std::string& participantId,
+        const joynr::system::RoutingTypes::Address& address,
+        bool isGloballyVisible,
+        std::int64_t expiryDateMs,
+        bool isSticky)
+{
+    ReadLocker lock(_routingTableLock);
+    auto routingEntry = _routingTable.lookupRoutingEntryByParticipantId(participantId);
+    if (!routingEntry) {
+        return false;
+    }
+    // interned addresses are shared, so comparing the pointers is sufficient in most cases
+    const bool isSameAddress = (routingEntry->address.get() == &address) ||
+                               routingEntry->address->equals(address, joynr::util::MAX_ULPS);
+    return isSameAddress && (routingEntry->isGloballyVisible == isGloballyVisible) &&
+           (routingEntry->_expiryDateMs >= expiryDateMs) && (routingEntry->_isSticky || !isSticky);
+}
+
 std::uint64_t AbstractMessageRouter::getNumberOfRoutedMessages() const
 {
     return _numberOfRoutedMessages;
@@ -738,7 +917,10 @@ void MessageRunnable::run()
             return;
         }
 
+        ScopedLatency runnableLatency(*messageRouterSharedPtr->_messageRunnableLatency);
         if (messageRouterSharedPtr->canMessageBeTransmitted(_message)) {
+            // the transport limits its own queue, see client-max-send-buffer-bytes
+            _message->releaseInFlightCredit();
             _messagingStub->transmit(_message, onFailure);
         } else {
             messageRouterSharedPtr->sendMessage(_message, _destAddress, _tryCount);
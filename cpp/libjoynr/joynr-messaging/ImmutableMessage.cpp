@@ -26,6 +26,7 @@
 #include "boost/algorithm/string.hpp"
 
 #include "joynr/Message.h"
+#include "joynr/MessageCompression.h"
 
 namespace joynr
 {
@@ -39,7 +40,9 @@ ImmutableMessage::ImmutableMessage(smrf::ByteVector&& serializedMessage, bool ve
           receivedFromGlobal(false),
           _accessControlChecked(false),
           creator(),
-          _requiredHeaders()
+          _requiredHeaders(),
+          _inFlightCredit(),
+          _isInFlightCreditReleased(false)
 {
     init();
 }
@@ -53,7 +56,9 @@ ImmutableMessage::ImmutableMessage(const smrf::ByteVector& serializedMessage, bo
           receivedFromGlobal(false),
           _accessControlChecked(false),
           creator(),
-          _requiredHeaders()
+          _requiredHeaders(),
+          _inFlightCredit(),
+          _isInFlightCreditReleased(false)
 {
     init();
 }
@@ -131,17 +136,31 @@ bool ImmutableMessage::isSigned() const
 
 bool ImmutableMessage::isCompressed() const
 {
-    return _messageDeserializer.isCompressed();
+    return _messageDeserializer.isCompressed() ||
+           headers.find(Message::HEADER_COMPRESSION_CODEC()) != headers.cend();
+}
+
+std::string ImmutableMessage::getCompressionCodec() const
+{
+    if (_messageDeserializer.isCompressed()) {
+        return MessageCompression::GZIP();
+    }
+    return getOptionalHeaderByKey(Message::HEADER_COMPRESSION_CODEC()).value_or(std::string());
 }
 
 smrf::ByteArrayView ImmutableMessage::getUnencryptedBody() const
 {
     if (!_bodyView) {
-        if (!_messageDeserializer.isCompressed()) {
-            _bodyView = _messageDeserializer.getBody();
-        } else {
+        auto compressionCodec = getOptionalHeaderByKey(Message::HEADER_COMPRESSION_CODEC());
+        if (_messageDeserializer.isCompressed()) {
             _decompressedBody = _messageDeserializer.decompressBody();
             _bodyView = smrf::ByteArrayView(*_decompressedBody);
+        } else if (compressionCodec) {
+            _decompressedBody = MessageCompression::instance().decompress(
+                    *compressionCodec, _messageDeserializer.getBody());
+            _bodyView = smrf::ByteArrayView(*_decompressedBody);
+        } else {
+            _bodyView = _messageDeserializer.getBody();
         }
     }
     return *_bodyView;
@@ -157,6 +176,11 @@ const std::string& ImmutableMessage::getType() const
     return _requiredHeaders.type;
 }
 
+MessageType ImmutableMessage::getMessageType() const
+{
+    return _requiredHeaders.messageType;
+}
+
 const std::string& ImmutableMessage::getId() const
 {
     return _requiredHeaders.id;
@@ -243,6 +267,7 @@ void ImmutableMessage::init()
     } else {
         _requiredHeaders.id = std::move(*optionalId);
         _requiredHeaders.type = std::move(*optionalType);
+        _requiredHeaders.messageType = Message::decodeMessageType(_requiredHeaders.type);
     }
 }
 
@@ -261,6 +286,18 @@ void ImmutableMessage::setAccessControlChecked()
     _accessControlChecked = true;
 }
 
+void ImmutableMessage::setInFlightCredit(InFlightBudget::Credit credit)
+{
+    _inFlightCredit = std::move(credit);
+}
+
+void ImmutableMessage::releaseInFlightCredit()
+{
+    if (!_isInFlightCreditReleased.exchange(true)) {
+        _inFlightCredit.reset();
+    }
+}
+
 std::string ImmutableMessage::getTrackingInfo() const
 {
     auto requestReplyId = getOptionalHeaderByKey(Message::CUSTOM_HEADER_PREFIX() +
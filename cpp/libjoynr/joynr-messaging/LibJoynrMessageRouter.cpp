@@ -143,7 +143,7 @@ void LibJoynrMessageRouter::routeInternal(std::shared_ptr<ImmutableMessage> mess
 
         // if destination address is not known
         if (destAddresses.empty()) {
-            if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+            if (message->getMessageType() == MessageType::MULTICAST) {
                 // Do not queue multicast messages for future multicast receivers.
                 return;
             }
@@ -0,0 +1,218 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/MessageCompression.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
+#include "joynr/ICompressionCodec.h"
+#include "joynr/MessagingSettings.h"
+#include "joynr/Util.h"
+
+#ifdef JOYNR_ENABLE_ZSTD_COMPRESSION
+#include "ZstdCompressionCodec.h"
+#endif // JOYNR_ENABLE_ZSTD_COMPRESSION
+
+namespace joynr
+{
+
+MessageCompression::MessageCompression()
+        : _codecs(),
+          _interfaceCodecs(),
+          _defaultCodec(MessagingSettings::DEFAULT_COMPRESSION_CODEC()),
+          _minimumSize(MessagingSettings::DEFAULT_COMPRESSION_MIN_SIZE()),
+          _mutex()
+{
+}
+
+MessageCompression& MessageCompression::instance()
+{
+    static MessageCompression compressionInstance;
+    return compressionInstance;
+}
+
+const std::string& MessageCompression::GZIP()
+{
+    static const std::string value("gzip");
+    return value;
+}
+
+const std::string& MessageCompression::ZSTD()
+{
+    static const std::string value("zstd");
+    return value;
+}
+
+const std::string& MessageCompression::ZSTD_DICTIONARY_PREFIX()
+{
+    static const std::string value("zstd-");
+    return value;
+}
+
+void MessageCompression::load(const MessagingSettings& settings)
+{
+#ifdef JOYNR_ENABLE_ZSTD_COMPRESSION
+    const std::int32_t level = settings.getCompressionZstdLevel();
+    registerCodec(std::make_shared<ZstdCompressionCodec>(ZSTD(), level));
+    for (const auto& dictionary : parseAssignments(settings.getCompressionDictionaries())) {
+        const std::string codecId = ZSTD_DICTIONARY_PREFIX() + dictionary.first;
+        try {
+            registerCodec(std::make_shared<ZstdCompressionCodec>(
+                    codecId, level, util::loadStringFromFile(dictionary.second)));
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(), "Cannot register compression codec {}: {}", codecId, e.what());
+        }
+    }
+#else
+    if (!settings.getCompressionDictionaries().empty()) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Ignoring compression dictionaries, joynr is built without zstd support");
+    }
+#endif // JOYNR_ENABLE_ZSTD_COMPRESSION
+
+    setMinimumSize(settings.getCompressionMinSize());
+    setDefaultCodec(settings.getCompressionCodec());
+    for (const auto& interfaceCodec : parseAssignments(settings.getCompressionInterfaceCodecs())) {
+        setInterfaceCodec(interfaceCodec.first, interfaceCodec.second);
+    }
+}
+
+void MessageCompression::registerCodec(std::shared_ptr<const ICompressionCodec> codec)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _codecs[codec->getId()] = std::move(codec);
+}
+
+std::shared_ptr<const ICompressionCodec> MessageCompression::getCodec(
+        const std::string& codecId) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _codecs.find(codecId);
+    if (it == _codecs.cend()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+std::string MessageCompression::getInterfaceCodec(const std::string& interfaceName) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _interfaceCodecs.find(interfaceName);
+    if (it == _interfaceCodecs.cend()) {
+        return std::string();
+    }
+    return it->second;
+}
+
+std::string MessageCompression::selectCodec(const std::string& requestedCodec,
+                                            std::size_t bodySize) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (bodySize < _minimumSize) {
+        return std::string();
+    }
+    if (requestedCodec.empty()) {
+        return _defaultCodec;
+    }
+    if (requestedCodec == GZIP()) {
+        return requestedCodec;
+    }
+    if (_codecs.find(requestedCodec) == _codecs.cend()) {
+        JOYNR_LOG_WARN(logger(),
+                       "Unknown compression codec {}, using {}",
+                       requestedCodec,
+                       _defaultCodec);
+        return _defaultCodec;
+    }
+    return requestedCodec;
+}
+
+smrf::ByteVector MessageCompression::decompress(const std::string& codecId,
+                                                const smrf::ByteArrayView& body) const
+{
+    std::shared_ptr<const ICompressionCodec> codec = getCodec(codecId);
+    if (!codec) {
+        throw std::invalid_argument("unknown compression codec " + codecId);
+    }
+    return codec->decompress(body);
+}
+
+void MessageCompression::setDefaultCodec(const std::string& codecId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (codecId != GZIP() && _codecs.find(codecId) == _codecs.cend()) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Unknown default compression codec {}, using {}",
+                        codecId,
+                        GZIP());
+        _defaultCodec = GZIP();
+        return;
+    }
+    _defaultCodec = codecId;
+}
+
+void MessageCompression::setMinimumSize(std::size_t minimumSize)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _minimumSize = minimumSize;
+}
+
+void MessageCompression::setInterfaceCodec(const std::string& interfaceName,
+                                           const std::string& codecId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _interfaceCodecs[interfaceName] = codecId;
+}
+
+void MessageCompression::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _codecs.clear();
+    _interfaceCodecs.clear();
+    _defaultCodec = MessagingSettings::DEFAULT_COMPRESSION_CODEC();
+    _minimumSize = MessagingSettings::DEFAULT_COMPRESSION_MIN_SIZE();
+}
+
+std::map<std::string, std::string> MessageCompression::parseAssignments(
+        const std::string& assignments)
+{
+    std::vector<std::string> entries;
+    boost::algorithm::split(entries, assignments, [](char c) { return c == ','; });
+    std::map<std::string, std::string> result;
+    for (std::string& entry : entries) {
+        boost::algorithm::trim(entry);
+        if (entry.empty()) {
+            continue;
+        }
+        const std::size_t separator = entry.find('=');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == entry.size()) {
+            JOYNR_LOG_ERROR(logger(), "Ignoring invalid compression setting {}", entry);
+            continue;
+        }
+        result[boost::algorithm::trim_copy(entry.substr(0, separator))] =
+                boost::algorithm::trim_copy(entry.substr(separator + 1));
+    }
+    return result;
+}
+
+} // namespace joynr
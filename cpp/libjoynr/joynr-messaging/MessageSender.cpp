@@ -96,6 +96,43 @@ void MessageSender::sendRequest(const std::string& senderParticipantId,
     _messageRouter->route(message.getImmutableMessage());
 }
 
+void MessageSender::sendBatchRequest(const std::string& senderParticipantId,
+                                     const std::string& receiverParticipantId,
+                                     const MessagingQos& qos,
+                                     const std::vector<Request>& requests,
+                                     const std::vector<std::shared_ptr<IReplyCaller>>& callbacks,
+                                     bool isLocalMessage)
+{
+    assert(requests.size() == callbacks.size());
+    auto dispatcherSharedPtr = _dispatcher.lock();
+    if (dispatcherSharedPtr == nullptr) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Sending a batch request failed. Dispatcher is null. Probably a proxy "
+                        "was used after the runtime was deleted.");
+        return;
+    }
+
+    MutableMessage message = _messageFactory.createBatchRequest(
+            senderParticipantId, receiverParticipantId, qos, requests, isLocalMessage);
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        dispatcherSharedPtr->addReplyCaller(requests[i].getRequestReplyId(), callbacks[i], qos);
+    }
+
+    if (!message.isLocalMessage()) {
+        message.setReplyTo(_replyToAddress);
+    }
+
+    JOYNR_LOG_DEBUG(logger(),
+                    "Send BatchRequest: {} requests, messageId: {}, "
+                    "proxy participantId: {}, provider participantId: {}",
+                    requests.size(),
+                    message.getId(),
+                    senderParticipantId,
+                    receiverParticipantId);
+    assert(_messageRouter);
+    _messageRouter->route(message.getImmutableMessage());
+}
+
 void MessageSender::sendOneWayRequest(const std::string& senderParticipantId,
                                       const std::string& receiverParticipantId,
                                       const MessagingQos& qos,
@@ -149,6 +186,37 @@ void MessageSender::sendReply(const std::string& senderParticipantId,
     }
 }
 
+void MessageSender::sendBatchReply(
+        const std::string& senderParticipantId,
+        const std::string& receiverParticipantId,
+        const MessagingQos& qos,
+        std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+        const std::vector<Reply>& replies)
+{
+    try {
+        MutableMessage message = _messageFactory.createBatchReply(senderParticipantId,
+                                                                  receiverParticipantId,
+                                                                  qos,
+                                                                  std::move(prefixedCustomHeaders),
+                                                                  replies);
+        assert(_messageRouter);
+        _messageRouter->route(message.getImmutableMessage());
+    } catch (const std::invalid_argument& exception) {
+        throw joynr::exceptions::MethodInvocationException(exception.what());
+    } catch (const exceptions::JoynrMessageExpiredException& e) {
+        JOYNR_LOG_WARN(logger(),
+                       "BatchReply with {} replies could not be sent. Error: {}",
+                       replies.size(),
+                       e.getMessage());
+    } catch (const exceptions::JoynrRuntimeException& e) {
+        JOYNR_LOG_ERROR(logger(),
+                        "BatchReply with {} replies could not be sent to {}. Error: {}",
+                        replies.size(),
+                        receiverParticipantId,
+                        e.getMessage());
+    }
+}
+
 void MessageSender::sendSubscriptionRequest(const std::string& senderParticipantId,
                                             const std::string& receiverParticipantId,
                                             const MessagingQos& qos,
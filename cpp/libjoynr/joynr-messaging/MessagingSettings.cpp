@@ -19,6 +19,7 @@
 #include "joynr/MessagingSettings.h"
 
 #include <cassert>
+#include <limits>
 
 #include "joynr/BrokerUrl.h"
 #include "joynr/Settings.h"
@@ -282,6 +283,74 @@ const std::string& MessagingSettings::SETTING_TTL_UPLIFT_MS()
     return value;
 }
 
+const std::string& MessagingSettings::SETTING_SUBSCRIPTION_SCHEDULER_THREADS()
+{
+    static const std::string value("messaging/subscription-scheduler-threads");
+    return value;
+}
+
+std::uint32_t MessagingSettings::DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS()
+{
+    return 2;
+}
+
+const std::string& MessagingSettings::SETTING_IO_SERVICE_THREADS()
+{
+    static const std::string value("messaging/io-service-threads");
+    return value;
+}
+
+std::uint32_t MessagingSettings::DEFAULT_IO_SERVICE_THREADS()
+{
+    return 1;
+}
+
+const std::string& MessagingSettings::SETTING_COMPRESSION_CODEC()
+{
+    static const std::string value("messaging/compression-codec");
+    return value;
+}
+
+const std::string& MessagingSettings::DEFAULT_COMPRESSION_CODEC()
+{
+    static const std::string value("gzip");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_COMPRESSION_MIN_SIZE()
+{
+    static const std::string value("messaging/compression-min-size");
+    return value;
+}
+
+std::uint32_t MessagingSettings::DEFAULT_COMPRESSION_MIN_SIZE()
+{
+    return 0;
+}
+
+const std::string& MessagingSettings::SETTING_COMPRESSION_ZSTD_LEVEL()
+{
+    static const std::string value("messaging/compression-zstd-level");
+    return value;
+}
+
+std::int32_t MessagingSettings::DEFAULT_COMPRESSION_ZSTD_LEVEL()
+{
+    return 1;
+}
+
+const std::string& MessagingSettings::SETTING_COMPRESSION_DICTIONARIES()
+{
+    static const std::string value("messaging/compression-dictionaries");
+    return value;
+}
+
+const std::string& MessagingSettings::SETTING_COMPRESSION_INTERFACE_CODECS()
+{
+    static const std::string value("messaging/compression-interface-codecs");
+    return value;
+}
+
 BrokerUrl MessagingSettings::getBrokerUrl() const
 {
     return BrokerUrl(_settings.get<std::string>(SETTING_BROKER_URL()));
@@ -523,6 +592,76 @@ void MessagingSettings::setDiscardUnroutableRepliesAndPublications(
                   discardUnRoutableRepliesAndPublications);
 }
 
+std::uint32_t MessagingSettings::getSubscriptionSchedulerThreads() const
+{
+    return _settings.get<std::uint32_t>(SETTING_SUBSCRIPTION_SCHEDULER_THREADS());
+}
+
+void MessagingSettings::setSubscriptionSchedulerThreads(std::uint32_t subscriptionSchedulerThreads)
+{
+    _settings.set(SETTING_SUBSCRIPTION_SCHEDULER_THREADS(), subscriptionSchedulerThreads);
+}
+
+std::uint32_t MessagingSettings::getIoServiceThreads() const
+{
+    return _settings.get<std::uint32_t>(SETTING_IO_SERVICE_THREADS());
+}
+
+void MessagingSettings::setIoServiceThreads(std::uint32_t ioServiceThreads)
+{
+    _settings.set(SETTING_IO_SERVICE_THREADS(), ioServiceThreads);
+}
+
+std::string MessagingSettings::getCompressionCodec() const
+{
+    return _settings.get<std::string>(SETTING_COMPRESSION_CODEC());
+}
+
+void MessagingSettings::setCompressionCodec(const std::string& compressionCodec)
+{
+    _settings.set(SETTING_COMPRESSION_CODEC(), compressionCodec);
+}
+
+std::uint32_t MessagingSettings::getCompressionMinSize() const
+{
+    return _settings.get<std::uint32_t>(SETTING_COMPRESSION_MIN_SIZE());
+}
+
+void MessagingSettings::setCompressionMinSize(std::uint32_t compressionMinSize)
+{
+    _settings.set(SETTING_COMPRESSION_MIN_SIZE(), compressionMinSize);
+}
+
+std::int32_t MessagingSettings::getCompressionZstdLevel() const
+{
+    return _settings.get<std::int32_t>(SETTING_COMPRESSION_ZSTD_LEVEL());
+}
+
+void MessagingSettings::setCompressionZstdLevel(std::int32_t compressionZstdLevel)
+{
+    _settings.set(SETTING_COMPRESSION_ZSTD_LEVEL(), compressionZstdLevel);
+}
+
+std::string MessagingSettings::getCompressionDictionaries() const
+{
+    return _settings.get<std::string>(SETTING_COMPRESSION_DICTIONARIES());
+}
+
+void MessagingSettings::setCompressionDictionaries(const std::string& compressionDictionaries)
+{
+    _settings.set(SETTING_COMPRESSION_DICTIONARIES(), compressionDictionaries);
+}
+
+std::string MessagingSettings::getCompressionInterfaceCodecs() const
+{
+    return _settings.get<std::string>(SETTING_COMPRESSION_INTERFACE_CODECS());
+}
+
+void MessagingSettings::setCompressionInterfaceCodecs(const std::string& compressionInterfaceCodecs)
+{
+    _settings.set(SETTING_COMPRESSION_INTERFACE_CODECS(), compressionInterfaceCodecs);
+}
+
 bool MessagingSettings::contains(const std::string& key) const
 {
     return _settings.contains(key);
@@ -594,6 +733,45 @@ void MessagingSettings::checkSettings()
         _settings.set(SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS(),
                       DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS());
     }
+    if (!_settings.contains(SETTING_SUBSCRIPTION_SCHEDULER_THREADS())) {
+        _settings.set(SETTING_SUBSCRIPTION_SCHEDULER_THREADS(),
+                      DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS());
+    } else {
+        // the scheduler's thread pool takes the number of threads as std::uint8_t
+        const std::uint32_t threads = getSubscriptionSchedulerThreads();
+        if (threads == 0 || threads > std::numeric_limits<std::uint8_t>::max()) {
+            JOYNR_LOG_WARN(logger(),
+                           "Invalid value {} for {}, using default {}",
+                           threads,
+                           SETTING_SUBSCRIPTION_SCHEDULER_THREADS(),
+                           DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS());
+            setSubscriptionSchedulerThreads(DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS());
+        }
+    }
+    if (!_settings.contains(SETTING_IO_SERVICE_THREADS())) {
+        _settings.set(SETTING_IO_SERVICE_THREADS(), DEFAULT_IO_SERVICE_THREADS());
+    } else if (getIoServiceThreads() == 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "Invalid value 0 for {}, using default {}",
+                       SETTING_IO_SERVICE_THREADS(),
+                       DEFAULT_IO_SERVICE_THREADS());
+        setIoServiceThreads(DEFAULT_IO_SERVICE_THREADS());
+    }
+    if (!_settings.contains(SETTING_COMPRESSION_CODEC())) {
+        _settings.set(SETTING_COMPRESSION_CODEC(), DEFAULT_COMPRESSION_CODEC());
+    }
+    if (!_settings.contains(SETTING_COMPRESSION_MIN_SIZE())) {
+        _settings.set(SETTING_COMPRESSION_MIN_SIZE(), DEFAULT_COMPRESSION_MIN_SIZE());
+    }
+    if (!_settings.contains(SETTING_COMPRESSION_ZSTD_LEVEL())) {
+        _settings.set(SETTING_COMPRESSION_ZSTD_LEVEL(), DEFAULT_COMPRESSION_ZSTD_LEVEL());
+    }
+    if (!_settings.contains(SETTING_COMPRESSION_DICTIONARIES())) {
+        _settings.set(SETTING_COMPRESSION_DICTIONARIES(), std::string());
+    }
+    if (!_settings.contains(SETTING_COMPRESSION_INTERFACE_CODECS())) {
+        _settings.set(SETTING_COMPRESSION_INTERFACE_CODECS(), std::string());
+    }
 
     if (!checkMultipleBackendsSettings()) {
         const std::string message =
@@ -786,6 +964,30 @@ void MessagingSettings::printSettings() const
             "SETTING: {} = {}",
             SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS(),
             _settings.get<std::string>(SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS()));
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_SUBSCRIPTION_SCHEDULER_THREADS(),
+                   getSubscriptionSchedulerThreads());
+    JOYNR_LOG_INFO(
+            logger(), "SETTING: {} = {}", SETTING_IO_SERVICE_THREADS(), getIoServiceThreads());
+    JOYNR_LOG_INFO(
+            logger(), "SETTING: {} = {}", SETTING_COMPRESSION_CODEC(), getCompressionCodec());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_COMPRESSION_MIN_SIZE(),
+                   getCompressionMinSize());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_COMPRESSION_ZSTD_LEVEL(),
+                   getCompressionZstdLevel());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_COMPRESSION_DICTIONARIES(),
+                   getCompressionDictionaries());
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_COMPRESSION_INTERFACE_CODECS(),
+                   getCompressionInterfaceCodecs());
     printAdditionalBackendsSettings();
 }
 
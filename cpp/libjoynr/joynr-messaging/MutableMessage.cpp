@@ -24,8 +24,10 @@
 #include <smrf/MessageSerializer.h>
 
 #include "joynr/IKeychain.h"
+#include "joynr/ICompressionCodec.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Message.h"
+#include "joynr/MessageCompression.h"
 #include "joynr/Util.h"
 
 namespace joynr
@@ -44,16 +46,36 @@ MutableMessage::MutableMessage()
           payload(),
           _localMessage(false),
           _encrypt(false),
-          _compress(false)
+          _compress(false),
+          _compressionCodec()
 {
 }
 
 std::unique_ptr<ImmutableMessage> MutableMessage::getImmutableMessage() const
 {
     smrf::MessageSerializer messageSerializer;
+    smrf::ByteArrayView payloadView(
+            reinterpret_cast<smrf::Byte*>(const_cast<char*>(payload.data())), payload.size());
+
+    // gzip is built into smrf, bodies compressed by other codecs are flagged by a header
+    std::string compressionCodec;
+    smrf::ByteVector compressedPayload;
+    if (_compress) {
+        compressionCodec =
+                MessageCompression::instance().selectCodec(_compressionCodec, payload.size());
+    }
+    if (!compressionCodec.empty() && compressionCodec != MessageCompression::GZIP()) {
+        auto codec = MessageCompression::instance().getCodec(compressionCodec);
+        if (codec) {
+            compressedPayload = codec->compress(payloadView);
+            payloadView = smrf::ByteArrayView(compressedPayload);
+        } else {
+            compressionCodec.clear();
+        }
+    }
 
     // propagate flags
-    messageSerializer.setCompressed(_compress);
+    messageSerializer.setCompressed(compressionCodec == MessageCompression::GZIP());
 
     // explicit headers
     messageSerializer.setSender(sender);
@@ -61,7 +83,10 @@ std::unique_ptr<ImmutableMessage> MutableMessage::getImmutableMessage() const
     messageSerializer.setTtlMs(_expiryDate.toMilliseconds());
 
     // key-value pair headers
+    // type, id, replyTo, effort and compression codec
+    constexpr std::size_t maxNumberOfKeyValuePairHeaders = 5;
     std::unordered_map<std::string, std::string> keyValuePairHeaders;
+    keyValuePairHeaders.reserve(maxNumberOfKeyValuePairHeaders + customHeaders.size());
     keyValuePairHeaders.insert({Message::HEADER_TYPE(), type});
     keyValuePairHeaders.insert({Message::HEADER_ID(), id});
 
@@ -71,11 +96,12 @@ std::unique_ptr<ImmutableMessage> MutableMessage::getImmutableMessage() const
     if (_effort) {
         keyValuePairHeaders.insert({Message::HEADER_EFFORT(), *_effort});
     }
+    if (!compressionCodec.empty() && compressionCodec != MessageCompression::GZIP()) {
+        keyValuePairHeaders.insert({Message::HEADER_COMPRESSION_CODEC(), compressionCodec});
+    }
     keyValuePairHeaders.insert(customHeaders.cbegin(), customHeaders.cend());
     messageSerializer.setHeaders(keyValuePairHeaders);
 
-    smrf::ByteArrayView payloadView(
-            reinterpret_cast<smrf::Byte*>(const_cast<char*>(payload.data())), payload.size());
     messageSerializer.setBody(payloadView);
 
     if (_keyChain) {
@@ -215,6 +241,16 @@ bool MutableMessage::getCompress() const
     return _compress;
 }
 
+void MutableMessage::setCompressionCodec(const std::string& compressionCodec)
+{
+    this->_compressionCodec = compressionCodec;
+}
+
+const std::string& MutableMessage::getCompressionCodec() const
+{
+    return _compressionCodec;
+}
+
 void MutableMessage::setEffort(std::string&& effort)
 {
     this->_effort = std::move(effort);
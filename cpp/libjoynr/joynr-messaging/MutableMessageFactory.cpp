@@ -84,6 +84,42 @@ MutableMessage MutableMessageFactory::createReply(
     return msg;
 }
 
+MutableMessage MutableMessageFactory::createBatchRequest(const std::string& senderId,
+                                                         const std::string& receiverId,
+                                                         const MessagingQos& qos,
+                                                         const std::vector<Request>& payload,
+                                                         bool isLocalMessage) const
+{
+    MutableMessage msg;
+    msg.setType(Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST());
+    // the id of the first request identifies the batch in traces
+    if (!payload.empty()) {
+        msg.setCustomHeader(
+                Message::CUSTOM_HEADER_REQUEST_REPLY_ID(), payload.front().getRequestReplyId());
+    }
+    msg.setLocalMessage(isLocalMessage);
+    initMsg(msg, senderId, receiverId, qos, joynr::serializer::serializeToJson(payload));
+    return msg;
+}
+
+MutableMessage MutableMessageFactory::createBatchReply(
+        const std::string& senderId,
+        const std::string& receiverId,
+        const MessagingQos& qos,
+        std::unordered_map<std::string, std::string>&& prefixedCustomHeaders,
+        const std::vector<Reply>& payload) const
+{
+    MutableMessage msg;
+    msg.setType(Message::VALUE_MESSAGE_TYPE_BATCH_REPLY());
+    if (!payload.empty()) {
+        msg.setCustomHeader(
+                Message::CUSTOM_HEADER_REQUEST_REPLY_ID(), payload.front().getRequestReplyId());
+    }
+    msg.setPrefixedCustomHeaders(std::move(prefixedCustomHeaders));
+    initMsg(msg, senderId, receiverId, qos, joynr::serializer::serializeToJson(payload), false);
+    return msg;
+}
+
 MutableMessage MutableMessageFactory::createOneWayRequest(const std::string& senderId,
                                                           const std::string& receiverId,
                                                           const MessagingQos& qos,
@@ -227,6 +263,7 @@ void MutableMessageFactory::initMsg(MutableMessage& msg,
     // set flags
     msg.setEncrypt(qos.getEncrypt());
     msg.setCompress(qos.getCompress());
+    msg.setCompressionCodec(qos.getCompressionCodec());
 }
 
 } // namespace joynr
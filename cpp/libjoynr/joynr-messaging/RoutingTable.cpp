@@ -150,6 +150,18 @@ void RoutingTable::remove(const std::string& participantId)
     _multiIndexContainer.erase(participantId);
 }
 
+std::vector<routingtable::RoutingEntry> RoutingTable::getPersistableEntries() const
+{
+    std::vector<routingtable::RoutingEntry> result;
+    result.reserve(_multiIndexContainer.size());
+    for (const auto& entry : _multiIndexContainer) {
+        if (dynamic_cast<const InProcessMessagingAddress*>(entry.address.get()) == nullptr) {
+            result.push_back(entry);
+        }
+    }
+    return result;
+}
+
 void RoutingTable::purge()
 {
     bool expiredEntriesFound = false;
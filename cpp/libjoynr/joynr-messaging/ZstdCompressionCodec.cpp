@@ -0,0 +1,140 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "ZstdCompressionCodec.h"
+
+#include <memory>
+#include <stdexcept>
+
+namespace joynr
+{
+
+namespace
+{
+
+// the contexts are not thread safe, they are reused by all codecs of a thread
+ZSTD_CCtx* getCompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(
+            ZSTD_createCCtx(), &ZSTD_freeCCtx);
+    return context.get();
+}
+
+ZSTD_DCtx* getDecompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(
+            ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    return context.get();
+}
+
+void throwOnError(std::size_t result, const std::string& operation)
+{
+    if (ZSTD_isError(result)) {
+        throw std::runtime_error("zstd " + operation + " failed: " + ZSTD_getErrorName(result));
+    }
+}
+
+} // namespace
+
+ZstdCompressionCodec::ZstdCompressionCodec(const std::string& id, std::int32_t level)
+        : _id(id), _level(level), _compressionDictionary(nullptr), _decompressionDictionary(nullptr)
+{
+}
+
+ZstdCompressionCodec::ZstdCompressionCodec(const std::string& id,
+                                           std::int32_t level,
+                                           const std::string& dictionary)
+        : _id(id),
+          _level(level),
+          _compressionDictionary(ZSTD_createCDict(dictionary.data(), dictionary.size(), level)),
+          _decompressionDictionary(ZSTD_createDDict(dictionary.data(), dictionary.size()))
+{
+    if (!_compressionDictionary || !_decompressionDictionary) {
+        ZSTD_freeCDict(_compressionDictionary);
+        ZSTD_freeDDict(_decompressionDictionary);
+        throw std::runtime_error("invalid zstd dictionary for codec " + id);
+    }
+}
+
+ZstdCompressionCodec::~ZstdCompressionCodec()
+{
+    ZSTD_freeCDict(_compressionDictionary);
+    ZSTD_freeDDict(_decompressionDictionary);
+}
+
+const std::string& ZstdCompressionCodec::getId() const
+{
+    return _id;
+}
+
+smrf::ByteVector ZstdCompressionCodec::compress(const smrf::ByteArrayView& data) const
+{
+    ZSTD_CCtx* context = getCompressionContext();
+    if (!context) {
+        throw std::runtime_error("zstd compression context could not be created");
+    }
+    smrf::ByteVector compressed(ZSTD_compressBound(data.size()));
+    std::size_t size;
+    if (_compressionDictionary) {
+        size = ZSTD_compress_usingCDict(context,
+                                        compressed.data(),
+                                        compressed.size(),
+                                        data.data(),
+                                        data.size(),
+                                        _compressionDictionary);
+    } else {
+        size = ZSTD_compressCCtx(
+                context, compressed.data(), compressed.size(), data.data(), data.size(), _level);
+    }
+    throwOnError(size, "compression");
+    compressed.resize(size);
+    return compressed;
+}
+
+smrf::ByteVector ZstdCompressionCodec::decompress(const smrf::ByteArrayView& data) const
+{
+    ZSTD_DCtx* context = getDecompressionContext();
+    if (!context) {
+        throw std::runtime_error("zstd decompression context could not be created");
+    }
+    // the content size is always written by compress, the limit protects against forged sizes
+    constexpr unsigned long long maxContentSize = 1ULL << 30;
+    const unsigned long long contentSize = ZSTD_getFrameContentSize(data.data(), data.size());
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+        contentSize > maxContentSize) {
+        throw std::runtime_error("invalid zstd frame");
+    }
+    smrf::ByteVector decompressed(contentSize);
+    std::size_t size;
+    if (_decompressionDictionary) {
+        size = ZSTD_decompress_usingDDict(context,
+                                          decompressed.data(),
+                                          decompressed.size(),
+                                          data.data(),
+                                          data.size(),
+                                          _decompressionDictionary);
+    } else {
+        size = ZSTD_decompressDCtx(
+                context, decompressed.data(), decompressed.size(), data.data(), data.size());
+    }
+    throwOnError(size, "decompression");
+    decompressed.resize(size);
+    return decompressed;
+}
+
+} // namespace joynr
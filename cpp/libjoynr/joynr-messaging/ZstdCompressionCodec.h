@@ -0,0 +1,67 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef ZSTDCOMPRESSIONCODEC_H
+#define ZSTDCOMPRESSIONCODEC_H
+
+#include <cstdint>
+#include <string>
+
+#include <zstd.h>
+
+#include "joynr/ICompressionCodec.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * zstd codec, optionally with a pre-trained dictionary (see "zstd --train"). Dictionaries pay
+ * off for the small and repetitive JSON bodies of joynr messages, which gzip hardly compresses.
+ * Low levels, e.g. the default 1, are faster than gzip; negative levels trade ratio for speed.
+ */
+class ZstdCompressionCodec : public ICompressionCodec
+{
+public:
+    ZstdCompressionCodec(const std::string& id, std::int32_t level);
+
+    /**
+     * @throws std::runtime_error if the dictionary cannot be loaded
+     */
+    ZstdCompressionCodec(const std::string& id,
+                         std::int32_t level,
+                         const std::string& dictionary);
+
+    ~ZstdCompressionCodec() override;
+
+    const std::string& getId() const override;
+    smrf::ByteVector compress(const smrf::ByteArrayView& data) const override;
+    smrf::ByteVector decompress(const smrf::ByteArrayView& data) const override;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ZstdCompressionCodec);
+
+    const std::string _id;
+    const std::int32_t _level;
+    ZSTD_CDict* _compressionDictionary;
+    ZSTD_DDict* _decompressionDictionary;
+};
+
+} // namespace joynr
+
+#endif // ZSTDCOMPRESSIONCODEC_H
@@ -18,9 +18,12 @@
  */
 #include "joynr/Dispatcher.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 #include "joynr/BroadcastSubscriptionRequest.h"
 #include "joynr/IMessageSender.h"
@@ -32,9 +35,11 @@
 #include "joynr/InterfaceRegistrar.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingQosEffort.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastPublication.h"
 #include "joynr/MulticastSubscriptionRequest.h"
 #include "joynr/OneWayRequest.h"
+#include "joynr/PoolAllocator.h"
 #include "joynr/PublicationManager.h"
 #include "joynr/Reply.h"
 #include "joynr/Request.h"
@@ -43,6 +48,7 @@
 #include "joynr/SubscriptionReply.h"
 #include "joynr/SubscriptionRequest.h"
 #include "joynr/SubscriptionStop.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/ThreadPool.h"
 #include "joynr/TimePoint.h"
 #include "joynr/Util.h"
@@ -55,6 +61,31 @@
 namespace joynr
 {
 
+namespace
+{
+
+// collects the replies to the requests of a batch request until all of them are answered
+struct BatchReplyCollector {
+    explicit BatchReplyCollector(std::size_t numberOfRequests)
+            : mutex(), replies(numberOfRequests), outstandingReplies(numberOfRequests)
+    {
+    }
+
+    // returns true for the last outstanding reply
+    bool add(std::size_t index, Reply&& reply)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        replies[index] = std::move(reply);
+        return --outstandingReplies == 0;
+    }
+
+    std::mutex mutex;
+    std::vector<Reply> replies;
+    std::size_t outstandingReplies;
+};
+
+} // namespace
+
 Dispatcher::Dispatcher(std::shared_ptr<IMessageSender> messageSender,
                        boost::asio::io_service& ioService)
         : std::enable_shared_from_this<Dispatcher>(),
@@ -64,12 +95,23 @@ Dispatcher::Dispatcher(std::shared_ptr<IMessageSender> messageSender,
           _replyCallerDirectory("Dispatcher-ReplyCallerDirectory", ioService),
           _publicationManager(),
           _subscriptionManager(nullptr),
-          _handleReceivedMessageThreadPool(std::make_shared<ThreadPool>("Dispatcher", 1)),
+          _handleReceivedMessageThreadPool(std::make_shared<ThreadPool>(
+                  ThreadConfiguration::DISPATCHER(),
+                  static_cast<std::uint8_t>(std::min<std::uint32_t>(
+                          ThreadConfiguration::instance().getNumberOfThreads(
+                                  ThreadConfiguration::DISPATCHER(), 1),
+                          255)))),
           _subscriptionHandlingMutex(),
           _isShuttingDown(false),
           _isShuttingDownLock(),
           _replyCallerDirectoryPurgeTimer(ioService),
-          _replyCallerDirectoryPurgeTimerPeriodMs(std::chrono::milliseconds(60000))
+          _replyCallerDirectoryPurgeTimerPeriodMs(std::chrono::milliseconds(60000)),
+          _receiveQueueDepth(MetricsRegistry::instance().getGauge(
+                  "joynr_dispatcher_receive_queue_depth",
+                  "Number of received messages waiting for the dispatcher thread")),
+          _receiveQueueingLatency(MetricsRegistry::instance().getHistogram(
+                  "joynr_dispatcher_receive_queueing_seconds",
+                  "Time received messages wait for the dispatcher thread"))
 {
     _handleReceivedMessageThreadPool->init();
 }
@@ -189,10 +231,18 @@ void Dispatcher::receive(std::shared_ptr<ImmutableMessage> message)
     // we only support non-encrypted messages for now
     assert(!message->isEncrypted());
     std::shared_ptr<ReceivedMessageRunnable> receivedMessageRunnable =
-            std::make_shared<ReceivedMessageRunnable>(std::move(message), shared_from_this());
+            util::makePooledShared<ReceivedMessageRunnable>(std::move(message), shared_from_this());
+    _receiveQueueDepth->add(1);
     _handleReceivedMessageThreadPool->execute(receivedMessageRunnable);
 }
 
+void Dispatcher::onReceivedMessageDequeued(std::chrono::steady_clock::time_point enqueueTime)
+{
+    _receiveQueueDepth->add(-1);
+    _receiveQueueingLatency->record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - enqueueTime));
+}
+
 void Dispatcher::handleRequestReceived(std::shared_ptr<ImmutableMessage> message)
 {
     ReadLocker locker(_isShuttingDownLock);
@@ -255,6 +305,7 @@ void Dispatcher::handleRequestReceived(std::shared_ptr<ImmutableMessage> message
             const std::chrono::milliseconds ttl = requestExpiryDate.relativeFromNow();
             MessagingQos messagingQos(static_cast<std::uint64_t>(ttl.count()));
             messagingQos.setCompress(message->isCompressed());
+            messagingQos.setCompressionCodec(message->getCompressionCodec());
             const boost::optional<std::string> effort = message->getEffort();
             if (effort) {
                 try {
@@ -294,6 +345,7 @@ void Dispatcher::handleRequestReceived(std::shared_ptr<ImmutableMessage> message
             const std::chrono::milliseconds ttl = requestExpiryDate.relativeFromNow();
             MessagingQos messagingQos(static_cast<std::uint64_t>(ttl.count()));
             messagingQos.setCompress(message->isCompressed());
+            messagingQos.setCompressionCodec(message->getCompressionCodec());
             thisSharedPtr->_messageSender->sendReply(
                     receiverId, // receiver of the request is sender of reply
                     senderId,   // sender of request is receiver of reply
@@ -309,6 +361,115 @@ void Dispatcher::handleRequestReceived(std::shared_ptr<ImmutableMessage> message
             std::move(caller), request, std::move(onSuccess), std::move(onError));
 }
 
+void Dispatcher::handleBatchRequestReceived(std::shared_ptr<ImmutableMessage> message)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "handleBatchRequestReceived cancelled, shutting down");
+        return;
+    }
+    std::string senderId = message->getSender();
+    std::string receiverId = message->getRecipient();
+
+    std::shared_ptr<RequestCaller> caller = _requestCallerDirectory.lookup(receiverId);
+    if (!caller) {
+        JOYNR_LOG_ERROR(
+                logger(),
+                "caller not found in the RequestCallerDirectory for receiverId {}, ignoring",
+                receiverId);
+        return;
+    }
+
+    const std::string& interfaceName = caller->getInterfaceName();
+    std::shared_ptr<IRequestInterpreter> requestInterpreter =
+            InterfaceRegistrar::instance().getRequestInterpreter(
+                    interfaceName + std::to_string(caller->getProviderVersion().getMajorVersion()));
+    if (!requestInterpreter) {
+        JOYNR_LOG_ERROR(logger(), "requestInterpreter not found for interface {}", interfaceName);
+        return;
+    }
+
+    std::vector<Request> requests;
+    try {
+        joynr::serializer::deserializeFromJson(requests, message->getUnencryptedBody());
+    } catch (const std::invalid_argument& e) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Unable to deserialize batch request object from: {} - error: {}",
+                        message->toLogMessage(),
+                        e.what());
+        return;
+    }
+    if (requests.empty()) {
+        JOYNR_LOG_WARN(logger(), "Ignoring empty batch request: {}", message->getTrackingInfo());
+        return;
+    }
+
+    // all replies are sent back in one message as soon as the last request is answered
+    auto collector = std::make_shared<BatchReplyCollector>(requests.size());
+    TimePoint requestExpiryDate = message->getExpiryDate();
+    auto sendBatchReply = [collector,
+                           requestExpiryDate,
+                           thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                           senderId,
+                           receiverId,
+                           message]() {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            const std::chrono::milliseconds ttl = requestExpiryDate.relativeFromNow();
+            MessagingQos messagingQos(static_cast<std::uint64_t>(ttl.count()));
+            messagingQos.setCompress(message->isCompressed());
+            messagingQos.setCompressionCodec(message->getCompressionCodec());
+            const boost::optional<std::string> effort = message->getEffort();
+            if (effort) {
+                try {
+                    messagingQos.setEffort(MessagingQosEffort::getEnum(*effort));
+                } catch (const std::invalid_argument& e) {
+                    JOYNR_LOG_ERROR(logger(),
+                                    "Batch request message (id: {}) uses invalid effort: {}. "
+                                    "Using default effort for batch reply message.",
+                                    message->getId(),
+                                    *effort);
+                }
+            }
+            // all replies have been added, the collector is not modified anymore
+            thisSharedPtr->_messageSender->sendBatchReply(receiverId,
+                                                          senderId,
+                                                          messagingQos,
+                                                          message->getPrefixedCustomHeaders(),
+                                                          collector->replies);
+        }
+    };
+    locker.unlock();
+
+    JOYNR_LOG_TRACE(logger(),
+                    "Executing batch request with {} requests: {}",
+                    requests.size(),
+                    message->getTrackingInfo());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        const std::string requestReplyId = requests[i].getRequestReplyId();
+        auto onSuccess = [i, requestReplyId, collector, sendBatchReply](Reply&& reply) {
+            reply.setRequestReplyId(requestReplyId);
+            if (collector->add(i, std::move(reply))) {
+                sendBatchReply();
+            }
+        };
+        auto onError = [i, requestReplyId, collector, sendBatchReply](
+                               const std::shared_ptr<exceptions::JoynrException>& exception) {
+            assert(exception);
+            JOYNR_LOG_WARN(logger(),
+                           "Got error '{}' from RequestInterpreter for requestReplyId {}",
+                           exception->getMessage(),
+                           requestReplyId);
+            Reply reply;
+            reply.setRequestReplyId(requestReplyId);
+            reply.setError(exception);
+            if (collector->add(i, std::move(reply))) {
+                sendBatchReply();
+            }
+        };
+        requestInterpreter->execute(caller, requests[i], std::move(onSuccess), std::move(onError));
+    }
+}
+
 void Dispatcher::handleOneWayRequestReceived(std::shared_ptr<ImmutableMessage> message)
 {
     ReadLocker locker(_isShuttingDownLock);
@@ -396,6 +557,46 @@ void Dispatcher::handleReplyReceived(std::shared_ptr<ImmutableMessage> message)
     caller->execute(std::move(reply));
 }
 
+void Dispatcher::handleBatchReplyReceived(std::shared_ptr<ImmutableMessage> message)
+{
+    ReadLocker locker(_isShuttingDownLock);
+    if (_isShuttingDown) {
+        JOYNR_LOG_TRACE(logger(), "handleBatchReplyReceived cancelled, shutting down");
+        return;
+    }
+    std::vector<Reply> replies;
+    try {
+        joynr::serializer::deserializeFromJson(replies, message->getUnencryptedBody());
+    } catch (const std::invalid_argument& e) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Unable to deserialize batch reply object from: {} - error {}",
+                        message->toLogMessage(),
+                        e.what());
+        return;
+    }
+
+    std::vector<std::shared_ptr<IReplyCaller>> callers;
+    callers.reserve(replies.size());
+    for (const Reply& reply : replies) {
+        std::shared_ptr<IReplyCaller> caller =
+                _replyCallerDirectory.take(reply.getRequestReplyId());
+        if (!caller) {
+            JOYNR_LOG_WARN(logger(),
+                           "caller not found in the ReplyCallerDirectory for requestid {}, "
+                           "ignoring",
+                           reply.getRequestReplyId());
+        }
+        callers.push_back(std::move(caller));
+    }
+    locker.unlock();
+
+    for (std::size_t i = 0; i < replies.size(); ++i) {
+        if (callers[i]) {
+            callers[i]->execute(std::move(replies[i]));
+        }
+    }
+}
+
 void Dispatcher::handleSubscriptionRequestReceived(std::shared_ptr<ImmutableMessage> message)
 {
     ReadLocker locker(_isShuttingDownLock);
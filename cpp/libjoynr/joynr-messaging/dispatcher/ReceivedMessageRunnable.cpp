@@ -35,7 +35,8 @@ ReceivedMessageRunnable::ReceivedMessageRunnable(std::shared_ptr<ImmutableMessag
         : Runnable(),
           ObjectWithDecayTime(message->getExpiryDate()),
           _message(std::move(message)),
-          _dispatcher(dispatcher)
+          _dispatcher(dispatcher),
+          _enqueueTime(std::chrono::steady_clock::now())
 {
     JOYNR_LOG_TRACE(logger(),
                     "Creating ReceivedMessageRunnable for message: {}",
@@ -52,11 +53,19 @@ void ReceivedMessageRunnable::run()
         return;
     }
 
-    const std::string& messageType = _message->getType();
+    auto dispatcherSharedPtr = _dispatcher.lock();
+    if (!dispatcherSharedPtr) {
+        JOYNR_LOG_DEBUG(
+                logger(),
+                "Dropping ReceivedMessageRunnable message, because dispatcher not available");
+        return;
+    }
+
+    dispatcherSharedPtr->onReceivedMessageDequeued(_enqueueTime);
 
     JOYNR_LOG_TRACE(logger(),
                     "Running ReceivedMessageRunnable for message type: {}, msg ID: {}",
-                    messageType,
+                    _message->getType(),
                     _message->getId());
     if (isExpired()) {
         const auto now = TimePoint::now();
@@ -66,41 +75,51 @@ void ReceivedMessageRunnable::run()
         return;
     }
 
-    auto dispatcherSharedPtr = _dispatcher.lock();
-    if (!dispatcherSharedPtr) {
-        JOYNR_LOG_DEBUG(
-                logger(),
-                "Dropping ReceivedMessageRunnable message, because dispatcher not available");
-        return;
-    }
-
     JOYNR_LOG_TRACE(logger(), "Setting callContext principal to: {}", _message->getCreator());
     CallContext callContext;
     callContext.setPrincipal(_message->getCreator());
     CallContextStorage::set(std::move(callContext));
 
-    if (messageType == Message::VALUE_MESSAGE_TYPE_REQUEST()) {
+    switch (_message->getMessageType()) {
+    case MessageType::REQUEST:
         dispatcherSharedPtr->handleRequestReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_REPLY()) {
+        break;
+    case MessageType::REPLY:
         dispatcherSharedPtr->handleReplyReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_ONE_WAY()) {
+        break;
+    case MessageType::BATCH_REQUEST:
+        dispatcherSharedPtr->handleBatchRequestReceived(std::move(_message));
+        break;
+    case MessageType::BATCH_REPLY:
+        dispatcherSharedPtr->handleBatchReplyReceived(std::move(_message));
+        break;
+    case MessageType::ONE_WAY:
         dispatcherSharedPtr->handleOneWayRequestReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST()) {
+        break;
+    case MessageType::SUBSCRIPTION_REQUEST:
         dispatcherSharedPtr->handleSubscriptionRequestReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST()) {
+        break;
+    case MessageType::BROADCAST_SUBSCRIPTION_REQUEST:
         dispatcherSharedPtr->handleBroadcastSubscriptionRequestReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+        break;
+    case MessageType::MULTICAST_SUBSCRIPTION_REQUEST:
         dispatcherSharedPtr->handleMulticastSubscriptionRequestReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+        break;
+    case MessageType::SUBSCRIPTION_REPLY:
         dispatcherSharedPtr->handleSubscriptionReplyReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+        break;
+    case MessageType::MULTICAST:
         dispatcherSharedPtr->handleMulticastReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_PUBLICATION()) {
+        break;
+    case MessageType::PUBLICATION:
         dispatcherSharedPtr->handlePublicationReceived(std::move(_message));
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP()) {
+        break;
+    case MessageType::SUBSCRIPTION_STOP:
         dispatcherSharedPtr->handleSubscriptionStopReceived(std::move(_message));
-    } else {
-        JOYNR_LOG_ERROR(logger(), "unknown message type: {}", messageType);
+        break;
+    case MessageType::UNKNOWN:
+        JOYNR_LOG_ERROR(logger(), "unknown message type: {}", _message->getType());
+        break;
     }
 
     CallContextStorage::invalidate();
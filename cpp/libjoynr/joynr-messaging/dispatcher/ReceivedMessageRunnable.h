@@ -19,6 +19,7 @@
 #ifndef RECEIVEDMESSAGERUNNABLE_H
 #define RECEIVEDMESSAGERUNNABLE_H
 
+#include <chrono>
 #include <memory>
 
 #include "joynr/Logger.h"
@@ -51,6 +52,7 @@ private:
     DISALLOW_COPY_AND_ASSIGN(ReceivedMessageRunnable);
     std::shared_ptr<ImmutableMessage> _message;
     std::weak_ptr<Dispatcher> _dispatcher;
+    const std::chrono::steady_clock::time_point _enqueueTime;
     ADD_LOGGER(ReceivedMessageRunnable)
 };
 
@@ -24,6 +24,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -64,6 +65,8 @@ class IMessagingStubFactory;
 class IMulticastAddressCalculator;
 class ITransportStatus;
 class ImmutableMessage;
+class LatencyHistogram;
+class MetricsGauge;
 class ThreadPoolDelayedScheduler;
 
 /**
@@ -81,6 +84,13 @@ public:
                                bool isGloballyVisible);
     virtual void setToKnown(const std::string& participantId) override;
 
+    /**
+     * Adds the next hops one by one with addNextHop. Subclasses which are able to add them at
+     * once override this.
+     */
+    void addNextHops(std::vector<NextHop> nextHops,
+                     std::function<void(const std::vector<bool>& added)> onResult) override;
+
     virtual void init();
     std::uint64_t getNumberOfRoutedMessages() const;
     void removeRoutingEntries(std::shared_ptr<const joynr::system::RoutingTypes::Address> address);
@@ -137,7 +147,7 @@ protected:
                                std::uint32_t tryCount) = 0;
 
     void sendQueuedMessages(
-            std::shared_ptr<const joynr::system::RoutingTypes::Address> address) final;
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> address) override;
 
     void sendQueuedMessages(const std::string& destinationPartId,
                             std::shared_ptr<const joynr::system::RoutingTypes::Address> address,
@@ -164,6 +174,32 @@ protected:
                            const std::int64_t expiryDateMs,
                            const bool isSticky);
 
+    /**
+     * Adds all next hops to the routing table while holding the write lock of the routing table
+     * only once.
+     * @return one flag per next hop which tells whether it has been added
+     */
+    std::vector<bool> addToRoutingTable(const std::vector<NextHop>& nextHops);
+
+    /**
+     * Sends the queued messages of all added next hops. messageQueueRetryWriteLock is released
+     * before the messages are sent.
+     */
+    void sendQueuedMessages(const std::vector<NextHop>& nextHops,
+                            const std::vector<bool>& added,
+                            WriteLocker&& messageQueueRetryWriteLock);
+
+    /**
+     * @return true if the routing table contains an entry for participantId which would not
+     * be changed by addToRoutingTable with the same parameters. Only a read lock of the
+     * routing table is taken.
+     */
+    bool isRoutingEntryUpToDate(const std::string& participantId,
+                                const joynr::system::RoutingTypes::Address& address,
+                                bool isGloballyVisible,
+                                std::int64_t expiryDateMs,
+                                bool isSticky);
+
     void activateMessageCleanerTimer();
     void activateRoutingTableCleanerTimer();
     void registerTransportStatusCallbacks();
@@ -175,6 +211,7 @@ protected:
     virtual void queueMessage(std::shared_ptr<ImmutableMessage> message,
                               ReadLocker& messageQueueRetryReadLock);
     void onMsgsDropped(std::deque<std::shared_ptr<ImmutableMessage>>& droppedMessages);
+    void updateMessageQueueDepthMetric();
     /*
      * return always true in libjoynr and result accessControlChecked for the CCMessageRouter
      */
@@ -220,12 +257,20 @@ protected:
     std::vector<std::shared_ptr<ITransportStatus>> _transportStatuses;
     bool _printRoutedMessages;
     std::uint32_t _routedMessagePrintIntervalS;
+    std::shared_ptr<MetricsGauge> _messageQueueDepth;
+    std::shared_ptr<LatencyHistogram> _messageRunnableLatency;
 
 private:
     DISALLOW_COPY_AND_ASSIGN(AbstractMessageRouter);
     ADD_LOGGER(AbstractMessageRouter)
 
     void checkExpiryDate(const ImmutableMessage& message);
+    bool addToRoutingTable(std::string participantId,
+                           bool isGloballyVisible,
+                           std::shared_ptr<const joynr::system::RoutingTypes::Address> address,
+                           std::int64_t expiryDateMs,
+                           bool isSticky,
+                           const WriteLocker& routingTableWriteLock);
     AddressUnorderedSet lookupAddresses(const std::unordered_set<std::string>& participantIds);
     std::atomic<bool> _isShuttingDown;
     std::atomic<std::uint64_t> _numberOfRoutedMessages;
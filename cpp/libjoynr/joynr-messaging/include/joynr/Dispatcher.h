@@ -19,6 +19,7 @@
 #ifndef DISPATCHER_H
 #define DISPATCHER_H
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -38,7 +39,9 @@ class IMessageSender;
 class IReplyCaller;
 class ISubscriptionManager;
 class ImmutableMessage;
+class LatencyHistogram;
 class MessagingQos;
+class MetricsGauge;
 class PublicationManager;
 class RequestCaller;
 class ThreadPool;
@@ -77,6 +80,8 @@ private:
     void handleRequestReceived(std::shared_ptr<ImmutableMessage> message);
     void handleOneWayRequestReceived(std::shared_ptr<ImmutableMessage> message);
     void handleReplyReceived(std::shared_ptr<ImmutableMessage> message);
+    void handleBatchRequestReceived(std::shared_ptr<ImmutableMessage> message);
+    void handleBatchReplyReceived(std::shared_ptr<ImmutableMessage> message);
     void handleMulticastReceived(std::shared_ptr<ImmutableMessage> message);
     void handlePublicationReceived(std::shared_ptr<ImmutableMessage> message);
     void handleSubscriptionRequestReceived(std::shared_ptr<ImmutableMessage> message);
@@ -84,6 +89,7 @@ private:
     void handleSubscriptionStopReceived(std::shared_ptr<ImmutableMessage> message);
     void handleSubscriptionReplyReceived(std::shared_ptr<ImmutableMessage> message);
     void handleMulticastSubscriptionRequestReceived(std::shared_ptr<ImmutableMessage> message);
+    void onReceivedMessageDequeued(std::chrono::steady_clock::time_point enqueueTime);
 
 private:
     DISALLOW_COPY_AND_ASSIGN(Dispatcher);
@@ -98,6 +104,8 @@ private:
     ReadWriteLock _isShuttingDownLock;
     SteadyTimer _replyCallerDirectoryPurgeTimer;
     const std::chrono::milliseconds _replyCallerDirectoryPurgeTimerPeriodMs;
+    std::shared_ptr<MetricsGauge> _receiveQueueDepth;
+    std::shared_ptr<LatencyHistogram> _receiveQueueingLatency;
 
     ADD_LOGGER(Dispatcher)
 
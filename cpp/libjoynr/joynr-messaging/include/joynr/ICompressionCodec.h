@@ -0,0 +1,57 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef ICOMPRESSIONCODEC_H
+#define ICOMPRESSIONCODEC_H
+
+#include <string>
+
+#include <smrf/ByteArrayView.h>
+#include <smrf/ByteVector.h>
+
+namespace joynr
+{
+
+/**
+ * Compresses message bodies. The id of the codec is sent in the header of every message
+ * compressed by it, so sender and receiver must register a codec with the same id and, for
+ * codecs using a dictionary, the same dictionary.
+ *
+ * Implementations must be thread safe.
+ */
+class ICompressionCodec
+{
+public:
+    virtual ~ICompressionCodec() = default;
+
+    virtual const std::string& getId() const = 0;
+
+    /**
+     * @throws std::runtime_error if the data cannot be compressed
+     */
+    virtual smrf::ByteVector compress(const smrf::ByteArrayView& data) const = 0;
+
+    /**
+     * @throws std::runtime_error if the data is corrupt
+     */
+    virtual smrf::ByteVector decompress(const smrf::ByteArrayView& data) const = 0;
+};
+
+} // namespace joynr
+
+#endif // ICOMPRESSIONCODEC_H
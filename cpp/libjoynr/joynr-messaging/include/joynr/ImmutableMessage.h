@@ -20,7 +20,9 @@
 #ifndef IMMUTABLEMESSAGE_H
 #define IMMUTABLEMESSAGE_H
 
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -28,7 +30,9 @@
 #include <smrf/ByteVector.h>
 #include <smrf/MessageDeserializer.h>
 
+#include "joynr/InFlightBudget.h"
 #include "joynr/Logger.h"
+#include "joynr/Message.h"
 #include "joynr/TimePoint.h"
 #include "joynr/serializer/Serializer.h"
 
@@ -38,6 +42,7 @@ namespace joynr
 struct RequiredHeaders {
     std::string id;
     std::string type;
+    MessageType messageType = MessageType::UNKNOWN;
     static constexpr std::size_t NUM_REQUIRED_HEADERS = 2;
 };
 
@@ -70,12 +75,22 @@ public:
 
     bool isCompressed() const;
 
+    /**
+     * @return the codec the body is compressed with, empty if the body is not compressed
+     */
+    std::string getCompressionCodec() const;
+
     smrf::ByteArrayView getUnencryptedBody() const;
 
     std::string toLogMessage() const;
 
     const std::string& getType() const;
 
+    /**
+     * @return the type decoded from the type header, cheaper to compare than getType()
+     */
+    MessageType getMessageType() const;
+
     const std::string& getId() const;
 
     boost::optional<std::string> getReplyTo() const;
@@ -135,6 +150,21 @@ public:
     bool isAccessControlChecked() const;
     void setAccessControlChecked();
 
+    /**
+     * @brief Keeps the credit of the client connection the message has been received from
+     * until releaseInFlightCredit() is called or the message is destroyed.
+     * @see InFlightBudget
+     */
+    void setInFlightCredit(InFlightBudget::Credit credit);
+
+    /**
+     * @brief Returns the credit of the client connection before the message is destroyed, i.e.
+     * when the message is handed to a transport or parked in a message queue, so that parked
+     * messages do not pause the connection. May be called concurrently, e.g. for the
+     * destinations of a multicast.
+     */
+    void releaseInFlightCredit();
+
 private:
     boost::optional<std::string> getOptionalHeaderByKey(const std::string& key) const;
 
@@ -154,6 +184,9 @@ private:
 
     std::string creator;
     RequiredHeaders _requiredHeaders;
+    // transient as well, returned to the budget of the connection with the last reference
+    InFlightBudget::Credit _inFlightCredit;
+    std::atomic<bool> _isInFlightCreditReleased;
     ADD_LOGGER(ImmutableMessage)
 };
 
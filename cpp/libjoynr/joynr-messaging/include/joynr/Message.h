@@ -20,11 +20,32 @@
 #ifndef MESSAGE_H
 #define MESSAGE_H
 
+#include <cstdint>
 #include <string>
 
 namespace joynr
 {
 
+/**
+ * Message type decoded once from the type header, see Message::VALUE_MESSAGE_TYPE_*().
+ * Routing and dispatching decisions use it instead of comparing the type strings.
+ */
+enum class MessageType : std::uint8_t {
+    UNKNOWN,
+    ONE_WAY,
+    REPLY,
+    REQUEST,
+    BATCH_REQUEST,
+    BATCH_REPLY,
+    PUBLICATION,
+    MULTICAST,
+    SUBSCRIPTION_REPLY,
+    SUBSCRIPTION_REQUEST,
+    MULTICAST_SUBSCRIPTION_REQUEST,
+    BROADCAST_SUBSCRIPTION_REQUEST,
+    SUBSCRIPTION_STOP
+};
+
 class Message
 {
 public:
@@ -66,6 +87,13 @@ public:
         return value;
     }
 
+    // codec of a body compressed by a MessageCompression codec, only understood by C++ runtimes
+    static const std::string& HEADER_COMPRESSION_CODEC()
+    {
+        static const std::string value("co");
+        return value;
+    }
+
     static const std::string& CUSTOM_HEADER_REQUEST_REPLY_ID()
     {
         static const std::string value("z4");
@@ -96,6 +124,28 @@ public:
         return value;
     }
 
+    // payload is a JSON array of requests to the same provider, only understood by C++ runtimes
+    static const std::string& VALUE_MESSAGE_TYPE_BATCH_REQUEST()
+    {
+        static const std::string value("rqs");
+        return value;
+    }
+
+    // payload is a JSON array with one reply for each request of a batch request
+    static const std::string& VALUE_MESSAGE_TYPE_BATCH_REPLY()
+    {
+        static const std::string value("rps");
+        return value;
+    }
+
+    // name of the ProviderQos custom parameter by which a provider declares that it accepts
+    // batch requests, the value must be "true"
+    static const std::string& CUSTOM_PARAMETER_BATCH_REQUESTS()
+    {
+        static const std::string value("___joynr.BatchRequests___");
+        return value;
+    }
+
     static const std::string& VALUE_MESSAGE_TYPE_PUBLICATION()
     {
         static const std::string value("p");
@@ -136,6 +186,55 @@ public:
         static const std::string value("sst");
         return value;
     }
+
+    /**
+     * @return the MessageType of the value of the type header, MessageType::UNKNOWN for
+     * unknown values
+     */
+    static MessageType decodeMessageType(const std::string& type)
+    {
+        // all type values consist of one to three characters
+        switch (type.size()) {
+        case 1:
+            switch (type[0]) {
+            case 'o':
+                return MessageType::ONE_WAY;
+            case 'p':
+                return MessageType::PUBLICATION;
+            case 'm':
+                return MessageType::MULTICAST;
+            }
+            break;
+        case 2:
+            if (type[0] == 'r') {
+                if (type[1] == 'p') {
+                    return MessageType::REPLY;
+                }
+                if (type[1] == 'q') {
+                    return MessageType::REQUEST;
+                }
+            }
+            break;
+        case 3:
+            if (type == VALUE_MESSAGE_TYPE_BATCH_REQUEST()) {
+                return MessageType::BATCH_REQUEST;
+            } else if (type == VALUE_MESSAGE_TYPE_BATCH_REPLY()) {
+                return MessageType::BATCH_REPLY;
+            } else if (type == VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+                return MessageType::SUBSCRIPTION_REPLY;
+            } else if (type == VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST()) {
+                return MessageType::SUBSCRIPTION_REQUEST;
+            } else if (type == VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+                return MessageType::MULTICAST_SUBSCRIPTION_REQUEST;
+            } else if (type == VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST()) {
+                return MessageType::BROADCAST_SUBSCRIPTION_REQUEST;
+            } else if (type == VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP()) {
+                return MessageType::SUBSCRIPTION_STOP;
+            }
+            break;
+        }
+        return MessageType::UNKNOWN;
+    }
 };
 
 } // namespace joynr
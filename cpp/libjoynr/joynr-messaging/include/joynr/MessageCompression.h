@@ -0,0 +1,126 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef MESSAGECOMPRESSION_H
+#define MESSAGECOMPRESSION_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <smrf/ByteArrayView.h>
+#include <smrf/ByteVector.h>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+class ICompressionCodec;
+class MessagingSettings;
+
+/**
+ * Process wide registry and configuration of the codecs compressing message bodies.
+ *
+ * Messages are compressed if the compress flag of their MessagingQos is set and the body is at
+ * least as large as the configured minimum size. The codec is taken from the MessagingQos, from
+ * the codec configured for the interface of the proxy or from the default codec of the runtime.
+ *
+ * The codec GZIP is the body compression built into smrf and is signalled by the compressed
+ * flag of the message. All other codecs are registered here and signalled by the header
+ * Message::HEADER_COMPRESSION_CODEC, which is only understood by C++ runtimes.
+ */
+class JOYNR_EXPORT MessageCompression
+{
+public:
+    /**
+     * This class is currently implemented as a singleton
+     */
+    static MessageCompression& instance();
+
+    static const std::string& GZIP();
+    static const std::string& ZSTD();
+    static const std::string& ZSTD_DICTIONARY_PREFIX();
+
+    /**
+     * Applies the compression settings of the runtime and registers the zstd codecs, if joynr is
+     * built with JOYNR_ENABLE_ZSTD_COMPRESSION. Invalid settings are logged and ignored.
+     */
+    void load(const MessagingSettings& settings);
+
+    /**
+     * Registers a codec, replacing a codec with the same id.
+     */
+    void registerCodec(std::shared_ptr<const ICompressionCodec> codec);
+
+    /**
+     * @return the codec with the given id or nullptr if it is not registered
+     */
+    std::shared_ptr<const ICompressionCodec> getCodec(const std::string& codecId) const;
+
+    /**
+     * @return the codec configured for proxies of the given interface, empty if there is none
+     */
+    std::string getInterfaceCodec(const std::string& interfaceName) const;
+
+    /**
+     * @param requestedCodec the codec of the MessagingQos, empty for the default codec
+     * @param bodySize size of the uncompressed body
+     * @return the codec to compress a body with, empty if the body is smaller than the minimum
+     * size. An unknown requested codec is replaced by the default codec.
+     */
+    std::string selectCodec(const std::string& requestedCodec, std::size_t bodySize) const;
+
+    /**
+     * Decompresses the body of a received message.
+     * @throws std::invalid_argument if the codec is not registered
+     * @throws std::runtime_error if the body is corrupt
+     */
+    smrf::ByteVector decompress(const std::string& codecId, const smrf::ByteArrayView& body) const;
+
+    void setDefaultCodec(const std::string& codecId);
+    void setMinimumSize(std::size_t minimumSize);
+    void setInterfaceCodec(const std::string& interfaceName, const std::string& codecId);
+
+    /**
+     * Removes all codecs and restores the defaults - for use in tests.
+     */
+    void reset();
+
+private:
+    MessageCompression();
+    DISALLOW_COPY_AND_ASSIGN(MessageCompression);
+    ADD_LOGGER(MessageCompression)
+
+    static std::map<std::string, std::string> parseAssignments(const std::string& assignments);
+
+    std::unordered_map<std::string, std::shared_ptr<const ICompressionCodec>> _codecs;
+    std::unordered_map<std::string, std::string> _interfaceCodecs;
+    std::string _defaultCodec;
+    std::size_t _minimumSize;
+    mutable std::mutex _mutex;
+};
+
+} // namespace joynr
+
+#endif // MESSAGECOMPRESSION_H
@@ -80,6 +80,13 @@ public:
         return _queueSizeBytes;
     }
 
+    virtual bool containsMessagesFor(const T& key) const
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        const auto& keyIndex = boost::multi_index::get<messagequeuetags::key>(_queue);
+        return keyIndex.find(key) != keyIndex.cend();
+    }
+
     virtual std::deque<std::shared_ptr<ImmutableMessage>> queueMessage(
             const T key,
             std::shared_ptr<ImmutableMessage> message)
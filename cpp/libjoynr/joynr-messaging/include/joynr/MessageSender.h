@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "joynr/IMessageSender.h"
 #include "joynr/JoynrExport.h"
@@ -95,6 +96,13 @@ public:
                      const Request& request,
                      std::shared_ptr<IReplyCaller> callback,
                      bool isLocalMessage) override;
+
+    void sendBatchRequest(const std::string& senderParticipantId,
+                          const std::string& receiverParticipantId,
+                          const MessagingQos& qos,
+                          const std::vector<Request>& requests,
+                          const std::vector<std::shared_ptr<IReplyCaller>>& callbacks,
+                          bool isLocalMessage) override;
     /*
      * Prepares and sends a single message
      */
@@ -112,6 +120,12 @@ public:
                    std::unordered_map<std::string, std::string> prefixedCustomHeaders,
                    const Reply& reply) override;
 
+    void sendBatchReply(const std::string& senderParticipantId,
+                        const std::string& receiverParticipantId,
+                        const MessagingQos& qos,
+                        std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+                        const std::vector<Reply>& replies) override;
+
     void sendSubscriptionRequest(const std::string& senderParticipantId,
                                  const std::string& receiverParticipantId,
                                  const MessagingQos& qos,
@@ -68,6 +68,13 @@ public:
     static const std::string& SETTING_ROUTING_TABLE_CLEANUP_INTERVAL_MS();
 
     static const std::string& SETTING_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS();
+    static const std::string& SETTING_SUBSCRIPTION_SCHEDULER_THREADS();
+    static const std::string& SETTING_IO_SERVICE_THREADS();
+    static const std::string& SETTING_COMPRESSION_CODEC();
+    static const std::string& SETTING_COMPRESSION_MIN_SIZE();
+    static const std::string& SETTING_COMPRESSION_ZSTD_LEVEL();
+    static const std::string& SETTING_COMPRESSION_DICTIONARIES();
+    static const std::string& SETTING_COMPRESSION_INTERFACE_CODECS();
 
     /**
      * @brief SETTING_MAXIMUM_TTL_MS The key used in settings to identifiy the maximum allowed value
@@ -88,6 +95,11 @@ public:
     static std::int64_t DEFAULT_ROUTING_TABLE_CLEANUP_INTERVAL_MS();
     static std::uint64_t DEFAULT_TTL_UPLIFT_MS();
     static bool DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS();
+    static std::uint32_t DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS();
+    static std::uint32_t DEFAULT_IO_SERVICE_THREADS();
+    static const std::string& DEFAULT_COMPRESSION_CODEC();
+    static std::uint32_t DEFAULT_COMPRESSION_MIN_SIZE();
+    static std::int32_t DEFAULT_COMPRESSION_ZSTD_LEVEL();
 
     /**
      * @brief DEFAULT_MAXIMUM_TTL_MS
@@ -169,6 +181,51 @@ public:
     void setDiscardUnroutableRepliesAndPublications(
             const bool& discardUnroutableRepliesAndPublications);
 
+    /**
+     * @brief Number of threads of the scheduler shared by the PublicationManager and the
+     * SubscriptionManager (periodic publications, publication ends and missed publication alerts)
+     */
+    std::uint32_t getSubscriptionSchedulerThreads() const;
+    void setSubscriptionSchedulerThreads(std::uint32_t subscriptionSchedulerThreads);
+
+    /**
+     * @brief Number of threads running the io_service of the runtime (timers and other
+     * asynchronous work which is not bound to a transport)
+     */
+    std::uint32_t getIoServiceThreads() const;
+    void setIoServiceThreads(std::uint32_t ioServiceThreads);
+
+    /**
+     * @brief Codec of messages sent with the compress flag of MessagingQos, see
+     * MessageCompression
+     */
+    std::string getCompressionCodec() const;
+    void setCompressionCodec(const std::string& compressionCodec);
+
+    /**
+     * @brief Messages with a smaller body are sent uncompressed even if the compress flag of
+     * MessagingQos is set
+     */
+    std::uint32_t getCompressionMinSize() const;
+    void setCompressionMinSize(std::uint32_t compressionMinSize);
+
+    std::int32_t getCompressionZstdLevel() const;
+    void setCompressionZstdLevel(std::int32_t compressionZstdLevel);
+
+    /**
+     * @brief zstd dictionaries as comma separated list of <name>=<file>, each dictionary is
+     * registered as codec "zstd-<name>"
+     */
+    std::string getCompressionDictionaries() const;
+    void setCompressionDictionaries(const std::string& compressionDictionaries);
+
+    /**
+     * @brief Codecs of proxies of an interface as comma separated list of <interface>=<codec>,
+     * e.g. "infrastructure/GlobalCapabilitiesDirectory=zstd-gcd"
+     */
+    std::string getCompressionInterfaceCodecs() const;
+    void setCompressionInterfaceCodecs(const std::string& compressionInterfaceCodecs);
+
     bool contains(const std::string& key) const;
 
     bool settingsContainMultipleBackendsConfiguration() const;
@@ -246,6 +246,18 @@ public:
      */
     bool getCompress() const;
 
+    /**
+     * @brief Sets the codec used if the compress flag is set, see MessageCompression
+     * @param compressionCodec the codec id, empty for the default codec of the runtime
+     */
+    void setCompressionCodec(const std::string& compressionCodec);
+
+    /**
+     * @brief Gets the codec used if the compress flag is set
+     * @return the codec id, empty for the default codec of the runtime
+     */
+    const std::string& getCompressionCodec() const;
+
     template <typename Archive>
     void save(Archive& archive)
     {
@@ -284,6 +296,9 @@ private:
 
     /** @brief Specifies whether message will be sent compressed */
     bool _compress;
+
+    /** @brief Codec used if the message is sent compressed */
+    std::string _compressionCodec;
 };
 
 } // namespace joynr
@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "joynr/JoynrExport.h"
 #include "joynr/Logger.h"
@@ -69,6 +70,19 @@ public:
                                std::unordered_map<std::string, std::string>&& prefixedCustomHeaders,
                                const Reply& payload) const;
 
+    MutableMessage createBatchRequest(const std::string& senderId,
+                                      const std::string& receiverId,
+                                      const MessagingQos& qos,
+                                      const std::vector<Request>& payload,
+                                      bool isLocalMessage) const;
+
+    MutableMessage createBatchReply(
+            const std::string& senderId,
+            const std::string& receiverId,
+            const MessagingQos& qos,
+            std::unordered_map<std::string, std::string>&& prefixedCustomHeaders,
+            const std::vector<Reply>& payload) const;
+
     MutableMessage createOneWayRequest(const std::string& senderId,
                                        const std::string& receiverId,
                                        const MessagingQos& qos,
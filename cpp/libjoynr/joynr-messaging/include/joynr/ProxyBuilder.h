@@ -35,6 +35,7 @@
 #include "joynr/IProxyBuilder.h"
 #include "joynr/IRequestCallerDirectory.h"
 #include "joynr/Logger.h"
+#include "joynr/MessageCompression.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingSettings.h"
 #include "joynr/PrivateCopyAssign.h"
@@ -460,8 +461,13 @@ void ProxyBuilder<T>::buildInternalAsync(
         return;
     }
 
+    MessagingQos messagingQos = _messagingQos;
+    if (messagingQos.getCompressionCodec().empty()) {
+        messagingQos.setCompressionCodec(
+                MessageCompression::instance().getInterfaceCodec(T::INTERFACE_NAME()));
+    }
     std::shared_ptr<T> proxy =
-            _proxyFactory.createProxy<T>(runtimeSharedPtr, _domain, _messagingQos);
+            _proxyFactory.createProxy<T>(runtimeSharedPtr, _domain, messagingQos);
     proxy->handleArbitrationFinished(discoveryEntry);
 
     JOYNR_LOG_INFO(logger(),
@@ -189,6 +189,12 @@ public:
      */
     void purge();
 
+    /*
+     * Returns all elements except those with an InProcessMessagingAddress, which is only valid
+     * within the current process
+     */
+    std::vector<routingtable::RoutingEntry> getPersistableEntries() const;
+
     template <typename Archive>
     void save(Archive& archive)
     {
@@ -21,6 +21,112 @@
 #include <array>
 #include <cstdlib>
 #include <tuple>
+#include <vector>
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+#include <spdlog/details/thread_pool.h>
+#include <spdlog/pattern_formatter.h>
+
+#ifdef JOYNR_ENABLE_STDOUT_LOGGING
+#include <spdlog/sinks/stdout_sinks.h>
+#endif // JOYNR_ENABLE_STDOUT_LOGGING
+#ifdef JOYNR_ENABLE_DLT_LOGGING
+#include "joynr/DltSink.h"
+#endif // JOYNR_ENABLE_DLT_LOGGING
+
+namespace
+{
+
+const std::string& logPattern()
+{
+    static const std::string pattern("%Y-%m-%d %H:%M:%S.%e [thread ID:%t] [%l] %n %v");
+    return pattern;
+}
+
+std::vector<spdlog::sink_ptr> createSinks()
+{
+    std::vector<spdlog::sink_ptr> sinks;
+
+#ifdef JOYNR_ENABLE_STDOUT_LOGGING
+    auto sink1 = std::make_shared<spdlog::sinks::stdout_sink_mt>();
+    sink1->set_level(spdlog::level::trace);
+    sinks.push_back(sink1);
+#endif // JOYNR_ENABLE_STDOUT_LOGGING
+
+#ifdef JOYNR_ENABLE_DLT_LOGGING
+    auto sink2 = std::make_shared<joynr::DltSink>();
+    sink2->set_level(spdlog::level::trace);
+    sinks.push_back(sink2);
+#endif // JOYNR_ENABLE_DLT_LOGGING
+
+    return sinks;
+}
+
+/**
+ * Background thread and sinks shared by all asynchronous loggers. The sinks are only written
+ * by the background thread, so their formatters are set once here and never changed.
+ */
+struct AsyncLogBackend {
+    AsyncLogBackend()
+            : threadPool(), overflowPolicy(spdlog::async_overflow_policy::block), sinks()
+    {
+        const char* asyncEnv = std::getenv("JOYNR_LOG_ASYNC");
+        if (asyncEnv == nullptr) {
+            return;
+        }
+        const std::string overflowPolicyName(asyncEnv, strnlen(asyncEnv, 10UL));
+        if (overflowPolicyName == "BLOCK") {
+            overflowPolicy = spdlog::async_overflow_policy::block;
+        } else if (overflowPolicyName == "DROP") {
+            overflowPolicy = spdlog::async_overflow_policy::overrun_oldest;
+        } else {
+            return;
+        }
+
+        std::size_t queueSize = 8192;
+        const char* queueSizeEnv = std::getenv("JOYNR_LOG_ASYNC_QUEUE_SIZE");
+        if (queueSizeEnv != nullptr) {
+            const unsigned long long configuredQueueSize = std::strtoull(queueSizeEnv, nullptr, 10);
+            if (configuredQueueSize > 0) {
+                queueSize = static_cast<std::size_t>(configuredQueueSize);
+            }
+        }
+
+        sinks = createSinks();
+        for (spdlog::sink_ptr& sink : sinks) {
+            sink->set_formatter(std::make_unique<spdlog::pattern_formatter>(
+                    logPattern(), spdlog::pattern_time_type::utc));
+        }
+        // a single thread keeps the order of the messages and serializes the sink writes
+        threadPool = std::make_shared<spdlog::details::thread_pool>(queueSize, 1);
+    }
+
+    // nullptr if logging is synchronous
+    std::shared_ptr<spdlog::details::thread_pool> threadPool;
+    spdlog::async_overflow_policy overflowPolicy;
+    std::vector<spdlog::sink_ptr> sinks;
+};
+
+} // namespace
+
+std::shared_ptr<spdlog::logger> joynr::Logger::createSpdlogLogger(const std::string& prefix)
+{
+    // destroyed after all loggers created later, draining the queue on exit
+    static AsyncLogBackend asyncLogBackend;
+    if (asyncLogBackend.threadPool) {
+        return std::make_shared<spdlog::async_logger>(prefix,
+                                                      begin(asyncLogBackend.sinks),
+                                                      end(asyncLogBackend.sinks),
+                                                      asyncLogBackend.threadPool,
+                                                      asyncLogBackend.overflowPolicy);
+    }
+
+    std::vector<spdlog::sink_ptr> sinks = createSinks();
+    auto logger = std::make_shared<spdlog::logger>(prefix, begin(sinks), end(sinks));
+    logger->set_pattern(logPattern(), spdlog::pattern_time_type::utc);
+    return logger;
+}
 
 joynr::LogLevelInitializer::LogLevelInitializer()
 {
@@ -34,13 +34,6 @@
 #include <boost/type_index.hpp>
 #include <spdlog/spdlog.h>
 
-#ifdef JOYNR_ENABLE_STDOUT_LOGGING
-#include <spdlog/sinks/stdout_sinks.h>
-#endif // JOYNR_ENABLE_STDOUT_LOGGING
-#ifdef JOYNR_ENABLE_DLT_LOGGING
-#include "joynr/DltSink.h"
-#endif // JOYNR_ENABLE_DLT_LOGGING
-
 namespace joynr
 {
 enum class LogLevel { Trace, Debug, Info, Warn, Error, Fatal };
@@ -151,26 +144,22 @@ struct Logger {
         static LogLevelInitializer logLevelInitializer;
         level = logLevelInitializer.level;
         spdlogLevel = logLevelInitializer.spdlogLevel;
-        std::vector<spdlog::sink_ptr> sinks;
-
-#ifdef JOYNR_ENABLE_STDOUT_LOGGING
-        auto sink1 = std::make_shared<spdlog::sinks::stdout_sink_mt>();
-        sink1->set_level(spdlog::level::trace);
-        sinks.push_back(sink1);
-#endif // JOYNR_ENABLE_STDOUT_LOGGING
-
-#ifdef JOYNR_ENABLE_DLT_LOGGING
-        auto sink2 = std::make_shared<joynr::DltSink>();
-        sink2->set_level(spdlog::level::trace);
-        sinks.push_back(sink2);
-#endif // JOYNR_ENABLE_DLT_LOGGING
-
-        spdlog = std::make_shared<spdlog::logger>(prefix, begin(sinks), end(sinks));
-        spdlog->set_pattern(
-                "%Y-%m-%d %H:%M:%S.%e [thread ID:%t] [%l] %n %v", spdlog::pattern_time_type::utc);
+        spdlog = createSpdlogLogger(prefix);
         spdlog->set_level(spdlogLevel);
     }
 
+    /**
+     * Creates the spdlog logger writing to the stdout and DLT sinks (depending on the build
+     * options).
+     *
+     * If the environment variable JOYNR_LOG_ASYNC is set to "BLOCK" or "DROP" when the first
+     * logger is created, all loggers log asynchronously: the logging thread only formats the
+     * message and enqueues it, a single background thread writes it to the sinks. If the queue
+     * (JOYNR_LOG_ASYNC_QUEUE_SIZE entries, default 8192) is full, the logging thread either
+     * waits (BLOCK) or the oldest queued message is dropped (DROP).
+     */
+    static std::shared_ptr<spdlog::logger> createSpdlogLogger(const std::string& prefix);
+
     template <typename Parent>
     static std::string getPrefix()
     {
@@ -24,6 +24,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/Util.h"
 
 #include "UdsFrameBufferV1.h"
@@ -100,7 +101,7 @@ void UdsClient::start()
         return;
     }
     _state.store(State::START);
-    _worker = std::async(&UdsClient::run, this);
+    _worker = std::async(std::launch::async, &UdsClient::run, this);
 }
 
 void UdsClient::shutdown() noexcept
@@ -124,6 +125,7 @@ void UdsClient::shutdown() noexcept
 
 void UdsClient::run()
 {
+    ThreadConfiguration::instance().applyToCurrentThread(ThreadConfiguration::UDS());
     bool isRetry = false;
     while (State::START == _state.load()) {
         if (isRetry) {
@@ -29,6 +29,7 @@
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Logger.h"
 #include "joynr/Message.h"
+#include "joynr/Metrics.h"
 #include "joynr/exceptions/JoynrException.h"
 
 namespace joynr
@@ -44,7 +45,7 @@ void UdsLibJoynrMessagingSkeleton::transmit(
         std::shared_ptr<ImmutableMessage> message,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure)
 {
-    if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+    if (message->getMessageType() == MessageType::MULTICAST) {
         message->setReceivedFromGlobal(true);
     }
 
@@ -66,6 +67,8 @@ void UdsLibJoynrMessagingSkeleton::transmit(
 
 void UdsLibJoynrMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message)
 {
+    static TransportTrafficCounter receivedTraffic("uds", "received");
+    receivedTraffic.count(message.size());
     // deserialize message and transmit
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
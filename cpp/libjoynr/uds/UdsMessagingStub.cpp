@@ -22,6 +22,7 @@
 
 #include "joynr/IUdsSender.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
 #include "joynr/exceptions/JoynrException.h"
 
 namespace joynr
@@ -41,6 +42,8 @@ void UdsMessagingStub::transmit(
     } else {
         JOYNR_LOG_TRACE(logger(), ">>> OUTGOING >>> {}", message->toLogMessage());
     }
+    static TransportTrafficCounter sentTraffic("uds", "sent");
+    sentTraffic.count(message->getMessageSize());
     const smrf::ByteArrayView serializedMessageView(message->getSerializedMessage());
     _udsSender->send(std::move(serializedMessageView), std::move(onFailure));
 }
@@ -19,6 +19,7 @@
 #ifndef UDSSENDQUEUE_H
 #define UDSSENDQUEUE_H
 
+#include <cstddef>
 #include <deque>
 #include <utility>
 
@@ -34,6 +35,9 @@ namespace joynr
 /**
  * @brief Size limited FIFO queue for sending UDS frames using state machine
  *
+ * The queue is limited by the number of frames and optionally by the number of bytes waiting
+ * to be sent, so a slow consumer cannot make the queue grow without bound.
+ *
  * The boolean return values are e.g. true if a new state shall be inserted to
  * corresponding user state machine.
  */
@@ -41,15 +45,22 @@ template <typename FRAME>
 class UdsSendQueue
 {
 public:
-    explicit UdsSendQueue(const std::size_t& maxSize) noexcept
-            : _maxSize{maxSize}, _entryInSendingBuffer{emptyEntry()}
+    /**
+     * @param maxSize Maximum number of queued frames
+     * @param maxBytes Maximum number of queued bytes, 0 disables the limit
+     */
+    explicit UdsSendQueue(const std::size_t& maxSize, const std::size_t& maxBytes = 0) noexcept
+            : _maxSize{maxSize},
+              _maxBytes{maxBytes},
+              _queuedBytes{0},
+              _entryInSendingBuffer{emptyEntry()}
     {
     }
 
     /**
      * Adds a new entry to the end of the queue.
-     * If the maximum size is reached, the current entries are removed, and for each entry the send
-     * failure callback is executed.
+     * If the maximum size or the maximum number of bytes is reached, the current entries are
+     * removed, and for each entry the send failure callback is executed.
      * @param frame Frame to send, byte array will be consumed by call
      * @param callback Callback executed if frame has not been sent and the queue limit is reached.
      * @return True if the queue was empty before the insertion of the new entry.
@@ -60,14 +71,21 @@ public:
                     [](const joynr::exceptions::JoynrRuntimeException&) {})
     {
         const auto previousSize = _buffer.size();
+        const std::size_t frameBytes = boost::asio::buffer_size(frame.raw());
         if (_maxSize <= previousSize) {
             const auto errorMsg =
                     boost::format(
                             "Sending queue size %d exceeded. Rescheduling all queued messages.") %
                     _maxSize;
             emptyQueueAndNotify(true, errorMsg.str());
+        } else if (_maxBytes > 0 && previousSize > 0 && _maxBytes < _queuedBytes + frameBytes) {
+            const auto errorMsg = boost::format("Sending queue limit of %d bytes exceeded. "
+                                                "Rescheduling all queued messages.") %
+                                  _maxBytes;
+            emptyQueueAndNotify(true, errorMsg.str());
         }
         _buffer.push_back(Entry(std::move(frame), callback));
+        _queuedBytes += frameBytes;
         return (previousSize == 0) && !_entryInSendingBuffer.first;
     }
 
@@ -83,6 +101,7 @@ public:
             }
             _entryInSendingBuffer = std::move(_buffer.front());
             _buffer.pop_front();
+            _queuedBytes -= boost::asio::buffer_size(_entryInSendingBuffer.first.raw());
         }
         return _entryInSendingBuffer.first.raw();
     }
@@ -127,6 +146,7 @@ private:
             entry.second(error);
         }
         _buffer.clear();
+        _queuedBytes = 0;
     }
 
     using Entry = std::pair<FRAME, IUdsSender::SendFailed>;
@@ -136,6 +156,9 @@ private:
     }
     std::deque<Entry> _buffer;
     std::size_t _maxSize;
+    std::size_t _maxBytes;
+    // bytes in _buffer, the entry in the sending buffer is not counted
+    std::size_t _queuedBytes;
     Entry _entryInSendingBuffer;
 };
 
@@ -25,6 +25,7 @@
 
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Logger.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/UdsServer.h"
 
 #include "UdsFrameBufferV1.h"
@@ -110,17 +111,25 @@ void UdsServer::setReceiveCallback(const Received& callback)
     }
 }
 
+void UdsServer::setFlowControlLimits(std::size_t maxInFlightMessages,
+                                     std::size_t maxSendQueueBytes)
+{
+    _remoteConfig._maxInFlightMessages = maxInFlightMessages;
+    _remoteConfig._maxSendQueueBytes = maxSendQueueBytes;
+}
+
 void UdsServer::start()
 {
     if (_started.exchange(true)) {
         JOYNR_LOG_ERROR(logger(), "Server already started.");
         return;
     }
-    _worker = std::async(&UdsServer::run, this);
+    _worker = std::async(std::launch::async, &UdsServer::run, this);
 }
 
 void UdsServer::run()
 {
+    ThreadConfiguration::instance().applyToCurrentThread(ThreadConfiguration::UDS());
     bool isRetry = false;
     while (_started.load()) {
         if (isRetry) {
@@ -211,8 +220,10 @@ UdsServer::Connection::Connection(std::shared_ptr<boost::asio::io_service>& ioCo
           _receivedCallback{config._receivedCallback},
           _isClosed{false},
           _username("connection not established"),
-          _sendQueue(std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(config._maxSendQueueSize)),
+          _sendQueue(std::make_unique<UdsSendQueue<UdsFrameBufferV1>>(config._maxSendQueueSize,
+                                                                      config._maxSendQueueBytes)),
           _readBuffer(std::make_unique<UdsFrameBufferV1>()),
+          _inFlightBudget(std::make_shared<InFlightBudget>(config._maxInFlightMessages, "uds")),
           _connectionIndex(connectionIndex)
 {
 }
@@ -379,11 +390,12 @@ void UdsServer::Connection::doReadBody() noexcept
                         try {
                             self->_receivedCallback(self->_address,
                                                     self->_readBuffer->readMessage(),
-                                                    self->_username);
+                                                    self->_username,
+                                                    self->_inFlightBudget->acquire());
                         } catch (const std::exception& e) {
                             self->doClose("Failed to process message", e);
                         }
-                        self->doReadHeader();
+                        self->doReadNextMessage();
                     }
                 });
     } catch (const std::exception& e) {
@@ -391,6 +403,27 @@ void UdsServer::Connection::doReadBody() noexcept
     }
 }
 
+void UdsServer::Connection::doReadNextMessage() noexcept
+{
+    // the budget keeps the resume callback, hence it must not own the connection
+    auto resume = [thisWeakPtr = std::weak_ptr<Connection>(shared_from_this())]() {
+        if (auto self = thisWeakPtr.lock()) {
+            self->_ioContext->post([self]() {
+                if (!self->_isClosed.load()) {
+                    self->doReadHeader();
+                }
+            });
+        }
+    };
+    if (_inFlightBudget->pauseIfExhausted(std::move(resume))) {
+        JOYNR_LOG_DEBUG(logger(),
+                        "Connection index {} paused reading, too many messages in flight.",
+                        _connectionIndex);
+        return;
+    }
+    doReadHeader();
+}
+
 void UdsServer::Connection::doWrite() noexcept
 {
     boost::asio::async_write(_socket,
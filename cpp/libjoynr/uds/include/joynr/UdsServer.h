@@ -29,6 +29,7 @@
 
 #include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/IUdsSender.h"
+#include "joynr/InFlightBudget.h"
 #include "joynr/Logger.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/UdsSettings.h"
@@ -61,9 +62,14 @@ public:
     using Connected = std::function<void(const system::RoutingTypes::UdsClientAddress&,
                                          std::unique_ptr<IUdsSender>)>;
     using Disconnected = std::function<void(const system::RoutingTypes::UdsClientAddress&)>;
+    /**
+     * Receives a message together with a credit of the connection. Reading from the connection
+     * pauses while too many credits are held, see setFlowControlLimits().
+     */
     using Received = std::function<void(const system::RoutingTypes::UdsClientAddress&,
                                         smrf::ByteVector&&,
-                                        const std::string&)>;
+                                        const std::string&,
+                                        InFlightBudget::Credit)>;
 
     explicit UdsServer(const UdsSettings& settings);
     ~UdsServer();
@@ -93,6 +99,16 @@ public:
      */
     void setReceiveCallback(const Received& callback);
 
+    /**
+     * @brief Limits the resources a single client connection may use. Must be called before
+     * start().
+     * @param maxInFlightMessages Maximum number of credits of received messages held at the same
+     * time, reading from the connection pauses if exhausted. 0 disables the limit.
+     * @param maxSendQueueBytes Maximum number of bytes queued for sending to the client,
+     * 0 disables the limit.
+     */
+    void setFlowControlLimits(std::size_t maxInFlightMessages, std::size_t maxSendQueueBytes);
+
     /** Opens an UNIX domain socket asynchronously and starts the IO thread pool. */
     void start();
 
@@ -101,12 +117,15 @@ private:
     // Default config basically does nothing, everything is just eaten
     struct ConnectionConfig {
         std::size_t _maxSendQueueSize = 0;
+        std::size_t _maxSendQueueBytes = 0;
+        std::size_t _maxInFlightMessages = 0;
         Connected _connectedCallback = [](const system::RoutingTypes::UdsClientAddress&,
                                           std::shared_ptr<IUdsSender>) {};
         Disconnected _disconnectedCallback = [](const system::RoutingTypes::UdsClientAddress&) {};
         Received _receivedCallback = [](const system::RoutingTypes::UdsClientAddress&,
                                         smrf::ByteVector&&,
-                                        const std::string&) {};
+                                        const std::string&,
+                                        InFlightBudget::Credit) {};
     };
 
     // Connection to remote client
@@ -140,6 +159,7 @@ private:
         void doReadInitBody() noexcept;
         void doReadHeader() noexcept;
         void doReadBody() noexcept;
+        void doReadNextMessage() noexcept;
         void doWrite() noexcept;
         bool doCheck(const boost::system::error_code& ec) noexcept;
         void doClose(const std::string& errorMessage, const std::exception& error) noexcept;
@@ -161,6 +181,7 @@ private:
         // PIMPL to keep includes clean
         std::unique_ptr<UdsSendQueue<UdsFrameBufferV1>> _sendQueue;
         std::unique_ptr<UdsFrameBufferV1> _readBuffer;
+        std::shared_ptr<InFlightBudget> _inFlightBudget;
 
         std::uint64_t _connectionIndex;
 
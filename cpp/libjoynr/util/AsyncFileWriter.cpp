@@ -0,0 +1,151 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include "joynr/AsyncFileWriter.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "joynr/ThreadConfiguration.h"
+#include "joynr/Util.h"
+
+namespace joynr
+{
+
+AsyncFileWriter::AsyncFileWriter(std::chrono::milliseconds coalescingWindow)
+        : _coalescingWindow(coalescingWindow),
+          _syncDelay(0),
+          _mutex(),
+          _pendingWritesAvailable(),
+          _writesCompleted(),
+          _pendingWrites(),
+          _scheduledWrites(0),
+          _completedWrites(0),
+          _waitingFlushes(0),
+          _stopped(false),
+          _writerThread()
+{
+    _writerThread = std::thread(&AsyncFileWriter::run, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _pendingWritesAvailable.notify_one();
+    _writerThread.join();
+}
+
+void AsyncFileWriter::replace(const std::string& fileName, std::string content)
+{
+    schedule(fileName, std::move(content), false);
+}
+
+void AsyncFileWriter::append(const std::string& fileName, std::string content)
+{
+    schedule(fileName, std::move(content), true);
+}
+
+void AsyncFileWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    const std::uint64_t scheduledWrites = _scheduledWrites;
+    if (_completedWrites >= scheduledWrites) {
+        return;
+    }
+    ++_waitingFlushes;
+    _pendingWritesAvailable.notify_one();
+    _writesCompleted.wait(
+            lock, [this, scheduledWrites]() { return _completedWrites >= scheduledWrites; });
+    --_waitingFlushes;
+}
+
+void AsyncFileWriter::setSyncDelay(std::chrono::milliseconds syncDelay)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _syncDelay = syncDelay;
+}
+
+void AsyncFileWriter::schedule(const std::string& fileName, std::string content, bool append)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto pendingWrite = _pendingWrites.find(fileName);
+    if (pendingWrite == _pendingWrites.end()) {
+        _pendingWrites.emplace(fileName, PendingWrite{std::move(content), append});
+        _pendingWritesAvailable.notify_one();
+    } else if (append) {
+        // a pending replace stays a replace which includes the appended content
+        pendingWrite->second.content += content;
+    } else {
+        pendingWrite->second = PendingWrite{std::move(content), false};
+    }
+    ++_scheduledWrites;
+}
+
+void AsyncFileWriter::run()
+{
+    ThreadConfiguration::instance().applyToCurrentThread(ThreadConfiguration::PERSISTENCE());
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _pendingWritesAvailable.wait(
+                lock, [this]() { return _stopped || !_pendingWrites.empty(); });
+        if (_pendingWrites.empty()) {
+            return;
+        }
+        // collect further writes of the same files until the window ends or a caller waits
+        _pendingWritesAvailable.wait_for(lock, _coalescingWindow, [this]() {
+            return _stopped || _waitingFlushes > 0;
+        });
+
+        std::map<std::string, PendingWrite> pendingWrites;
+        pendingWrites.swap(_pendingWrites);
+        const std::uint64_t scheduledWrites = _scheduledWrites;
+        const std::chrono::milliseconds syncDelay = _syncDelay;
+        lock.unlock();
+
+        for (const auto& pendingWrite : pendingWrites) {
+            write(pendingWrite.first, pendingWrite.second);
+            if (syncDelay.count() > 0) {
+                std::this_thread::sleep_for(syncDelay);
+            }
+        }
+
+        lock.lock();
+        _completedWrites = scheduledWrites;
+        _writesCompleted.notify_all();
+    }
+}
+
+void AsyncFileWriter::write(const std::string& fileName, const PendingWrite& pendingWrite)
+{
+    const bool syncFile = true;
+    try {
+        if (pendingWrite.append) {
+            util::appendStringToFile(fileName, pendingWrite.content, syncFile);
+        } else {
+            util::saveStringToFileAtomically(fileName, pendingWrite.content, syncFile);
+        }
+    } catch (const std::runtime_error& e) {
+        JOYNR_LOG_ERROR(logger(), "Could not write persistence file {}: {}", fileName, e.what());
+    }
+}
+
+} // namespace joynr
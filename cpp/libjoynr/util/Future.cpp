@@ -30,7 +30,8 @@ std::exception_ptr convertToExceptionPtr(const JoynrException& error);
 std::exception_ptr createJoynrTimeOutException(const std::string& message);
 } // namespace exceptions
 
-FutureBase::FutureBase() : _status(StatusCodeEnum::IN_PROGRESS)
+FutureBase::FutureBase()
+        : _status(StatusCodeEnum::IN_PROGRESS), _completed(false), _completionCallbacks()
 {
 }
 
@@ -76,16 +77,43 @@ bool FutureBase::isOk() const
 void FutureBase::onError(std::shared_ptr<exceptions::JoynrException> error)
 {
     JOYNR_LOG_TRACE(logger(), "onError has been invoked");
-    const std::lock_guard<std::mutex> lock{_statusMutex};
-    try {
-        storeException(convertToExceptionPtr(*error));
-        _status = StatusCodeEnum::ERROR;
-    } catch (const std::future_error& e) {
-        JOYNR_LOG_ERROR(logger(),
-                        "While calling onError: future_error caught: {}"
-                        " [_status = {}]",
-                        e.what(),
-                        static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+    {
+        const std::lock_guard<std::mutex> lock{_statusMutex};
+        try {
+            storeException(convertToExceptionPtr(*error));
+            _status = StatusCodeEnum::ERROR;
+        } catch (const std::future_error& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "While calling onError: future_error caught: {}"
+                            " [_status = {}]",
+                            e.what(),
+                            static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+        }
+    }
+    notifyCompletion();
+}
+
+void FutureBase::onCompletion(std::function<void()> callback)
+{
+    std::unique_lock<std::mutex> lock{_statusMutex};
+    if (!_completed) {
+        _completionCallbacks.push_back(std::move(callback));
+        return;
+    }
+    lock.unlock();
+    callback();
+}
+
+void FutureBase::notifyCompletion()
+{
+    std::vector<std::function<void()>> callbacks;
+    {
+        const std::lock_guard<std::mutex> lock{_statusMutex};
+        _completed = true;
+        callbacks.swap(_completionCallbacks);
+    }
+    for (const auto& callback : callbacks) {
+        callback();
     }
 }
 
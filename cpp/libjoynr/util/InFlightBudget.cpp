@@ -0,0 +1,111 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include "joynr/InFlightBudget.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "joynr/Metrics.h"
+
+namespace joynr
+{
+
+class InFlightBudget::CreditHolder
+{
+public:
+    explicit CreditHolder(std::shared_ptr<InFlightBudget> budget) : _budget(std::move(budget))
+    {
+    }
+
+    ~CreditHolder()
+    {
+        _budget->release();
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(CreditHolder);
+    std::shared_ptr<InFlightBudget> _budget;
+};
+
+InFlightBudget::InFlightBudget(std::size_t limit, const std::string& transport)
+        : _limit(limit),
+          _mutex(),
+          _inFlight(0),
+          _maxInFlight(0),
+          _pauses(0),
+          _resume(),
+          _inFlightGauge(MetricsRegistry::instance().getGauge(
+                  "joynr_client_inflight_messages",
+                  "Messages received from local clients which are still being processed",
+                  "transport=\"" + transport + "\"")),
+          _pausesCounter(MetricsRegistry::instance().getCounter(
+                  "joynr_client_read_pauses_total",
+                  "Times reading from a local client paused because its budget was exhausted",
+                  "transport=\"" + transport + "\""))
+{
+}
+
+InFlightBudget::Credit InFlightBudget::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_inFlight;
+        _maxInFlight = std::max(_maxInFlight, _inFlight);
+    }
+    _inFlightGauge->add(1);
+    return std::make_shared<CreditHolder>(shared_from_this());
+}
+
+bool InFlightBudget::pauseIfExhausted(std::function<void()> resume)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_limit == 0 || _inFlight < _limit) {
+        return false;
+    }
+    _resume = std::move(resume);
+    ++_pauses;
+    _pausesCounter->increment();
+    return true;
+}
+
+InFlightBudget::Statistics InFlightBudget::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Statistics{_inFlight, _maxInFlight, _pauses};
+}
+
+void InFlightBudget::release()
+{
+    std::function<void()> resume;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_inFlight;
+        // resume at half of the limit, so a paused reader is not woken up for every message
+        if (_resume && _inFlight <= _limit / 2) {
+            std::swap(resume, _resume);
+        }
+    }
+    _inFlightGauge->add(-1);
+    if (resume) {
+        resume();
+    }
+}
+
+} // namespace joynr
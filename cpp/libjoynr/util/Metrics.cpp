@@ -0,0 +1,274 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/Metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "joynr/Util.h"
+
+namespace joynr
+{
+
+constexpr std::size_t LatencyHistogram::_exactBuckets;
+constexpr std::size_t LatencyHistogram::_subBucketBits;
+constexpr std::size_t LatencyHistogram::_subBuckets;
+constexpr std::size_t LatencyHistogram::_maxExponent;
+constexpr std::size_t LatencyHistogram::_numberOfBuckets;
+
+LatencyHistogram::LatencyHistogram() : _buckets(), _count(0), _sumUs(0), _maxUs(0)
+{
+    for (std::atomic<std::uint64_t>& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t LatencyHistogram::bucketIndex(std::uint64_t valueUs)
+{
+    if (valueUs < _exactBuckets) {
+        return static_cast<std::size_t>(valueUs);
+    }
+    const std::size_t exponent = 63 - static_cast<std::size_t>(__builtin_clzll(valueUs));
+    if (exponent > _maxExponent) {
+        return _numberOfBuckets - 1;
+    }
+    const std::size_t subBucket = (valueUs >> (exponent - _subBucketBits)) & (_subBuckets - 1);
+    return _exactBuckets + (exponent - 4) * _subBuckets + subBucket;
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t index)
+{
+    if (index < _exactBuckets) {
+        return index;
+    }
+    const std::size_t exponent = 4 + (index - _exactBuckets) / _subBuckets;
+    const std::uint64_t subBucket = (index - _exactBuckets) % _subBuckets;
+    const std::uint64_t width = std::uint64_t(1) << (exponent - _subBucketBits);
+    return (_subBuckets + subBucket) * width + width - 1;
+}
+
+void LatencyHistogram::record(std::chrono::microseconds latency)
+{
+    const std::uint64_t valueUs =
+            latency.count() > 0 ? static_cast<std::uint64_t>(latency.count()) : 0;
+    _buckets[bucketIndex(valueUs)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sumUs.fetch_add(valueUs, std::memory_order_relaxed);
+    std::uint64_t currentMax = _maxUs.load(std::memory_order_relaxed);
+    while (valueUs > currentMax &&
+           !_maxUs.compare_exchange_weak(currentMax, valueUs, std::memory_order_relaxed)) {
+    }
+}
+
+std::chrono::microseconds LatencyHistogram::getValueAtPercentile(double percentile) const
+{
+    // copy the buckets first, concurrent updates must not change the total while iterating
+    std::array<std::uint64_t, _numberOfBuckets> counts;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < _numberOfBuckets; ++i) {
+        counts[i] = _buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return std::chrono::microseconds(0);
+    }
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    const std::uint64_t target = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * total)));
+    const std::uint64_t maxUs = _maxUs.load(std::memory_order_relaxed);
+    std::uint64_t cumulated = 0;
+    for (std::size_t i = 0; i < _numberOfBuckets; ++i) {
+        cumulated += counts[i];
+        if (cumulated >= target) {
+            return std::chrono::microseconds(std::min(bucketUpperBound(i), maxUs));
+        }
+    }
+    return std::chrono::microseconds(maxUs);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const
+{
+    using std::chrono::microseconds;
+    return Snapshot{_count.load(std::memory_order_relaxed),
+                    microseconds(_sumUs.load(std::memory_order_relaxed)),
+                    microseconds(_maxUs.load(std::memory_order_relaxed)),
+                    getValueAtPercentile(50),
+                    getValueAtPercentile(90),
+                    getValueAtPercentile(99),
+                    getValueAtPercentile(99.9)};
+}
+
+TransportTrafficCounter::TransportTrafficCounter(const std::string& transport,
+                                                 const std::string& direction)
+        : _messages(), _bytes()
+{
+    const std::string labels = "transport=\"" + transport + "\",direction=\"" + direction + "\"";
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    _messages = registry.getCounter(
+            "joynr_transport_messages_total", "Messages sent or received per transport", labels);
+    _bytes = registry.getCounter(
+            "joynr_transport_bytes_total", "Bytes sent or received per transport", labels);
+}
+
+MetricsRegistry::MetricsRegistry() : _families(), _mutex()
+{
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    static MetricsRegistry registryInstance;
+    return registryInstance;
+}
+
+MetricsRegistry::Family& MetricsRegistry::getFamily(const std::string& name,
+                                                    Type type,
+                                                    const std::string& help)
+{
+    auto it = _families.find(name);
+    if (it == _families.cend()) {
+        Family family;
+        family.type = type;
+        family.help = help;
+        it = _families.emplace(name, std::move(family)).first;
+    } else if (it->second.type != type) {
+        throw std::invalid_argument("Metric " + name + " is already registered with another type");
+    }
+    return it->second;
+}
+
+std::shared_ptr<MetricsCounter> MetricsRegistry::getCounter(const std::string& name,
+                                                            const std::string& help,
+                                                            const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_ptr<MetricsCounter>& counter =
+            getFamily(name, Type::COUNTER, help).counters[labels];
+    if (!counter) {
+        counter = std::make_shared<MetricsCounter>();
+    }
+    return counter;
+}
+
+std::shared_ptr<MetricsGauge> MetricsRegistry::getGauge(const std::string& name,
+                                                        const std::string& help,
+                                                        const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_ptr<MetricsGauge>& gauge = getFamily(name, Type::GAUGE, help).gauges[labels];
+    if (!gauge) {
+        gauge = std::make_shared<MetricsGauge>();
+    }
+    return gauge;
+}
+
+std::shared_ptr<LatencyHistogram> MetricsRegistry::getHistogram(const std::string& name,
+                                                                const std::string& help,
+                                                                const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_ptr<LatencyHistogram>& histogram =
+            getFamily(name, Type::HISTOGRAM, help).histograms[labels];
+    if (!histogram) {
+        histogram = std::make_shared<LatencyHistogram>();
+    }
+    return histogram;
+}
+
+namespace
+{
+
+std::string formatLabels(const std::string& labels, const std::string& additionalLabel = "")
+{
+    if (labels.empty() && additionalLabel.empty()) {
+        return std::string();
+    }
+    if (labels.empty() || additionalLabel.empty()) {
+        return "{" + labels + additionalLabel + "}";
+    }
+    return "{" + labels + "," + additionalLabel + "}";
+}
+
+std::string toSeconds(std::chrono::microseconds value)
+{
+    // microsecond resolution is kept by the 6 fractional digits of std::to_string
+    return std::to_string(static_cast<double>(value.count()) / 1e6);
+}
+
+} // namespace
+
+std::string MetricsRegistry::toPrometheusText() const
+{
+    std::ostringstream text;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& entry : _families) {
+        const std::string& name = entry.first;
+        const Family& family = entry.second;
+        text << "# HELP " << name << " " << family.help << "\n";
+        switch (family.type) {
+        case Type::COUNTER:
+            text << "# TYPE " << name << " counter\n";
+            for (const auto& counter : family.counters) {
+                text << name << formatLabels(counter.first) << " " << counter.second->get()
+                     << "\n";
+            }
+            break;
+        case Type::GAUGE:
+            text << "# TYPE " << name << " gauge\n";
+            for (const auto& gauge : family.gauges) {
+                text << name << formatLabels(gauge.first) << " " << gauge.second->get() << "\n";
+            }
+            break;
+        case Type::HISTOGRAM:
+            text << "# TYPE " << name << " summary\n";
+            for (const auto& histogram : family.histograms) {
+                const std::string& labels = histogram.first;
+                const LatencyHistogram::Snapshot snapshot = histogram.second->getSnapshot();
+                text << name << formatLabels(labels, "quantile=\"0.5\"") << " "
+                     << toSeconds(snapshot.p50) << "\n";
+                text << name << formatLabels(labels, "quantile=\"0.9\"") << " "
+                     << toSeconds(snapshot.p90) << "\n";
+                text << name << formatLabels(labels, "quantile=\"0.99\"") << " "
+                     << toSeconds(snapshot.p99) << "\n";
+                text << name << formatLabels(labels, "quantile=\"0.999\"") << " "
+                     << toSeconds(snapshot.p999) << "\n";
+                text << name << "_sum" << formatLabels(labels) << " " << toSeconds(snapshot.sum)
+                     << "\n";
+                text << name << "_count" << formatLabels(labels) << " " << snapshot.count << "\n";
+            }
+            break;
+        }
+    }
+    return text.str();
+}
+
+void MetricsRegistry::writePrometheusTextFile(const std::string& fileName) const
+{
+    const bool syncFile = false;
+    util::saveStringToFileAtomically(fileName, toPrometheusText(), syncFile);
+}
+
+void MetricsRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _families.clear();
+}
+
+} // namespace joynr
@@ -20,6 +20,8 @@
 #include "joynr/Settings.h"
 
 #include <boost/property_tree/ini_parser.hpp>
+#include <sstream>
+#include <stdexcept>
 #include <utility>
 
 #include "joynr/Util.h"
@@ -69,7 +71,11 @@ bool Settings::sync()
 {
     try {
         if (contentChanged(_propertyTree, _filename)) {
-            ptree::write_ini(_filename, _propertyTree);
+            // write to a temporary file first, so an interrupted sync does not leave a
+            // truncated settings file behind
+            std::ostringstream iniStream;
+            ptree::write_ini(iniStream, _propertyTree);
+            util::saveStringToFileAtomically(_filename, iniStream.str());
             return true;
         } else {
             JOYNR_LOG_INFO(logger(),
@@ -81,6 +87,11 @@ bool Settings::sync()
                         "settings file \"{}\" cannot be written due to the following error: {}",
                         _filename,
                         e.message());
+    } catch (const std::runtime_error& e) {
+        JOYNR_LOG_ERROR(logger(),
+                        "settings file \"{}\" cannot be written due to the following error: {}",
+                        _filename,
+                        e.what());
     }
     return false;
 }
@@ -0,0 +1,302 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/ThreadConfiguration.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "joynr/Settings.h"
+
+namespace joynr
+{
+
+ThreadConfiguration::ThreadConfiguration() : _pools(), _mutex()
+{
+}
+
+ThreadConfiguration& ThreadConfiguration::instance()
+{
+    static ThreadConfiguration configurationInstance;
+    return configurationInstance;
+}
+
+const std::string& ThreadConfiguration::IO_SERVICE()
+{
+    static const std::string value("io-service");
+    return value;
+}
+
+const std::string& ThreadConfiguration::WEBSOCKET()
+{
+    static const std::string value("websocket");
+    return value;
+}
+
+const std::string& ThreadConfiguration::DISPATCHER()
+{
+    static const std::string value("dispatcher");
+    return value;
+}
+
+const std::string& ThreadConfiguration::MESSAGE_ROUTER()
+{
+    static const std::string value("router");
+    return value;
+}
+
+const std::string& ThreadConfiguration::SUBSCRIPTIONS()
+{
+    static const std::string value("subscriptions");
+    return value;
+}
+
+const std::string& ThreadConfiguration::MQTT()
+{
+    static const std::string value("mqtt");
+    return value;
+}
+
+const std::string& ThreadConfiguration::MQTT_INGRESS()
+{
+    static const std::string value("mqtt-ingress");
+    return value;
+}
+
+const std::string& ThreadConfiguration::UDS()
+{
+    static const std::string value("uds");
+    return value;
+}
+
+const std::string& ThreadConfiguration::ARBITRATION()
+{
+    static const std::string value("arbitration");
+    return value;
+}
+
+const std::string& ThreadConfiguration::PERSISTENCE()
+{
+    static const std::string value("persistence");
+    return value;
+}
+
+const std::vector<std::string>& ThreadConfiguration::getPoolNames()
+{
+    static const std::vector<std::string> poolNames = {IO_SERVICE(),
+                                                       WEBSOCKET(),
+                                                       DISPATCHER(),
+                                                       MESSAGE_ROUTER(),
+                                                       SUBSCRIPTIONS(),
+                                                       MQTT(),
+                                                       MQTT_INGRESS(),
+                                                       UDS(),
+                                                       ARBITRATION(),
+                                                       PERSISTENCE()};
+    return poolNames;
+}
+
+void ThreadConfiguration::load(const Settings& settings)
+{
+    for (const std::string& pool : getPoolNames()) {
+        const std::string prefix = "threads/" + pool;
+        PoolConfiguration configuration;
+        bool configured = false;
+        try {
+            if (settings.contains(prefix + "-threads")) {
+                configuration.numberOfThreads =
+                        settings.get<std::uint32_t>(prefix + "-threads");
+                configured = true;
+            }
+            if (settings.contains(prefix + "-cpu-affinity")) {
+                configuration.cpus =
+                        parseCpuList(settings.get<std::string>(prefix + "-cpu-affinity"));
+                configured = true;
+            }
+            if (settings.contains(prefix + "-realtime-priority")) {
+                configuration.realtimePriority =
+                        settings.get<std::int32_t>(prefix + "-realtime-priority");
+                if (configuration.realtimePriority < 0 || configuration.realtimePriority > 99) {
+                    throw std::invalid_argument(
+                            "realtime priority must be between 0 (no realtime scheduling) and 99");
+                }
+                configured = true;
+            }
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "Ignoring invalid thread configuration of pool {}: {}",
+                            pool,
+                            e.what());
+            continue;
+        }
+        if (configured) {
+            JOYNR_LOG_INFO(logger(),
+                           "Thread pool {}: threads = {}, cpus = {}, realtime priority = {}",
+                           pool,
+                           configuration.numberOfThreads,
+                           configuration.cpus.size(),
+                           configuration.realtimePriority);
+            setPoolConfiguration(pool, configuration);
+        }
+    }
+}
+
+void ThreadConfiguration::setPoolConfiguration(const std::string& pool,
+                                               const PoolConfiguration& configuration)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pools[pool] = configuration;
+}
+
+ThreadConfiguration::PoolConfiguration ThreadConfiguration::getPoolConfiguration(
+        const std::string& pool) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _pools.find(pool);
+    if (it == _pools.cend()) {
+        return PoolConfiguration();
+    }
+    return it->second;
+}
+
+std::uint32_t ThreadConfiguration::getNumberOfThreads(const std::string& pool,
+                                                      std::uint32_t defaultNumberOfThreads) const
+{
+    const std::uint32_t numberOfThreads = getPoolConfiguration(pool).numberOfThreads;
+    return numberOfThreads > 0 ? numberOfThreads : defaultNumberOfThreads;
+}
+
+void ThreadConfiguration::applyToCurrentThread(const std::string& pool, std::size_t index) const
+{
+    const PoolConfiguration configuration = getPoolConfiguration(pool);
+    const std::string threadName = getThreadName(pool, index);
+#if defined(__linux__)
+    const pthread_t thread = pthread_self();
+    int result = pthread_setname_np(thread, threadName.c_str());
+    if (result != 0) {
+        JOYNR_LOG_WARN(
+                logger(), "Could not name thread {}: {}", threadName, std::strerror(result));
+    }
+
+    if (!configuration.cpus.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (std::uint32_t cpu : configuration.cpus) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        result = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+        if (result != 0) {
+            JOYNR_LOG_WARN(logger(),
+                           "Could not set CPU affinity of thread {}: {}",
+                           threadName,
+                           std::strerror(result));
+        }
+    }
+
+    if (configuration.realtimePriority > 0) {
+        sched_param parameters;
+        parameters.sched_priority = configuration.realtimePriority;
+        result = pthread_setschedparam(thread, SCHED_FIFO, &parameters);
+        if (result != 0) {
+            JOYNR_LOG_WARN(logger(),
+                           "Could not set realtime priority {} of thread {}: {}",
+                           configuration.realtimePriority,
+                           threadName,
+                           std::strerror(result));
+        }
+    }
+#else
+    if (!configuration.cpus.empty() || configuration.realtimePriority > 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "CPU affinity and realtime priority of thread {} are not supported on "
+                       "this platform",
+                       threadName);
+    }
+#endif
+}
+
+std::string ThreadConfiguration::getThreadName(const std::string& pool, std::size_t index)
+{
+    // Linux limits thread names to 15 characters
+    constexpr std::size_t maxLength = 15;
+    const std::string suffix = "-" + std::to_string(index);
+    if (suffix.size() >= maxLength) {
+        return suffix.substr(suffix.size() - maxLength);
+    }
+    return pool.substr(0, maxLength - suffix.size()) + suffix;
+}
+
+std::vector<std::uint32_t> ThreadConfiguration::parseCpuList(const std::string& cpuList)
+{
+    std::vector<std::string> ranges;
+    boost::algorithm::split(ranges, cpuList, [](char c) { return c == ','; });
+    std::vector<std::uint32_t> cpus;
+    for (std::string& range : ranges) {
+        boost::algorithm::trim(range);
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            const std::size_t dash = range.find('-');
+            std::size_t parsed = 0;
+            const unsigned long first = std::stoul(range.substr(0, dash), &parsed);
+            if (parsed != range.substr(0, dash).size()) {
+                throw std::invalid_argument(range);
+            }
+            unsigned long last = first;
+            if (dash != std::string::npos) {
+                const std::string end = range.substr(dash + 1);
+                last = std::stoul(end, &parsed);
+                if (parsed != end.size() || last < first) {
+                    throw std::invalid_argument(range);
+                }
+            }
+            // a cpu_set_t holds CPUs 0 - 1023
+            if (last > 1023) {
+                throw std::invalid_argument(range);
+            }
+            for (unsigned long cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(static_cast<std::uint32_t>(cpu));
+            }
+        } catch (const std::logic_error&) {
+            throw std::invalid_argument("invalid CPU list: " + cpuList);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+void ThreadConfiguration::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pools.clear();
+}
+
+} // namespace joynr
@@ -22,6 +22,7 @@
 #include <cctype>
 #include <cerrno>
 #include <cstddef>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <mutex>
@@ -36,6 +37,9 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 #pragma GCC diagnostic ignored "-Wsign-conversion"
 
 namespace joynr
@@ -114,6 +118,60 @@ void appendStringToFile(const std::string& fileName, const std::string& strToSav
     writeToFile(fileName, strToSave, std::ios::app, syncFile);
 }
 
+[[noreturn]] static void discardTemporaryFile(int fd,
+                                              const std::string& temporaryFileName,
+                                              const std::string& error)
+{
+    const std::string reason = std::strerror(errno);
+    ::close(fd);
+    std::remove(temporaryFileName.c_str());
+    throw std::runtime_error(error + " " + temporaryFileName + ": " + reason);
+}
+
+void saveStringToFileAtomically(const std::string& fileName,
+                                const std::string& strToSave,
+                                bool syncFile)
+{
+    // a unique temporary file, concurrent saves of the same file must not write into each other
+    std::string temporaryFileName = fileName + ".XXXXXX";
+    const int fd = mkstemp(&temporaryFileName[0]);
+    if (fd == -1) {
+        throw std::runtime_error("Could not create temporary file for " + fileName + ": " +
+                                 std::strerror(errno));
+    }
+    // mkstemp creates the file readable by the owner only
+    if (::fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) == -1) {
+        discardTemporaryFile(fd, temporaryFileName, "Could not set permissions of file");
+    }
+    const char* data = strToSave.data();
+    std::size_t remaining = strToSave.size();
+    while (remaining > 0) {
+        const ssize_t written = ::write(fd, data, remaining);
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            discardTemporaryFile(fd, temporaryFileName, "Could not write file");
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+    if (syncFile && fsync(fd) == -1) {
+        discardTemporaryFile(fd, temporaryFileName, "Could not fsync file");
+    }
+    if (::close(fd) == -1) {
+        const std::string reason = std::strerror(errno);
+        std::remove(temporaryFileName.c_str());
+        throw std::runtime_error("Could not close file " + temporaryFileName + ": " + reason);
+    }
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+        const std::string reason = std::strerror(errno);
+        std::remove(temporaryFileName.c_str());
+        throw std::runtime_error("Could not rename " + temporaryFileName + " to " + fileName +
+                                 ": " + reason);
+    }
+}
+
 std::string loadStringFromFile(const std::string& fileName)
 {
     // read from file
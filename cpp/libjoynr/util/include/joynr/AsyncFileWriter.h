@@ -0,0 +1,110 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef ASYNCFILEWRITER_H
+#define ASYNCFILEWRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * Writes persistence files on a background thread, so callers on latency sensitive paths, e.g.
+ * provider registration or changes of access control entries, do not wait for the storage.
+ *
+ * Writes to the same file which are scheduled within the coalescing window are combined into a
+ * single write with a single fsync: the latest replace wins, appends are concatenated. Replaced
+ * files are written to a temporary file and renamed, so they contain either the old or the new
+ * content. Write errors are logged.
+ *
+ * This class is thread safe.
+ */
+class JOYNR_EXPORT AsyncFileWriter
+{
+public:
+    explicit AsyncFileWriter(std::chrono::milliseconds coalescingWindow);
+
+    /**
+     * Writes all pending files before returning.
+     */
+    ~AsyncFileWriter();
+
+    /**
+     * Schedules replacing the content of fileName with content.
+     */
+    void replace(const std::string& fileName, std::string content);
+
+    /**
+     * Schedules appending content to fileName.
+     */
+    void append(const std::string& fileName, std::string content);
+
+    /**
+     * Durability barrier: blocks until all writes scheduled before the call have been synced to
+     * the storage, without waiting for the rest of the coalescing window.
+     */
+    void flush();
+
+    /**
+     * Delays every write by the given time after its fsync, to simulate slow flash storage in
+     * performance tests.
+     */
+    void setSyncDelay(std::chrono::milliseconds syncDelay);
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(AsyncFileWriter);
+    ADD_LOGGER(AsyncFileWriter)
+
+    struct PendingWrite {
+        std::string content;
+        bool append;
+    };
+
+    void schedule(const std::string& fileName, std::string content, bool append);
+    void run();
+    void write(const std::string& fileName, const PendingWrite& pendingWrite);
+
+    const std::chrono::milliseconds _coalescingWindow;
+    std::chrono::milliseconds _syncDelay;
+    std::mutex _mutex;
+    std::condition_variable _pendingWritesAvailable;
+    std::condition_variable _writesCompleted;
+    // guarded by _mutex
+    std::map<std::string, PendingWrite> _pendingWrites;
+    std::uint64_t _scheduledWrites;
+    std::uint64_t _completedWrites;
+    std::size_t _waitingFlushes;
+    bool _stopped;
+    std::thread _writerThread;
+};
+
+} // namespace joynr
+
+#endif // ASYNCFILEWRITER_H
@@ -22,11 +22,13 @@
 #include <chrono>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "joynr/Logger.h"
 #include "joynr/PrivateCopyAssign.h"
@@ -80,9 +82,24 @@ public:
      */
     void onError(std::shared_ptr<exceptions::JoynrException> error);
 
+    /**
+     * @brief Registers a callback which is invoked once the operation has finished, either
+     * successfully or with an error. If it has already finished, the callback is invoked
+     * immediately. The callback is invoked by the thread finishing the operation and must not
+     * block.
+     * @param callback The callback
+     */
+    void onCompletion(std::function<void()> callback);
+
 protected:
     FutureBase();
 
+    /**
+     * @brief Invokes the completion callbacks, called without holding _statusMutex after the
+     * result has been set
+     */
+    void notifyCompletion();
+
     virtual void storeException(std::exception_ptr eptr) = 0;
 
     virtual std::future_status waitForFuture(std::int64_t timeOut) = 0;
@@ -95,13 +112,13 @@ protected:
 
 private:
     DISALLOW_COPY_AND_ASSIGN(FutureBase);
+
+    bool _completed;
+    std::vector<std::function<void()>> _completionCallbacks;
 };
 
 // -------------------------------------------------------------------------------------------------
 
-template <class... Ts>
-class TaskSequencer;
-
 template <class... Ts>
 /**
  * @brief Class for monitoring the status of a request by applications.
@@ -115,8 +132,6 @@ template <class... Ts>
  */
 class Future : public FutureBase
 {
-    friend class TaskSequencer<Ts...>;
-
 public:
     /**
      * @brief Constructor
@@ -159,16 +174,19 @@ public:
     void onSuccess(Ts... results)
     {
         JOYNR_LOG_TRACE(logger(), "onSuccess has been invoked");
-        const std::lock_guard<std::mutex> lock{_statusMutex};
-        try {
-            _resultPromise.set_value(std::make_tuple(std::move(results)...));
-            _status = StatusCodeEnum::SUCCESS;
-        } catch (const std::future_error& e) {
-            JOYNR_LOG_ERROR(logger(),
-                            "While calling onError: future_error caught: {} [_status = {}]",
-                            e.what(),
-                            static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+        {
+            const std::lock_guard<std::mutex> lock{_statusMutex};
+            try {
+                _resultPromise.set_value(std::make_tuple(std::move(results)...));
+                _status = StatusCodeEnum::SUCCESS;
+            } catch (const std::future_error& e) {
+                JOYNR_LOG_ERROR(logger(),
+                                "While calling onError: future_error caught: {} [_status = {}]",
+                                e.what(),
+                                static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+            }
         }
+        notifyCompletion();
     }
 
 private:
@@ -201,8 +219,6 @@ template <>
  */
 class Future<void> : public FutureBase
 {
-    friend class TaskSequencer<void>;
-
 public:
     Future() = default;
 
@@ -238,16 +254,19 @@ public:
     void onSuccess()
     {
         JOYNR_LOG_TRACE(logger(), "onSuccess has been invoked");
-        const std::lock_guard<std::mutex> lock{_statusMutex};
-        try {
-            _resultPromise.set_value();
-            _status = StatusCodeEnum::SUCCESS;
-        } catch (const std::future_error& e) {
-            JOYNR_LOG_ERROR(logger(),
-                            "While calling onError: future_error caught: {} [_status = {}]",
-                            e.what(),
-                            static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+        {
+            const std::lock_guard<std::mutex> lock{_statusMutex};
+            try {
+                _resultPromise.set_value();
+                _status = StatusCodeEnum::SUCCESS;
+            } catch (const std::future_error& e) {
+                JOYNR_LOG_ERROR(logger(),
+                                "While calling onError: future_error caught: {} [_status = {}]",
+                                e.what(),
+                                static_cast<std::underlying_type_t<decltype(_status)>>(_status));
+            }
         }
+        notifyCompletion();
     }
 
 private:
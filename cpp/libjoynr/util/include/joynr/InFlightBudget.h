@@ -0,0 +1,103 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef INFLIGHTBUDGET_H
+#define INFLIGHTBUDGET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+class MetricsCounter;
+class MetricsGauge;
+
+/**
+ * Credit based flow control for the messages received from one client connection.
+ *
+ * The reader of the connection acquires a credit for every received message and hands it on
+ * together with the message. The credit is returned as soon as the last reference to it is
+ * released, i.e. when the message has been routed: handed to a transport, parked in a message
+ * queue or dropped. If all credits are taken, the reader
+ * stops reading from the connection until half of the credits have been returned.
+ *
+ * The number of messages in flight and the number of pauses are exported as
+ * joynr_client_inflight_messages and joynr_client_read_pauses_total.
+ *
+ * An instance must be owned by a std::shared_ptr. This class is thread safe.
+ */
+class JOYNR_EXPORT InFlightBudget : public std::enable_shared_from_this<InFlightBudget>
+{
+public:
+    using Credit = std::shared_ptr<void>;
+
+    struct Statistics {
+        std::size_t inFlight;
+        std::size_t maxInFlight;
+        std::uint64_t pauses;
+    };
+
+    /**
+     * @param limit maximum number of messages in flight, 0 disables the limit
+     * @param transport transport name used as label of the exported metrics, e.g. "uds"
+     */
+    InFlightBudget(std::size_t limit, const std::string& transport);
+
+    /**
+     * Takes a credit. Never blocks, the reader calls pauseIfExhausted() afterwards.
+     * @return credit which is returned to the budget when it is destroyed
+     */
+    Credit acquire();
+
+    /**
+     * If all credits are taken, registers resume to be invoked once half of the credits have
+     * been returned. resume is invoked by the thread returning the credit and must not block.
+     * @return true if the reader has to stop reading until resume is invoked
+     */
+    bool pauseIfExhausted(std::function<void()> resume);
+
+    Statistics getStatistics() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(InFlightBudget);
+
+    class CreditHolder;
+
+    void release();
+
+    const std::size_t _limit;
+    mutable std::mutex _mutex;
+    std::size_t _inFlight;
+    std::size_t _maxInFlight;
+    std::uint64_t _pauses;
+    std::function<void()> _resume;
+    std::shared_ptr<MetricsGauge> _inFlightGauge;
+    std::shared_ptr<MetricsCounter> _pausesCounter;
+};
+
+} // namespace joynr
+
+#endif // INFLIGHTBUDGET_H
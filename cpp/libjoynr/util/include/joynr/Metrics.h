@@ -0,0 +1,264 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * Monotonically increasing counter. Thread safe and lock free.
+ */
+class JOYNR_EXPORT MetricsCounter
+{
+public:
+    MetricsCounter() : _value(0)
+    {
+    }
+
+    void increment(std::uint64_t delta = 1)
+    {
+        _value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    std::uint64_t get() const
+    {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(MetricsCounter);
+    std::atomic<std::uint64_t> _value;
+};
+
+/**
+ * Value which can go up and down, e.g. a queue depth. Thread safe and lock free.
+ */
+class JOYNR_EXPORT MetricsGauge
+{
+public:
+    MetricsGauge() : _value(0)
+    {
+    }
+
+    void set(std::int64_t value)
+    {
+        _value.store(value, std::memory_order_relaxed);
+    }
+
+    void add(std::int64_t delta)
+    {
+        _value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    std::int64_t get() const
+    {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(MetricsGauge);
+    std::atomic<std::int64_t> _value;
+};
+
+/**
+ * Latency histogram with log-linear buckets in the style of an HDR histogram.
+ *
+ * Values are recorded in microseconds. Values below 16us are counted exactly, larger values
+ * are sorted into 8 linear sub-buckets per power of two, i.e. the relative error of a
+ * reported percentile is at most 12.5%. Recording is lock free and does not allocate.
+ */
+class JOYNR_EXPORT LatencyHistogram
+{
+public:
+    struct Snapshot {
+        std::uint64_t count;
+        std::chrono::microseconds sum;
+        std::chrono::microseconds max;
+        std::chrono::microseconds p50;
+        std::chrono::microseconds p90;
+        std::chrono::microseconds p99;
+        std::chrono::microseconds p999;
+    };
+
+    LatencyHistogram();
+
+    void record(std::chrono::microseconds latency);
+
+    /**
+     * @return the highest value which is equivalent to the value at the given percentile
+     * (0 - 100), limited by the maximum recorded value
+     */
+    std::chrono::microseconds getValueAtPercentile(double percentile) const;
+
+    Snapshot getSnapshot() const;
+
+    static std::size_t bucketIndex(std::uint64_t valueUs);
+    static std::uint64_t bucketUpperBound(std::size_t index);
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(LatencyHistogram);
+
+    static constexpr std::size_t _exactBuckets = 16;
+    static constexpr std::size_t _subBucketBits = 3;
+    static constexpr std::size_t _subBuckets = 1 << _subBucketBits;
+    // values up to 2^40us (~12 days), larger values are counted in the last bucket
+    static constexpr std::size_t _maxExponent = 40;
+    static constexpr std::size_t _numberOfBuckets =
+            _exactBuckets + (_maxExponent - 4 + 1) * _subBuckets;
+
+    std::array<std::atomic<std::uint64_t>, _numberOfBuckets> _buckets;
+    std::atomic<std::uint64_t> _count;
+    std::atomic<std::uint64_t> _sumUs;
+    std::atomic<std::uint64_t> _maxUs;
+};
+
+/**
+ * Records the time between construction and destruction in a LatencyHistogram.
+ */
+class ScopedLatency
+{
+public:
+    explicit ScopedLatency(LatencyHistogram& histogram)
+            : _histogram(histogram), _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedLatency()
+    {
+        _histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - _start));
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ScopedLatency);
+    LatencyHistogram& _histogram;
+    const std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * Counts the messages and bytes passing one transport in one direction, exported as
+ * joynr_transport_messages_total and joynr_transport_bytes_total.
+ */
+class JOYNR_EXPORT TransportTrafficCounter
+{
+public:
+    /**
+     * @param transport transport name, e.g. "mqtt"
+     * @param direction "sent" or "received"
+     */
+    TransportTrafficCounter(const std::string& transport, const std::string& direction);
+
+    void count(std::size_t bytes)
+    {
+        _messages->increment();
+        _bytes->increment(bytes);
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(TransportTrafficCounter);
+    std::shared_ptr<MetricsCounter> _messages;
+    std::shared_ptr<MetricsCounter> _bytes;
+};
+
+/**
+ * Process wide registry of metrics.
+ *
+ * Only the registration of a metric takes a lock. Call sites are expected to look up their
+ * metrics once and keep the returned pointers, updating a metric is lock free.
+ * The same name and labels always return the same metric instance.
+ */
+class JOYNR_EXPORT MetricsRegistry
+{
+public:
+    /**
+     * This class is currently implemented as a singleton
+     */
+    static MetricsRegistry& instance();
+
+    /**
+     * @param name metric name, e.g. "joynr_messages_routed_total"
+     * @param help description exported with the metric
+     * @param labels optional Prometheus labels without braces, e.g. "transport=\"mqtt\""
+     */
+    std::shared_ptr<MetricsCounter> getCounter(const std::string& name,
+                                               const std::string& help,
+                                               const std::string& labels = std::string());
+    std::shared_ptr<MetricsGauge> getGauge(const std::string& name,
+                                           const std::string& help,
+                                           const std::string& labels = std::string());
+    std::shared_ptr<LatencyHistogram> getHistogram(const std::string& name,
+                                                   const std::string& help,
+                                                   const std::string& labels = std::string());
+
+    /**
+     * @return all metrics in the Prometheus text exposition format. Histograms are exported
+     * as summaries with quantiles, sum and count in seconds.
+     */
+    std::string toPrometheusText() const;
+
+    /**
+     * Writes toPrometheusText() to the given file. The file is replaced atomically so a
+     * reader never sees partial content.
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void writePrometheusTextFile(const std::string& fileName) const;
+
+    /**
+     * Removes all metrics - for use in tests. Pointers handed out before stay valid but
+     * are no longer exported.
+     */
+    void reset();
+
+private:
+    MetricsRegistry();
+    DISALLOW_COPY_AND_ASSIGN(MetricsRegistry);
+
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::map<std::string, std::shared_ptr<MetricsCounter>> counters;
+        std::map<std::string, std::shared_ptr<MetricsGauge>> gauges;
+        std::map<std::string, std::shared_ptr<LatencyHistogram>> histograms;
+    };
+
+    Family& getFamily(const std::string& name, Type type, const std::string& help);
+
+    std::map<std::string, Family> _families;
+    mutable std::mutex _mutex;
+};
+
+} // namespace joynr
+
+#endif // METRICS_H
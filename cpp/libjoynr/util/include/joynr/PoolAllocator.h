@@ -0,0 +1,314 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef POOLALLOCATOR_H
+#define POOLALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace joynr
+{
+
+namespace detail
+{
+
+/**
+ * Per thread cache of freed memory blocks of one size. Every block remembers the pool of the
+ * thread which allocated it. A block freed by that thread goes to its local free list, a block
+ * freed by another thread is pushed to a lock free return list of the allocating thread, which
+ * takes the returned blocks over once its local free list is empty. Objects allocated by one
+ * thread and freed by a worker thread, e.g. runnables, are therefore reused by the allocating
+ * thread.
+ *
+ * At most MAX_CACHED_BLOCKS blocks are cached in the local free list, further blocks freed by
+ * the allocating thread or taken over from the return list are returned to the heap. When a
+ * thread exits, its cached blocks are released and blocks freed later are returned to the heap
+ * directly. The pool itself is deleted together with the last of its blocks.
+ */
+template <std::size_t BlockSize>
+class ThreadLocalBlockPool
+{
+public:
+    static constexpr std::size_t MAX_CACHED_BLOCKS = 256;
+
+    static void* allocate()
+    {
+        Pool* pool = getPool();
+        Block* block = pool == nullptr ? nullptr : pool->take();
+        if (block == nullptr) {
+            block = static_cast<Block*>(::operator new(sizeof(Block) + BlockSize));
+            block->_owner = pool;
+            if (pool != nullptr) {
+                pool->_references.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        return block + 1;
+    }
+
+    /**
+     * @return the number of blocks cached in the local free list of the calling thread
+     */
+    static std::size_t numberOfCachedBlocks() noexcept
+    {
+        Pool* pool = currentPool();
+        return pool == nullptr ? 0 : pool->_size;
+    }
+
+    static void deallocate(void* pointer) noexcept
+    {
+        Block* block = static_cast<Block*>(pointer) - 1;
+        Pool* owner = block->_owner;
+        if (owner == nullptr) {
+            ::operator delete(block);
+        } else if (owner == currentPool()) {
+            owner->put(block);
+        } else {
+            owner->returnBlock(block);
+        }
+    }
+
+private:
+    struct Pool;
+
+    // header in front of every block, keeps the payload aligned to std::max_align_t
+    struct alignas(std::max_align_t) Block {
+        Pool* _owner;
+        Block* _next;
+    };
+
+    struct Pool {
+        // accessed by the owning thread only
+        Block* _head;
+        std::size_t _size;
+        // blocks freed by other threads, releasedMarker() once the owning thread has exited
+        std::atomic<Block*> _returnedHead;
+        // one per block on the heap and one of the owning thread until it exits
+        std::atomic<std::size_t> _references;
+
+        Block* take() noexcept
+        {
+            if (_head == nullptr) {
+                _head = _returnedHead.exchange(nullptr, std::memory_order_acquire);
+                Block* last = nullptr;
+                for (Block* block = _head; block != nullptr && _size < MAX_CACHED_BLOCKS;
+                     block = block->_next) {
+                    last = block;
+                    ++_size;
+                }
+                if (last != nullptr) {
+                    deleteBlocks(last->_next);
+                    last->_next = nullptr;
+                }
+            }
+            Block* block = _head;
+            if (block != nullptr) {
+                _head = block->_next;
+                --_size;
+            }
+            return block;
+        }
+
+        void put(Block* block) noexcept
+        {
+            if (_size >= MAX_CACHED_BLOCKS) {
+                deleteBlock(block);
+                return;
+            }
+            block->_next = _head;
+            _head = block;
+            ++_size;
+        }
+
+        void returnBlock(Block* block) noexcept
+        {
+            Block* head = _returnedHead.load(std::memory_order_relaxed);
+            do {
+                if (head == releasedMarker()) {
+                    deleteBlock(block);
+                    return;
+                }
+                block->_next = head;
+            } while (!_returnedHead.compare_exchange_weak(
+                    head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void deleteBlock(Block* block) noexcept
+        {
+            ::operator delete(block);
+            unreference();
+        }
+
+        void unreference() noexcept
+        {
+            if (_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        void release() noexcept
+        {
+            deleteBlocks(_head);
+            _head = nullptr;
+            _size = 0;
+            deleteBlocks(_returnedHead.exchange(releasedMarker(), std::memory_order_acquire));
+            unreference();
+        }
+
+        void deleteBlocks(Block* block) noexcept
+        {
+            while (block != nullptr) {
+                Block* next = block->_next;
+                deleteBlock(block);
+                block = next;
+            }
+        }
+    };
+
+    static Block* releasedMarker() noexcept
+    {
+        static Block marker{nullptr, nullptr};
+        return &marker;
+    }
+
+    struct ThreadState {
+        Pool* _pool;
+        bool _isExiting;
+    };
+
+    struct Releaser {
+        ~Releaser()
+        {
+            ThreadState& state = threadState();
+            state._isExiting = true;
+            if (state._pool != nullptr) {
+                Pool* pool = state._pool;
+                state._pool = nullptr;
+                pool->release();
+            }
+        }
+    };
+
+    // trivially destructible, so it can still be used after the thread local Releaser of its
+    // thread has been destroyed, e.g. when a pooled object is freed by another thread local
+    static ThreadState& threadState() noexcept
+    {
+        thread_local ThreadState state{nullptr, false};
+        return state;
+    }
+
+    static Pool* currentPool() noexcept
+    {
+        return threadState()._pool;
+    }
+
+    // a thread which only frees blocks allocated by other threads never creates a pool, a
+    // thread which is exiting allocates from the heap
+    static Pool* getPool()
+    {
+        ThreadState& state = threadState();
+        if (state._pool == nullptr && !state._isExiting) {
+            state._pool = new Pool{nullptr, 0, {nullptr}, {1}};
+            thread_local Releaser releaser;
+        }
+        return state._pool;
+    }
+};
+
+} // namespace detail
+
+/**
+ * Allocator for small objects which are allocated and freed at a high rate, e.g. per message.
+ * Single objects are taken from a per thread pool of blocks of the same size, arrays are
+ * allocated on the heap. Use it with std::allocate_shared, see util::makePooledShared.
+ */
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(Pool::allocate());
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept
+    {
+        if (n != 1) {
+            ::operator delete(pointer);
+            return;
+        }
+        Pool::deallocate(pointer);
+    }
+
+private:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+    static constexpr std::size_t blockSize()
+    {
+        return sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T);
+    }
+
+    using Pool = detail::ThreadLocalBlockPool<blockSize()>;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return false;
+}
+
+namespace util
+{
+
+/**
+ * Like std::make_shared, but the object and its control block are allocated by a
+ * PoolAllocator.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makePooledShared(Args&&... args)
+{
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+} // namespace util
+
+} // namespace joynr
+
+#endif // POOLALLOCATOR_H
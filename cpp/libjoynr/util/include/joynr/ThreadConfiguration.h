@@ -0,0 +1,135 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef THREADCONFIGURATION_H
+#define THREADCONFIGURATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "joynr/JoynrExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+class Settings;
+
+/**
+ * Process wide configuration of the threads created by joynr.
+ *
+ * The threads are grouped into named pools, e.g. all threads of the dispatcher. For each pool,
+ * the settings section "threads" may define
+ *  - "<pool>-threads": the number of threads, only used by pools without a dedicated setting
+ *  - "<pool>-cpu-affinity": the CPUs the threads may run on, e.g. "0-3,6"
+ *  - "<pool>-realtime-priority": a SCHED_FIFO priority from 1 to 99, 0 disables realtime
+ *    scheduling
+ *
+ * Every thread calls applyToCurrentThread when it starts. The thread is named "<pool>-<index>"
+ * and the affinity and priority of its pool are applied. Threads of pools which are not
+ * configured keep the affinity and scheduling policy of the process.
+ */
+class JOYNR_EXPORT ThreadConfiguration
+{
+public:
+    struct PoolConfiguration {
+        // 0: the default number of threads of the component
+        std::uint32_t numberOfThreads = 0;
+        // empty: no affinity
+        std::vector<std::uint32_t> cpus;
+        // 0: the scheduling policy of the process
+        std::int32_t realtimePriority = 0;
+    };
+
+    /**
+     * This class is currently implemented as a singleton
+     */
+    static ThreadConfiguration& instance();
+
+    // the pools of the joynr runtimes
+    static const std::string& IO_SERVICE();
+    static const std::string& WEBSOCKET();
+    static const std::string& DISPATCHER();
+    static const std::string& MESSAGE_ROUTER();
+    static const std::string& SUBSCRIPTIONS();
+    static const std::string& MQTT();
+    static const std::string& MQTT_INGRESS();
+    static const std::string& UDS();
+    static const std::string& ARBITRATION();
+    static const std::string& PERSISTENCE();
+
+    static const std::vector<std::string>& getPoolNames();
+
+    /**
+     * Reads the configuration of all pools from the section "threads" of the given settings.
+     * Invalid values are logged and ignored.
+     */
+    void load(const Settings& settings);
+
+    void setPoolConfiguration(const std::string& pool, const PoolConfiguration& configuration);
+    PoolConfiguration getPoolConfiguration(const std::string& pool) const;
+
+    /**
+     * @return the configured number of threads of the pool or defaultNumberOfThreads if it is
+     * not configured
+     */
+    std::uint32_t getNumberOfThreads(const std::string& pool,
+                                     std::uint32_t defaultNumberOfThreads) const;
+
+    /**
+     * Names the calling thread and applies the CPU affinity and realtime priority of the given
+     * pool. Failures, e.g. missing permissions for a realtime priority, are logged and do not
+     * stop the thread.
+     * @param index index of the thread within the pool, part of the thread name
+     */
+    void applyToCurrentThread(const std::string& pool, std::size_t index = 0) const;
+
+    /**
+     * @return "<pool>-<index>", the pool name is shortened to fit the 15 characters of a
+     * thread name on Linux
+     */
+    static std::string getThreadName(const std::string& pool, std::size_t index);
+
+    /**
+     * Parses a CPU list like "0-3,6".
+     * @throws std::invalid_argument if the list cannot be parsed
+     */
+    static std::vector<std::uint32_t> parseCpuList(const std::string& cpuList);
+
+    /**
+     * Removes the configuration of all pools - for use in tests.
+     */
+    void reset();
+
+private:
+    ThreadConfiguration();
+    DISALLOW_COPY_AND_ASSIGN(ThreadConfiguration);
+    ADD_LOGGER(ThreadConfiguration)
+
+    std::map<std::string, PoolConfiguration> _pools;
+    mutable std::mutex _mutex;
+};
+
+} // namespace joynr
+
+#endif // THREADCONFIGURATION_H
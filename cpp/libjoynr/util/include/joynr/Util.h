@@ -119,6 +119,16 @@ void appendStringToFile(const std::string& fileName,
                         const std::string& strToSave,
                         bool syncFile = false);
 
+/*
+ * It saves strToSave to a uniquely named temporary file next to fileName and renames it to
+ * fileName, so fileName contains either the old or the new content even if the process is
+ * interrupted or the file is saved by several threads at the same time.
+ * Throws std::runtime_error if the file cannot be written or renamed.
+ */
+void saveStringToFileAtomically(const std::string& fileName,
+                                const std::string& strToSave,
+                                bool syncFile = true);
+
 /**
  * Create a Uuid for use in Joynr.
  *
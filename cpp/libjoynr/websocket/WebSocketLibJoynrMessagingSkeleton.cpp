@@ -28,6 +28,7 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Message.h"
+#include "joynr/Metrics.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
 
@@ -57,6 +58,8 @@ void WebSocketLibJoynrMessagingSkeleton::transmit(
 
 void WebSocketLibJoynrMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message)
 {
+    static TransportTrafficCounter receivedTraffic("websocket", "received");
+    receivedTraffic.count(message.size());
     // deserialize message and transmit
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
@@ -69,7 +72,7 @@ void WebSocketLibJoynrMessagingSkeleton::onMessageReceived(smrf::ByteVector&& me
         return;
     }
 
-    if (immutableMessage->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+    if (immutableMessage->getMessageType() == MessageType::MULTICAST) {
         immutableMessage->setReceivedFromGlobal(true);
     }
 
@@ -22,6 +22,7 @@
 
 #include "joynr/IWebSocketSendInterface.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
 
@@ -52,6 +53,8 @@ void WebSocketMessagingStub::transmit(
     } else {
         JOYNR_LOG_TRACE(logger(), ">>> OUTGOING >>> {}", message->toLogMessage());
     }
+    static TransportTrafficCounter sentTraffic("websocket", "sent");
+    sentTraffic.count(message->getMessageSize());
     smrf::ByteArrayView serializedMessageView(message->getSerializedMessage());
     _webSocket->send(serializedMessageView, onFailure);
 }
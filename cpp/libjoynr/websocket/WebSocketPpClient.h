@@ -35,6 +35,7 @@
 #include "joynr/Logger.h"
 #include "joynr/Semaphore.h"
 #include "joynr/SingleThreadedIOService.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/WebSocketSettings.h"
 #include "joynr/system/RoutingTypes/WebSocketAddress.h"
 #include "joynr/system/RoutingTypes/WebSocketProtocol.h"
@@ -55,7 +56,9 @@ public:
     using ConnectionPtr = typename Client::connection_ptr;
 
     WebSocketPpClient(const WebSocketSettings& wsSettings, boost::asio::io_service& ioService)
-            : _webSocketPpSingleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+            : _webSocketPpSingleThreadedIOService(
+                      std::make_shared<SingleThreadedIOService>(nullptr,
+                                                                ThreadConfiguration::WEBSOCKET())),
               _endpoint(),
               _connection(),
               _isRunning(true),
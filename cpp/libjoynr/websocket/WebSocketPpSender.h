@@ -19,6 +19,7 @@
 #ifndef WEBSOCKETPPSENDER_H
 #define WEBSOCKETPPSENDER_H
 
+#include <cstddef>
 #include <functional>
 
 #include <smrf/ByteVector.h>
@@ -37,7 +38,8 @@ protected:
     using ConnectionHandle = websocketpp::connection_hdl;
 
 public:
-    WebSocketPpSender(Endpoint& endpoint) : _endpoint(endpoint), _connectionHandle()
+    WebSocketPpSender(Endpoint& endpoint)
+            : _endpoint(endpoint), _connectionHandle(), _maxBufferedBytes(0)
     {
     }
 
@@ -49,6 +51,18 @@ public:
     {
         JOYNR_LOG_TRACE(logger(), "outgoing binary message of size {}", msg.size());
         websocketpp::lib::error_code websocketError;
+        if (_maxBufferedBytes > 0) {
+            websocketpp::lib::error_code connectionError;
+            typename Endpoint::connection_ptr connection =
+                    _endpoint.get_con_from_hdl(_connectionHandle, connectionError);
+            if (connection && connection->get_buffered_amount() > 0 &&
+                connection->get_buffered_amount() + msg.size() > _maxBufferedBytes) {
+                // the consumer is too slow, the message is rescheduled by the router
+                onFailure(exceptions::JoynrDelayMessageException(
+                        "Send buffer limit of websocket connection exceeded"));
+                return;
+            }
+        }
         _endpoint.send(_connectionHandle,
                        msg.data(),
                        msg.size(),
@@ -99,9 +113,19 @@ public:
         this->_connectionHandle.reset();
     }
 
+    /**
+     * @brief Limits the bytes buffered for sending to the connection
+     * @param maxBufferedBytes Maximum number of bytes, 0 disables the limit
+     */
+    void setMaxBufferedBytes(std::size_t maxBufferedBytes)
+    {
+        _maxBufferedBytes = maxBufferedBytes;
+    }
+
 private:
     Endpoint& _endpoint;
     ConnectionHandle _connectionHandle;
+    std::size_t _maxBufferedBytes;
     ADD_LOGGER(WebSocketPpSender)
 };
 
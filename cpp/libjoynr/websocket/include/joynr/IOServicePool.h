@@ -0,0 +1,127 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef IOSERVICEPOOL_H
+#define IOSERVICEPOOL_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "joynr/Logger.h"
+#include "joynr/Semaphore.h"
+#include "joynr/ThreadConfiguration.h"
+#include <boost/asio/io_service.hpp>
+
+namespace joynr
+{
+
+/**
+ * Runs one boost::asio::io_service on a fixed number of threads.
+ *
+ * With more than one thread, handlers of the io_service may run concurrently. Components whose
+ * handlers must not run concurrently (e.g. several timers sharing state) have to dispatch them
+ * through a boost::asio::io_service::strand.
+ * The threads are configured by the ThreadConfiguration of the given pool name.
+ */
+class IOServicePool : public std::enable_shared_from_this<IOServicePool>
+{
+public:
+    explicit IOServicePool(std::uint32_t numberOfThreads,
+                           std::shared_ptr<Semaphore> destructed = nullptr,
+                           const std::string& poolName = ThreadConfiguration::IO_SERVICE())
+            : std::enable_shared_from_this<IOServicePool>(),
+              _ioService(),
+              _ioServiceWork(),
+              _ioServiceThreads(),
+              _numberOfThreads(numberOfThreads > 0 ? numberOfThreads : 1),
+              _destructed(destructed),
+              _poolName(poolName)
+    {
+        JOYNR_LOG_TRACE(logger(), "Created with {} threads.", _numberOfThreads);
+    }
+
+    virtual ~IOServicePool()
+    {
+        if (_destructed) {
+            _destructed->notify();
+        }
+    }
+
+    void start()
+    {
+        _ioServiceWork = std::make_unique<boost::asio::io_service::work>(_ioService);
+        _ioServiceThreads.reserve(_numberOfThreads);
+        for (std::uint32_t i = 0; i < _numberOfThreads; ++i) {
+            _ioServiceThreads.emplace_back(&runIOService, shared_from_this(), i);
+        }
+        JOYNR_LOG_TRACE(logger(), "Started.");
+    }
+
+    void stop()
+    {
+        JOYNR_LOG_TRACE(logger(), "Stopping.");
+        _ioServiceWork.reset();
+        _ioService.stop();
+
+        // do not join the calling thread since we would be joining ourselves
+        // the destructor here will not get called until all threads have ended due to
+        // shared_ptr reference count
+        for (std::thread& ioServiceThread : _ioServiceThreads) {
+            if (std::this_thread::get_id() == ioServiceThread.get_id()) {
+                ioServiceThread.detach();
+                JOYNR_LOG_TRACE(logger(), "Same thread: detach!");
+            } else if (ioServiceThread.joinable()) {
+                JOYNR_LOG_TRACE(logger(), "Other thread: join!");
+                ioServiceThread.join();
+            }
+        }
+        _ioServiceThreads.clear();
+    }
+
+    boost::asio::io_service& getIOService()
+    {
+        return _ioService;
+    }
+
+    std::uint32_t getNumberOfThreads() const
+    {
+        return _numberOfThreads;
+    }
+
+private:
+    static void runIOService(std::shared_ptr<IOServicePool> ioServicePool, std::uint32_t index)
+    {
+        ThreadConfiguration::instance().applyToCurrentThread(ioServicePool->_poolName, index);
+        ioServicePool->_ioService.run();
+    }
+
+private:
+    ADD_LOGGER(IOServicePool)
+    boost::asio::io_service _ioService;
+    std::unique_ptr<boost::asio::io_service::work> _ioServiceWork;
+    std::vector<std::thread> _ioServiceThreads;
+    const std::uint32_t _numberOfThreads;
+    std::shared_ptr<Semaphore> _destructed;
+    const std::string _poolName;
+};
+
+} // namespace joynr
+#endif // IOSERVICEPOOL_H
@@ -20,78 +20,25 @@
 #define SINGLETHREADEDIOSERVICE_H
 
 #include <memory>
-#include <thread>
+#include <string>
 
-#include "joynr/Logger.h"
+#include "joynr/IOServicePool.h"
 #include "joynr/Semaphore.h"
-#include <boost/asio/io_service.hpp>
 
 namespace joynr
 {
 
-class SingleThreadedIOService : public std::enable_shared_from_this<SingleThreadedIOService>
+/**
+ * IOServicePool with a single thread, i.e. all handlers are executed sequentially.
+ */
+class SingleThreadedIOService : public IOServicePool
 {
 public:
-    SingleThreadedIOService(std::shared_ptr<Semaphore> destructed = nullptr)
-            : std::enable_shared_from_this<SingleThreadedIOService>(),
-              _ioService(),
-              _ioServiceWork(),
-              _ioServiceThread(),
-              _destructed(destructed)
-    {
-        JOYNR_LOG_TRACE(logger(), "Created.");
-    }
-
-    ~SingleThreadedIOService()
-    {
-        if (_destructed) {
-            _destructed->notify();
-        }
-    }
-
-    void start()
+    SingleThreadedIOService(std::shared_ptr<Semaphore> destructed = nullptr,
+                            const std::string& poolName = ThreadConfiguration::IO_SERVICE())
+            : IOServicePool(1, destructed, poolName)
     {
-        _ioServiceWork = std::make_unique<boost::asio::io_service::work>(_ioService);
-        _ioServiceThread = std::thread(&runIOService, shared_from_this());
-        JOYNR_LOG_TRACE(logger(), "Started.");
     }
-
-    void stop()
-    {
-        JOYNR_LOG_TRACE(logger(), "Stopping.");
-        _ioServiceWork.reset();
-        _ioService.stop();
-
-        // do not join here since we could be joining ourselves
-        // the destructor here will not get called until thread has ended due to
-        // shared_ptr reference count
-
-        if (std::this_thread::get_id() == _ioServiceThread.get_id()) {
-            _ioServiceThread.detach();
-            JOYNR_LOG_TRACE(logger(), "Same thread: detach!");
-        } else if (_ioServiceThread.joinable()) {
-            JOYNR_LOG_TRACE(logger(), "Other thread: join!");
-            _ioServiceThread.join();
-        }
-    }
-
-    boost::asio::io_service& getIOService()
-    {
-        return _ioService;
-    }
-
-private:
-    static void runIOService(std::shared_ptr<SingleThreadedIOService> singleThreadedIOService)
-    {
-        singleThreadedIOService->_ioService.run();
-    }
-
-private:
-    ADD_LOGGER(SingleThreadedIOService)
-    boost::asio::io_service _ioService;
-    std::unique_ptr<boost::asio::io_service::work> _ioServiceWork;
-    std::thread _ioServiceThread;
-    std::shared_ptr<Semaphore> _destructed;
 };
 
 } // namespace joynr
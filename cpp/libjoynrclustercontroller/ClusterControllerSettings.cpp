@@ -41,6 +41,18 @@ void ClusterControllerSettings::checkSettings()
                 DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED());
     }
 
+    if (!_settings.contains(SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS())) {
+        setGlobalCapabilitiesDirectoryMaxConcurrentCalls(
+                DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS());
+    } else if (getGlobalCapabilitiesDirectoryMaxConcurrentCalls() == 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "{} must be at least 1, using default {}",
+                       SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS(),
+                       DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS());
+        setGlobalCapabilitiesDirectoryMaxConcurrentCalls(
+                DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS());
+    }
+
     if (!_settings.contains(SETTING_MQTT_CLIENT_ID_PREFIX())) {
         setMqttClientIdPrefix(DEFAULT_MQTT_CLIENT_ID_PREFIX());
     }
@@ -78,6 +90,60 @@ void ClusterControllerSettings::checkSettings()
         setMqttMulticastTopicPrefix(DEFAULT_MQTT_UNICAST_TOPIC_PREFIX());
     }
 
+    if (!_settings.contains(SETTING_MQTT_CONNECTIONS_PER_GBID())) {
+        setMqttConnectionsPerGbid(DEFAULT_MQTT_CONNECTIONS_PER_GBID());
+    } else if (getMqttConnectionsPerGbid() == 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "{} must be at least 1, using default {}",
+                       SETTING_MQTT_CONNECTIONS_PER_GBID(),
+                       DEFAULT_MQTT_CONNECTIONS_PER_GBID());
+        setMqttConnectionsPerGbid(DEFAULT_MQTT_CONNECTIONS_PER_GBID());
+    }
+
+    if (!_settings.contains(SETTING_MQTT_INGRESS_QUEUE_CAPACITY())) {
+        setMqttIngressQueueCapacity(DEFAULT_MQTT_INGRESS_QUEUE_CAPACITY());
+    }
+
+    if (!_settings.contains(SETTING_MQTT_INGRESS_THREADS())) {
+        setMqttIngressThreads(DEFAULT_MQTT_INGRESS_THREADS());
+    } else if (getMqttIngressThreads() == 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "{} must be at least 1, using default {}",
+                       SETTING_MQTT_INGRESS_THREADS(),
+                       DEFAULT_MQTT_INGRESS_THREADS());
+        setMqttIngressThreads(DEFAULT_MQTT_INGRESS_THREADS());
+    }
+
+    if (!_settings.contains(SETTING_CLIENT_MAX_INFLIGHT_MESSAGES())) {
+        setClientMaxInFlightMessages(DEFAULT_CLIENT_MAX_INFLIGHT_MESSAGES());
+    }
+
+    if (!_settings.contains(SETTING_CLIENT_MAX_SEND_BUFFER_BYTES())) {
+        setClientMaxSendBufferBytes(DEFAULT_CLIENT_MAX_SEND_BUFFER_BYTES());
+    }
+
+    if (!_settings.contains(SETTING_METRICS_EXPORT_INTERVAL_MS())) {
+        setMetricsExportIntervalMs(DEFAULT_METRICS_EXPORT_INTERVAL_MS());
+    } else if (getMetricsExportIntervalMs() == 0) {
+        JOYNR_LOG_WARN(logger(),
+                       "{} must be at least 1, using default {}",
+                       SETTING_METRICS_EXPORT_INTERVAL_MS(),
+                       DEFAULT_METRICS_EXPORT_INTERVAL_MS());
+        setMetricsExportIntervalMs(DEFAULT_METRICS_EXPORT_INTERVAL_MS());
+    }
+
+    if (!_settings.contains(SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS())) {
+        setWarmRestartSnapshotIntervalMs(DEFAULT_WARM_RESTART_SNAPSHOT_INTERVAL_MS());
+    }
+
+    if (!_settings.contains(SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS())) {
+        setWarmRestartClientReconnectTimeoutMs(DEFAULT_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS());
+    }
+
+    if (!_settings.contains(SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS())) {
+        setMessageNotificationIntervalMs(DEFAULT_MESSAGE_NOTIFICATION_INTERVAL_MS());
+    }
+
     if (!_settings.contains(SETTING_PURGE_EXPIRED_DISCOVERY_ENTRIES_INTERVAL_MS())) {
         setPurgeExpiredDiscoveryEntriesIntervalMs(
                 DEFAULT_PURGE_EXPIRED_DISCOVERY_ENTRIES_INTERVAL_MS());
@@ -208,6 +274,72 @@ const std::string& ClusterControllerSettings::SETTING_MQTT_UNICAST_TOPIC_PREFIX(
     return value;
 }
 
+const std::string& ClusterControllerSettings::SETTING_MQTT_CONNECTIONS_PER_GBID()
+{
+    static const std::string value("cluster-controller/mqtt-connections-per-gbid");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_MQTT_INGRESS_QUEUE_CAPACITY()
+{
+    static const std::string value("cluster-controller/mqtt-ingress-queue-capacity");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_MQTT_INGRESS_THREADS()
+{
+    static const std::string value("cluster-controller/mqtt-ingress-threads");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_CLIENT_MAX_INFLIGHT_MESSAGES()
+{
+    static const std::string value("cluster-controller/client-max-inflight-messages");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_CLIENT_MAX_SEND_BUFFER_BYTES()
+{
+    static const std::string value("cluster-controller/client-max-send-buffer-bytes");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_METRICS_EXPORT_FILE()
+{
+    static const std::string value("cluster-controller/metrics-export-file");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_METRICS_EXPORT_INTERVAL_MS()
+{
+    static const std::string value("cluster-controller/metrics-export-interval-ms");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_WARM_RESTART_SNAPSHOT_FILE()
+{
+    static const std::string value("cluster-controller/warm-restart-snapshot-file");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS()
+{
+    static const std::string value("cluster-controller/warm-restart-snapshot-interval-ms");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS()
+{
+    static const std::string value("cluster-controller/warm-restart-client-reconnect-timeout-ms");
+    return value;
+}
+
+const std::string& ClusterControllerSettings::SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS()
+{
+    static const std::string value("cluster-controller/message-notification-interval-ms");
+    return value;
+}
+
 const std::string& ClusterControllerSettings::SETTING_MQTT_TLS_ENABLED()
 {
     static const std::string value("cluster-controller/mqtt-tls-enabled");
@@ -370,6 +502,51 @@ const std::string& ClusterControllerSettings::DEFAULT_MQTT_UNICAST_TOPIC_PREFIX(
     return value;
 }
 
+std::uint32_t ClusterControllerSettings::DEFAULT_MQTT_CONNECTIONS_PER_GBID()
+{
+    return 1;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_MQTT_INGRESS_QUEUE_CAPACITY()
+{
+    return 1024;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_MQTT_INGRESS_THREADS()
+{
+    return 1;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_CLIENT_MAX_INFLIGHT_MESSAGES()
+{
+    return 1024;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_CLIENT_MAX_SEND_BUFFER_BYTES()
+{
+    return 16 * 1024 * 1024;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_METRICS_EXPORT_INTERVAL_MS()
+{
+    return 10000;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_WARM_RESTART_SNAPSHOT_INTERVAL_MS()
+{
+    return 60000;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS()
+{
+    return 60000;
+}
+
+std::uint32_t ClusterControllerSettings::DEFAULT_MESSAGE_NOTIFICATION_INTERVAL_MS()
+{
+    return 100;
+}
+
 bool ClusterControllerSettings::DEFAULT_ENABLE_ACCESS_CONTROLLER()
 {
     return false;
@@ -464,6 +641,127 @@ void ClusterControllerSettings::setMqttUnicastTopicPrefix(const std::string& mqt
     _settings.set(SETTING_MQTT_UNICAST_TOPIC_PREFIX(), mqttUnicastTopicPrefix);
 }
 
+std::uint32_t ClusterControllerSettings::getMqttConnectionsPerGbid() const
+{
+    return _settings.get<std::uint32_t>(SETTING_MQTT_CONNECTIONS_PER_GBID());
+}
+
+void ClusterControllerSettings::setMqttConnectionsPerGbid(std::uint32_t connectionsPerGbid)
+{
+    _settings.set(SETTING_MQTT_CONNECTIONS_PER_GBID(), connectionsPerGbid);
+}
+
+std::uint32_t ClusterControllerSettings::getMqttIngressQueueCapacity() const
+{
+    return _settings.get<std::uint32_t>(SETTING_MQTT_INGRESS_QUEUE_CAPACITY());
+}
+
+void ClusterControllerSettings::setMqttIngressQueueCapacity(std::uint32_t capacity)
+{
+    _settings.set(SETTING_MQTT_INGRESS_QUEUE_CAPACITY(), capacity);
+}
+
+std::uint32_t ClusterControllerSettings::getMqttIngressThreads() const
+{
+    return _settings.get<std::uint32_t>(SETTING_MQTT_INGRESS_THREADS());
+}
+
+void ClusterControllerSettings::setMqttIngressThreads(std::uint32_t numberOfThreads)
+{
+    _settings.set(SETTING_MQTT_INGRESS_THREADS(), numberOfThreads);
+}
+
+std::uint32_t ClusterControllerSettings::getClientMaxInFlightMessages() const
+{
+    return _settings.get<std::uint32_t>(SETTING_CLIENT_MAX_INFLIGHT_MESSAGES());
+}
+
+void ClusterControllerSettings::setClientMaxInFlightMessages(std::uint32_t maxInFlightMessages)
+{
+    _settings.set(SETTING_CLIENT_MAX_INFLIGHT_MESSAGES(), maxInFlightMessages);
+}
+
+std::uint32_t ClusterControllerSettings::getClientMaxSendBufferBytes() const
+{
+    return _settings.get<std::uint32_t>(SETTING_CLIENT_MAX_SEND_BUFFER_BYTES());
+}
+
+void ClusterControllerSettings::setClientMaxSendBufferBytes(std::uint32_t maxSendBufferBytes)
+{
+    _settings.set(SETTING_CLIENT_MAX_SEND_BUFFER_BYTES(), maxSendBufferBytes);
+}
+
+bool ClusterControllerSettings::isMetricsExportFileSet() const
+{
+    return _settings.contains(SETTING_METRICS_EXPORT_FILE()) && !getMetricsExportFile().empty();
+}
+
+std::string ClusterControllerSettings::getMetricsExportFile() const
+{
+    return _settings.get<std::string>(SETTING_METRICS_EXPORT_FILE());
+}
+
+void ClusterControllerSettings::setMetricsExportFile(const std::string& fileName)
+{
+    _settings.set(SETTING_METRICS_EXPORT_FILE(), fileName);
+}
+
+std::uint32_t ClusterControllerSettings::getMetricsExportIntervalMs() const
+{
+    return _settings.get<std::uint32_t>(SETTING_METRICS_EXPORT_INTERVAL_MS());
+}
+
+void ClusterControllerSettings::setMetricsExportIntervalMs(std::uint32_t intervalMs)
+{
+    _settings.set(SETTING_METRICS_EXPORT_INTERVAL_MS(), intervalMs);
+}
+
+bool ClusterControllerSettings::isWarmRestartSnapshotFileSet() const
+{
+    return _settings.contains(SETTING_WARM_RESTART_SNAPSHOT_FILE()) &&
+           !getWarmRestartSnapshotFile().empty();
+}
+
+std::string ClusterControllerSettings::getWarmRestartSnapshotFile() const
+{
+    return _settings.get<std::string>(SETTING_WARM_RESTART_SNAPSHOT_FILE());
+}
+
+void ClusterControllerSettings::setWarmRestartSnapshotFile(const std::string& fileName)
+{
+    _settings.set(SETTING_WARM_RESTART_SNAPSHOT_FILE(), fileName);
+}
+
+std::uint32_t ClusterControllerSettings::getWarmRestartSnapshotIntervalMs() const
+{
+    return _settings.get<std::uint32_t>(SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS());
+}
+
+void ClusterControllerSettings::setWarmRestartSnapshotIntervalMs(std::uint32_t intervalMs)
+{
+    _settings.set(SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS(), intervalMs);
+}
+
+std::uint32_t ClusterControllerSettings::getWarmRestartClientReconnectTimeoutMs() const
+{
+    return _settings.get<std::uint32_t>(SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS());
+}
+
+void ClusterControllerSettings::setWarmRestartClientReconnectTimeoutMs(std::uint32_t timeoutMs)
+{
+    _settings.set(SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS(), timeoutMs);
+}
+
+std::uint32_t ClusterControllerSettings::getMessageNotificationIntervalMs() const
+{
+    return _settings.get<std::uint32_t>(SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS());
+}
+
+void ClusterControllerSettings::setMessageNotificationIntervalMs(std::uint32_t intervalMs)
+{
+    _settings.set(SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS(), intervalMs);
+}
+
 bool ClusterControllerSettings::isMqttCertificateAuthorityPemFilenameSet() const
 {
     return _settings.contains(SETTING_MQTT_CERTIFICATE_AUTHORITY_PEM_FILENAME());
@@ -586,6 +884,18 @@ void ClusterControllerSettings::setGlobalCapabilitiesDirectoryCompressedMessages
             SETTING_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED(), enabled);
 }
 
+std::uint32_t ClusterControllerSettings::getGlobalCapabilitiesDirectoryMaxConcurrentCalls() const
+{
+    return _settings.get<std::uint32_t>(
+            SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS());
+}
+
+void ClusterControllerSettings::setGlobalCapabilitiesDirectoryMaxConcurrentCalls(
+        std::uint32_t maxConcurrentCalls)
+{
+    _settings.set(SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS(), maxConcurrentCalls);
+}
+
 const std::string& ClusterControllerSettings::
         DEFAULT_LOCAL_DOMAIN_ACCESS_STORE_PERSISTENCE_FILENAME()
 {
@@ -598,6 +908,12 @@ bool ClusterControllerSettings::DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED
     return false;
 }
 
+std::uint32_t ClusterControllerSettings::
+        DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS()
+{
+    return 1;
+}
+
 const std::string& ClusterControllerSettings::SETTING_MESSAGE_QUEUE_LIMIT()
 {
     static const std::string value("cluster-controller/message-queue-limit");
@@ -649,6 +965,14 @@ const std::string& ClusterControllerSettings::
     return value;
 }
 
+const std::string& ClusterControllerSettings::
+        SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS()
+{
+    static const std::string value(
+            "cluster-controller/global-capabilities-directory-max-concurrent-calls");
+    return value;
+}
+
 std::string ClusterControllerSettings::getLocalDomainAccessStorePersistenceFilename() const
 {
     return _settings.get<std::string>(SETTING_LOCAL_DOMAIN_ACCESS_STORE_PERSISTENCE_FILENAME());
@@ -793,6 +1117,69 @@ void ClusterControllerSettings::printSettings() const
                    SETTING_MQTT_UNICAST_TOPIC_PREFIX(),
                    getMqttUnicastTopicPrefix());
 
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MQTT_CONNECTIONS_PER_GBID(),
+                   getMqttConnectionsPerGbid());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MQTT_INGRESS_QUEUE_CAPACITY(),
+                   getMqttIngressQueueCapacity());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MQTT_INGRESS_THREADS(),
+                   getMqttIngressThreads());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_CLIENT_MAX_INFLIGHT_MESSAGES(),
+                   getClientMaxInFlightMessages());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_CLIENT_MAX_SEND_BUFFER_BYTES(),
+                   getClientMaxSendBufferBytes());
+
+    if (isMetricsExportFileSet()) {
+        JOYNR_LOG_INFO(logger(),
+                       "SETTING: {} = {}",
+                       SETTING_METRICS_EXPORT_FILE(),
+                       getMetricsExportFile());
+    } else {
+        JOYNR_LOG_INFO(logger(), "SETTING: {} = NOT SET", SETTING_METRICS_EXPORT_FILE());
+    }
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_METRICS_EXPORT_INTERVAL_MS(),
+                   getMetricsExportIntervalMs());
+
+    if (isWarmRestartSnapshotFileSet()) {
+        JOYNR_LOG_INFO(logger(),
+                       "SETTING: {} = {}",
+                       SETTING_WARM_RESTART_SNAPSHOT_FILE(),
+                       getWarmRestartSnapshotFile());
+    } else {
+        JOYNR_LOG_INFO(logger(), "SETTING: {} = NOT SET", SETTING_WARM_RESTART_SNAPSHOT_FILE());
+    }
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS(),
+                   getWarmRestartSnapshotIntervalMs());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS(),
+                   getWarmRestartClientReconnectTimeoutMs());
+
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS(),
+                   getMessageNotificationIntervalMs());
+
     if (isWsTLSPortSet()) {
         JOYNR_LOG_INFO(logger(), "SETTING: {} = {}", SETTING_WS_TLS_PORT(), getWsTLSPort());
     } else {
@@ -885,6 +1272,11 @@ void ClusterControllerSettings::printSettings() const
                    SETTING_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED(),
                    isGlobalCapabilitiesDirectoryCompressedMessagesEnabled());
 
+    JOYNR_LOG_INFO(logger(),
+                   "SETTING: {} = {}",
+                   SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS(),
+                   getGlobalCapabilitiesDirectoryMaxConcurrentCalls());
+
     JOYNR_LOG_INFO(logger(),
                    "SETTING: {} = {}",
                    SETTING_PURGE_EXPIRED_DISCOVERY_ENTRIES_INTERVAL_MS(),
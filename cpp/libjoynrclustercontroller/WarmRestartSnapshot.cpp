@@ -0,0 +1,83 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "joynr/WarmRestartSnapshot.h"
+
+#include <stdexcept>
+
+#include "joynr/TimePoint.h"
+#include "joynr/Util.h"
+
+namespace joynr
+{
+
+std::int32_t WarmRestartSnapshot::VERSION()
+{
+    return 1;
+}
+
+WarmRestartSnapshot::WarmRestartSnapshot()
+        : version(VERSION()),
+          creationDateMs(TimePoint::now().toMilliseconds()),
+          routingEntries(),
+          multicastReceivers(),
+          globalCacheEntries()
+{
+}
+
+void WarmRestartSnapshot::saveToFile(const std::string& fileName) const
+{
+    const bool syncFile = true;
+    util::saveStringToFileAtomically(fileName, serializer::serializeToJson(*this), syncFile);
+}
+
+boost::optional<WarmRestartSnapshot> WarmRestartSnapshot::loadFromFile(const std::string& fileName)
+{
+    WarmRestartSnapshot snapshot;
+    try {
+        serializer::deserializeFromJson(snapshot, util::loadStringFromFile(fileName));
+    } catch (const std::runtime_error& e) {
+        JOYNR_LOG_INFO(logger(), "No warm restart snapshot loaded: {}", e.what());
+        return boost::none;
+    } catch (const std::invalid_argument& e) {
+        JOYNR_LOG_ERROR(
+                logger(), "Could not deserialize warm restart snapshot {}: {}", fileName, e.what());
+        return boost::none;
+    }
+
+    if (snapshot.version != VERSION()) {
+        JOYNR_LOG_WARN(logger(),
+                       "Ignoring warm restart snapshot {} of version {}, expected version {}",
+                       fileName,
+                       snapshot.version,
+                       VERSION());
+        return boost::none;
+    }
+
+    JOYNR_LOG_INFO(logger(),
+                   "Loaded warm restart snapshot from {} created at {}: {} routing entries, {} "
+                   "multicast IDs, {} cached discovery entries",
+                   fileName,
+                   snapshot.creationDateMs,
+                   snapshot.routingEntries.size(),
+                   snapshot.multicastReceivers.size(),
+                   snapshot.globalCacheEntries.size());
+    return snapshot;
+}
+
+} // namespace joynr
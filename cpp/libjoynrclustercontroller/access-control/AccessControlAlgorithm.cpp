@@ -33,58 +33,57 @@ namespace joynr
 using namespace infrastructure::DacTypes;
 
 Permission::Enum AccessControlAlgorithm::getConsumerPermission(
-        const boost::optional<MasterAccessControlEntry>& masterOptional,
-        const boost::optional<MasterAccessControlEntry>& mediatorOptional,
-        const boost::optional<OwnerAccessControlEntry>& ownerOptional,
+        const MasterAccessControlEntry* masterEntry,
+        const MasterAccessControlEntry* mediatorEntry,
+        const OwnerAccessControlEntry* ownerEntry,
         TrustLevel::Enum trustLevel)
 {
     return getPermission(
-            PERMISSION_FOR_CONSUMER, masterOptional, mediatorOptional, ownerOptional, trustLevel);
+            PERMISSION_FOR_CONSUMER, masterEntry, mediatorEntry, ownerEntry, trustLevel);
 }
 
 Permission::Enum AccessControlAlgorithm::getProviderPermission(
-        const boost::optional<MasterRegistrationControlEntry>& masterOptional,
-        const boost::optional<MasterRegistrationControlEntry>& mediatorOptional,
-        const boost::optional<OwnerRegistrationControlEntry>& ownerOptional,
+        const MasterRegistrationControlEntry* masterEntry,
+        const MasterRegistrationControlEntry* mediatorEntry,
+        const OwnerRegistrationControlEntry* ownerEntry,
         TrustLevel::Enum trustLevel)
 {
     return getPermission(
-            PERMISSION_FOR_PROVIDER, masterOptional, mediatorOptional, ownerOptional, trustLevel);
+            PERMISSION_FOR_PROVIDER, masterEntry, mediatorEntry, ownerEntry, trustLevel);
 }
 
 Permission::Enum AccessControlAlgorithm::getPermission(
         AccessControlAlgorithm::PermissionType permissionType,
-        const boost::optional<MasterAccessControlEntry>& masterOptional,
-        const boost::optional<MasterAccessControlEntry>& mediatorOptional,
-        const boost::optional<OwnerAccessControlEntry>& ownerOptional,
+        const MasterAccessControlEntry* masterEntry,
+        const MasterAccessControlEntry* mediatorEntry,
+        const OwnerAccessControlEntry* ownerEntry,
         TrustLevel::Enum trustLevel)
 {
-    AceValidator validator(masterOptional, mediatorOptional, ownerOptional);
+    AceValidator validator(masterEntry, mediatorEntry, ownerEntry);
     if (!validator.isValid()) {
         return Permission::NO;
     }
 
     Permission::Enum permission = Permission::Enum::NO;
 
-    if (ownerOptional) {
-        if (TrustLevelComparator::compare(trustLevel, ownerOptional->getRequiredTrustLevel()) >=
-            0) {
+    if (ownerEntry) {
+        if (TrustLevelComparator::compare(trustLevel, ownerEntry->getRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_CONSUMER) {
-                permission = ownerOptional->getConsumerPermission();
+                permission = ownerEntry->getConsumerPermission();
             }
         }
-    } else if (mediatorOptional) {
+    } else if (mediatorEntry) {
         if (TrustLevelComparator::compare(
-                    trustLevel, mediatorOptional->getDefaultRequiredTrustLevel()) >= 0) {
+                    trustLevel, mediatorEntry->getDefaultRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_CONSUMER) {
-                permission = mediatorOptional->getDefaultConsumerPermission();
+                permission = mediatorEntry->getDefaultConsumerPermission();
             }
         }
-    } else if (masterOptional) {
+    } else if (masterEntry) {
         if (TrustLevelComparator::compare(
-                    trustLevel, masterOptional->getDefaultRequiredTrustLevel()) >= 0) {
+                    trustLevel, masterEntry->getDefaultRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_CONSUMER) {
-                permission = masterOptional->getDefaultConsumerPermission();
+                permission = masterEntry->getDefaultConsumerPermission();
             }
         }
     }
@@ -94,37 +93,36 @@ Permission::Enum AccessControlAlgorithm::getPermission(
 
 Permission::Enum AccessControlAlgorithm::getPermission(
         AccessControlAlgorithm::PermissionType permissionType,
-        const boost::optional<MasterRegistrationControlEntry>& masterOptional,
-        const boost::optional<MasterRegistrationControlEntry>& mediatorOptional,
-        const boost::optional<OwnerRegistrationControlEntry>& ownerOptional,
+        const MasterRegistrationControlEntry* masterEntry,
+        const MasterRegistrationControlEntry* mediatorEntry,
+        const OwnerRegistrationControlEntry* ownerEntry,
         TrustLevel::Enum trustLevel)
 {
-    RceValidator validator(masterOptional, mediatorOptional, ownerOptional);
+    RceValidator validator(masterEntry, mediatorEntry, ownerEntry);
     if (!validator.isValid()) {
         return Permission::NO;
     }
 
     Permission::Enum permission = Permission::Enum::NO;
 
-    if (ownerOptional) {
-        if (TrustLevelComparator::compare(trustLevel, ownerOptional->getRequiredTrustLevel()) >=
-            0) {
+    if (ownerEntry) {
+        if (TrustLevelComparator::compare(trustLevel, ownerEntry->getRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_PROVIDER) {
-                permission = ownerOptional->getProviderPermission();
+                permission = ownerEntry->getProviderPermission();
             }
         }
-    } else if (mediatorOptional) {
+    } else if (mediatorEntry) {
         if (TrustLevelComparator::compare(
-                    trustLevel, mediatorOptional->getDefaultRequiredTrustLevel()) >= 0) {
+                    trustLevel, mediatorEntry->getDefaultRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_PROVIDER) {
-                permission = mediatorOptional->getDefaultProviderPermission();
+                permission = mediatorEntry->getDefaultProviderPermission();
             }
         }
-    } else if (masterOptional) {
+    } else if (masterEntry) {
         if (TrustLevelComparator::compare(
-                    trustLevel, masterOptional->getDefaultRequiredTrustLevel()) >= 0) {
+                    trustLevel, masterEntry->getDefaultRequiredTrustLevel()) >= 0) {
             if (permissionType == PERMISSION_FOR_PROVIDER) {
-                permission = masterOptional->getDefaultProviderPermission();
+                permission = masterEntry->getDefaultProviderPermission();
             }
         }
     }
@@ -20,8 +20,6 @@
 #ifndef ACCESSCONTROLALGORITHM_H
 #define ACCESSCONTROLALGORITHM_H
 
-#include <boost/optional.hpp>
-
 #include "joynr/JoynrClusterControllerExport.h"
 #include "joynr/infrastructure/DacTypes/Permission.h"
 #include "joynr/infrastructure/DacTypes/TrustLevel.h"
@@ -51,7 +49,7 @@ public:
 
     /**
      * Get the consumer permission for given combination of control entries and with the given trust
-     *level.
+     *level. Missing entries are passed as nullptr.
      *
      * @param master The master access control entry
      * @param mediator The mediator access control entry
@@ -60,11 +58,9 @@ public:
      * @return The permission
      */
     virtual infrastructure::DacTypes::Permission::Enum getConsumerPermission(
-            const boost::optional<infrastructure::DacTypes::MasterAccessControlEntry>&
-                    masterOptional,
-            const boost::optional<infrastructure::DacTypes::MasterAccessControlEntry>&
-                    mediatorOptional,
-            const boost::optional<infrastructure::DacTypes::OwnerAccessControlEntry>& ownerOptional,
+            const infrastructure::DacTypes::MasterAccessControlEntry* masterEntry,
+            const infrastructure::DacTypes::MasterAccessControlEntry* mediatorEntry,
+            const infrastructure::DacTypes::OwnerAccessControlEntry* ownerEntry,
             infrastructure::DacTypes::TrustLevel::Enum trustLevel);
 
     /**
@@ -77,12 +73,9 @@ public:
      * @return Always Permission::YES
      */
     virtual infrastructure::DacTypes::Permission::Enum getProviderPermission(
-            const boost::optional<infrastructure::DacTypes::MasterRegistrationControlEntry>&
-                    masterOptional,
-            const boost::optional<infrastructure::DacTypes::MasterRegistrationControlEntry>&
-                    mediatorOptional,
-            const boost::optional<infrastructure::DacTypes::OwnerRegistrationControlEntry>&
-                    ownerOptional,
+            const infrastructure::DacTypes::MasterRegistrationControlEntry* masterEntry,
+            const infrastructure::DacTypes::MasterRegistrationControlEntry* mediatorEntry,
+            const infrastructure::DacTypes::OwnerRegistrationControlEntry* ownerEntry,
             infrastructure::DacTypes::TrustLevel::Enum trustLevel);
 
 private:
@@ -90,21 +83,16 @@ private:
 
     infrastructure::DacTypes::Permission::Enum getPermission(
             PermissionType permissionType,
-            const boost::optional<infrastructure::DacTypes::MasterAccessControlEntry>&
-                    masterOptional,
-            const boost::optional<infrastructure::DacTypes::MasterAccessControlEntry>&
-                    mediatorOptional,
-            const boost::optional<infrastructure::DacTypes::OwnerAccessControlEntry>& ownerOptional,
+            const infrastructure::DacTypes::MasterAccessControlEntry* masterEntry,
+            const infrastructure::DacTypes::MasterAccessControlEntry* mediatorEntry,
+            const infrastructure::DacTypes::OwnerAccessControlEntry* ownerEntry,
             infrastructure::DacTypes::TrustLevel::Enum trustLevel);
 
     infrastructure::DacTypes::Permission::Enum getPermission(
             PermissionType permissionType,
-            const boost::optional<infrastructure::DacTypes::MasterRegistrationControlEntry>&
-                    masterOptional,
-            const boost::optional<infrastructure::DacTypes::MasterRegistrationControlEntry>&
-                    mediatorOptional,
-            const boost::optional<infrastructure::DacTypes::OwnerRegistrationControlEntry>&
-                    ownerOptional,
+            const infrastructure::DacTypes::MasterRegistrationControlEntry* masterEntry,
+            const infrastructure::DacTypes::MasterRegistrationControlEntry* mediatorEntry,
+            const infrastructure::DacTypes::OwnerRegistrationControlEntry* ownerEntry,
             infrastructure::DacTypes::TrustLevel::Enum trustLevel);
 };
 
@@ -0,0 +1,376 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef ACCESSCONTROLSNAPSHOT_H
+#define ACCESSCONTROLSNAPSHOT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "joynr/PrivateCopyAssign.h"
+
+#include "AccessControlUtils.h"
+
+namespace joynr
+{
+namespace access_control
+{
+
+/*
+ * Immutable, precompiled view of the control entry tables of the LocalDomainAccessStore.
+ *
+ * All uids, domains and interface names are interned to integer ids and the wildcard
+ * resolution is precomputed: entries with a wildcard domain are indexed by their domain
+ * prefix, entries with a wildcard interface by their domain, and each index list is sorted
+ * closest match first. A lookup therefore neither locks nor allocates, it only hashes the
+ * query strings. The snapshot is recompiled after changes of the tables and replaced as a
+ * whole, so readers keep using a consistent snapshot while it is replaced.
+ *
+ * A lookup returns the same entry as LocalDomainAccessStore did with its wildcard storage:
+ * 1. the entry with the exact uid, domain and interface,
+ * 2. the entry with uid "*" and the exact domain and interface,
+ * 3. the closest entry with a wildcard domain or interface for the exact uid, then for "*".
+ *    Exact values take precedence over wildcards and longer wildcard prefixes over shorter
+ *    ones, the domain is compared before the interface.
+ * Of several access control entries which only differ in their operation, the first in
+ * table order is returned.
+ */
+class AccessControlSnapshot
+{
+public:
+    AccessControlSnapshot(
+            const TableMaker<dac::MasterAccessControlEntry>::Type& masterAccessTable,
+            const TableMaker<dac::MediatorAccessControlEntry>::Type& mediatorAccessTable,
+            const TableMaker<dac::OwnerAccessControlEntry>::Type& ownerAccessTable,
+            const TableMaker<dac::MasterRegistrationControlEntry>::Type& masterRegistrationTable,
+            const TableMaker<dac::MediatorRegistrationControlEntry>::Type&
+                    mediatorRegistrationTable,
+            const TableMaker<dac::OwnerRegistrationControlEntry>::Type& ownerRegistrationTable)
+            : _ids(),
+              _wildcardId(intern(WILDCARD)),
+              _masterAccess(masterAccessTable, *this),
+              _mediatorAccess(mediatorAccessTable, *this),
+              _ownerAccess(ownerAccessTable, *this),
+              _masterRegistration(masterRegistrationTable, *this),
+              _mediatorRegistration(mediatorRegistrationTable, *this),
+              _ownerRegistration(ownerRegistrationTable, *this)
+    {
+    }
+
+    const dac::MasterAccessControlEntry* getMasterAccessControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _masterAccess.lookup(*this, uid, domain, interfaceName);
+    }
+
+    const dac::MasterAccessControlEntry* getMediatorAccessControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _mediatorAccess.lookup(*this, uid, domain, interfaceName);
+    }
+
+    const dac::OwnerAccessControlEntry* getOwnerAccessControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _ownerAccess.lookup(*this, uid, domain, interfaceName);
+    }
+
+    const dac::MasterRegistrationControlEntry* getMasterRegistrationControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _masterRegistration.lookup(*this, uid, domain, interfaceName);
+    }
+
+    const dac::MasterRegistrationControlEntry* getMediatorRegistrationControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _mediatorRegistration.lookup(*this, uid, domain, interfaceName);
+    }
+
+    const dac::OwnerRegistrationControlEntry* getOwnerRegistrationControlEntry(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName) const
+    {
+        return _ownerRegistration.lookup(*this, uid, domain, interfaceName);
+    }
+
+    std::size_t getNumberOfInternedStrings() const
+    {
+        return _ids.size();
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(AccessControlSnapshot);
+
+    static constexpr std::uint32_t _unknownId = UINT32_MAX;
+
+    static bool endsWithWildcard(const std::string& value)
+    {
+        return !value.empty() && value.back() == *WILDCARD;
+    }
+
+    // FNV-1a over the first length characters, used to look up domain prefixes without
+    // creating substrings
+    static std::uint64_t prefixHash(const std::string& value, std::size_t length)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (std::size_t i = 0; i < length; ++i) {
+            hash ^= static_cast<unsigned char>(value[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static std::uint64_t combine(std::uint32_t uidId, std::uint64_t value)
+    {
+        return value ^ (static_cast<std::uint64_t>(uidId) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    static bool matches(const std::string& pattern, const std::string& value)
+    {
+        if (!endsWithWildcard(pattern)) {
+            return pattern == value;
+        }
+        return value.compare(0, pattern.size() - 1, pattern, 0, pattern.size() - 1) == 0;
+    }
+
+    std::uint32_t intern(const std::string& value)
+    {
+        return _ids.emplace(value, static_cast<std::uint32_t>(_ids.size())).first->second;
+    }
+
+    std::uint32_t find(const std::string& value) const
+    {
+        auto it = _ids.find(value);
+        if (it == _ids.cend()) {
+            return _unknownId;
+        }
+        return it->second;
+    }
+
+    template <typename Entry>
+    class CompiledTable
+    {
+    public:
+        template <typename Table>
+        CompiledTable(const Table& table, AccessControlSnapshot& snapshot)
+                : _entries(table.begin(), table.end()),
+                  _uidIds(),
+                  _exact(),
+                  _byDomain(),
+                  _byDomainPrefix(),
+                  _domainPrefixLengths()
+        {
+            for (std::uint32_t index = 0; index < _entries.size(); ++index) {
+                const Entry& entry = _entries[index];
+                const std::uint32_t uidId = snapshot.intern(entry.getUid());
+                _uidIds.push_back(uidId);
+                const std::uint32_t domainId = snapshot.intern(entry.getDomain());
+                const std::uint32_t interfaceId = snapshot.intern(entry.getInterfaceName());
+                // tables are ordered by operation, keep the first entry of each key
+                _exact.emplace(Key{uidId, domainId, interfaceId}, index);
+
+                if (endsWithWildcard(entry.getDomain())) {
+                    const std::size_t prefixLength = entry.getDomain().size() - 1;
+                    _byDomainPrefix[combine(uidId, prefixHash(entry.getDomain(), prefixLength))]
+                            .push_back(index);
+                    _domainPrefixLengths.push_back(prefixLength);
+                } else if (endsWithWildcard(entry.getInterfaceName())) {
+                    _byDomain[combine(uidId, domainId)].push_back(index);
+                }
+            }
+
+            // sort the candidates closest first, keep the table order of equal candidates
+            auto closestInterfaceFirst = [this](std::uint32_t lhs, std::uint32_t rhs) {
+                return TableViewTraitsBase::SetUnionComparator()(
+                        _entries[lhs].getInterfaceName(), _entries[rhs].getInterfaceName());
+            };
+            for (auto& candidates : _byDomain) {
+                std::stable_sort(
+                        candidates.second.begin(), candidates.second.end(), closestInterfaceFirst);
+            }
+            for (auto& candidates : _byDomainPrefix) {
+                std::stable_sort(
+                        candidates.second.begin(), candidates.second.end(), closestInterfaceFirst);
+            }
+            std::sort(_domainPrefixLengths.begin(),
+                      _domainPrefixLengths.end(),
+                      std::greater<std::size_t>());
+            _domainPrefixLengths.erase(
+                    std::unique(_domainPrefixLengths.begin(), _domainPrefixLengths.end()),
+                    _domainPrefixLengths.end());
+        }
+
+        const Entry* lookup(const AccessControlSnapshot& snapshot,
+                            const std::string& uid,
+                            const std::string& domain,
+                            const std::string& interfaceName) const
+        {
+            const std::uint32_t uidId = snapshot.find(uid);
+            const std::uint32_t domainId = snapshot.find(domain);
+            const std::uint32_t interfaceId = snapshot.find(interfaceName);
+            const std::uint32_t wildcardId = snapshot._wildcardId;
+
+            if (const Entry* entry = lookupExact(uidId, domainId, interfaceId)) {
+                return entry;
+            }
+            if (const Entry* entry = lookupExact(wildcardId, domainId, interfaceId)) {
+                return entry;
+            }
+            if (const Entry* entry = lookupWildcard(uidId, domain, domainId, interfaceName)) {
+                return entry;
+            }
+            return lookupWildcard(wildcardId, domain, domainId, interfaceName);
+        }
+
+    private:
+        DISALLOW_COPY_AND_ASSIGN(CompiledTable);
+
+        struct Key {
+            std::uint32_t uid;
+            std::uint32_t domain;
+            std::uint32_t interfaceName;
+
+            bool operator==(const Key& other) const
+            {
+                return uid == other.uid && domain == other.domain &&
+                       interfaceName == other.interfaceName;
+            }
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const
+            {
+                const std::uint64_t value =
+                        (static_cast<std::uint64_t>(key.domain) << 32) | key.interfaceName;
+                return static_cast<std::size_t>(combine(key.uid, value * 0xC2B2AE3D27D4EB4FULL));
+            }
+        };
+
+        using Candidates = std::unordered_map<std::uint64_t, std::vector<std::uint32_t>>;
+
+        const Entry* lookupExact(std::uint32_t uidId,
+                                 std::uint32_t domainId,
+                                 std::uint32_t interfaceId) const
+        {
+            if (uidId == _unknownId || domainId == _unknownId || interfaceId == _unknownId) {
+                return nullptr;
+            }
+            auto it = _exact.find(Key{uidId, domainId, interfaceId});
+            return it == _exact.cend() ? nullptr : &_entries[it->second];
+        }
+
+        const Entry* lookupWildcard(std::uint32_t uidId,
+                                    const std::string& domain,
+                                    std::uint32_t domainId,
+                                    const std::string& interfaceName) const
+        {
+            if (uidId == _unknownId) {
+                return nullptr;
+            }
+
+            // an exact domain takes precedence over a wildcard domain
+            if (domainId != _unknownId) {
+                auto it = _byDomain.find(combine(uidId, domainId));
+                if (it != _byDomain.cend()) {
+                    for (std::uint32_t index : it->second) {
+                        if (matches(_entries[index].getInterfaceName(), interfaceName)) {
+                            return &_entries[index];
+                        }
+                    }
+                }
+            }
+
+            // longest domain prefix first, different prefixes may share a hash bucket
+            for (std::size_t prefixLength : _domainPrefixLengths) {
+                if (prefixLength > domain.size()) {
+                    continue;
+                }
+                auto it = _byDomainPrefix.find(combine(uidId, prefixHash(domain, prefixLength)));
+                if (it == _byDomainPrefix.cend()) {
+                    continue;
+                }
+                for (std::uint32_t index : it->second) {
+                    const Entry& entry = _entries[index];
+                    if (_uidIds[index] == uidId && entry.getDomain().size() == prefixLength + 1 &&
+                        matches(entry.getDomain(), domain) &&
+                        matches(entry.getInterfaceName(), interfaceName)) {
+                        return &entry;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        std::vector<Entry> _entries;
+        std::vector<std::uint32_t> _uidIds;
+        std::unordered_map<Key, std::uint32_t, KeyHash> _exact;
+        // entries with an exact domain and a wildcard interface, by uid and domain
+        Candidates _byDomain;
+        // entries with a wildcard domain, by uid and domain prefix
+        Candidates _byDomainPrefix;
+        // distinct lengths of all domain prefixes, longest first
+        std::vector<std::size_t> _domainPrefixLengths;
+    };
+
+    std::unordered_map<std::string, std::uint32_t> _ids;
+    const std::uint32_t _wildcardId;
+    const CompiledTable<dac::MasterAccessControlEntry> _masterAccess;
+    const CompiledTable<dac::MediatorAccessControlEntry> _mediatorAccess;
+    const CompiledTable<dac::OwnerAccessControlEntry> _ownerAccess;
+    const CompiledTable<dac::MasterRegistrationControlEntry> _masterRegistration;
+    const CompiledTable<dac::MediatorRegistrationControlEntry> _mediatorRegistration;
+    const CompiledTable<dac::OwnerRegistrationControlEntry> _ownerRegistration;
+};
+
+/*
+ * Copies an entry returned by an AccessControlSnapshot lookup for the getters of the
+ * LocalDomainAccessStore, permission checks use the entries in place.
+ */
+template <typename Entry>
+boost::optional<Entry> toOptional(const Entry* entry)
+{
+    if (entry == nullptr) {
+        return boost::none;
+    }
+    return *entry;
+}
+
+} // namespace access_control
+} // namespace joynr
+
+#endif // ACCESSCONTROLSNAPSHOT_H
@@ -20,13 +20,16 @@
 #include "AccessController.h"
 
 #include <cassert>
+#include <chrono>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include "joynr/BroadcastSubscriptionRequest.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/LocalCapabilitiesDirectory.h"
 #include "joynr/Message.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastSubscriptionRequest.h"
 #include "joynr/OneWayRequest.h"
 #include "joynr/Request.h"
@@ -120,8 +123,9 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
 
     assert(!_message->isEncrypted());
     std::string operation;
-    const std::string& messageType = _message->getType();
-    if (messageType == Message::VALUE_MESSAGE_TYPE_ONE_WAY()) {
+    std::vector<std::string> operations;
+    const MessageType messageType = _message->getMessageType();
+    if (messageType == MessageType::ONE_WAY) {
         try {
             OneWayRequest request;
             joynr::serializer::deserializeFromJson(request, _message->getUnencryptedBody());
@@ -129,7 +133,7 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
         } catch (const std::exception& e) {
             JOYNR_LOG_ERROR(logger(), "could not deserialize OneWayRequest - error {}", e.what());
         }
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_REQUEST()) {
+    } else if (messageType == MessageType::REQUEST) {
         try {
             Request request;
             joynr::serializer::deserializeFromJson(request, _message->getUnencryptedBody());
@@ -137,7 +141,22 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
         } catch (const std::exception& e) {
             JOYNR_LOG_ERROR(logger(), "could not deserialize Request - error {}", e.what());
         }
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST()) {
+    } else if (messageType == MessageType::BATCH_REQUEST) {
+        try {
+            std::vector<Request> requests;
+            joynr::serializer::deserializeFromJson(requests, _message->getUnencryptedBody());
+            for (const Request& request : requests) {
+                if (request.getMethodName().empty()) {
+                    // a single request without operation rejects the whole batch
+                    operations.clear();
+                    break;
+                }
+                operations.push_back(request.getMethodName());
+            }
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(), "could not deserialize batch Request - error {}", e.what());
+        }
+    } else if (messageType == MessageType::SUBSCRIPTION_REQUEST) {
         try {
             SubscriptionRequest request;
             joynr::serializer::deserializeFromJson(request, _message->getUnencryptedBody());
@@ -147,7 +166,7 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
             JOYNR_LOG_ERROR(
                     logger(), "could not deserialize SubscriptionRequest - error {}", e.what());
         }
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST()) {
+    } else if (messageType == MessageType::BROADCAST_SUBSCRIPTION_REQUEST) {
         try {
             BroadcastSubscriptionRequest request;
             joynr::serializer::deserializeFromJson(request, _message->getUnencryptedBody());
@@ -158,7 +177,7 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
                             "could not deserialize BroadcastSubscriptionRequest - error {}",
                             e.what());
         }
-    } else if (messageType == Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+    } else if (messageType == MessageType::MULTICAST_SUBSCRIPTION_REQUEST) {
         try {
             MulticastSubscriptionRequest request;
             joynr::serializer::deserializeFromJson(request, _message->getUnencryptedBody());
@@ -170,34 +189,98 @@ void AccessController::LdacConsumerPermissionCallback::operationNeeded()
         }
     }
 
-    if (operation.empty()) {
+    if (!operation.empty()) {
+        operations.push_back(std::move(operation));
+    }
+    if (operations.empty()) {
         JOYNR_LOG_ERROR(_owningAccessController.logger(), "Could not deserialize request");
         _callback->hasConsumerPermission(IAccessController::Enum::NO);
         return;
     }
 
-    // Get the permission for given operation
-    Permission::Enum permission = _owningAccessController.getConsumerPermission(
-            _message->getCreator(), _domain, _interfaceName, operation, _trustlevel);
-    assert(permission != Permission::ASK && "Permission.ASK user dialog not yet implemented.");
-
-    IAccessController::Enum hasPermission = IAccessController::Enum::NO;
-    if (permission == Permission::Enum::YES) {
-        hasPermission = IAccessController::Enum::YES;
-    } else {
-        JOYNR_LOG_ERROR(_owningAccessController.logger(),
-                        "Message {} to domain {}, interface/operation {}/{} from creator {} failed "
-                        "ACL check",
-                        _message->getId(),
-                        _domain,
-                        _interfaceName,
-                        operation,
-                        _message->getCreator());
+    // Get the permission for given operations, a batch request needs permission for all of them
+    IAccessController::Enum hasPermission = IAccessController::Enum::YES;
+    for (const std::string& requestedOperation : operations) {
+        Permission::Enum permission = _owningAccessController.getConsumerPermission(
+                _message->getCreator(), _domain, _interfaceName, requestedOperation, _trustlevel);
+        assert(permission != Permission::ASK && "Permission.ASK user dialog not yet implemented.");
+
+        if (permission != Permission::Enum::YES) {
+            hasPermission = IAccessController::Enum::NO;
+            JOYNR_LOG_ERROR(_owningAccessController.logger(),
+                            "Message {} to domain {}, interface/operation {}/{} from creator {} "
+                            "failed ACL check",
+                            _message->getId(),
+                            _domain,
+                            _interfaceName,
+                            requestedOperation,
+                            _message->getCreator());
+            break;
+        }
     }
 
     _callback->hasConsumerPermission(hasPermission);
 }
 
+//--------- TimedConsumerPermissionCallback ------------------------------------
+
+struct AccessController::ConsumerPermissionMetrics {
+    ConsumerPermissionMetrics()
+    {
+        MetricsRegistry& registry = MetricsRegistry::instance();
+        const std::string help = "Decisions of consumer permission checks";
+        const std::string name = "joynr_cc_acl_consumer_permission_total";
+        latency = registry.getHistogram("joynr_cc_acl_consumer_permission_seconds",
+                                        "Duration of consumer permission checks including the "
+                                        "lookup of the recipient");
+        yes = registry.getCounter(name, help, "result=\"yes\"");
+        no = registry.getCounter(name, help, "result=\"no\"");
+        retry = registry.getCounter(name, help, "result=\"retry\"");
+    }
+
+    std::shared_ptr<LatencyHistogram> latency;
+    std::shared_ptr<MetricsCounter> yes;
+    std::shared_ptr<MetricsCounter> no;
+    std::shared_ptr<MetricsCounter> retry;
+};
+
+class AccessController::TimedConsumerPermissionCallback
+        : public IAccessController::IHasConsumerPermissionCallback
+{
+public:
+    TimedConsumerPermissionCallback(
+            std::shared_ptr<ConsumerPermissionMetrics> metrics,
+            std::shared_ptr<IAccessController::IHasConsumerPermissionCallback> callback)
+            : _metrics(std::move(metrics)),
+              _callback(std::move(callback)),
+              _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    void hasConsumerPermission(IAccessController::Enum hasPermission) override
+    {
+        _metrics->latency->record(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - _start));
+        switch (hasPermission) {
+        case IAccessController::Enum::YES:
+            _metrics->yes->increment();
+            break;
+        case IAccessController::Enum::NO:
+            _metrics->no->increment();
+            break;
+        case IAccessController::Enum::RETRY:
+            _metrics->retry->increment();
+            break;
+        }
+        _callback->hasConsumerPermission(hasPermission);
+    }
+
+private:
+    std::shared_ptr<ConsumerPermissionMetrics> _metrics;
+    std::shared_ptr<IAccessController::IHasConsumerPermissionCallback> _callback;
+    const std::chrono::steady_clock::time_point _start;
+};
+
 //--------- AccessController ---------------------------------------------------
 
 AccessController::AccessController(
@@ -206,7 +289,9 @@ AccessController::AccessController(
         : _localCapabilitiesDirectory(localCapabilitiesDirectory),
           _localDomainAccessStore(localDomainAccessStore),
           _whitelistParticipantIds(),
-          _discoveryQos()
+          _discoveryQos(),
+          _discoveryQosWithLocalOnlyScope(),
+          _consumerPermissionMetrics(std::make_shared<ConsumerPermissionMetrics>())
 {
     _discoveryQos.setDiscoveryScope(types::DiscoveryScope::LOCAL_THEN_GLOBAL);
     _discoveryQos.setDiscoveryTimeout(60000);
@@ -225,11 +310,10 @@ bool AccessController::needsHasConsumerPermissionCheck(const ImmutableMessage& m
         return false;
     }
 
-    const std::string& messageType = message.getType();
-    if (messageType == Message::VALUE_MESSAGE_TYPE_MULTICAST() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_PUBLICATION() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_REPLY() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+    const MessageType messageType = message.getMessageType();
+    if (messageType == MessageType::MULTICAST || messageType == MessageType::PUBLICATION ||
+        messageType == MessageType::REPLY || messageType == MessageType::BATCH_REPLY ||
+        messageType == MessageType::SUBSCRIPTION_REPLY) {
         // reply messages don't need permission check
         // they are filtered by request reply ID or subscritpion ID
         return false;
@@ -259,6 +343,8 @@ void AccessController::hasConsumerPermission(
         callback->hasConsumerPermission(IAccessController::Enum::YES);
         return;
     }
+    callback = std::make_shared<TimedConsumerPermissionCallback>(_consumerPermissionMetrics,
+                                                                 std::move(callback));
 
     // Get the domain and interface of the message destination
     auto lookupSuccessCallback = [message,
@@ -372,18 +458,21 @@ Permission::Enum AccessController::getConsumerPermission(const std::string& user
                     domain,
                     interfaceName);
 
-    boost::optional<MasterAccessControlEntry> masterAceOptional =
-            _localDomainAccessStore->getMasterAccessControlEntry(
-                    userId, domain, interfaceName, operation);
-    boost::optional<MasterAccessControlEntry> mediatorAceOptional =
-            _localDomainAccessStore->getMediatorAccessControlEntry(
-                    userId, domain, interfaceName, operation);
-    boost::optional<OwnerAccessControlEntry> ownerAceOptional =
-            _localDomainAccessStore->getOwnerAccessControlEntry(
-                    userId, domain, interfaceName, operation);
+    // all entries are looked up in the same snapshot, concurrent ACL updates are not mixed in;
+    // the entries are used in place, the snapshot is pinned until this thread fetches another
+    const access_control::AccessControlSnapshot& snapshot =
+            *_localDomainAccessStore->getAccessControlSnapshot();
+    // ignoring operation as not yet supported
+    std::ignore = operation;
+    const MasterAccessControlEntry* masterAce =
+            snapshot.getMasterAccessControlEntry(userId, domain, interfaceName);
+    const MasterAccessControlEntry* mediatorAce =
+            snapshot.getMediatorAccessControlEntry(userId, domain, interfaceName);
+    const OwnerAccessControlEntry* ownerAce =
+            snapshot.getOwnerAccessControlEntry(userId, domain, interfaceName);
 
     return _accessControlAlgorithm.getConsumerPermission(
-            masterAceOptional, mediatorAceOptional, ownerAceOptional, trustLevel);
+            masterAce, mediatorAce, ownerAce, trustLevel);
 }
 
 void AccessController::getProviderPermission(
@@ -409,16 +498,17 @@ Permission::Enum AccessController::getProviderPermission(const std::string& uid,
                     domain,
                     interfaceName);
 
-    boost::optional<MasterRegistrationControlEntry> masterRceOptional =
-            _localDomainAccessStore->getMasterRegistrationControlEntry(uid, domain, interfaceName);
-    boost::optional<MasterRegistrationControlEntry> mediatorRceOptional =
-            _localDomainAccessStore->getMediatorRegistrationControlEntry(
-                    uid, domain, interfaceName);
-    boost::optional<OwnerRegistrationControlEntry> ownerRceOptional =
-            _localDomainAccessStore->getOwnerRegistrationControlEntry(uid, domain, interfaceName);
+    const access_control::AccessControlSnapshot& snapshot =
+            *_localDomainAccessStore->getAccessControlSnapshot();
+    const MasterRegistrationControlEntry* masterRce =
+            snapshot.getMasterRegistrationControlEntry(uid, domain, interfaceName);
+    const MasterRegistrationControlEntry* mediatorRce =
+            snapshot.getMediatorRegistrationControlEntry(uid, domain, interfaceName);
+    const OwnerRegistrationControlEntry* ownerRce =
+            snapshot.getOwnerRegistrationControlEntry(uid, domain, interfaceName);
 
     return _accessControlAlgorithm.getProviderPermission(
-            masterRceOptional, mediatorRceOptional, ownerRceOptional, trustLevel);
+            masterRce, mediatorRce, ownerRce, trustLevel);
 }
 
 } // namespace joynr
@@ -92,6 +92,8 @@ public:
 
 protected:
     class LdacConsumerPermissionCallback;
+    class TimedConsumerPermissionCallback;
+    struct ConsumerPermissionMetrics;
 
     /**
      * Get consumer permission to access an interface
@@ -176,6 +178,7 @@ protected:
     std::vector<std::string> _whitelistParticipantIds;
     types::DiscoveryQos _discoveryQos;
     types::DiscoveryQos _discoveryQosWithLocalOnlyScope;
+    std::shared_ptr<ConsumerPermissionMetrics> _consumerPermissionMetrics;
 
     ADD_LOGGER(AccessController)
 };
@@ -20,7 +20,12 @@
 #include "LocalDomainAccessStore.h"
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
 
+#include "joynr/AsyncFileWriter.h"
 #include "joynr/Util.h"
 #include "joynr/infrastructure/DacTypes/OwnerRegistrationControlEntry.h"
 
@@ -30,16 +35,37 @@ namespace joynr
 {
 using namespace infrastructure::DacTypes;
 
-LocalDomainAccessStore::LocalDomainAccessStore() : persistenceFileName()
+namespace
 {
+
+std::uint64_t nextAccessControlSnapshotGeneration()
+{
+    static std::atomic<std::uint64_t> generation(0);
+    return ++generation;
 }
 
-LocalDomainAccessStore::LocalDomainAccessStore(std::string fileName)
+} // namespace
+
+LocalDomainAccessStore::LocalDomainAccessStore()
+        : persistenceFileName(),
+          fileWriter(),
+          accessControlSnapshotGeneration(nextAccessControlSnapshotGeneration()),
+          accessControlSnapshotMutex(),
+          accessControlSnapshot(),
+          accessControlSnapshotCompiledGeneration(0)
+{
+}
+
+LocalDomainAccessStore::LocalDomainAccessStore(std::string fileName,
+                                               std::shared_ptr<AsyncFileWriter> asyncFileWriter)
+        : LocalDomainAccessStore()
 {
     if (fileName.empty()) {
         return;
     }
 
+    fileWriter = std::move(asyncFileWriter);
+
     persistenceFileName = std::move(fileName);
 
     try {
@@ -56,8 +82,7 @@ LocalDomainAccessStore::LocalDomainAccessStore(std::string fileName)
                         ex.what());
     }
 
-    // insert all entries into wildcard storage
-    applyForAllTables([this](auto& entryParam) { addToWildcardStorage(entryParam); });
+    invalidateAccessControlSnapshot();
 }
 
 LocalDomainAccessStore::~LocalDomainAccessStore() = default;
@@ -89,13 +114,55 @@ void LocalDomainAccessStore::logContent()
                     serializer::serializeToJson(ownerRegistrationTable));
 
     JOYNR_LOG_TRACE(logger(), "domainRoleTable: {}", serializer::serializeToJson(domainRoleTable));
+}
 
-    JOYNR_LOG_TRACE(logger(), "domainWildcardStorage: {}", domainWildcardStorage.toString());
+bool LocalDomainAccessStore::mergeDomainAccessStore(const LocalDomainAccessStore& other)
+{
+    const bool success = mergeTables(other);
+    // publish all merged entries at once, also if the merge failed halfway
+    WriteLocker lock(readWriteLock);
+    invalidateAccessControlSnapshot();
+    return success;
+}
 
-    JOYNR_LOG_TRACE(logger(), "interfaceWildcardStorage: {}", interfaceWildcardStorage.toString());
+const std::shared_ptr<const access_control::AccessControlSnapshot>& LocalDomainAccessStore::
+        getAccessControlSnapshot() const
+{
+    struct CachedSnapshot {
+        std::uint64_t generation;
+        std::shared_ptr<const access_control::AccessControlSnapshot> snapshot;
+    };
+    thread_local CachedSnapshot cached{0, nullptr};
+
+    if (cached.generation != accessControlSnapshotGeneration.load(std::memory_order_acquire)) {
+        // the generation cannot change while the tables are read locked
+        ReadLocker lock(readWriteLock);
+        std::lock_guard<std::mutex> snapshotLock(accessControlSnapshotMutex);
+        const std::uint64_t generation =
+                accessControlSnapshotGeneration.load(std::memory_order_relaxed);
+        if (accessControlSnapshotCompiledGeneration != generation) {
+            accessControlSnapshot = std::make_shared<access_control::AccessControlSnapshot>(
+                    masterAccessTable,
+                    mediatorAccessTable,
+                    ownerAccessTable,
+                    masterRegistrationTable,
+                    mediatorRegistrationTable,
+                    ownerRegistrationTable);
+            accessControlSnapshotCompiledGeneration = generation;
+        }
+        cached.generation = generation;
+        cached.snapshot = accessControlSnapshot;
+    }
+    return cached.snapshot;
 }
 
-bool LocalDomainAccessStore::mergeDomainAccessStore(const LocalDomainAccessStore& other)
+void LocalDomainAccessStore::invalidateAccessControlSnapshot()
+{
+    accessControlSnapshotGeneration.store(
+            nextAccessControlSnapshotGeneration(), std::memory_order_release);
+}
+
+bool LocalDomainAccessStore::mergeTables(const LocalDomainAccessStore& other)
 {
     if (!mergeTable(other.domainRoleTable, domainRoleTable)) {
         JOYNR_LOG_ERROR(logger(), "Could not merge domainRoleTable");
@@ -247,7 +314,8 @@ boost::optional<MasterAccessControlEntry> LocalDomainAccessStore::getMasterAcces
                     uid,
                     domain,
                     interfaceName);
-    return lookupOptionalWithWildcard(masterAccessTable, uid, domain, interfaceName);
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getMasterAccessControlEntry(uid, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateMasterAccessControlEntry(
@@ -330,8 +398,9 @@ boost::optional<MasterAccessControlEntry> LocalDomainAccessStore::getMediatorAcc
                     uid,
                     domain,
                     interfaceName);
-    return convertMediator(
-            lookupOptionalWithWildcard(mediatorAccessTable, uid, domain, interfaceName));
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getMediatorAccessControlEntry(
+                    uid, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateMediatorAccessControlEntry(
@@ -350,7 +419,7 @@ bool LocalDomainAccessStore::updateMediatorAccessControlEntry(
                                         updatedMediatorAce.getDomain(),
                                         updatedMediatorAce.getInterfaceName(),
                                         updatedMediatorAce.getOperation());
-    AceValidator aceValidator(masterAceOptional, updatedMediatorAce, boost::none);
+    AceValidator aceValidator(masterAceOptional.get_ptr(), &updatedMediatorAce, nullptr);
 
     if (aceValidator.isMediatorValid()) {
         // Add/update a mediator ACE
@@ -424,7 +493,8 @@ boost::optional<OwnerAccessControlEntry> LocalDomainAccessStore::getOwnerAccessC
                     userId,
                     domain,
                     interfaceName);
-    return lookupOptionalWithWildcard(ownerAccessTable, userId, domain, interfaceName);
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getOwnerAccessControlEntry(userId, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateOwnerAccessControlEntry(
@@ -449,7 +519,8 @@ bool LocalDomainAccessStore::updateOwnerAccessControlEntry(
                                           updatedOwnerAce.getDomain(),
                                           updatedOwnerAce.getInterfaceName(),
                                           updatedOwnerAce.getOperation());
-    AceValidator aceValidator(masterAceOptional, mediatorAceOptional, updatedOwnerAce);
+    AceValidator aceValidator(
+            masterAceOptional.get_ptr(), mediatorAceOptional.get_ptr(), &updatedOwnerAce);
 
     if (aceValidator.isOwnerValid()) {
         updateSuccess = insertOrReplace(ownerAccessTable, updatedOwnerAce);
@@ -507,7 +578,9 @@ boost::optional<MasterRegistrationControlEntry> LocalDomainAccessStore::
                     uid,
                     domain,
                     interfaceName);
-    return lookupOptionalWithWildcard(masterRegistrationTable, uid, domain, interfaceName);
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getMasterRegistrationControlEntry(
+                    uid, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateMasterRegistrationControlEntry(
@@ -568,8 +641,9 @@ boost::optional<MasterRegistrationControlEntry> LocalDomainAccessStore::
                     uid,
                     domain,
                     interfaceName);
-    return convertMediator(
-            lookupOptionalWithWildcard(mediatorRegistrationTable, uid, domain, interfaceName));
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getMediatorRegistrationControlEntry(
+                    uid, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateMediatorRegistrationControlEntry(
@@ -587,7 +661,7 @@ bool LocalDomainAccessStore::updateMediatorRegistrationControlEntry(
             getMasterRegistrationControlEntry(updatedMediatorRce.getUid(),
                                               updatedMediatorRce.getDomain(),
                                               updatedMediatorRce.getInterfaceName());
-    RceValidator rceValidator(masterRceOptional, updatedMediatorRce, boost::none);
+    RceValidator rceValidator(masterRceOptional.get_ptr(), &updatedMediatorRce, nullptr);
 
     if (rceValidator.isMediatorValid()) {
         // Add/update a mediator RCE
@@ -641,7 +715,9 @@ boost::optional<OwnerRegistrationControlEntry> LocalDomainAccessStore::
                     userId,
                     domain,
                     interfaceName);
-    return lookupOptionalWithWildcard(ownerRegistrationTable, userId, domain, interfaceName);
+    return access_control::toOptional(
+            getAccessControlSnapshot()->getOwnerRegistrationControlEntry(
+                    userId, domain, interfaceName));
 }
 
 bool LocalDomainAccessStore::updateOwnerRegistrationControlEntry(
@@ -664,7 +740,8 @@ bool LocalDomainAccessStore::updateOwnerRegistrationControlEntry(
             getMediatorRegistrationControlEntry(updatedOwnerRce.getUid(),
                                                 updatedOwnerRce.getDomain(),
                                                 updatedOwnerRce.getInterfaceName());
-    RceValidator rceValidator(masterRceOptional, mediatorRceOptional, updatedOwnerRce);
+    RceValidator rceValidator(
+            masterRceOptional.get_ptr(), mediatorRceOptional.get_ptr(), &updatedOwnerRce);
 
     if (rceValidator.isOwnerValid()) {
         // Add/update a mediator RCE
@@ -706,8 +783,13 @@ void LocalDomainAccessStore::persistToFile() const
         return;
     }
     try {
-        joynr::util::saveStringToFile(
-                persistenceFileName, joynr::serializer::serializeToJson(*this));
+        // the JSON is created under the lock of the caller, so it is a consistent snapshot
+        std::string serializedStore = joynr::serializer::serializeToJson(*this);
+        if (fileWriter) {
+            fileWriter->replace(persistenceFileName, std::move(serializedStore));
+        } else {
+            joynr::util::saveStringToFileAtomically(persistenceFileName, serializedStore);
+        }
     } catch (const std::invalid_argument& ex) {
         JOYNR_LOG_ERROR(logger(), "serializing to JSON failed: {}", ex.what());
     } catch (const std::runtime_error& ex) {
@@ -715,14 +797,6 @@ void LocalDomainAccessStore::persistToFile() const
     }
 }
 
-bool LocalDomainAccessStore::endsWithWildcard(const std::string& value) const
-{
-    if (value.empty()) {
-        return false;
-    }
-    return value.back() == *joynr::access_control::WILDCARD;
-}
-
 void LocalDomainAccessStore::logControlEntry(
         const MasterAccessControlEntry& masterAccessControlEntry,
         const std::string title)
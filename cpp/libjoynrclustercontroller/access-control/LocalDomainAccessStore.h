@@ -20,7 +20,10 @@
 #ifndef LOCALDOMAINACCESSSTORE_H
 #define LOCALDOMAINACCESSSTORE_H
 
-#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -40,16 +43,24 @@
 #include "joynr/infrastructure/DacTypes/Role.h"
 #include "joynr/serializer/Serializer.h"
 
+#include "AccessControlSnapshot.h"
 #include "AccessControlUtils.h"
-#include "WildcardStorage.h"
 
 namespace joynr
 {
+class AsyncFileWriter;
+
 class JOYNRCLUSTERCONTROLLER_EXPORT LocalDomainAccessStore
 {
 public:
     LocalDomainAccessStore();
-    explicit LocalDomainAccessStore(std::string fileName);
+    /**
+     * @param fileName file the entries are loaded from and persisted to
+     * @param asyncFileWriter if set, the entries are persisted in the background, otherwise
+     * every change writes the file before it returns
+     */
+    explicit LocalDomainAccessStore(std::string fileName,
+                                    std::shared_ptr<AsyncFileWriter> asyncFileWriter = nullptr);
     virtual ~LocalDomainAccessStore();
 
     /**
@@ -607,17 +618,34 @@ public:
      */
     bool mergeDomainAccessStore(const LocalDomainAccessStore& other);
 
+    /**
+     * Returns the current precompiled snapshot of all control entry tables. Permission checks
+     * should use a single snapshot for all lookups, the snapshot is never modified but replaced
+     * after changes of the store.
+     *
+     * Every thread caches the snapshot it used last. As long as the store is not changed, this
+     * call only compares a generation counter and neither locks nor allocates. After a change,
+     * the first caller recompiles the snapshot, so a series of changes costs one compilation.
+     *
+     * The returned reference is valid until the next call on the same thread, copy the
+     * shared_ptr to keep the snapshot longer.
+     */
+    const std::shared_ptr<const access_control::AccessControlSnapshot>& getAccessControlSnapshot()
+            const;
+
     // Use the logger to print content of entire access store
     void logContent();
 
 private:
     ADD_LOGGER(LocalDomainAccessStore)
     void persistToFile() const;
-    bool endsWithWildcard(const std::string& value) const;
+    bool mergeTables(const LocalDomainAccessStore& other);
+    // marks the snapshot as outdated, the caller must hold the write lock
+    void invalidateAccessControlSnapshot();
 
     std::string persistenceFileName;
+    std::shared_ptr<AsyncFileWriter> fileWriter;
     mutable ReadWriteLock readWriteLock;
-    mutable ReadWriteLock readWriteLockWildcard;
 
     using MasterAccessControlTable =
             access_control::TableMaker<access_control::dac::MasterAccessControlEntry>::Type;
@@ -646,8 +674,13 @@ private:
     using DomainRoleTable = access_control::domain_role::Table;
     DomainRoleTable domainRoleTable;
 
-    joynr::access_control::WildcardStorage domainWildcardStorage;
-    joynr::access_control::WildcardStorage interfaceWildcardStorage;
+    // changed with every change of the tables, unique across all stores so that a snapshot
+    // cached by a thread is identified by its generation alone
+    std::atomic<std::uint64_t> accessControlSnapshotGeneration;
+    // guards the compiled snapshot, only taken by readers which have to refresh their cache
+    mutable std::mutex accessControlSnapshotMutex;
+    mutable std::shared_ptr<const access_control::AccessControlSnapshot> accessControlSnapshot;
+    mutable std::uint64_t accessControlSnapshotCompiledGeneration;
 
     template <typename Table, typename Value = typename Table::value_type, typename... Args>
     std::vector<Value> getEqualRange(const Table& table, Args&&... args) const
@@ -671,6 +704,9 @@ private:
         if (it != table.end()) {
             success = true;
             table.erase(it);
+            if (!std::is_same<Table, DomainRoleTable>::value) {
+                invalidateAccessControlSnapshot();
+            }
         }
         persistToFile();
         return success;
@@ -731,34 +767,15 @@ private:
             success = table.replace(result.first, updatedEntry);
         }
 
-        addToWildcardStorage(updatedEntry);
-
+        // entries merged from another store are published at once by mergeDomainAccessStore
         if (persist) {
+            invalidateAccessControlSnapshot();
             persistToFile();
         }
 
         return success;
     }
 
-    template <typename Fun, typename TableType>
-    void applyForTable(Fun f, TableType& table)
-    {
-        for (auto& entry : table) {
-            f(entry);
-        }
-    }
-
-    template <typename Fun>
-    void applyForAllTables(Fun f)
-    {
-        applyForTable(f, masterAccessTable);
-        applyForTable(f, mediatorAccessTable);
-        applyForTable(f, ownerAccessTable);
-        applyForTable(f, masterRegistrationTable);
-        applyForTable(f, mediatorRegistrationTable);
-        applyForTable(f, ownerRegistrationTable);
-    }
-
     template <typename Table>
     bool mergeTable(const Table& source, Table& dest)
     {
@@ -792,175 +809,6 @@ private:
 
     void logTables();
 
-    template <typename Entry>
-    void addToWildcardStorage(const Entry& updatedEntry)
-    {
-        WriteLocker lock(readWriteLockWildcard);
-
-        // If entry ends with wildcard, then add it to the corresponding WildcardStorage
-        if (endsWithWildcard(updatedEntry.getDomain())) {
-            domainWildcardStorage.insert<access_control::wildcards::Domain>(
-                    updatedEntry.getDomain(), updatedEntry);
-        }
-        if (endsWithWildcard(updatedEntry.getInterfaceName())) {
-            interfaceWildcardStorage.insert<access_control::wildcards::Interface>(
-                    updatedEntry.getInterfaceName(), updatedEntry);
-        }
-    }
-
-    template <typename Value>
-    access_control::WildcardStorage::Set<Value> filterOnUid(
-            const access_control::WildcardStorage::Set<Value>& inputSet,
-            const std::string& uid) const
-    {
-        // look first for the Uid
-        access_control::WildcardStorage::Set<Value> tempResult;
-        for (const auto& entry : inputSet) {
-            auto entryUid = entry.getUid();
-            if (entryUid == uid || entryUid == access_control::WILDCARD) {
-                tempResult.insert(entry);
-            }
-        }
-        return tempResult;
-    }
-
-    bool matchWildcard(const std::string& value, std::string wildcard) const
-    {
-        wildcard.pop_back();
-        return boost::algorithm::starts_with(value, wildcard);
-    }
-
-    template <typename Value>
-    access_control::WildcardStorage::Set<Value> filterForDomain(
-            const access_control::WildcardStorage::OptionalSet<Value>& interfaceSet,
-            const std::string& uid,
-            const std::string& domain) const
-    {
-        assert(interfaceSet);
-
-        // all entries in the set have the same interfaceName (as from RadixTree)
-        access_control::WildcardStorage::Set<Value> tempResult = filterOnUid(*interfaceSet, uid);
-        access_control::WildcardStorage::Set<Value> resultSet;
-
-        // look then at the domain
-        for (const auto& value : tempResult) {
-            if (value.getDomain() == domain) {
-                // exact match
-                resultSet.insert(value);
-            } else if (endsWithWildcard(value.getDomain()) &&
-                       matchWildcard(domain, value.getDomain())) {
-                // wildcard match
-                resultSet.insert(value);
-            }
-        }
-        return resultSet;
-    }
-
-    template <typename Value>
-    access_control::WildcardStorage::Set<Value> filterForInterface(
-            const access_control::WildcardStorage::OptionalSet<Value>& domainSet,
-            const std::string& uid,
-            const std::string& interface) const
-    {
-        assert(domainSet);
-
-        // all entries in the set have the same domain (as from RadixTree)
-        access_control::WildcardStorage::Set<Value> tempResult = filterOnUid(*domainSet, uid);
-        access_control::WildcardStorage::Set<Value> resultSet;
-
-        // look then at the domain
-        for (const auto& value : tempResult) {
-            if (value.getInterfaceName() == interface) {
-                // exact match
-                resultSet.insert(value);
-            } else if (endsWithWildcard(value.getInterfaceName()) &&
-                       matchWildcard(interface, value.getInterfaceName())) {
-                // wildcard match
-                resultSet.insert(value);
-            }
-        }
-        return resultSet;
-    }
-
-    template <typename Value>
-    boost::optional<Value> pickClosest(
-            const access_control::WildcardStorage::Set<Value>& set_1,
-            const access_control::WildcardStorage::Set<Value>& set_2 = {}) const
-    {
-        // ordered set with custom comparator
-        typename access_control::TableViewResultSet<Value>::Type resultSet;
-        for (auto entry : set_1) {
-            resultSet.insert(entry);
-        }
-
-        for (auto entry : set_2) {
-            resultSet.insert(entry);
-        }
-
-        // return top
-        if (resultSet.empty()) {
-            return boost::none;
-        }
-        return *resultSet.begin();
-    }
-
-    template <typename Value>
-    boost::optional<Value> lookupDomainInterfaceWithWildcard(const std::string& uid,
-                                                             const std::string& domain,
-                                                             const std::string& interfaceName) const
-    {
-        ReadLocker lock(readWriteLockWildcard);
-
-        using OptionalSet = access_control::WildcardStorage::OptionalSet<Value>;
-        OptionalSet ifRes = interfaceWildcardStorage.getLongestMatch<Value>(interfaceName);
-        OptionalSet dRes = domainWildcardStorage.getLongestMatch<Value>(domain);
-
-        if (ifRes && dRes) {
-            auto ifSetResult = filterForDomain(ifRes, uid, domain);
-            auto dRetResult = filterForInterface(dRes, uid, interfaceName);
-            // both the domain and interface wildcard results match the input parameters
-            // selection can be done without taking into account all input parameters
-            return pickClosest(ifSetResult, dRetResult);
-        }
-
-        if (ifRes) {
-            auto ifSetResult = filterForDomain(ifRes, uid, domain);
-            // only got a result from the interface wildcard storage
-            return pickClosest(ifSetResult);
-        }
-
-        if (dRes) {
-            // only got a result from the domain wildcard storage
-            auto dRetResult = filterForInterface(dRes, uid, interfaceName);
-            return pickClosest(dRetResult);
-        }
-
-        // no match found
-        return boost::none;
-    }
-
-    template <typename Table, typename Value = typename Table::value_type>
-    boost::optional<Value> lookupOptionalWithWildcard(const Table& table,
-                                                      const std::string& uid,
-                                                      const std::string& domain,
-                                                      const std::string& interfaceName) const
-    {
-        // Exact match
-        boost::optional<Value> entry = lookupOptional(table, uid, domain, interfaceName);
-
-        if (!entry) {
-            // try to match with wildcarded userId
-            entry = lookupOptional(table, access_control::WILDCARD, domain, interfaceName);
-        }
-
-        if (!entry) {
-            // try to match with wildcarded domain and/or interface and uid wildcarded
-            entry = lookupDomainInterfaceWithWildcard<Value>(uid, domain, interfaceName);
-        }
-
-        return entry;
-    }
-
     template <typename Table>
     bool checkOnlyWildcardOperations(const Table& table,
                                      const std::string& userId,
@@ -1025,16 +873,6 @@ private:
         return result;
     }
 
-    boost::optional<access_control::dac::MasterAccessControlEntry> convertMediator(
-            const boost::optional<access_control::dac::MediatorAccessControlEntry>& mediatorEntry)
-    {
-        boost::optional<access_control::dac::MasterAccessControlEntry> result;
-        if (mediatorEntry) {
-            result = *mediatorEntry;
-        }
-        return result;
-    }
-
     std::vector<access_control::dac::MasterRegistrationControlEntry> convertMediator(
             const std::vector<access_control::dac::MediatorRegistrationControlEntry>&
                     mediatorEntries)
@@ -1045,17 +883,6 @@ private:
         }
         return result;
     }
-
-    boost::optional<access_control::dac::MasterRegistrationControlEntry> convertMediator(
-            const boost::optional<access_control::dac::MediatorRegistrationControlEntry>&
-                    mediatorEntry)
-    {
-        boost::optional<access_control::dac::MasterRegistrationControlEntry> result;
-        if (mediatorEntry) {
-            result = *mediatorEntry;
-        }
-        return result;
-    }
 };
 } // namespace joynr
 #endif // LOCALDOMAINACCESSSTORE_H
@@ -20,8 +20,6 @@
 #ifndef ACCESS_CONTROL_VALIDATOR_H
 #define ACCESS_CONTROL_VALIDATOR_H
 
-#include <boost/optional.hpp>
-
 #include "joynr/infrastructure/DacTypes/MasterAccessControlEntry.h"
 #include "joynr/infrastructure/DacTypes/MasterRegistrationControlEntry.h"
 #include "joynr/infrastructure/DacTypes/OwnerAccessControlEntry.h"
@@ -69,12 +67,13 @@ public:
     using MediatorEntry = typename Link::MediatorEntry;
     using OwnerEntry = typename Link::OwnerEntry;
 
-    Validator(const boost::optional<MasterEntry>& masterEntryOptional,
-              const boost::optional<MediatorEntry>& mediatorEntryOptional,
-              const boost::optional<OwnerEntry>& ownerEntryOptional)
-            : _masterEntryOptional(masterEntryOptional),
-              _mediatorEntryOptional(mediatorEntryOptional),
-              _ownerEntryOptional(ownerEntryOptional)
+    /**
+     * The entries are not copied and must outlive the validator, missing entries are nullptr
+     */
+    Validator(const MasterEntry* masterEntry,
+              const MediatorEntry* mediatorEntry,
+              const OwnerEntry* ownerEntry)
+            : _masterEntry(masterEntry), _mediatorEntry(mediatorEntry), _ownerEntry(ownerEntry)
     {
     }
 
@@ -92,10 +91,10 @@ public:
     bool isOwnerValid() const
     {
         bool isOwnerValid = true;
-        if (_mediatorEntryOptional) {
-            isOwnerValid = isMediatorValid() && validateOwner(*_mediatorEntryOptional);
-        } else if (_masterEntryOptional) {
-            isOwnerValid = validateOwner(*_masterEntryOptional);
+        if (_mediatorEntry) {
+            isOwnerValid = isMediatorValid() && validateOwner(*_mediatorEntry);
+        } else if (_masterEntry) {
+            isOwnerValid = validateOwner(*_masterEntry);
         }
 
         return isOwnerValid;
@@ -104,39 +103,39 @@ public:
     bool isMediatorValid() const
     {
         // if mediator entry is missing, always return true
-        if (!_mediatorEntryOptional) {
+        if (!_mediatorEntry) {
             return true;
         }
 
         // if master entry is not set, mediator is valid
-        if (!_masterEntryOptional) {
+        if (!_masterEntry) {
             return true;
         }
 
         bool isMediatorValid = true;
 
         auto masterPossiblePermissions =
-                util::vectorToSet(getPossiblePermissions(*_masterEntryOptional));
-        if (masterPossiblePermissions.count(getDefaultPermission(*_mediatorEntryOptional)) == 0) {
+                util::vectorToSet(getPossiblePermissions(*_masterEntry));
+        if (masterPossiblePermissions.count(getDefaultPermission(*_mediatorEntry)) == 0) {
             isMediatorValid = false;
         } else {
             // Convert the lists to sets so that intersections can be easily calculated
             auto mediatorPossiblePermissions =
-                    util::vectorToSet(getPossiblePermissions(*_mediatorEntryOptional));
+                    util::vectorToSet(getPossiblePermissions(*_mediatorEntry));
             if (!util::setContainsSet(masterPossiblePermissions, mediatorPossiblePermissions)) {
                 isMediatorValid = false;
             }
         }
 
         auto masterPossibleTrustLevels =
-                util::vectorToSet(_masterEntryOptional->getPossibleRequiredTrustLevels());
+                util::vectorToSet(_masterEntry->getPossibleRequiredTrustLevels());
         if (masterPossibleTrustLevels.count(
-                    _mediatorEntryOptional->getDefaultRequiredTrustLevel()) == 0) {
+                    _mediatorEntry->getDefaultRequiredTrustLevel()) == 0) {
             isMediatorValid = false;
         } else {
             // Convert the lists to sets so that intersections can be easily calculated
             auto mediatorPossibleTrustLevels =
-                    util::vectorToSet(_mediatorEntryOptional->getPossibleRequiredTrustLevels());
+                    util::vectorToSet(_mediatorEntry->getPossibleRequiredTrustLevels());
             if (!util::setContainsSet(masterPossibleTrustLevels, mediatorPossibleTrustLevels)) {
                 isMediatorValid = false;
             }
@@ -146,14 +145,14 @@ public:
     }
 
 private:
-    boost::optional<MasterEntry> _masterEntryOptional;
-    boost::optional<MediatorEntry> _mediatorEntryOptional;
-    boost::optional<OwnerEntry> _ownerEntryOptional;
+    const MasterEntry* _masterEntry;
+    const MediatorEntry* _mediatorEntry;
+    const OwnerEntry* _ownerEntry;
 
     bool validateOwner(const MasterEntry& targetMasterEntry) const
     {
         // if owner entry is missing, always return true
-        if (!_ownerEntryOptional) {
+        if (!_ownerEntry) {
             return true;
         }
 
@@ -162,7 +161,7 @@ private:
         if (!ownerPermissionInPossiblePermissions(targetMasterEntry)) {
             isValid = false;
         } else if (!util::vectorContains(possibleRequiredTrustLevels,
-                                         _ownerEntryOptional->getRequiredTrustLevel())) {
+                                         _ownerEntry->getRequiredTrustLevel())) {
             isValid = false;
         }
 
@@ -174,7 +173,7 @@ private:
     {
         const auto& possiblePermissions = targetMasterEntry.getPossibleProviderPermissions();
         return util::vectorContains(
-                possiblePermissions, _ownerEntryOptional->getProviderPermission());
+                possiblePermissions, _ownerEntry->getProviderPermission());
     }
 
     bool ownerPermissionInPossiblePermissions(
@@ -182,7 +181,7 @@ private:
     {
         const auto& possiblePermissions = targetMasterEntry.getPossibleConsumerPermissions();
         return util::vectorContains(
-                possiblePermissions, _ownerEntryOptional->getConsumerPermission());
+                possiblePermissions, _ownerEntry->getConsumerPermission());
     }
 
     auto getPossiblePermissions(
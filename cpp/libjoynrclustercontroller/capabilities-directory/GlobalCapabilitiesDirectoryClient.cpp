@@ -40,13 +40,18 @@ namespace joynr
 
 GlobalCapabilitiesDirectoryClient::GlobalCapabilitiesDirectoryClient(
         const ClusterControllerSettings& clusterControllerSettings,
-        std::unique_ptr<TaskSequencer<void>> taskSequencer)
+        std::unique_ptr<TaskSequencer<void>> taskSequencer,
+        const std::string& gcdGbid)
         : _capabilitiesProxy(nullptr),
           _messagingQos(),
           _touchTtl(static_cast<std::uint64_t>(
                   clusterControllerSettings.getCapabilitiesFreshnessUpdateIntervalMs().count())),
           _removeStaleTtl(60000),
-          _sequentialTasks(std::move(taskSequencer))
+          _sequentialTasks(std::move(taskSequencer)),
+          _gcdGbid(gcdGbid),
+          _sequencingKeys(std::make_shared<SequencingKeys>()),
+          _pendingAddBatch(),
+          _pendingAddBatchMutex()
 {
 }
 
@@ -73,12 +78,10 @@ void GlobalCapabilitiesDirectoryClient::add(
     addMessagingQos.putCustomMessageHeader(Message::CUSTOM_HEADER_GBID_KEY(), gbids[0]);
     using std::move;
     TaskSequencer<void>::TaskWithExpiryDate addTask;
+    const bool entryExpired = TimePoint::now() > TimePoint::fromAbsoluteMs(entry.getExpiryDateMs());
 
     if (!awaitGlobalRegistration) {
-        addTask._expiryDate =
-                (TimePoint::now() > TimePoint::fromAbsoluteMs(entry.getExpiryDateMs()))
-                        ? TimePoint::now()
-                        : TimePoint::max();
+        addTask._expiryDate = entryExpired ? TimePoint::now() : TimePoint::max();
         addTask._timeout = []() {};
     } else {
         addTask._expiryDate =
@@ -96,9 +99,79 @@ void GlobalCapabilitiesDirectoryClient::add(
                                                        std::move(onSuccess),
                                                        std::move(onError),
                                                        std::move(onRuntimeError),
-                                                       std::move(addMessagingQos),
+                                                       addMessagingQos,
                                                        addTask._expiryDate);
 
+    if (!awaitGlobalRegistration && gbids.size() == 1 && gbids[0] == _gcdGbid && !entryExpired) {
+        // Nobody waits for the result of the global registration, so the add is allowed to wait
+        // for the tasks of the batch it joins and to be sent together with them. The multi-entry
+        // add registers the entries in the GBID of the GCD only, hence it is not used for other
+        // GBIDs.
+        const std::string& participantId = entry.getParticipantId();
+        std::lock_guard<std::mutex> lock(_pendingAddBatchMutex);
+        if (_pendingAddBatch &&
+            _sequencingKeys->tryAcquire(participantId, _pendingAddBatch->getKey())) {
+            _pendingAddBatch->join(std::move(addOperation));
+            JOYNR_LOG_DEBUG(logger(),
+                            "Global provider registration joined pending batch: participantId {}, "
+                            "domain {}, interface {}, {}, gbid {}",
+                            participantId,
+                            entry.getDomain(),
+                            entry.getInterfaceName(),
+                            entry.getProviderVersion().toString(),
+                            gbids[0]);
+            return;
+        }
+        if (!_pendingAddBatch && _sequencingKeys->tryAcquire(participantId, participantId)) {
+            auto addBatch = std::make_shared<AddBatch>(
+                    _capabilitiesProxy, gbids[0], std::move(addMessagingQos));
+            addBatch->join(std::move(addOperation));
+            _pendingAddBatch = addBatch;
+
+            TaskSequencer<void>::TaskWithExpiryDate addBatchTask;
+            addBatchTask._expiryDate = TimePoint::max();
+            addBatchTask._timeout = []() {};
+            // The batch and the later tasks of all participantIds joining it use the key of
+            // the batch, see SequencingKeys.
+            addBatchTask._key = participantId;
+            addBatchTask._task = [this, addBatch, sequencingKeys = _sequencingKeys]() {
+                {
+                    std::lock_guard<std::mutex> batchLock(_pendingAddBatchMutex);
+                    if (_pendingAddBatch == addBatch) {
+                        _pendingAddBatch.reset();
+                    }
+                }
+                auto releaseSequencingKeys = [sequencingKeys,
+                                              participantIds = addBatch->getParticipantIds()]() {
+                    for (const std::string& participantId : participantIds) {
+                        sequencingKeys->release(participantId);
+                    }
+                };
+                std::shared_ptr<Future<void>> future;
+                try {
+                    future = addBatch->execute();
+                } catch (...) {
+                    // the TaskSequencer drops the task, its future will never complete
+                    releaseSequencingKeys();
+                    throw;
+                }
+                future->onCompletion(std::move(releaseSequencingKeys));
+                return future;
+            };
+            JOYNR_LOG_DEBUG(logger(),
+                            "Global provider registration scheduled in new batch: participantId "
+                            "{}, domain {}, interface {}, {}, gbid {}",
+                            participantId,
+                            entry.getDomain(),
+                            entry.getInterfaceName(),
+                            entry.getProviderVersion().toString(),
+                            gbids[0]);
+            _sequentialTasks->add(addBatchTask);
+            return;
+        }
+        // the participantId has unfinished tasks which the add must not overtake
+    }
+
     addTask._task = [addOperation]() {
         addOperation->execute();
         return addOperation;
@@ -112,7 +185,7 @@ void GlobalCapabilitiesDirectoryClient::add(
                     entry.getInterfaceName(),
                     entry.getProviderVersion().toString(),
                     awaitGlobalRegistration);
-    _sequentialTasks->add(addTask);
+    queueTask(std::move(addTask), entry.getParticipantId());
 }
 
 void GlobalCapabilitiesDirectoryClient::reAdd(
@@ -203,7 +276,7 @@ void GlobalCapabilitiesDirectoryClient::reAdd(
     };
 
     JOYNR_LOG_DEBUG(logger(), "Re-Add scheduled.");
-    _sequentialTasks->add(reAddTask);
+    queueTask(std::move(reAddTask), std::string());
 }
 
 void GlobalCapabilitiesDirectoryClient::remove(
@@ -233,7 +306,7 @@ void GlobalCapabilitiesDirectoryClient::remove(
     };
 
     JOYNR_LOG_DEBUG(logger(), "Global remove scheduled, participantId {}", participantId);
-    _sequentialTasks->add(removeTask);
+    queueTask(std::move(removeTask), participantId);
 }
 
 void GlobalCapabilitiesDirectoryClient::lookup(
@@ -323,6 +396,77 @@ void GlobalCapabilitiesDirectoryClient::removeStale(
                                          removeStaleMessagingQos);
 }
 
+void GlobalCapabilitiesDirectoryClient::queueTask(TaskSequencer<void>::TaskWithExpiryDate task,
+                                                  const std::string& participantId)
+{
+    if (participantId.empty()) {
+        // no add may overtake the task by joining a batch queued before it
+        std::lock_guard<std::mutex> lock(_pendingAddBatchMutex);
+        _pendingAddBatch.reset();
+        _sequentialTasks->add(task);
+        return;
+    }
+    // the task is finished when its future has completed or when it has expired
+    task._key = _sequencingKeys->acquire(participantId);
+    task._task = [sequencingKeys = _sequencingKeys,
+                  participantId,
+                  createFuture = std::move(task._task)]() {
+        TaskSequencer<void>::FutureSP future;
+        try {
+            future = createFuture();
+        } catch (...) {
+            // the TaskSequencer drops the task, its future will never complete
+            sequencingKeys->release(participantId);
+            throw;
+        }
+        if (!future) {
+            // dropped by the TaskSequencer as well
+            sequencingKeys->release(participantId);
+            return future;
+        }
+        future->onCompletion(
+                [sequencingKeys, participantId]() { sequencingKeys->release(participantId); });
+        return future;
+    };
+    task._timeout = [sequencingKeys = _sequencingKeys,
+                     participantId,
+                     timeout = std::move(task._timeout)]() {
+        timeout();
+        sequencingKeys->release(participantId);
+    };
+    _sequentialTasks->add(task);
+}
+
+std::string GlobalCapabilitiesDirectoryClient::SequencingKeys::acquire(
+        const std::string& participantId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto entry = _entries.find(participantId);
+    if (entry == _entries.end()) {
+        _entries.emplace(participantId, Entry{participantId, 1});
+        return participantId;
+    }
+    ++entry->second._unfinishedTasks;
+    return entry->second._key;
+}
+
+bool GlobalCapabilitiesDirectoryClient::SequencingKeys::tryAcquire(
+        const std::string& participantId,
+        const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.emplace(participantId, Entry{key, 1}).second;
+}
+
+void GlobalCapabilitiesDirectoryClient::SequencingKeys::release(const std::string& participantId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto entry = _entries.find(participantId);
+    if (entry != _entries.end() && --entry->second._unfinishedTasks == 0) {
+        _entries.erase(entry);
+    }
+}
+
 GlobalCapabilitiesDirectoryClient::RetryRemoveOperation::RetryRemoveOperation(
         const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>& capabilitiesProxy,
         const std::string& participantId,
@@ -508,6 +652,12 @@ void GlobalCapabilitiesDirectoryClient::AddOperation::execute()
     }
 }
 
+const types::GlobalDiscoveryEntry& GlobalCapabilitiesDirectoryClient::AddOperation::
+        getGlobalDiscoveryEntry() const
+{
+    return _globalDiscoveryEntry;
+}
+
 void GlobalCapabilitiesDirectoryClient::AddOperation::forwardSuccess()
 {
     if (_onSuccess) {
@@ -539,4 +689,105 @@ void GlobalCapabilitiesDirectoryClient::AddOperation::retryOrForwardRuntimeError
     }
 }
 
+GlobalCapabilitiesDirectoryClient::AddBatch::AddBatch(
+        const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>& capabilitiesProxy,
+        const std::string& gbid,
+        MessagingQos qos)
+        : Future<void>(),
+          _capabilitiesProxy{capabilitiesProxy},
+          _gbid{gbid},
+          _addOperations{},
+          _qos{qos}
+{
+}
+
+const std::string& GlobalCapabilitiesDirectoryClient::AddBatch::getKey() const
+{
+    return _addOperations.front()->getGlobalDiscoveryEntry().getParticipantId();
+}
+
+std::vector<std::string> GlobalCapabilitiesDirectoryClient::AddBatch::getParticipantIds() const
+{
+    std::vector<std::string> participantIds;
+    participantIds.reserve(_addOperations.size());
+    for (const auto& addOperation : _addOperations) {
+        participantIds.push_back(addOperation->getGlobalDiscoveryEntry().getParticipantId());
+    }
+    return participantIds;
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatch::join(std::shared_ptr<AddOperation> addOperation)
+{
+    _addOperations.push_back(std::move(addOperation));
+}
+
+std::shared_ptr<Future<void>> GlobalCapabilitiesDirectoryClient::AddBatch::execute()
+{
+    if (_addOperations.size() == 1) {
+        // keep the single-entry add, it reports DiscoveryErrors of the entry
+        _addOperations.front()->execute();
+        return _addOperations.front();
+    }
+    send();
+    return shared_from_this();
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatch::send()
+{
+    std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> capabilitiesProxy =
+            _capabilitiesProxy.lock();
+    if (!capabilitiesProxy) {
+        const exceptions::JoynrRuntimeException proxyNotAvailable(
+                "Add operation retry aborted since proxy not available.");
+        forwardRuntimeError(proxyNotAvailable);
+        onError(std::make_shared<exceptions::JoynrRuntimeException>(proxyNotAvailable));
+        return;
+    }
+    std::vector<types::GlobalDiscoveryEntry> globalDiscoveryEntries;
+    globalDiscoveryEntries.reserve(_addOperations.size());
+    for (const auto& addOperation : _addOperations) {
+        globalDiscoveryEntries.push_back(addOperation->getGlobalDiscoveryEntry());
+    }
+    using std::placeholders::_1;
+    JOYNR_LOG_DEBUG(logger(),
+                    "Global provider registration of {} entries started, gbid {}",
+                    globalDiscoveryEntries.size(),
+                    _gbid);
+    capabilitiesProxy->addAsync(
+            globalDiscoveryEntries,
+            std::bind(&AddBatch::forwardSuccess, shared_from_this()),
+            std::bind(&AddBatch::retryOrForwardRuntimeError, shared_from_this(), _1),
+            _qos);
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatch::forwardSuccess()
+{
+    for (const auto& addOperation : _addOperations) {
+        addOperation->forwardSuccess();
+    }
+    onSuccess();
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatch::retryOrForwardRuntimeError(
+        const exceptions::JoynrRuntimeException& e)
+{
+    if (StatusCodeEnum::IN_PROGRESS != getStatus()) {
+        forwardRuntimeError(exceptions::JoynrRuntimeException("Add operation retry canceled."));
+    } else if (typeid(exceptions::JoynrTimeOutException) == typeid(e)) {
+        send();
+    } else {
+        forwardRuntimeError(e);
+        onError(std::make_shared<exceptions::JoynrRuntimeException>(e));
+    }
+}
+
+void GlobalCapabilitiesDirectoryClient::AddBatch::forwardRuntimeError(
+        const exceptions::JoynrRuntimeException& e)
+{
+    // e is never a JoynrTimeOutException, hence the operations do not retry on their own
+    for (const auto& addOperation : _addOperations) {
+        addOperation->retryOrForwardRuntimeError(e);
+    }
+}
+
 } // namespace joynr
@@ -19,11 +19,13 @@
 #ifndef GLOBALCAPABILITIESDIRECTORYCLIENT_H
 #define GLOBALCAPABILITIESDIRECTORYCLIENT_H
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "joynr/Future.h"
@@ -73,8 +75,14 @@ public:
        To upgrade to a complete GlobalCapabilitiesDirectoryClient the setProxy method must be
        called, and a Proxy must be provided.
      */
+    /*
+       gcdGbid is the GBID of the backend the global capabilities directory itself is
+       registered in. Adds for this GBID which do not await the global registration may be sent
+       in one multi-entry add call.
+     */
     GlobalCapabilitiesDirectoryClient(const ClusterControllerSettings& clusterControllerSettings,
-                                      std::unique_ptr<TaskSequencer<void>> taskSequencer);
+                                      std::unique_ptr<TaskSequencer<void>> taskSequencer,
+                                      const std::string& gcdGbid);
 
     ~GlobalCapabilitiesDirectoryClient() override;
 
@@ -200,11 +208,12 @@ private:
                 const TimePoint& taskExpiryDate);
         ~AddOperation() override = default;
         void execute();
+        const types::GlobalDiscoveryEntry& getGlobalDiscoveryEntry() const;
+        void forwardSuccess();
+        void retryOrForwardRuntimeError(const exceptions::JoynrRuntimeException& e);
 
     private:
-        void forwardSuccess();
         void forwardApplicationError(const types::DiscoveryError::Enum& e);
-        void retryOrForwardRuntimeError(const exceptions::JoynrRuntimeException& e);
         std::weak_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
         types::GlobalDiscoveryEntry _globalDiscoveryEntry;
         bool _awaitGlobalRegistration;
@@ -216,12 +225,91 @@ private:
         TimePoint _taskExpiryDate;
     };
 
+    /*
+     * Add operations which do not await the global registration and target only the GBID of the
+     * GCD. Operations joining the batch before it is started are sent in one multi-entry add
+     * call, which registers the entries in the GBID of the GCD; a batch with a single operation
+     * falls back to the single-entry add.
+     */
+    class AddBatch
+            : public Future<void>,
+              public std::enable_shared_from_this<GlobalCapabilitiesDirectoryClient::AddBatch>
+    {
+    public:
+        AddBatch(const std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy>&
+                         capabilitiesProxy,
+                 const std::string& gbid,
+                 MessagingQos qos);
+        ~AddBatch() override = default;
+        /*
+         * @return the key of the batch in the TaskSequencer, the participantId of the first
+         * operation
+         */
+        const std::string& getKey() const;
+        std::vector<std::string> getParticipantIds() const;
+        void join(std::shared_ptr<AddOperation> addOperation);
+        std::shared_ptr<Future<void>> execute();
+
+    private:
+        void send();
+        void forwardSuccess();
+        void retryOrForwardRuntimeError(const exceptions::JoynrRuntimeException& e);
+        void forwardRuntimeError(const exceptions::JoynrRuntimeException& e);
+        std::weak_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
+        std::string _gbid;
+        std::vector<std::shared_ptr<AddOperation>> _addOperations;
+        MessagingQos _qos;
+    };
+
+    /*
+     * Keys of the TaskSequencer for the participantIds with unfinished tasks. The tasks of a
+     * participantId use its own participantId as key, unless it has joined an add batch: then
+     * the batch and all later tasks of the participantId use the key of the batch until they
+     * have finished, so that they are processed in the order they were added.
+     * Shared with the completion callbacks of the tasks, which may outlive the client.
+     */
+    class SequencingKeys
+    {
+    public:
+        SequencingKeys() = default;
+        /*
+         * @return the key for a new task of the participantId, the task is counted as unfinished
+         */
+        std::string acquire(const std::string& participantId);
+        /*
+         * Counts a new task of the participantId with the given key as unfinished, if the
+         * participantId has no unfinished tasks.
+         * @return false if the participantId has unfinished tasks
+         */
+        bool tryAcquire(const std::string& participantId, const std::string& key);
+        void release(const std::string& participantId);
+
+    private:
+        DISALLOW_COPY_AND_ASSIGN(SequencingKeys);
+        struct Entry {
+            std::string _key;
+            std::size_t _unfinishedTasks;
+        };
+        std::mutex _mutex;
+        std::unordered_map<std::string, Entry> _entries;
+    };
+
+    /*
+     * Queues a task of the participantId, or a task which waits for all tasks added before it
+     * and blocks all tasks added after it if the participantId is empty.
+     */
+    void queueTask(TaskSequencer<void>::TaskWithExpiryDate task, const std::string& participantId);
+
     DISALLOW_COPY_AND_ASSIGN(GlobalCapabilitiesDirectoryClient);
     std::shared_ptr<infrastructure::GlobalCapabilitiesDirectoryProxy> _capabilitiesProxy;
     MessagingQos _messagingQos;
     const std::uint64_t _touchTtl;
     const std::uint64_t _removeStaleTtl;
     std::unique_ptr<TaskSequencer<void>> _sequentialTasks;
+    const std::string _gcdGbid;
+    std::shared_ptr<SequencingKeys> _sequencingKeys;
+    std::shared_ptr<AddBatch> _pendingAddBatch;
+    std::mutex _pendingAddBatchMutex;
     ADD_LOGGER(GlobalCapabilitiesDirectoryClient)
 };
 
@@ -21,15 +21,14 @@
 #include <boost/optional.hpp>
 #include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "joynr/LCDUtil.h"
-#include "joynr/serializer/Serializer.h"
-#include "joynr/system/RoutingTypes/Address.h"
-#include "joynr/system/RoutingTypes/MqttAddress.h"
+#include "joynr/ParsedAddressCache.h"
 #include "joynr/types/DiscoveryEntry.h"
 #include "joynr/types/DiscoveryEntryWithMetaInfo.h"
 #include "joynr/types/GlobalDiscoveryEntry.h"
@@ -98,28 +97,23 @@ bool LCDUtil::containsOnlyEmptyString(const std::vector<std::string> gbids)
 }
 
 void LCDUtil::replaceGbidWithEmptyString(
-        std::vector<joynr::types::GlobalDiscoveryEntry>& capabilities)
+        std::vector<joynr::types::GlobalDiscoveryEntry>& capabilities,
+        ParsedAddressCache& addressCache)
 {
     JOYNR_LOG_TRACE(logger(), "replacing GBID of GDEs with empty string");
     for (auto& cap : capabilities) {
         const auto& serializedAddress = cap.getAddress();
-        std::shared_ptr<system::RoutingTypes::Address> address;
         try {
-            joynr::serializer::deserializeFromJson(address, serializedAddress);
+            // other address types do not contain a GBID, default GBID will be used then for
+            // globalParticipantIdsToGbidsMap
+            cap.setAddress(addressCache.replaceGbidWithEmptyString(serializedAddress));
         } catch (const std::invalid_argument& e) {
             JOYNR_LOG_FATAL(
                     logger(),
                     "could not deserialize Address for GBID replacement from {} - error: {}",
                     serializedAddress,
                     e.what());
-            continue;
         }
-        if (auto mqttAddress = dynamic_cast<system::RoutingTypes::MqttAddress*>(address.get())) {
-            mqttAddress->setBrokerUri("");
-            cap.setAddress(joynr::serializer::serializeToJson(*mqttAddress));
-        }
-        // other address types do not contain a GBID, default GBID will be used then for
-        // globalParticipantIdsToGbidsMap
     }
 }
 
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <ostream>
 #include <tuple>
+#include <typeinfo>
 #include <unordered_set>
 
 #include <boost/algorithm/string/join.hpp>
@@ -44,11 +45,11 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/InterfaceAddress.h"
 #include "joynr/LCDUtil.h"
+#include "joynr/Metrics.h"
 #include "joynr/TimePoint.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/infrastructure/DacTypes/TrustLevel.h"
-#include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/Address.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
 #include "joynr/types/DiscoveryEntry.h"
@@ -58,7 +59,6 @@
 #include "joynr/types/ProviderScope.h"
 
 #include "IGlobalCapabilitiesDirectoryClient.h"
-#include "joynr/Future.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunsafe-loop-optimizations"
@@ -66,6 +66,29 @@
 namespace joynr
 {
 
+namespace
+{
+
+std::string createGlobalLookupKey(const std::vector<std::string>& domains,
+                                  const std::string& interfaceName,
+                                  const std::vector<std::string>& gbids,
+                                  const joynr::types::DiscoveryQos& discoveryQos)
+{
+    // every string is prefixed with its length so that no two lookups share the same key
+    std::string key = joynr::types::DiscoveryScope::getLiteral(discoveryQos.getDiscoveryScope());
+    const auto append = [&key](const std::string& value) {
+        key += fmt::format("|{}:{}", value.size(), value);
+    };
+    append(interfaceName);
+    key += fmt::format("|{}", domains.size());
+    std::for_each(domains.cbegin(), domains.cend(), append);
+    key += fmt::format("|{}", gbids.size());
+    std::for_each(gbids.cbegin(), gbids.cend(), append);
+    return key;
+}
+
+} // namespace
+
 LocalCapabilitiesDirectory::LocalCapabilitiesDirectory(
         ClusterControllerSettings& clusterControllerSettings,
         std::shared_ptr<IGlobalCapabilitiesDirectoryClient> globalCapabilitiesDirectoryClient,
@@ -84,18 +107,39 @@ LocalCapabilitiesDirectory::LocalCapabilitiesDirectory(
           _globalCapabilitiesDirectoryClient(std::move(globalCapabilitiesDirectoryClient)),
           _localCapabilitiesDirectoryStore(localCapabilitiesDirectoryStore),
           _localAddress(localAddress),
+          _addressCache(),
           _pendingLookupsLock(),
           _messageRouter(messageRouter),
           _lcdPendingLookupsHandler(),
+          _globalLookups(),
           _accessController(),
           _checkExpiredDiscoveryEntriesTimer(ioService),
           _freshnessUpdateTimer(ioService),
           _reAddAllGlobalEntriesTimer(ioService),
+          _timerStrand(ioService),
           _clusterControllerId(clusterControllerId),
           _knownGbids(knownGbids),
           _knownGbidsSet(knownGbids.cbegin(), knownGbids.cend()),
           _defaultExpiryIntervalMs(defaultExpiryIntervalMs),
-          _reAddInterval(reAddInterval)
+          _reAddInterval(reAddInterval),
+          _localLookupLatency(MetricsRegistry::instance().getHistogram(
+                  "joynr_cc_lcd_local_lookup_seconds",
+                  "Duration of lookups in the local and cached discovery entries")),
+          _lookupsAnsweredLocally(MetricsRegistry::instance().getCounter(
+                  "joynr_cc_lcd_lookups_total",
+                  "Lookups answered from local or cached entries, forwarded to the GCD or joined "
+                  "to a pending lookup at the GCD",
+                  "source=\"local\"")),
+          _lookupsForwardedToGlobal(MetricsRegistry::instance().getCounter(
+                  "joynr_cc_lcd_lookups_total",
+                  "Lookups answered from local or cached entries, forwarded to the GCD or joined "
+                  "to a pending lookup at the GCD",
+                  "source=\"global\"")),
+          _lookupsJoinedToGlobal(MetricsRegistry::instance().getCounter(
+                  "joynr_cc_lcd_lookups_total",
+                  "Lookups answered from local or cached entries, forwarded to the GCD or joined "
+                  "to a pending lookup at the GCD",
+                  "source=\"joined\""))
 {
 }
 
@@ -124,12 +168,13 @@ void LocalCapabilitiesDirectory::scheduleFreshnessUpdate()
                         timerError.value(),
                         timerError.message());
     }
-    _freshnessUpdateTimer.async_wait([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
-                                             const boost::system::error_code& localTimerError) {
-        if (auto thisSharedPtr = thisWeakPtr.lock()) {
-            thisSharedPtr->sendAndRescheduleFreshnessUpdate(localTimerError);
-        }
-    });
+    _freshnessUpdateTimer.async_wait(
+            _timerStrand.wrap([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                    const boost::system::error_code& localTimerError) {
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->sendAndRescheduleFreshnessUpdate(localTimerError);
+                }
+            }));
 }
 
 void LocalCapabilitiesDirectory::sendAndRescheduleFreshnessUpdate(
@@ -268,12 +313,12 @@ void LocalCapabilitiesDirectory::scheduleReAddAllGlobalDiscoveryEntries()
                         timerError.message());
     }
     _reAddAllGlobalEntriesTimer.async_wait(
-            [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+            _timerStrand.wrap([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
                     const boost::system::error_code& localTimerError) {
                 if (auto thisSharedPtr = thisWeakPtr.lock()) {
                     thisSharedPtr->triggerAndRescheduleReAdd(localTimerError);
                 }
-            });
+            }));
 }
 
 void LocalCapabilitiesDirectory::triggerAndRescheduleReAdd(
@@ -523,23 +568,29 @@ std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectory::getCachedGlobalDi
 }
 
 void LocalCapabilitiesDirectory::capabilitiesReceived(
-        const std::vector<types::GlobalDiscoveryEntry>& receivedGlobalEntries,
-        std::vector<types::DiscoveryEntry>&& localEntries,
-        std::shared_ptr<ILocalCapabilitiesCallback> callback,
-        joynr::types::DiscoveryScope::Enum discoveryScope)
+        std::vector<types::GlobalDiscoveryEntry>&& receivedGlobalEntries,
+        std::function<void(std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries)>
+                onRegistered)
 {
     std::vector<types::GlobalDiscoveryEntry> capabilities;
-    for (types::GlobalDiscoveryEntry globalDiscoveryEntry : receivedGlobalEntries) {
+    for (types::GlobalDiscoveryEntry& globalDiscoveryEntry : receivedGlobalEntries) {
         // check whether this entry exists in the local store. if so, then skip it
-        auto localEntries2 = _localCapabilitiesDirectoryStore->getLocalCapabilities(
+        auto localEntries = _localCapabilitiesDirectoryStore->getLocalCapabilities(
                 globalDiscoveryEntry.getParticipantId());
-        if (localEntries2.empty()) {
+        if (localEntries.empty()) {
             capabilities.push_back(std::move(globalDiscoveryEntry));
         }
     }
     // stores remote entries in global cache
-    auto result = registerReceivedCapabilities(std::move(capabilities));
+    registerReceivedCapabilities(std::move(capabilities), std::move(onRegistered));
+}
 
+std::vector<types::DiscoveryEntryWithMetaInfo> LocalCapabilitiesDirectory::addLocalEntries(
+        std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries,
+        std::vector<types::DiscoveryEntry>&& localEntries,
+        joynr::types::DiscoveryScope::Enum discoveryScope)
+{
+    std::vector<types::DiscoveryEntryWithMetaInfo> result = std::move(globalEntries);
     if (discoveryScope == joynr::types::DiscoveryScope::LOCAL_THEN_GLOBAL ||
         discoveryScope == joynr::types::DiscoveryScope::LOCAL_AND_GLOBAL) {
         auto localEntriesWithMetaInfo = LCDUtil::convert(true, localEntries);
@@ -555,8 +606,7 @@ void LocalCapabilitiesDirectory::capabilitiesReceived(
             }
         }
     }
-
-    callback->capabilitiesReceived(result);
+    return result;
 }
 
 // base lookup by particiapntId
@@ -566,11 +616,18 @@ void LocalCapabilitiesDirectory::lookup(const std::string& participantId,
                                         std::shared_ptr<ILocalCapabilitiesCallback> callback)
 {
     // get the local and cached entries
-    bool receiverCalled = _localCapabilitiesDirectoryStore->getLocalAndCachedCapabilities(
-            participantId, discoveryQos, gbids, callback);
+    bool receiverCalled;
+    {
+        ScopedLatency localLookupLatency(*_localLookupLatency);
+        receiverCalled = _localCapabilitiesDirectoryStore->getLocalAndCachedCapabilities(
+                participantId, discoveryQos, gbids, callback);
+    }
 
     // if no receiver is called, use the global capabilities directory
-    if (!receiverCalled) {
+    if (receiverCalled) {
+        _lookupsAnsweredLocally->increment();
+    } else {
+        _lookupsForwardedToGlobal->increment();
         // search for global entries in the global capabilities directory
         auto onSuccess = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
                           participantId,
@@ -580,16 +637,20 @@ void LocalCapabilitiesDirectory::lookup(const std::string& participantId,
                                  std::vector<joynr::types::GlobalDiscoveryEntry> result) {
             if (auto thisSharedPtr = thisWeakPtr.lock()) {
                 if (replaceGdeGbid) {
-                    LCDUtil::replaceGbidWithEmptyString(result);
+                    LCDUtil::replaceGbidWithEmptyString(result, thisSharedPtr->_addressCache);
                 }
-                std::lock_guard<std::recursive_mutex> cacheLock(
-                        thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
                 thisSharedPtr->capabilitiesReceived(
-                        result,
-                        thisSharedPtr->_localCapabilitiesDirectoryStore->getLocalCapabilities(
-                                participantId),
-                        callback,
-                        discoveryScope);
+                        std::move(result),
+                        [thisWeakPtr, participantId, discoveryScope, callback](
+                                std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries) {
+                            if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                                callback->capabilitiesReceived(thisSharedPtr->addLocalEntries(
+                                        std::move(globalEntries),
+                                        thisSharedPtr->_localCapabilitiesDirectoryStore
+                                                ->getLocalCapabilities(participantId),
+                                        discoveryScope));
+                            }
+                        });
             }
         };
 
@@ -625,98 +686,242 @@ void LocalCapabilitiesDirectory::lookup(const std::vector<std::string>& domains,
             LCDUtil::getInterfaceAddresses(domains, interfaceName);
 
     // get the local and cached entries
-    bool receiverCalled = _localCapabilitiesDirectoryStore->getLocalAndCachedCapabilities(
-            interfaceAddresses, discoveryQos, gbids, callback);
+    bool receiverCalled;
+    {
+        ScopedLatency localLookupLatency(*_localLookupLatency);
+        receiverCalled = _localCapabilitiesDirectoryStore->getLocalAndCachedCapabilities(
+                interfaceAddresses, discoveryQos, gbids, callback);
+    }
 
     // if no receiver is called, use the global capabilities directory
-    if (!receiverCalled) {
-        // search for global entries in the global capabilities directory
-        auto onSuccess = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
-                          interfaceAddresses,
-                          callback,
-                          discoveryQos,
-                          replaceGdeGbid = LCDUtil::containsOnlyEmptyString(gbids)](
-                                 std::vector<joynr::types::GlobalDiscoveryEntry> result) {
-            if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                std::lock_guard<std::recursive_mutex> cacheLock(
-                        thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
-                std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
-                if (!(thisSharedPtr->_lcdPendingLookupsHandler.isCallbackCalled(
-                            interfaceAddresses, callback, discoveryQos))) {
-                    if (replaceGdeGbid) {
-                        LCDUtil::replaceGbidWithEmptyString(result);
+    if (receiverCalled) {
+        _lookupsAnsweredLocally->increment();
+        return;
+    }
+
+    // identical lookups which are issued while a lookup at the global capabilities directory is
+    // still pending are joined to the pending one, unless it would outlive their own discovery
+    // timeout
+    const std::string lookupKey =
+            createGlobalLookupKey(domains, interfaceName, gbids, discoveryQos);
+    const TimePoint expiryDate = TimePoint::fromRelativeMs(discoveryQos.getDiscoveryTimeout());
+    auto globalLookup = std::make_shared<GlobalLookup>(
+            expiryDate, std::vector<GlobalLookup::Waiter>{{callback, expiryDate}});
+    {
+        std::lock_guard<std::mutex> lock(_pendingLookupsLock);
+        if (discoveryQos.getDiscoveryScope() == joynr::types::DiscoveryScope::LOCAL_THEN_GLOBAL) {
+            _lcdPendingLookupsHandler.registerPendingLookup(interfaceAddresses, callback);
+        }
+        auto pendingLookup = _globalLookups.find(lookupKey);
+        if (pendingLookup != _globalLookups.cend() &&
+            pendingLookup->second->_expiryDate <= expiryDate) {
+            pendingLookup->second->_waiters.push_back({callback, expiryDate});
+            _lookupsJoinedToGlobal->increment();
+            return;
+        }
+        _globalLookups[lookupKey] = globalLookup;
+    }
+    _lookupsForwardedToGlobal->increment();
+    sendGlobalLookup(lookupKey, globalLookup, domains, interfaceName, gbids, discoveryQos);
+}
+
+void LocalCapabilitiesDirectory::sendGlobalLookup(const std::string& lookupKey,
+                                                  std::shared_ptr<GlobalLookup> globalLookup,
+                                                  const std::vector<std::string>& domains,
+                                                  const std::string& interfaceName,
+                                                  std::vector<std::string> gbids,
+                                                  const joynr::types::DiscoveryQos& discoveryQos)
+{
+    std::vector<InterfaceAddress> interfaceAddresses =
+            LCDUtil::getInterfaceAddresses(domains, interfaceName);
+
+    // search for global entries in the global capabilities directory
+    auto onSuccess = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                      lookupKey,
+                      globalLookup,
+                      interfaceAddresses,
+                      discoveryQos,
+                      replaceGdeGbid = LCDUtil::containsOnlyEmptyString(gbids)](
+                             std::vector<joynr::types::GlobalDiscoveryEntry> result) {
+        auto thisSharedPtr = thisWeakPtr.lock();
+        if (!thisSharedPtr) {
+            return;
+        }
+        if (replaceGdeGbid) {
+            LCDUtil::replaceGbidWithEmptyString(result, thisSharedPtr->_addressCache);
+        }
+        // the routing entries are added without holding the cache lock and the pending lookups
+        // lock, so other discovery calls are not blocked in the meantime
+        thisSharedPtr->capabilitiesReceived(
+                std::move(result),
+                [thisWeakPtr, lookupKey, globalLookup, interfaceAddresses, discoveryQos](
+                        std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries) {
+                    auto thisSharedPtr = thisWeakPtr.lock();
+                    if (!thisSharedPtr) {
+                        return;
+                    }
+                    std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
+                    auto waiters = thisSharedPtr->finishGlobalLookup(
+                            lookupKey, globalLookup, interfaceAddresses, discoveryQos);
+                    if (waiters.empty()) {
+                        return;
                     }
-                    thisSharedPtr->capabilitiesReceived(
-                            result,
+                    const auto entries = thisSharedPtr->addLocalEntries(
+                            std::move(globalEntries),
                             thisSharedPtr->_localCapabilitiesDirectoryStore->getLocalCapabilities(
                                     interfaceAddresses),
-                            callback,
                             discoveryQos.getDiscoveryScope());
-                    thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(
-                            interfaceAddresses, callback);
-                }
+                    for (const auto& waiter : waiters) {
+                        waiter._callback->capabilitiesReceived(entries);
+                        thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(
+                                interfaceAddresses, waiter._callback);
+                    }
+                });
+    };
+
+    auto onError = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                    lookupKey,
+                    globalLookup,
+                    interfaceAddresses,
+                    domain = domains[0],
+                    interfaceName,
+                    discoveryQos](const types::DiscoveryError::Enum& error) {
+        if (auto thisSharedPtr = thisWeakPtr.lock()) {
+            JOYNR_LOG_DEBUG(logger(),
+                            "Global lookup for domain {} and interface {} failed with "
+                            "DiscoveryError: {}",
+                            domain,
+                            interfaceName,
+                            types::DiscoveryError::getLiteral(error));
+            std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
+            for (const auto& waiter : thisSharedPtr->finishGlobalLookup(
+                         lookupKey, globalLookup, interfaceAddresses, discoveryQos)) {
+                waiter._callback->onError(error);
+                thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(interfaceAddresses,
+                                                                        waiter._callback);
             }
-        };
+        }
+    };
 
-        auto onError = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
-                        interfaceAddresses,
-                        domain = domains[0],
+    auto onRuntimeError = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+                           lookupKey,
+                           globalLookup,
+                           interfaceAddresses,
+                           domains,
+                           interfaceName,
+                           gbids,
+                           discoveryQos](const exceptions::JoynrRuntimeException& exception) {
+        auto thisSharedPtr = thisWeakPtr.lock();
+        if (!thisSharedPtr) {
+            return;
+        }
+        JOYNR_LOG_DEBUG(logger(),
+                        "Global lookup for domain {} and interface {} failed with "
+                        "exception: {} ({})",
+                        domains[0],
                         interfaceName,
-                        callback,
-                        discoveryQos](const types::DiscoveryError::Enum& error) {
-            if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                JOYNR_LOG_DEBUG(logger(),
-                                "Global lookup for domain {} and interface {} failed with "
-                                "DiscoveryError: {}",
-                                domain,
-                                interfaceName,
-                                types::DiscoveryError::getLiteral(error));
-                std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
-                if (!(thisSharedPtr->_lcdPendingLookupsHandler.isCallbackCalled(
-                            interfaceAddresses, callback, discoveryQos))) {
-                    callback->onError(error);
-                    thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(
-                            interfaceAddresses, callback);
-                }
-            }
-        };
+                        exception.getMessage(),
+                        exception.TYPE_NAME());
+        std::unique_lock<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
+        std::vector<GlobalLookup::Waiter> waiters = thisSharedPtr->finishGlobalLookup(
+                lookupKey, globalLookup, interfaceAddresses, discoveryQos);
+        // lookups joined to a timed out lookup are retried for the rest of their own discovery
+        // timeout
+        std::vector<GlobalLookup::Waiter> retriedWaiters;
+        if (typeid(exceptions::JoynrTimeOutException) == typeid(exception)) {
+            auto stillWaiting = std::partition(
+                    waiters.begin(), waiters.end(), [](const GlobalLookup::Waiter& waiter) {
+                        return waiter._expiryDate.relativeFromNow().count() <= 0;
+                    });
+            retriedWaiters.assign(std::make_move_iterator(stillWaiting),
+                                  std::make_move_iterator(waiters.end()));
+            waiters.erase(stillWaiting, waiters.end());
+        }
+        for (const auto& waiter : waiters) {
+            waiter._callback->onError(types::DiscoveryError::INTERNAL_ERROR);
+            thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(interfaceAddresses,
+                                                                    waiter._callback);
+        }
+        if (retriedWaiters.empty()) {
+            return;
+        }
+        auto retriedLookup =
+                thisSharedPtr->joinOrCreateGlobalLookup(lookupKey, std::move(retriedWaiters));
+        lock.unlock();
+        if (retriedLookup) {
+            joynr::types::DiscoveryQos retriedDiscoveryQos = discoveryQos;
+            retriedDiscoveryQos.setDiscoveryTimeout(
+                    retriedLookup->_expiryDate.relativeFromNow().count());
+            thisSharedPtr->sendGlobalLookup(lookupKey,
+                                            std::move(retriedLookup),
+                                            domains,
+                                            interfaceName,
+                                            gbids,
+                                            retriedDiscoveryQos);
+        }
+    };
 
-        auto onRuntimeError = [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
-                               interfaceAddresses,
-                               domain = domains[0],
-                               interfaceName,
-                               callback,
-                               discoveryQos](const exceptions::JoynrRuntimeException& exception) {
-            if (auto thisSharedPtr = thisWeakPtr.lock()) {
-                JOYNR_LOG_DEBUG(logger(),
-                                "Global lookup for domain {} and interface {} failed with "
-                                "exception: {} ({})",
-                                domain,
-                                interfaceName,
-                                exception.getMessage(),
-                                exception.TYPE_NAME());
-                std::lock_guard<std::mutex> lock(thisSharedPtr->_pendingLookupsLock);
-                if (!(thisSharedPtr->_lcdPendingLookupsHandler.isCallbackCalled(
-                            interfaceAddresses, callback, discoveryQos))) {
-                    callback->onError(types::DiscoveryError::INTERNAL_ERROR);
-                    thisSharedPtr->_lcdPendingLookupsHandler.callbackCalled(
-                            interfaceAddresses, callback);
-                }
-            }
-        };
+    _globalCapabilitiesDirectoryClient->lookup(domains,
+                                               interfaceName,
+                                               std::move(gbids),
+                                               discoveryQos.getDiscoveryTimeout(),
+                                               std::move(onSuccess),
+                                               std::move(onError),
+                                               std::move(onRuntimeError));
+}
 
-        if (discoveryQos.getDiscoveryScope() == joynr::types::DiscoveryScope::LOCAL_THEN_GLOBAL) {
-            std::lock_guard<std::mutex> lock(_pendingLookupsLock);
-            _lcdPendingLookupsHandler.registerPendingLookup(interfaceAddresses, callback);
-        }
-        _globalCapabilitiesDirectoryClient->lookup(domains,
-                                                   interfaceName,
-                                                   std::move(gbids),
-                                                   discoveryQos.getDiscoveryTimeout(),
-                                                   std::move(onSuccess),
-                                                   std::move(onError),
-                                                   std::move(onRuntimeError));
+LocalCapabilitiesDirectory::GlobalLookup::GlobalLookup(const TimePoint& expiryDate,
+                                                       std::vector<Waiter>&& waiters)
+        : _expiryDate(expiryDate), _waiters(std::move(waiters))
+{
+}
+
+std::shared_ptr<LocalCapabilitiesDirectory::GlobalLookup> LocalCapabilitiesDirectory::
+        joinOrCreateGlobalLookup(const std::string& lookupKey,
+                                 std::vector<GlobalLookup::Waiter>&& waiters)
+{
+    const TimePoint expiryDate =
+            std::min_element(waiters.cbegin(),
+                             waiters.cend(),
+                             [](const GlobalLookup::Waiter& lhs, const GlobalLookup::Waiter& rhs) {
+                                 return lhs._expiryDate < rhs._expiryDate;
+                             })->_expiryDate;
+    auto pendingLookup = _globalLookups.find(lookupKey);
+    if (pendingLookup != _globalLookups.cend() &&
+        pendingLookup->second->_expiryDate <= expiryDate) {
+        auto& pendingWaiters = pendingLookup->second->_waiters;
+        pendingWaiters.insert(pendingWaiters.end(),
+                              std::make_move_iterator(waiters.begin()),
+                              std::make_move_iterator(waiters.end()));
+        return nullptr;
+    }
+    auto globalLookup = std::make_shared<GlobalLookup>(expiryDate, std::move(waiters));
+    _globalLookups[lookupKey] = globalLookup;
+    return globalLookup;
+}
+
+std::vector<LocalCapabilitiesDirectory::GlobalLookup::Waiter> LocalCapabilitiesDirectory::
+        finishGlobalLookup(const std::string& lookupKey,
+                           const std::shared_ptr<GlobalLookup>& globalLookup,
+                           const std::vector<InterfaceAddress>& interfaceAddresses,
+                           const joynr::types::DiscoveryQos& discoveryQos)
+{
+    // a lookup with an earlier expiry date may already have replaced this one
+    auto pendingLookup = _globalLookups.find(lookupKey);
+    if (pendingLookup != _globalLookups.cend() && pendingLookup->second == globalLookup) {
+        _globalLookups.erase(pendingLookup);
     }
+    std::vector<GlobalLookup::Waiter> waiters;
+    waiters.swap(globalLookup->_waiters);
+    waiters.erase(std::remove_if(waiters.begin(),
+                                 waiters.end(),
+                                 [this, &interfaceAddresses, &discoveryQos](
+                                         const GlobalLookup::Waiter& waiter) {
+                                     return _lcdPendingLookupsHandler.isCallbackCalled(
+                                             interfaceAddresses, waiter._callback, discoveryQos);
+                                 }),
+                  waiters.end());
+    return waiters;
 }
 
 bool LocalCapabilitiesDirectory::hasPendingLookups()
@@ -725,16 +930,24 @@ bool LocalCapabilitiesDirectory::hasPendingLookups()
     return _lcdPendingLookupsHandler.hasPendingLookups();
 }
 
-std::vector<types::DiscoveryEntryWithMetaInfo> LocalCapabilitiesDirectory::
-        registerReceivedCapabilities(
-                const std::vector<types::GlobalDiscoveryEntry>&& capabilityEntries)
+void LocalCapabilitiesDirectory::registerReceivedCapabilities(
+        std::vector<types::GlobalDiscoveryEntry>&& capabilityEntries,
+        std::function<void(std::vector<types::DiscoveryEntryWithMetaInfo>&& validGlobalEntries)>
+                onRegistered)
 {
-    std::vector<types::DiscoveryEntryWithMetaInfo> validGlobalEntries;
-    for (auto currentEntry : capabilityEntries) {
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    std::vector<types::GlobalDiscoveryEntry> entries;
+    std::vector<std::shared_ptr<const system::RoutingTypes::Address>> addresses;
+    std::vector<IMessageRouter::NextHop> nextHops;
+    entries.reserve(capabilityEntries.size());
+    addresses.reserve(capabilityEntries.size());
+    nextHops.reserve(capabilityEntries.size());
+    for (types::GlobalDiscoveryEntry& currentEntry : capabilityEntries) {
         const std::string& serializedAddress = currentEntry.getAddress();
         std::shared_ptr<const system::RoutingTypes::Address> address;
         try {
-            joynr::serializer::deserializeFromJson(address, serializedAddress);
+            address = _addressCache.parse(serializedAddress);
         } catch (const std::invalid_argument& e) {
             JOYNR_LOG_FATAL(logger(),
                             "could not deserialize Address from {} - error: {}",
@@ -742,50 +955,64 @@ std::vector<types::DiscoveryEntryWithMetaInfo> LocalCapabilitiesDirectory::
                             e.what());
             continue;
         }
-
         const bool isGloballyVisible = LCDUtil::isGlobal(currentEntry);
-        if (auto messageRouterSharedPtr = _messageRouter.lock()) {
-            constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
-            const bool isSticky = false;
-            Future<void> future;
-            auto onSuccess = [&]() { future.onSuccess(); };
-            auto onError = [&](const joynr::exceptions::ProviderRuntimeException& e) {
-                future.onError(std::make_shared<exceptions::ProviderRuntimeException>(e));
-            };
-            messageRouterSharedPtr->addNextHop(currentEntry.getParticipantId(),
-                                               address,
-                                               isGloballyVisible,
-                                               expiryDateMs,
-                                               isSticky,
-                                               onSuccess,
-                                               onError);
-
-            try {
-                future.get();
-
-                types::DiscoveryEntryWithMetaInfo convertedEntry =
-                        LCDUtil::convert(false, currentEntry);
-                validGlobalEntries.push_back(std::move(convertedEntry));
-
-                _localCapabilitiesDirectoryStore->insertRemoteEntriesIntoGlobalCache(
-                        currentEntry, address, _knownGbids);
+        nextHops.push_back(IMessageRouter::NextHop{currentEntry.getParticipantId(),
+                                                   address,
+                                                   isGloballyVisible,
+                                                   expiryDateMs,
+                                                   isSticky});
+        addresses.push_back(std::move(address));
+        entries.push_back(std::move(currentEntry));
+    }
 
-            } catch (const joynr::exceptions::JoynrException& e) {
-                JOYNR_LOG_WARN(logger(),
-                               "Failed to register capability entry for participantId: {}, "
-                               "addNextHop failed: {}",
-                               currentEntry.getParticipantId(),
-                               e.what());
-            }
-        } else {
-            JOYNR_LOG_FATAL(logger(),
-                            "could not addNextHop {} to {} because messageRouter is not available",
-                            currentEntry.getParticipantId(),
-                            serializedAddress);
-            return {};
+    if (nextHops.empty()) {
+        if (onRegistered) {
+            onRegistered({});
+        }
+        return;
+    }
+    auto messageRouterSharedPtr = _messageRouter.lock();
+    if (!messageRouterSharedPtr) {
+        JOYNR_LOG_FATAL(logger(),
+                        "could not addNextHop for {} discovery entries because messageRouter is "
+                        "not available",
+                        nextHops.size());
+        if (onRegistered) {
+            onRegistered({});
         }
+        return;
     }
-    return validGlobalEntries;
+    messageRouterSharedPtr->addNextHops(
+            std::move(nextHops),
+            [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this()),
+             entries = std::move(entries),
+             addresses = std::move(addresses),
+             onRegistered = std::move(onRegistered)](const std::vector<bool>& added) {
+                auto thisSharedPtr = thisWeakPtr.lock();
+                if (!thisSharedPtr) {
+                    return;
+                }
+                std::lock_guard<std::recursive_mutex> cacheLock(
+                        thisSharedPtr->_localCapabilitiesDirectoryStore->getCacheLock());
+                std::vector<types::DiscoveryEntryWithMetaInfo> validGlobalEntries;
+                validGlobalEntries.reserve(entries.size());
+                for (std::size_t i = 0; i < entries.size(); ++i) {
+                    if (!added[i]) {
+                        JOYNR_LOG_WARN(logger(),
+                                       "Failed to register capability entry for participantId: "
+                                       "{}, addNextHop failed",
+                                       entries[i].getParticipantId());
+                        continue;
+                    }
+                    validGlobalEntries.push_back(LCDUtil::convert(false, entries[i]));
+                    thisSharedPtr->_localCapabilitiesDirectoryStore
+                            ->insertRemoteEntriesIntoGlobalCache(
+                                    entries[i], addresses[i], thisSharedPtr->_knownGbids);
+                }
+                if (onRegistered) {
+                    onRegistered(std::move(validGlobalEntries));
+                }
+            });
 }
 
 // inherited method from joynr::system::DiscoveryProvider
@@ -1260,12 +1487,12 @@ void LocalCapabilitiesDirectory::scheduleCleanupTimer()
                         timerError.message());
     } else {
         _checkExpiredDiscoveryEntriesTimer.async_wait(
-                [thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
+                _timerStrand.wrap([thisWeakPtr = joynr::util::as_weak_ptr(shared_from_this())](
                         const boost::system::error_code& errorCode) {
                     if (auto thisSharedPtr = thisWeakPtr.lock()) {
                         thisSharedPtr->checkExpiredDiscoveryEntries(errorCode);
                     }
-                });
+                }));
     }
 }
 
@@ -28,7 +28,9 @@
 #include "joynr/ILocalCapabilitiesCallback.h"
 #include "joynr/LCDUtil.h"
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
+#include "joynr/TimePoint.h"
 #include "joynr/Util.h"
+#include "joynr/WarmRestartSnapshot.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
 #include "joynr/types/DiscoveryQos.h"
 
@@ -68,6 +70,51 @@ std::size_t LocalCapabilitiesDirectoryStore::countGlobalCapabilities() const
     return counter;
 }
 
+void LocalCapabilitiesDirectoryStore::saveWarmRestartSnapshot(WarmRestartSnapshot& snapshot) const
+{
+    std::lock_guard<std::recursive_mutex> globalCachedRetrievalLock(_cacheLock);
+    for (auto cachedEntry = _globalLookupCache->cbegin(); cachedEntry != _globalLookupCache->cend();
+         ++cachedEntry) {
+        std::vector<std::string> gbids;
+        auto foundGbids = _globalParticipantIdsToGbidsMap.find(cachedEntry->getParticipantId());
+        if (foundGbids != _globalParticipantIdsToGbidsMap.cend()) {
+            gbids = foundGbids->second;
+        }
+        const std::int64_t cachedSinceMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                        cachedEntry->_timestamp.time_since_epoch())
+                        .count();
+        snapshot.globalCacheEntries.push_back({*cachedEntry, std::move(gbids), cachedSinceMs});
+    }
+}
+
+void LocalCapabilitiesDirectoryStore::restoreWarmRestartSnapshot(
+        const WarmRestartSnapshot& snapshot)
+{
+    const std::int64_t nowMs = TimePoint::now().toMilliseconds();
+    std::size_t numberOfRestoredEntries = 0;
+    std::unique_lock<std::recursive_mutex> cacheLock(_cacheLock);
+    for (const auto& globalCacheEntry : snapshot.globalCacheEntries) {
+        const types::DiscoveryEntry& entry = globalCacheEntry.discoveryEntry;
+        if (entry.getExpiryDateMs() <= nowMs ||
+            _globalLookupCache->lookupByParticipantId(entry.getParticipantId())) {
+            continue;
+        }
+        const capabilities::Timestamp cachedSince(
+                std::chrono::milliseconds(globalCacheEntry.cachedSinceMs));
+        getGlobalLookupCache(cacheLock)->insert(entry, cachedSince);
+        std::vector<std::string> gbids(globalCacheEntry.gbids);
+        mapGbidsToGlobalProviderParticipantId(entry.getParticipantId(), gbids);
+        ++numberOfRestoredEntries;
+    }
+    JOYNR_LOG_INFO(logger(),
+                   "Restored {} of {} global cache entries from warm restart snapshot, "
+                   "#globalLookupCache: {}",
+                   numberOfRestoredEntries,
+                   snapshot.globalCacheEntries.size(),
+                   _globalLookupCache->size());
+}
+
 std::vector<types::DiscoveryEntry> LocalCapabilitiesDirectoryStore::getAllGlobalCapabilities() const
 {
     std::vector<types::DiscoveryEntry> allGlobalEntries;
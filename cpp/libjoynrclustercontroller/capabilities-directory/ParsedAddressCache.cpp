@@ -0,0 +1,83 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include "joynr/ParsedAddressCache.h"
+
+#include <stdexcept>
+#include <tuple>
+
+#include "joynr/serializer/Serializer.h"
+#include "joynr/system/RoutingTypes/Address.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+
+namespace joynr
+{
+
+constexpr std::uint32_t ParsedAddressCache::DEFAULT_CAPACITY;
+
+ParsedAddressCache::ParsedAddressCache(std::uint32_t capacity)
+        : _mutex(), _parsedAddresses(capacity), _addressesWithoutGbid(capacity)
+{
+}
+
+std::shared_ptr<const system::RoutingTypes::Address> ParsedAddressCache::parse(
+        const std::string& serializedAddress)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return parse(lock, serializedAddress);
+}
+
+std::shared_ptr<const system::RoutingTypes::Address> ParsedAddressCache::parse(
+        const std::lock_guard<std::mutex>& lock,
+        const std::string& serializedAddress)
+{
+    std::ignore = lock;
+    if (auto cachedAddress = _parsedAddresses.object(serializedAddress)) {
+        return *cachedAddress;
+    }
+    std::shared_ptr<const system::RoutingTypes::Address> address;
+    joynr::serializer::deserializeFromJson(address, serializedAddress);
+    if (!address) {
+        throw std::invalid_argument("address is null");
+    }
+    _parsedAddresses.insert(
+            serializedAddress, new std::shared_ptr<const system::RoutingTypes::Address>(address));
+    return address;
+}
+
+std::string ParsedAddressCache::replaceGbidWithEmptyString(const std::string& serializedAddress)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto cachedAddress = _addressesWithoutGbid.object(serializedAddress)) {
+        return *cachedAddress;
+    }
+    std::string addressWithoutGbid = serializedAddress;
+    auto address = parse(lock, serializedAddress);
+    if (auto mqttAddress = dynamic_cast<const system::RoutingTypes::MqttAddress*>(address.get())) {
+        if (!mqttAddress->getBrokerUri().empty()) {
+            system::RoutingTypes::MqttAddress rewrittenAddress(*mqttAddress);
+            rewrittenAddress.setBrokerUri("");
+            addressWithoutGbid = joynr::serializer::serializeToJson(rewrittenAddress);
+        }
+    }
+    _addressesWithoutGbid.insert(serializedAddress, new std::string(addressWithoutGbid));
+    return addressWithoutGbid;
+}
+
+} // namespace joynr
@@ -19,14 +19,17 @@
 #ifndef ABSTRACTGLOBALMESSAGINGSKELETON_H
 #define ABSTRACTGLOBALMESSAGINGSKELETON_H
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <smrf/ByteVector.h>
 
 #include "joynr/JoynrClusterControllerExport.h"
 
+#include "joynr/Cache.h"
 #include "joynr/IMessagingMulticastSubscriber.h"
 
 #include "joynr/Logger.h"
@@ -42,11 +45,19 @@ class JoynrRuntimeException;
 class ImmutableMessage;
 class IMessageRouter;
 
+namespace system
+{
+namespace RoutingTypes
+{
+class Address;
+} // namespace RoutingTypes
+} // namespace system
+
 class JOYNRCLUSTERCONTROLLER_EXPORT AbstractGlobalMessagingSkeleton
         : public IMessagingMulticastSubscriber
 {
 public:
-    AbstractGlobalMessagingSkeleton() = default;
+    AbstractGlobalMessagingSkeleton();
     virtual ~AbstractGlobalMessagingSkeleton() = default;
     virtual void transmit(
             std::shared_ptr<ImmutableMessage> message,
@@ -60,6 +71,25 @@ protected:
                                               const std::string& gbid = "");
 
 private:
+    /**
+     * Returns the address for the serialized replyTo address. Remote cluster controllers
+     * always send the same replyTo, so the deserialized addresses are interned and shared
+     * between the routing entries.
+     * @throw std::invalid_argument if replyTo cannot be deserialized
+     */
+    std::shared_ptr<const system::RoutingTypes::Address> getReplyToAddress(
+            const std::string& replyTo,
+            const std::string& gbid);
+
+    struct InternedAddress {
+        std::string gbid;
+        std::shared_ptr<const system::RoutingTypes::Address> address;
+    };
+
+    static constexpr std::uint32_t _replyToAddressCacheCapacity = 1024;
+    Cache<std::string, InternedAddress> _replyToAddressCache;
+    std::mutex _replyToAddressCacheMutex;
+
     ADD_LOGGER(AbstractGlobalMessagingSkeleton)
 };
 
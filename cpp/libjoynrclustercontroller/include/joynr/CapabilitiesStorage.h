@@ -334,11 +334,19 @@ public:
 
     virtual ~CachingStorage() = default;
     virtual void insert(const DiscoveryEntry& entry)
+    {
+        insert(entry, std::chrono::system_clock::now());
+    }
+
+    /*
+     * Inserts an entry which has been cached since cachedSince, e.g. when the cache is restored
+     * after a restart. The age of the entry is computed from cachedSince.
+     */
+    void insert(const DiscoveryEntry& entry, Timestamp cachedSince)
     {
         auto& index = _container.get<tags::ParticipantId>();
 
-        auto now = std::chrono::system_clock::now();
-        CachedDiscoveryEntry cachedEntry(entry, now);
+        CachedDiscoveryEntry cachedEntry(entry, cachedSince);
         auto insertResult = index.insert(cachedEntry);
 
         // entry already existed
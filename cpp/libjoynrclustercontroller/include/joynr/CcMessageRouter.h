@@ -20,10 +20,14 @@
 #ifndef CCMESSAGEROUTER_H
 #define CCMESSAGEROUTER_H
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "joynr/AbstractMessageRouter.h"
@@ -33,6 +37,7 @@
 #include "joynr/Logger.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/ReadWriteLock.h"
+#include "joynr/SteadyTimer.h"
 #include "joynr/system/RoutingAbstractProvider.h"
 
 namespace joynr
@@ -48,8 +53,10 @@ class IMulticastAddressCalculator;
 class IPlatformSecurityManager;
 class ITransportStatus;
 class ImmutableMessage;
+class LatencyHistogram;
 class MessagingSettings;
 class MulticastMessagingSkeletonDirectory;
+struct WarmRestartSnapshot;
 
 namespace exceptions
 {
@@ -102,6 +109,8 @@ public:
 
     ~CcMessageRouter() override;
 
+    void shutdown() override;
+
     void routeInternal(std::shared_ptr<ImmutableMessage> message, std::uint32_t tryCount) final;
 
     /*
@@ -116,6 +125,12 @@ public:
                     std::function<void(const joynr::exceptions::ProviderRuntimeException&)>
                             onError = nullptr) final;
 
+    /*
+     * Adds all next hops to the routing table at once, onResult is called before returning
+     */
+    void addNextHops(std::vector<NextHop> nextHops,
+                     std::function<void(const std::vector<bool>& added)> onResult) final;
+
     /*
      * Implement methods from RoutingAbstractProvider
      */
@@ -227,10 +242,38 @@ public:
     void setAccessController(std::weak_ptr<IAccessController> accessController);
     std::shared_ptr<joynr::system::MessageNotificationProvider> getMessageNotificationProvider()
             const;
+
+    /*
+     * Adds the routing entries and the multicast receivers to the snapshot. Entries with an
+     * InProcessMessagingAddress are skipped since they are registered anew after a restart.
+     */
+    void saveWarmRestartSnapshot(WarmRestartSnapshot& snapshot);
+
+    /*
+     * Restores the routing entries and multicast receivers of a snapshot and subscribes to the
+     * multicasts of global providers again. Expired routing entries and participants which
+     * already have a routing entry are skipped, so a next hop added since the start of the
+     * cluster controller is never overwritten by the snapshot.
+     * Routing entries of local clients (UDS and WebSocket) expire after clientReconnectTimeout
+     * unless the client connects again in the meantime, see sendQueuedMessages. Restored
+     * multicast receivers which have not been added again by then are removed as well.
+     */
+    void restoreWarmRestartSnapshot(const WarmRestartSnapshot& snapshot,
+                                    std::chrono::milliseconds clientReconnectTimeout);
+
+    /*
+     * Called when a local client (re)connected: renews the routing entries with the client's
+     * address, so that entries restored from a snapshot no longer expire, and sends the
+     * messages which have been queued for them.
+     */
+    void sendQueuedMessages(
+            std::shared_ptr<const joynr::system::RoutingTypes::Address> address) final;
     friend class MessageRunnable;
     friend class ConsumerPermissionCallback;
 
 private:
+    using AbstractMessageRouter::sendQueuedMessages;
+
     bool isValidForRoutingTable(
             std::shared_ptr<const joynr::system::RoutingTypes::Address> address) final;
     bool allowRoutingEntryUpdate(const routingtable::RoutingEntry& oldEntry,
@@ -259,6 +302,23 @@ private:
     std::shared_ptr<IMessagingMulticastSubscriber> getMulticastMessagingSkeleton(
             const std::string& providerParticipantId);
 
+    /*
+     * Returns true and forgets the receiver if it was restored from a warm restart snapshot and
+     * has not been added or removed since.
+     */
+    bool takeRestoredMulticastReceiver(const std::string& multicastId,
+                                       const std::string& subscriberParticipantId);
+    void removeExpiredRestoredMulticastReceivers();
+
+    /*
+     * Fires the messageQueuedForDelivery broadcast off the routing path: all messages queued
+     * for the same participant and message type within the message notification interval are
+     * reported by a single broadcast.
+     */
+    void scheduleMessageQueuedNotification(const std::string& participantId,
+                                           const std::string& messageType);
+    void fireMessageQueuedNotifications();
+
     DISALLOW_COPY_AND_ASSIGN(CcMessageRouter);
     ADD_LOGGER(CcMessageRouter)
 
@@ -270,6 +330,18 @@ private:
     const std::string _messageNotificationProviderParticipantId;
     ClusterControllerSettings& _clusterControllerSettings;
     const system::RoutingTypes::Address& _ownGlobalAddress;
+    std::shared_ptr<LatencyHistogram> _routeLatency;
+    // pairs of multicastId and subscriberParticipantId which have been restored from a warm
+    // restart snapshot and are already registered in the multicast messaging skeleton
+    std::set<std::pair<std::string, std::string>> _restoredMulticastReceivers;
+    std::mutex _restoredMulticastReceiversMutex;
+    SteadyTimer _restoredMulticastReceiversTimer;
+    // pairs of participantId and messageType for which a messageQueuedForDelivery broadcast
+    // is pending
+    std::set<std::pair<std::string, std::string>> _pendingMessageNotifications;
+    bool _isMessageNotificationScheduled;
+    std::mutex _pendingMessageNotificationsMutex;
+    SteadyTimer _messageNotificationTimer;
 };
 
 } // namespace joynr
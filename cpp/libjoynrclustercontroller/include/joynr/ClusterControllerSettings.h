@@ -53,6 +53,17 @@ public:
     static const std::string& SETTING_MQTT_PASSWORD();
     static const std::string& SETTING_MQTT_MULTICAST_TOPIC_PREFIX();
     static const std::string& SETTING_MQTT_UNICAST_TOPIC_PREFIX();
+    static const std::string& SETTING_MQTT_CONNECTIONS_PER_GBID();
+    static const std::string& SETTING_MQTT_INGRESS_QUEUE_CAPACITY();
+    static const std::string& SETTING_MQTT_INGRESS_THREADS();
+    static const std::string& SETTING_CLIENT_MAX_INFLIGHT_MESSAGES();
+    static const std::string& SETTING_CLIENT_MAX_SEND_BUFFER_BYTES();
+    static const std::string& SETTING_METRICS_EXPORT_FILE();
+    static const std::string& SETTING_METRICS_EXPORT_INTERVAL_MS();
+    static const std::string& SETTING_WARM_RESTART_SNAPSHOT_FILE();
+    static const std::string& SETTING_WARM_RESTART_SNAPSHOT_INTERVAL_MS();
+    static const std::string& SETTING_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS();
+    static const std::string& SETTING_MESSAGE_NOTIFICATION_INTERVAL_MS();
     static const std::string& SETTING_PURGE_EXPIRED_DISCOVERY_ENTRIES_INTERVAL_MS();
     static const std::string& SETTING_WS_TLS_PORT();
     static const std::string& SETTING_WS_PORT();
@@ -63,6 +74,7 @@ public:
     static const std::string& SETTING_ACCESS_CONTROL_ENABLE();
     static const std::string& SETTING_ACL_ENTRIES_DIRECTORY();
     static const std::string& SETTING_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED();
+    static const std::string& SETTING_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS();
     static const std::string& SETTING_ROUTED_MESSAGE_PRINT_INTERVAL_S();
 
     static std::chrono::milliseconds DEFAULT_CAPABILITIES_FRESHNESS_UPDATE_INTERVAL_MS();
@@ -74,6 +86,15 @@ public:
     static const std::string& DEFAULT_MQTT_TLS_CIPHERS();
     static const std::string& DEFAULT_MQTT_MULTICAST_TOPIC_PREFIX();
     static const std::string& DEFAULT_MQTT_UNICAST_TOPIC_PREFIX();
+    static std::uint32_t DEFAULT_MQTT_CONNECTIONS_PER_GBID();
+    static std::uint32_t DEFAULT_MQTT_INGRESS_QUEUE_CAPACITY();
+    static std::uint32_t DEFAULT_MQTT_INGRESS_THREADS();
+    static std::uint32_t DEFAULT_CLIENT_MAX_INFLIGHT_MESSAGES();
+    static std::uint32_t DEFAULT_CLIENT_MAX_SEND_BUFFER_BYTES();
+    static std::uint32_t DEFAULT_METRICS_EXPORT_INTERVAL_MS();
+    static std::uint32_t DEFAULT_WARM_RESTART_SNAPSHOT_INTERVAL_MS();
+    static std::uint32_t DEFAULT_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS();
+    static std::uint32_t DEFAULT_MESSAGE_NOTIFICATION_INTERVAL_MS();
     static int DEFAULT_PURGE_EXPIRED_DISCOVERY_ENTRIES_INTERVAL_MS();
     static bool DEFAULT_ENABLE_ACCESS_CONTROLLER();
     static bool DEFAULT_ACCESS_CONTROL_AUDIT();
@@ -83,6 +104,7 @@ public:
     static std::uint64_t DEFAULT_MESSAGE_QUEUE_LIMIT_BYTES();
     static std::uint64_t DEFAULT_TRANSPORT_NOT_AVAILABLE_QUEUE_LIMIT_BYTES();
     static bool DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_COMPRESSED_MESSAGES_ENABLED();
+    static std::uint32_t DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS();
     static int DEFAULT_ROUTED_MESSAGE_PRINT_INTERVAL_S();
     static bool DEFAULT_WEBSOCKET_ENABLED();
     static bool DEFAULT_UDS_ENABLED();
@@ -111,6 +133,41 @@ public:
     std::string getMqttUnicastTopicPrefix() const;
     void setMqttUnicastTopicPrefix(const std::string& mqttUnicastTopicPrefix);
 
+    std::uint32_t getMqttConnectionsPerGbid() const;
+    void setMqttConnectionsPerGbid(std::uint32_t connectionsPerGbid);
+
+    std::uint32_t getMqttIngressQueueCapacity() const;
+    void setMqttIngressQueueCapacity(std::uint32_t capacity);
+
+    std::uint32_t getMqttIngressThreads() const;
+    void setMqttIngressThreads(std::uint32_t numberOfThreads);
+
+    std::uint32_t getClientMaxInFlightMessages() const;
+    void setClientMaxInFlightMessages(std::uint32_t maxInFlightMessages);
+
+    std::uint32_t getClientMaxSendBufferBytes() const;
+    void setClientMaxSendBufferBytes(std::uint32_t maxSendBufferBytes);
+
+    bool isMetricsExportFileSet() const;
+    std::string getMetricsExportFile() const;
+    void setMetricsExportFile(const std::string& fileName);
+
+    std::uint32_t getMetricsExportIntervalMs() const;
+    void setMetricsExportIntervalMs(std::uint32_t intervalMs);
+
+    bool isWarmRestartSnapshotFileSet() const;
+    std::string getWarmRestartSnapshotFile() const;
+    void setWarmRestartSnapshotFile(const std::string& fileName);
+
+    std::uint32_t getWarmRestartSnapshotIntervalMs() const;
+    void setWarmRestartSnapshotIntervalMs(std::uint32_t intervalMs);
+
+    std::uint32_t getWarmRestartClientReconnectTimeoutMs() const;
+    void setWarmRestartClientReconnectTimeoutMs(std::uint32_t timeoutMs);
+
+    std::uint32_t getMessageNotificationIntervalMs() const;
+    void setMessageNotificationIntervalMs(std::uint32_t intervalMs);
+
     bool isMqttCertificateAuthorityPemFilenameSet() const;
     std::string getMqttCertificateAuthorityPemFilename() const;
 
@@ -165,6 +222,9 @@ public:
     bool isGlobalCapabilitiesDirectoryCompressedMessagesEnabled() const;
     void setGlobalCapabilitiesDirectoryCompressedMessagesEnabled(bool enable);
 
+    std::uint32_t getGlobalCapabilitiesDirectoryMaxConcurrentCalls() const;
+    void setGlobalCapabilitiesDirectoryMaxConcurrentCalls(std::uint32_t maxConcurrentCalls);
+
     int getPurgeExpiredDiscoveryEntriesIntervalMs() const;
     void setPurgeExpiredDiscoveryEntriesIntervalMs(int purgeExpiredEntriesIntervalMs);
 
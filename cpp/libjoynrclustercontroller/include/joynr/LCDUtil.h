@@ -42,6 +42,8 @@ class DiscoveryEntryWithMetaInfo;
 class GlobalDiscoveryEntry;
 } // namespace types
 
+class ParsedAddressCache;
+
 struct DiscoveryEntryHash {
     std::size_t operator()(const types::DiscoveryEntry& entry) const
     {
@@ -82,7 +84,8 @@ public:
     static bool containsOnlyEmptyString(const std::vector<std::string> gbids);
 
     static void replaceGbidWithEmptyString(
-            std::vector<joynr::types::GlobalDiscoveryEntry>& capabilities);
+            std::vector<joynr::types::GlobalDiscoveryEntry>& capabilities,
+            ParsedAddressCache& addressCache);
 
     static std::vector<types::DiscoveryEntry> optionalToVector(
             boost::optional<types::DiscoveryEntry> optionalEntry);
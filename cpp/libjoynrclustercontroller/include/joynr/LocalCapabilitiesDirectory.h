@@ -29,17 +29,22 @@
 #include <unordered_set>
 #include <vector>
 
+#include <boost/asio/io_service.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
 
 #include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/ILocalCapabilitiesCallback.h"
+#include "joynr/InterfaceAddress.h"
 #include "joynr/JoynrClusterControllerExport.h"
 #include "joynr/LcdPendingLookupsHandler.h"
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
 #include "joynr/Logger.h"
 #include "joynr/MessagingSettings.h"
+#include "joynr/ParsedAddressCache.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Semaphore.h"
+#include "joynr/TimePoint.h"
 #include "joynr/system/DiscoveryAbstractProvider.h"
 #include "joynr/system/ProviderReregistrationControllerProvider.h"
 #include "joynr/types/DiscoveryEntry.h"
@@ -53,6 +58,8 @@ class IAccessController;
 class IGlobalCapabilitiesDirectoryClient;
 class ClusterControllerSettings;
 class IMessageRouter;
+class LatencyHistogram;
+class MetricsCounter;
 
 namespace capabilities
 {
@@ -110,12 +117,15 @@ public:
     void shutdown();
 
     /*
-     * Call back methods which will update the local capabilities cache and call the
-     * original callback with the results, this indirection was needed because we
-     * need to convert a CapabilitiesInformation object into a DiscoveryEntry object.
+     * Adds the routing entries of the received global entries with a single call to the
+     * message router, stores the entries whose routing entry has been added in the global
+     * lookup cache and passes them to onRegistered. onRegistered may be called after this
+     * method has returned, it is called with the cache lock held.
      */
-    std::vector<types::DiscoveryEntryWithMetaInfo> registerReceivedCapabilities(
-            const std::vector<types::GlobalDiscoveryEntry>&& capabilityEntries);
+    void registerReceivedCapabilities(
+            std::vector<types::GlobalDiscoveryEntry>&& capabilityEntries,
+            std::function<void(std::vector<types::DiscoveryEntryWithMetaInfo>&& validGlobalEntries)>
+                    onRegistered = nullptr);
 
     // inherited method from joynr::system::DiscoveryProvider
     void add(const joynr::types::DiscoveryEntry& discoveryEntry,
@@ -208,10 +218,14 @@ private:
     DISALLOW_COPY_AND_ASSIGN(LocalCapabilitiesDirectory);
     ClusterControllerSettings& _clusterControllerSettings; // to retrieve info about persistency
 
-    void capabilitiesReceived(const std::vector<types::GlobalDiscoveryEntry>& results,
-                              std::vector<types::DiscoveryEntry>&& localEntries,
-                              std::shared_ptr<ILocalCapabilitiesCallback> callback,
-                              joynr::types::DiscoveryScope::Enum discoveryScope);
+    void capabilitiesReceived(
+            std::vector<types::GlobalDiscoveryEntry>&& results,
+            std::function<void(std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries)>
+                    onRegistered);
+    std::vector<types::DiscoveryEntryWithMetaInfo> addLocalEntries(
+            std::vector<types::DiscoveryEntryWithMetaInfo>&& globalEntries,
+            std::vector<types::DiscoveryEntry>&& localEntries,
+            joynr::types::DiscoveryScope::Enum discoveryScope);
     void removeStaleProvidersOfClusterController(const std::int64_t& clusterControllerStartDateMs,
                                                  const std::string gbid);
     /*
@@ -233,15 +247,60 @@ private:
                         const std::vector<std::string>& gbids,
                         std::shared_ptr<ILocalCapabilitiesCallback> callback);
 
+    /*
+     * A lookup sent to the global capabilities directory, shared by all lookups with the same
+     * domains, interface, gbids and discovery scope which are issued before it has returned.
+     */
+    struct GlobalLookup {
+        struct Waiter {
+            std::shared_ptr<ILocalCapabilitiesCallback> _callback;
+            // end of the discovery timeout of the waiting lookup
+            TimePoint _expiryDate;
+        };
+        GlobalLookup(const TimePoint& expiryDate, std::vector<Waiter>&& waiters);
+        const TimePoint _expiryDate;
+        std::vector<Waiter> _waiters;
+    };
+
+    void sendGlobalLookup(const std::string& lookupKey,
+                          std::shared_ptr<GlobalLookup> globalLookup,
+                          const std::vector<std::string>& domains,
+                          const std::string& interfaceName,
+                          std::vector<std::string> gbids,
+                          const joynr::types::DiscoveryQos& discoveryQos);
+
+    /*
+     * Joins the waiters to the pending global lookup with the given key if it expires before all
+     * of them. Otherwise registers and returns a new global lookup for them, which expires with
+     * the earliest waiter and still has to be sent.
+     */
+    std::shared_ptr<GlobalLookup> joinOrCreateGlobalLookup(
+            const std::string& lookupKey,
+            std::vector<GlobalLookup::Waiter>&& waiters);
+
+    /*
+     * Removes the finished global lookup and returns the waiters which have not yet been called
+     * because of a matching provider registered while waiting for the result.
+     */
+    std::vector<GlobalLookup::Waiter> finishGlobalLookup(
+            const std::string& lookupKey,
+            const std::shared_ptr<GlobalLookup>& globalLookup,
+            const std::vector<InterfaceAddress>& interfaceAddresses,
+            const joynr::types::DiscoveryQos& discoveryQos);
+
     ADD_LOGGER(LocalCapabilitiesDirectory)
     std::shared_ptr<IGlobalCapabilitiesDirectoryClient> _globalCapabilitiesDirectoryClient;
     std::shared_ptr<LocalCapabilitiesDirectoryStore> _localCapabilitiesDirectoryStore;
     std::string _localAddress;
+    // addresses of entries received from the GCD
+    ParsedAddressCache _addressCache;
     std::mutex _pendingLookupsLock;
 
     std::weak_ptr<IMessageRouter> _messageRouter;
 
     LcdPendingLookupsHandler _lcdPendingLookupsHandler;
+    // guarded by _pendingLookupsLock
+    std::unordered_map<std::string, std::shared_ptr<GlobalLookup>> _globalLookups;
 
     std::weak_ptr<IAccessController> _accessController;
 
@@ -252,11 +311,17 @@ private:
     void remove(const types::DiscoveryEntry& discoveryEntry);
     boost::asio::steady_timer _freshnessUpdateTimer;
     boost::asio::steady_timer _reAddAllGlobalEntriesTimer;
+    // serializes the timer handlers if the io_service is run by multiple threads
+    boost::asio::io_service::strand _timerStrand;
     std::string _clusterControllerId;
     const std::vector<std::string> _knownGbids;
     std::unordered_set<std::string> _knownGbidsSet;
     const std::int64_t _defaultExpiryIntervalMs;
     const std::chrono::milliseconds _reAddInterval;
+    std::shared_ptr<LatencyHistogram> _localLookupLatency;
+    std::shared_ptr<MetricsCounter> _lookupsAnsweredLocally;
+    std::shared_ptr<MetricsCounter> _lookupsForwardedToGlobal;
+    std::shared_ptr<MetricsCounter> _lookupsJoinedToGlobal;
 
     void scheduleFreshnessUpdate();
     void scheduleReAddAllGlobalDiscoveryEntries();
@@ -36,6 +36,7 @@ namespace joynr
 {
 class DiscoveryEntry;
 class ILocalCapabilitiesCallback;
+struct WarmRestartSnapshot;
 
 namespace capabilities
 {
@@ -157,6 +158,18 @@ public:
     virtual void insertInGlobalLookupCache(const types::DiscoveryEntry& entry,
                                            const std::vector<std::string>& gbids);
     std::size_t countGlobalCapabilities() const;
+
+    /*
+     * Adds the entries of the global lookup cache with their GBIDs and cache timestamps to the
+     * snapshot
+     */
+    void saveWarmRestartSnapshot(WarmRestartSnapshot& snapshot) const;
+
+    /*
+     * Restores the global lookup cache of a snapshot. Expired entries and participants which
+     * have been cached since the start of the cluster controller are skipped.
+     */
+    void restoreWarmRestartSnapshot(const WarmRestartSnapshot& snapshot);
     virtual void eraseParticipantIdToGbidMapping(
             const std::string& participantId,
             const std::unique_lock<std::recursive_mutex>& cacheLock);
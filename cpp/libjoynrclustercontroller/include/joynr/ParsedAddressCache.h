@@ -0,0 +1,79 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef PARSEDADDRESSCACHE_H
+#define PARSEDADDRESSCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "joynr/Cache.h"
+
+namespace joynr
+{
+
+namespace system
+{
+namespace RoutingTypes
+{
+class Address;
+} // namespace RoutingTypes
+} // namespace system
+
+/*
+ * Interns the addresses of global discovery entries, keyed by their serialized form.
+ * A lookup at the GCD typically returns many entries of the same few cluster controllers, so
+ * each distinct address is parsed and rewritten only once instead of once per entry.
+ */
+class ParsedAddressCache
+{
+public:
+    static constexpr std::uint32_t DEFAULT_CAPACITY = 1000;
+
+    explicit ParsedAddressCache(std::uint32_t capacity = DEFAULT_CAPACITY);
+
+    /*
+     * Returns the address deserialized from serializedAddress. The returned object is shared
+     * by all callers passing the same serialized address.
+     * Throws std::invalid_argument if serializedAddress cannot be deserialized.
+     */
+    std::shared_ptr<const system::RoutingTypes::Address> parse(
+            const std::string& serializedAddress);
+
+    /*
+     * Returns serializedAddress with the broker URI, i.e. the GBID, of a MqttAddress replaced
+     * by an empty string. Other address types are returned unchanged.
+     * Throws std::invalid_argument if serializedAddress cannot be deserialized.
+     */
+    std::string replaceGbidWithEmptyString(const std::string& serializedAddress);
+
+private:
+    std::shared_ptr<const system::RoutingTypes::Address> parse(
+            const std::lock_guard<std::mutex>& lock,
+            const std::string& serializedAddress);
+
+    std::mutex _mutex;
+    Cache<std::string, std::shared_ptr<const system::RoutingTypes::Address>> _parsedAddresses;
+    Cache<std::string, std::string> _addressesWithoutGbid;
+};
+
+} // namespace joynr
+
+#endif // PARSEDADDRESSCACHE_H
@@ -0,0 +1,130 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef WARMRESTARTSNAPSHOT_H
+#define WARMRESTARTSNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "joynr/JoynrClusterControllerExport.h"
+#include "joynr/Logger.h"
+#include "joynr/serializer/Serializer.h"
+#include "joynr/system/RoutingTypes/Address.h"
+#include "joynr/types/DiscoveryEntry.h"
+
+namespace joynr
+{
+
+/**
+ * State of the cluster controller which is rebuilt from scratch after a restart: the routing
+ * table, the multicast receivers and the global lookup cache of the local capabilities directory.
+ * A snapshot written before a restart lets the cluster controller route messages to known
+ * participants immediately instead of waiting until all clients have reconnected and all
+ * lookups have been repeated.
+ *
+ * The snapshot is versioned. Snapshots of a different version are ignored, i.e. the cluster
+ * controller starts cold.
+ */
+struct JOYNRCLUSTERCONTROLLER_EXPORT WarmRestartSnapshot {
+    struct RoutingEntry {
+        std::string participantId;
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> address;
+        bool isGloballyVisible;
+        std::int64_t expiryDateMs;
+
+        template <typename Archive>
+        void serialize(Archive& archive)
+        {
+            archive(MUESLI_NVP(participantId),
+                    MUESLI_NVP(address),
+                    MUESLI_NVP(isGloballyVisible),
+                    MUESLI_NVP(expiryDateMs));
+        }
+    };
+
+    struct MulticastReceivers {
+        std::string multicastId;
+        std::vector<std::string> receiverIds;
+
+        template <typename Archive>
+        void serialize(Archive& archive)
+        {
+            archive(MUESLI_NVP(multicastId), MUESLI_NVP(receiverIds));
+        }
+    };
+
+    struct GlobalCacheEntry {
+        types::DiscoveryEntry discoveryEntry;
+        std::vector<std::string> gbids;
+        // time at which the entry was added to the cache, in ms since epoch
+        std::int64_t cachedSinceMs;
+
+        template <typename Archive>
+        void serialize(Archive& archive)
+        {
+            archive(MUESLI_NVP(discoveryEntry), MUESLI_NVP(gbids), MUESLI_NVP(cachedSinceMs));
+        }
+    };
+
+    static std::int32_t VERSION();
+
+    WarmRestartSnapshot();
+
+    /**
+     * Writes the snapshot to a temporary file which then replaces fileName, so that a crash
+     * while writing does not leave a truncated snapshot behind.
+     * @throw std::runtime_error if the file cannot be written
+     * @throw std::invalid_argument if the snapshot cannot be serialized
+     */
+    void saveToFile(const std::string& fileName) const;
+
+    /**
+     * Loads a snapshot written by saveToFile. Returns boost::none if the file does not exist,
+     * cannot be parsed or was written by another version.
+     */
+    static boost::optional<WarmRestartSnapshot> loadFromFile(const std::string& fileName);
+
+    template <typename Archive>
+    void serialize(Archive& archive)
+    {
+        archive(MUESLI_NVP(version),
+                MUESLI_NVP(creationDateMs),
+                MUESLI_NVP(routingEntries),
+                MUESLI_NVP(multicastReceivers),
+                MUESLI_NVP(globalCacheEntries));
+    }
+
+    std::int32_t version;
+    std::int64_t creationDateMs;
+    std::vector<RoutingEntry> routingEntries;
+    std::vector<MulticastReceivers> multicastReceivers;
+    std::vector<GlobalCacheEntry> globalCacheEntries;
+
+private:
+    ADD_LOGGER(WarmRestartSnapshot)
+};
+
+} // namespace joynr
+
+#endif // WARMRESTARTSNAPSHOT_H
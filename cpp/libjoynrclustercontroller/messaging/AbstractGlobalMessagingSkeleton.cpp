@@ -32,17 +32,50 @@
 namespace joynr
 {
 
+constexpr std::uint32_t AbstractGlobalMessagingSkeleton::_replyToAddressCacheCapacity;
+
+AbstractGlobalMessagingSkeleton::AbstractGlobalMessagingSkeleton()
+        : _replyToAddressCache(_replyToAddressCacheCapacity), _replyToAddressCacheMutex()
+{
+}
+
+std::shared_ptr<const system::RoutingTypes::Address> AbstractGlobalMessagingSkeleton::
+        getReplyToAddress(const std::string& replyTo, const std::string& gbid)
+{
+    using system::RoutingTypes::Address;
+    std::lock_guard<std::mutex> lock(_replyToAddressCacheMutex);
+    const InternedAddress* cachedAddress = _replyToAddressCache.object(replyTo);
+    if (cachedAddress != nullptr && cachedAddress->gbid == gbid) {
+        return cachedAddress->address;
+    }
+
+    std::shared_ptr<const Address> address;
+    joynr::serializer::deserializeFromJson(address, replyTo);
+    if (auto mqttAddress =
+                dynamic_cast<const joynr::system::RoutingTypes::MqttAddress*>(address.get())) {
+        address = std::make_shared<const joynr::system::RoutingTypes::MqttAddress>(
+                gbid, mqttAddress->getTopic());
+    }
+
+    if (cachedAddress != nullptr) {
+        // received via another GBID
+        _replyToAddressCache.remove(replyTo);
+    }
+    _replyToAddressCache.insert(replyTo, new InternedAddress{gbid, address});
+    return address;
+}
+
 void AbstractGlobalMessagingSkeleton::registerGlobalRoutingEntryIfRequired(
         const ImmutableMessage& message,
         std::shared_ptr<IMessageRouter> messageRouter,
         const std::string& gbid)
 {
-    const std::string& messageType = message.getType();
+    const MessageType messageType = message.getMessageType();
 
-    if (messageType == Message::VALUE_MESSAGE_TYPE_REQUEST() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST() ||
-        messageType == Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+    if (messageType == MessageType::REQUEST || messageType == MessageType::BATCH_REQUEST ||
+        messageType == MessageType::SUBSCRIPTION_REQUEST ||
+        messageType == MessageType::BROADCAST_SUBSCRIPTION_REQUEST ||
+        messageType == MessageType::MULTICAST_SUBSCRIPTION_REQUEST) {
 
         boost::optional<std::string> optionalReplyTo = message.getReplyTo();
 
@@ -60,16 +93,8 @@ void AbstractGlobalMessagingSkeleton::registerGlobalRoutingEntryIfRequired(
             const TimePoint expiryDate = TimePoint::max();
 
             const bool isSticky = false;
-            using system::RoutingTypes::Address;
-            std::shared_ptr<const Address> address;
-            joynr::serializer::deserializeFromJson(address, replyTo);
-            if (auto mqttAddress = dynamic_cast<const joynr::system::RoutingTypes::MqttAddress*>(
-                        address.get())) {
-                address = std::make_shared<const joynr::system::RoutingTypes::MqttAddress>(
-                        gbid, mqttAddress->getTopic());
-            }
             messageRouter->addNextHop(message.getSender(),
-                                      address,
+                                      getReplyToAddress(replyTo, gbid),
                                       isGloballyVisible,
                                       expiryDate.toMilliseconds(),
                                       isSticky);
@@ -0,0 +1,88 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "CcMessageNotificationProvider.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "joynr/UnicastBroadcastListener.h"
+
+namespace joynr
+{
+
+CcMessageNotificationProvider::CcMessageNotificationProvider()
+        : _messageQueuedForDeliveryListenersMutex(),
+          _messageQueuedForDeliveryListeners(),
+          _messageQueuedForDeliveryListenerCount(0)
+{
+}
+
+void CcMessageNotificationProvider::registerBroadcastListener(
+        const std::string& broadcastName,
+        std::shared_ptr<UnicastBroadcastListener> broadcastListener)
+{
+    if (broadcastName != MESSAGE_QUEUED_FOR_DELIVERY()) {
+        MessageNotificationAbstractProvider::registerBroadcastListener(
+                broadcastName, std::move(broadcastListener));
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_messageQueuedForDeliveryListenersMutex);
+    _messageQueuedForDeliveryListeners.push_back(broadcastListener);
+    _messageQueuedForDeliveryListenerCount = _messageQueuedForDeliveryListeners.size();
+    MessageNotificationAbstractProvider::registerBroadcastListener(
+            broadcastName, std::move(broadcastListener));
+}
+
+void CcMessageNotificationProvider::unregisterBroadcastListener(
+        const std::string& broadcastName,
+        std::shared_ptr<UnicastBroadcastListener> broadcastListener)
+{
+    if (broadcastName != MESSAGE_QUEUED_FOR_DELIVERY()) {
+        MessageNotificationAbstractProvider::unregisterBroadcastListener(
+                broadcastName, std::move(broadcastListener));
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_messageQueuedForDeliveryListenersMutex);
+    auto listenerIt = std::find(_messageQueuedForDeliveryListeners.cbegin(),
+                                _messageQueuedForDeliveryListeners.cend(),
+                                broadcastListener);
+    if (listenerIt == _messageQueuedForDeliveryListeners.cend()) {
+        JOYNR_LOG_WARN(logger(),
+                       "ignoring unregistration of unknown {} listener",
+                       MESSAGE_QUEUED_FOR_DELIVERY());
+        return;
+    }
+    _messageQueuedForDeliveryListeners.erase(listenerIt);
+    _messageQueuedForDeliveryListenerCount = _messageQueuedForDeliveryListeners.size();
+    MessageNotificationAbstractProvider::unregisterBroadcastListener(
+            broadcastName, std::move(broadcastListener));
+}
+
+bool CcMessageNotificationProvider::hasMessageQueuedForDeliveryListeners() const
+{
+    return _messageQueuedForDeliveryListenerCount > 0;
+}
+
+const std::string& CcMessageNotificationProvider::MESSAGE_QUEUED_FOR_DELIVERY()
+{
+    static const std::string value("messageQueuedForDelivery");
+    return value;
+}
+
+} // namespace joynr
@@ -0,0 +1,80 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef CCMESSAGENOTIFICATIONPROVIDER_H
+#define CCMESSAGENOTIFICATIONPROVIDER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "joynr/JoynrClusterControllerExport.h"
+#include "joynr/Logger.h"
+#include "joynr/PrivateCopyAssign.h"
+#include "joynr/system/MessageNotificationAbstractProvider.h"
+
+namespace joynr
+{
+
+class UnicastBroadcastListener;
+
+/**
+ * MessageNotification provider of the cluster controller. Keeps track of the listeners of the
+ * messageQueuedForDelivery broadcast, so that the message router can skip the notification
+ * without taking a lock when nobody is subscribed.
+ */
+class JOYNRCLUSTERCONTROLLER_EXPORT CcMessageNotificationProvider
+        : public joynr::system::MessageNotificationAbstractProvider
+{
+public:
+    CcMessageNotificationProvider();
+    ~CcMessageNotificationProvider() override = default;
+
+    using MessageNotificationAbstractProvider::fireMessageQueuedForDelivery;
+    using MessageNotificationAbstractProvider::registerBroadcastListener;
+    using MessageNotificationAbstractProvider::unregisterBroadcastListener;
+
+    void registerBroadcastListener(
+            const std::string& broadcastName,
+            std::shared_ptr<UnicastBroadcastListener> broadcastListener) override;
+
+    /**
+     * Unregistering a messageQueuedForDelivery listener which is not registered is ignored
+     */
+    void unregisterBroadcastListener(
+            const std::string& broadcastName,
+            std::shared_ptr<UnicastBroadcastListener> broadcastListener) override;
+
+    // checked for every queued message, so it must not take any lock
+    bool hasMessageQueuedForDeliveryListeners() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(CcMessageNotificationProvider);
+    static const std::string& MESSAGE_QUEUED_FOR_DELIVERY();
+
+    std::mutex _messageQueuedForDeliveryListenersMutex;
+    std::vector<std::shared_ptr<UnicastBroadcastListener>> _messageQueuedForDeliveryListeners;
+    // size of _messageQueuedForDeliveryListeners
+    std::atomic<std::size_t> _messageQueuedForDeliveryListenerCount;
+    ADD_LOGGER(CcMessageNotificationProvider)
+};
+
+} // namespace joynr
+#endif // CCMESSAGENOTIFICATIONPROVIDER_H
@@ -19,7 +19,9 @@
 
 #include "joynr/CcMessageRouter.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <stdexcept>
@@ -29,6 +31,8 @@
 #include <unordered_set>
 #include <utility>
 
+#include <boost/system/error_code.hpp>
+
 #include "joynr/ClusterControllerSettings.h"
 #include "joynr/IMulticastAddressCalculator.h"
 #include "joynr/IPlatformSecurityManager.h"
@@ -38,16 +42,18 @@
 #include "joynr/MessageQueue.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingSettings.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastMessagingSkeletonDirectory.h"
 #include "joynr/MulticastReceiverDirectory.h"
 #include "joynr/RoutingTable.h"
 #include "joynr/SubscriptionPublication.h"
 #include "joynr/SubscriptionStop.h"
+#include "joynr/TimePoint.h"
 #include "joynr/Util.h"
+#include "joynr/WarmRestartSnapshot.h"
 #include "joynr/access-control/IAccessController.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/serializer/Serializer.h"
-#include "joynr/system/MessageNotificationAbstractProvider.h"
 #include "joynr/system/MessageNotificationMessageQueuedForDeliveryBroadcastFilter.h"
 #include "joynr/system/MessageNotificationMessageQueuedForDeliveryBroadcastFilterParameters.h"
 #include "joynr/system/RoutingTypes/Address.h"
@@ -60,6 +66,8 @@
 #include "joynr/system/RoutingTypes/WebSocketAddress.h"
 #include "joynr/system/RoutingTypes/WebSocketClientAddress.h"
 
+#include "CcMessageNotificationProvider.h"
+
 namespace joynr
 {
 
@@ -89,13 +97,6 @@ private:
 
 //------ MessageNotification ---------------------------------------------------
 
-class CcMessageNotificationProvider : public joynr::system::MessageNotificationAbstractProvider
-{
-public:
-    virtual ~CcMessageNotificationProvider() = default;
-    using MessageNotificationAbstractProvider::fireMessageQueuedForDelivery;
-};
-
 class MessageQueuedForDeliveryBroadcastFilter
         : public joynr::system::MessageNotificationMessageQueuedForDeliveryBroadcastFilter
 {
@@ -158,7 +159,17 @@ CcMessageRouter::CcMessageRouter(
           _messageNotificationProvider(std::make_shared<CcMessageNotificationProvider>()),
           _messageNotificationProviderParticipantId(messageNotificationProviderParticipantId),
           _clusterControllerSettings(clusterControllerSettings),
-          _ownGlobalAddress(ownGlobalAddress)
+          _ownGlobalAddress(ownGlobalAddress),
+          _routeLatency(MetricsRegistry::instance().getHistogram(
+                  "joynr_cc_route_duration_seconds",
+                  "Duration of routing decisions in the cluster controller message router")),
+          _restoredMulticastReceivers(),
+          _restoredMulticastReceiversMutex(),
+          _restoredMulticastReceiversTimer(ioService),
+          _pendingMessageNotifications(),
+          _isMessageNotificationScheduled(false),
+          _pendingMessageNotificationsMutex(),
+          _messageNotificationTimer(ioService)
 {
     _printRoutedMessages = true;
     _routedMessagePrintIntervalS = clusterControllerSettings.getRoutedMessagePrintIntervalS();
@@ -170,6 +181,16 @@ CcMessageRouter::~CcMessageRouter()
 {
 }
 
+void CcMessageRouter::shutdown()
+{
+    AbstractMessageRouter::shutdown();
+    _restoredMulticastReceiversTimer.cancel();
+    // no notification is scheduled after _isShuttingDown has been set
+    std::lock_guard<std::mutex> lock(_pendingMessageNotificationsMutex);
+    _messageNotificationTimer.cancel();
+    _pendingMessageNotifications.clear();
+}
+
 void CcMessageRouter::setAccessController(std::weak_ptr<IAccessController> accessController)
 {
     this->_accessController = std::move(accessController);
@@ -242,6 +263,190 @@ void CcMessageRouter::reestablishMulticastSubscriptions()
     }
 }
 
+void CcMessageRouter::saveWarmRestartSnapshot(WarmRestartSnapshot& snapshot)
+{
+    {
+        ReadLocker lock(_routingTableLock);
+        for (const auto& routingEntry : _routingTable.getPersistableEntries()) {
+            // sticky entries are provisioned from the settings at every start
+            if (routingEntry._isSticky) {
+                continue;
+            }
+            snapshot.routingEntries.push_back({routingEntry.participantId,
+                                               routingEntry.address,
+                                               routingEntry.isGloballyVisible,
+                                               routingEntry._expiryDateMs});
+        }
+    }
+
+    for (const auto& multicastReceivers : _multicastReceiverDirectory.getAllReceivers()) {
+        snapshot.multicastReceivers.push_back(
+                {multicastReceivers.first,
+                 std::vector<std::string>(
+                         multicastReceivers.second.cbegin(), multicastReceivers.second.cend())});
+    }
+}
+
+void CcMessageRouter::restoreWarmRestartSnapshot(const WarmRestartSnapshot& snapshot,
+                                                 std::chrono::milliseconds clientReconnectTimeout)
+{
+    const std::int64_t nowMs = TimePoint::now().toMilliseconds();
+    const std::int64_t clientReconnectExpiryDateMs = nowMs + clientReconnectTimeout.count();
+    std::vector<NextHop> nextHops;
+    {
+        ReadLocker lock(_routingTableLock);
+        for (const auto& routingEntry : snapshot.routingEntries) {
+            if (routingEntry.expiryDateMs <= nowMs ||
+                _routingTable.containsParticipantId(routingEntry.participantId)) {
+                continue;
+            }
+            // messages to a local client are queued until it connects again; if it does not
+            // reconnect in time, its routing entries are purged and the queued messages expire
+            const auto& addressType = typeid(*routingEntry.address);
+            const bool isLocalClient =
+                    addressType == typeid(system::RoutingTypes::UdsClientAddress) ||
+                    addressType == typeid(system::RoutingTypes::WebSocketClientAddress);
+            const std::int64_t expiryDateMs =
+                    isLocalClient ? std::min(routingEntry.expiryDateMs, clientReconnectExpiryDateMs)
+                                  : routingEntry.expiryDateMs;
+            const bool isSticky = false;
+            nextHops.push_back({routingEntry.participantId,
+                                routingEntry.address,
+                                routingEntry.isGloballyVisible,
+                                expiryDateMs,
+                                isSticky});
+        }
+    }
+    std::size_t numberOfRestoredRoutingEntries = 0;
+    addNextHops(std::move(nextHops),
+                [&numberOfRestoredRoutingEntries](const std::vector<bool>& added) {
+                    numberOfRestoredRoutingEntries = static_cast<std::size_t>(
+                            std::count(added.cbegin(), added.cend(), true));
+                });
+
+    std::size_t numberOfRestoredMulticastReceivers = 0;
+    const auto knownMulticastReceivers = _multicastReceiverDirectory.getAllReceivers();
+    for (const auto& multicastReceivers : snapshot.multicastReceivers) {
+        const std::string& multicastId = multicastReceivers.multicastId;
+        std::string providerParticipantId;
+        try {
+            providerParticipantId = util::extractParticipantIdFromMulticastId(multicastId);
+        } catch (const std::invalid_argument& e) {
+            JOYNR_LOG_ERROR(logger(), "Warm restart snapshot: {}", e.what());
+            continue;
+        }
+        const auto knownReceivers = knownMulticastReceivers.find(multicastId);
+        for (const auto& receiverId : multicastReceivers.receiverIds) {
+            if (knownReceivers != knownMulticastReceivers.cend() &&
+                knownReceivers->second.count(receiverId) > 0) {
+                continue;
+            }
+            registerMulticastInSkeleton(
+                    multicastId,
+                    providerParticipantId,
+                    [this, &multicastId, &receiverId, &numberOfRestoredMulticastReceivers]() {
+                        _multicastReceiverDirectory.registerMulticastReceiver(multicastId,
+                                                                              receiverId);
+                        std::lock_guard<std::mutex> lock(_restoredMulticastReceiversMutex);
+                        _restoredMulticastReceivers.emplace(multicastId, receiverId);
+                        ++numberOfRestoredMulticastReceivers;
+                    },
+                    [&multicastId, &receiverId](const exceptions::JoynrRuntimeException& error) {
+                        JOYNR_LOG_WARN(logger(),
+                                       "Warm restart snapshot: multicast receiver={} for "
+                                       "multicastId={} not restored: {}",
+                                       receiverId,
+                                       multicastId,
+                                       error.getMessage());
+                    });
+        }
+    }
+
+    JOYNR_LOG_INFO(logger(),
+                   "Restored {} of {} routing entries and {} multicast receivers from warm "
+                   "restart snapshot",
+                   numberOfRestoredRoutingEntries,
+                   snapshot.routingEntries.size(),
+                   numberOfRestoredMulticastReceivers);
+
+    if (numberOfRestoredMulticastReceivers == 0) {
+        return;
+    }
+    // receivers of clients which do not reconnect in time are removed like their routing entries
+    _restoredMulticastReceiversTimer.expiresFromNow(clientReconnectTimeout);
+    _restoredMulticastReceiversTimer.asyncWait(
+            [thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<CcMessageRouter>(shared_from_this()))](
+                    const boost::system::error_code& errorCode) {
+                if (errorCode == boost::system::errc::operation_canceled) {
+                    return;
+                }
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->removeExpiredRestoredMulticastReceivers();
+                }
+            });
+}
+
+void CcMessageRouter::removeExpiredRestoredMulticastReceivers()
+{
+    std::set<std::pair<std::string, std::string>> expiredReceivers;
+    {
+        std::lock_guard<std::mutex> lock(_restoredMulticastReceiversMutex);
+        std::swap(expiredReceivers, _restoredMulticastReceivers);
+    }
+    for (const auto& expiredReceiver : expiredReceivers) {
+        const std::string& multicastId = expiredReceiver.first;
+        const std::string& receiverId = expiredReceiver.second;
+        JOYNR_LOG_INFO(logger(),
+                       "multicast receiver={} for multicastId={} restored from warm restart "
+                       "snapshot did not reconnect in time, removing it",
+                       receiverId,
+                       multicastId);
+        _multicastReceiverDirectory.unregisterMulticastReceiver(multicastId, receiverId);
+        unregisterMulticastInSkeleton(
+                multicastId,
+                util::extractParticipantIdFromMulticastId(multicastId),
+                nullptr,
+                [&multicastId](const exceptions::ProviderRuntimeException& error) {
+                    JOYNR_LOG_ERROR(logger(),
+                                    "could not unregister expired multicastId={}: {}",
+                                    multicastId,
+                                    error.getMessage());
+                });
+    }
+}
+
+void CcMessageRouter::sendQueuedMessages(
+        std::shared_ptr<const joynr::system::RoutingTypes::Address> address)
+{
+    // routing entries of local clients never expire once the client is connected, see addNextHop
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    {
+        WriteLocker lock(_routingTableLock);
+        for (const auto& participantId : _routingTable.lookupParticipantIdsByAddress(address)) {
+            const auto routingEntry =
+                    _routingTable.lookupRoutingEntryByParticipantId(participantId);
+            if (!routingEntry || routingEntry->_expiryDateMs == expiryDateMs) {
+                continue;
+            }
+            _routingTable.add(participantId,
+                              routingEntry->isGloballyVisible,
+                              routingEntry->address,
+                              expiryDateMs,
+                              routingEntry->_isSticky);
+        }
+    }
+    AbstractMessageRouter::sendQueuedMessages(std::move(address));
+}
+
+bool CcMessageRouter::takeRestoredMulticastReceiver(const std::string& multicastId,
+                                                    const std::string& subscriberParticipantId)
+{
+    std::lock_guard<std::mutex> lock(_restoredMulticastReceiversMutex);
+    return _restoredMulticastReceivers.erase(std::make_pair(multicastId, subscriberParticipantId)) >
+           0;
+}
+
 void CcMessageRouter::sendMessage(
         std::shared_ptr<ImmutableMessage> message,
         std::shared_ptr<const joynr::system::RoutingTypes::Address> destAddress,
@@ -277,6 +482,7 @@ void CcMessageRouter::routeInternal(std::shared_ptr<ImmutableMessage> message,
                                     std::uint32_t tryCount)
 {
     assert(message);
+    ScopedLatency routeLatency(*_routeLatency);
     // Validate the message if possible
     if (_securityManager != nullptr && !_securityManager->validate(*message)) {
         std::string errorMessage("messageId " + message->getId() + " failed validation");
@@ -292,15 +498,16 @@ void CcMessageRouter::routeInternal(std::shared_ptr<ImmutableMessage> message,
         destAddresses = getDestinationAddresses(*message, lock);
         // if destination address is not known
         if (destAddresses.empty()) {
-            if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+            if (message->getMessageType() == MessageType::MULTICAST) {
                 // Do not queue multicast messages for future multicast receivers.
                 return;
             }
 
             if (_messagingSettings.getDiscardUnroutableRepliesAndPublications() &&
-                ((message->getType() == Message::VALUE_MESSAGE_TYPE_REPLY()) ||
-                 (message->getType() == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) ||
-                 (message->getType() == Message::VALUE_MESSAGE_TYPE_PUBLICATION()))) {
+                ((message->getMessageType() == MessageType::REPLY) ||
+                 (message->getMessageType() == MessageType::BATCH_REPLY) ||
+                 (message->getMessageType() == MessageType::SUBSCRIPTION_REPLY) ||
+                 (message->getMessageType() == MessageType::PUBLICATION))) {
                 // Do not queue reply & publication messages if the proxy is not known.
                 // Prequisite is that for every proxy the associated routing entry has
                 // been added before any request is made.
@@ -452,6 +659,19 @@ void CcMessageRouter::addNextHop(
         std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
 {
     assert(address);
+    if (isRoutingEntryUpToDate(participantId, *address, isGloballyVisible, expiryDateMs, isSticky)) {
+        // nothing to update; messages may nevertheless have been queued for a known
+        // participant, e.g. because the creation of its messaging stub failed
+        if (_messageQueue->containsMessagesFor(participantId)) {
+            WriteLocker lock(_messageQueueRetryLock);
+            sendQueuedMessages(participantId, address, std::move(lock));
+        }
+        if (onSuccess) {
+            onSuccess();
+        }
+        return;
+    }
+
     WriteLocker lock(_messageQueueRetryLock);
     bool addToRoutingTableSuccessful =
             addToRoutingTable(participantId, isGloballyVisible, address, expiryDateMs, isSticky);
@@ -472,6 +692,18 @@ void CcMessageRouter::addNextHop(
     }
 }
 
+void CcMessageRouter::addNextHops(std::vector<NextHop> nextHops,
+                                  std::function<void(const std::vector<bool>& added)> onResult)
+{
+    WriteLocker lock(_messageQueueRetryLock);
+    const std::vector<bool> added = addToRoutingTable(nextHops);
+    sendQueuedMessages(nextHops, added, std::move(lock));
+
+    if (onResult) {
+        onResult(added);
+    }
+}
+
 // inherited from joynr::system::RoutingProvider
 void CcMessageRouter::addNextHop(
         const std::string& participantId,
@@ -690,6 +922,19 @@ void CcMessageRouter::addMulticastReceiver(
         std::function<void()> onSuccess,
         std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
 {
+    if (takeRestoredMulticastReceiver(multicastId, subscriberParticipantId)) {
+        // the subscriber reconnected after a warm restart, its multicast subscription has
+        // already been registered in the skeleton when the snapshot was restored
+        JOYNR_LOG_TRACE(logger(),
+                        "multicast receiver={} for multicastId={} already restored",
+                        subscriberParticipantId,
+                        multicastId);
+        if (onSuccess) {
+            onSuccess();
+        }
+        return;
+    }
+
     std::function<void()> onSuccessWrapper =
             [thisWeakPtr = joynr::util::as_weak_ptr(
                      std::dynamic_pointer_cast<CcMessageRouter>(shared_from_this())),
@@ -870,6 +1115,7 @@ void CcMessageRouter::removeMulticastReceiver(
         std::function<void()> onSuccess,
         std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError)
 {
+    std::ignore = takeRestoredMulticastReceiver(multicastId, subscriberParticipantId);
     _multicastReceiverDirectory.unregisterMulticastReceiver(multicastId, subscriberParticipantId);
     unregisterMulticastInSkeleton(
             multicastId, providerParticipantId, std::move(onSuccess), std::move(onError));
@@ -880,18 +1126,62 @@ void CcMessageRouter::queueMessage(std::shared_ptr<ImmutableMessage> message,
 {
     assert(messageQueueRetryReadLock.owns_lock());
     JOYNR_LOG_TRACE(logger(), "message queued: {}", message->toLogMessage());
+    message->releaseInFlightCredit();
     std::string recipient = message->getRecipient();
     auto droppedMessagesToBeReplied = _messageQueue->queueMessage(std::move(recipient), message);
     messageQueueRetryReadLock.unlock();
+    updateMessageQueueDepthMetric();
     if (!droppedMessagesToBeReplied.empty()) {
         onMsgsDropped(droppedMessagesToBeReplied);
     }
     // do not fire a broadcast for an undeliverable message sent by
     // messageNotificationProvider (e.g. messageQueueForDelivery publication)
     // since it may cause an endless loop
-    if (message->getSender() != _messageNotificationProviderParticipantId) {
+    if (_messageNotificationProvider->hasMessageQueuedForDeliveryListeners() &&
+        message->getSender() != _messageNotificationProviderParticipantId) {
+        scheduleMessageQueuedNotification(message->getRecipient(), message->getType());
+    }
+}
+
+void CcMessageRouter::scheduleMessageQueuedNotification(const std::string& participantId,
+                                                        const std::string& messageType)
+{
+    std::lock_guard<std::mutex> lock(_pendingMessageNotificationsMutex);
+    if (_isShuttingDown) {
+        return;
+    }
+    _pendingMessageNotifications.emplace(participantId, messageType);
+    if (_isMessageNotificationScheduled) {
+        return;
+    }
+    _isMessageNotificationScheduled = true;
+    _messageNotificationTimer.expiresFromNow(
+            std::chrono::milliseconds(
+                    _clusterControllerSettings.getMessageNotificationIntervalMs()));
+    _messageNotificationTimer.asyncWait(
+            [thisWeakPtr = joynr::util::as_weak_ptr(
+                     std::dynamic_pointer_cast<CcMessageRouter>(shared_from_this()))](
+                    const boost::system::error_code& errorCode) {
+                if (errorCode == boost::system::errc::operation_canceled) {
+                    return;
+                }
+                if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                    thisSharedPtr->fireMessageQueuedNotifications();
+                }
+            });
+}
+
+void CcMessageRouter::fireMessageQueuedNotifications()
+{
+    std::set<std::pair<std::string, std::string>> notifications;
+    {
+        std::lock_guard<std::mutex> lock(_pendingMessageNotificationsMutex);
+        std::swap(notifications, _pendingMessageNotifications);
+        _isMessageNotificationScheduled = false;
+    }
+    for (const auto& notification : notifications) {
         _messageNotificationProvider->fireMessageQueuedForDelivery(
-                message->getRecipient(), message->getType());
+                notification.first, notification.second);
     }
 }
 
@@ -20,6 +20,7 @@
 
 #include "joynr/ITransportMessageSender.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
 
 namespace joynr
 {
@@ -45,6 +46,8 @@ void MqttMessagingStub::transmit(
                         _destinationAddress.getBrokerUri(),
                         message->toLogMessage());
     }
+    static TransportTrafficCounter sentTraffic("mqtt", "sent");
+    sentTraffic.count(message->getMessageSize());
     _messageSender->sendMessage(_destinationAddress, std::move(message), onFailure);
 }
 
@@ -21,15 +21,18 @@
 
 #include <cassert>
 #include <cerrno>
+#include <iterator>
 #include <sstream>
 #include <thread>
 #include <tuple>
 #include <utility>
 
+#include <boost/functional/hash.hpp>
 #include <openssl/opensslv.h>
 #include <openssl/ssl.h>
 
 #include "joynr/ClusterControllerSettings.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/Url.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -48,7 +51,9 @@ MosquittoConnection::MosquittoConnection(const ClusterControllerSettings& ccSett
                                          bool isMqttExponentialBackoffEnabled,
                                          const std::string& clientId,
                                          const std::string& gbid,
-                                         bool isMqttRetain)
+                                         bool isMqttRetain,
+                                         bool isPublishOnly,
+                                         std::uint32_t connectionIndex)
         : _brokerUrl(brokerUrl),
           _mqttKeepAliveTimeSeconds(mqttKeepAliveTimeSeconds),
           _mqttReconnectDelayTimeSeconds(mqttReconnectDelayTimeSeconds),
@@ -80,10 +85,18 @@ MosquittoConnection::MosquittoConnection(const ClusterControllerSettings& ccSett
           _restartThread(),
           _mosq(nullptr),
           _mqttMaximumPacketSize(0),
-          _gbid(gbid)
+          _gbid(gbid),
+          _isPublishOnly(isPublishOnly),
+          _connectionIndex(connectionIndex),
+          _publishPropertiesCacheMutex(),
+          _publishPropertiesCache(),
+          _publishPropertiesIndex()
 {
-    JOYNR_LOG_INFO(
-            logger(), "[{}] Init mosquitto connection using MQTT client ID: {}", _gbid, clientId);
+    JOYNR_LOG_INFO(logger(),
+                   "[{}] Init {}mosquitto connection using MQTT client ID: {}",
+                   _gbid,
+                   _isPublishOnly ? "publish only " : "",
+                   clientId);
 
     {
         std::unique_lock<std::mutex> lock(_libUseCountMutex);
@@ -302,6 +315,10 @@ void MosquittoConnection::on_connect_v5(struct mosquitto* mosq,
     std::ignore = flags;
     class MosquittoConnection* mosquittoConnection = (class MosquittoConnection*)userdata;
 
+    // callbacks are invoked by the network thread which is started by mosquitto_loop_start
+    ThreadConfiguration::instance().applyToCurrentThread(
+            ThreadConfiguration::MQTT(), mosquittoConnection->_connectionIndex);
+
     if (rc == MOSQ_ERR_SUCCESS) {
         JOYNR_LOG_INFO(
                 logger(), "[{}] Mosquitto Connection established", mosquittoConnection->_gbid);
@@ -322,7 +339,11 @@ void MosquittoConnection::on_connect_v5(struct mosquitto* mosq,
 
         mosquittoConnection->_isConnected = true;
 
-        mosquittoConnection->createSubscriptions();
+        if (mosquittoConnection->_isPublishOnly) {
+            mosquittoConnection->setReadyToSend(true);
+        } else {
+            mosquittoConnection->createSubscriptions();
+        }
     } else {
         const std::string errorString(mosquittoConnection->getErrorString(rc));
         JOYNR_LOG_ERROR(logger(),
@@ -863,7 +884,7 @@ void MosquittoConnection::publishMessage(
         const int qosLevel,
         const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
         const std::uint32_t msgTtlSec,
-        const std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+        const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
         const uint32_t payloadlen = 0,
         const void* payload = nullptr)
 {
@@ -874,30 +895,72 @@ void MosquittoConnection::publishMessage(
                     payloadlen,
                     topic);
 
-    int mid;
-    mosquitto_property* props = nullptr;
-    int ret = mosquitto_property_add_int32(&props, MQTT_PROP_MESSAGE_EXPIRY_INTERVAL, msgTtlSec);
-    switch (ret) {
-    case MOSQ_ERR_SUCCESS:
-        JOYNR_LOG_TRACE(
-                logger(), "[{}] Added MQTT message expiry date in Sec {}", _gbid, msgTtlSec);
-        break;
-    default:
-        // MOSQ_ERR_INVAL, MOSQ_ERR_NOMEM
-        const std::string errorString(getErrorString(ret));
-        std::string errorMsg = fmt::format(
-                "[{}] Adding MQTT message expiry interval property failed: error: {} ({})",
-                _gbid,
-                std::to_string(ret),
-                errorString);
-        mosquitto_property_free_all(&props);
-        throw exceptions::JoynrRuntimeException(errorMsg);
+    std::shared_ptr<mosquitto_property> userProperties;
+    {
+        std::lock_guard<std::mutex> lock(_publishPropertiesCacheMutex);
+        if (!getUserPropertiesLocked(prefixedCustomHeaders, onFailure, userProperties)) {
+            return;
+        }
+    }
+    std::unique_ptr<mosquitto_property, void (*)(mosquitto_property*)> props(
+            createPublishProperties(msgTtlSec, userProperties.get()),
+            [](mosquitto_property* toBeFreed) { mosquitto_property_free_all(&toBeFreed); });
+    publishWithProperties(topic, qosLevel, onFailure, payloadlen, payload, props.get());
+}
+
+bool MosquittoConnection::getUserPropertiesLocked(
+        const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
+        const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+        std::shared_ptr<mosquitto_property>& userProperties)
+{
+    // the hash must not depend on the iteration order of the headers
+    std::size_t key = 0;
+    for (const auto& header : prefixedCustomHeaders) {
+        std::size_t headerHash = std::hash<std::string>{}(header.first);
+        boost::hash_combine(headerHash, header.second);
+        key ^= headerHash;
     }
 
-    std::unordered_map<std::string, std::string>::const_iterator it;
-    for (it = prefixedCustomHeaders.cbegin(); it != prefixedCustomHeaders.cend(); it++) {
-        const std::string key = it->first;
-        const std::string value = it->second;
+    auto range = _publishPropertiesIndex.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->prefixedCustomHeaders == prefixedCustomHeaders) {
+            _publishPropertiesCache.splice(
+                    _publishPropertiesCache.begin(), _publishPropertiesCache, it->second);
+            userProperties = it->second->properties;
+            return true;
+        }
+    }
+
+    if (!createUserProperties(prefixedCustomHeaders, onFailure, userProperties)) {
+        return false;
+    }
+    if (_publishPropertiesCache.size() >= _publishPropertiesCacheCapacity) {
+        // property lists still in use are kept alive by their shared_ptr
+        const auto leastRecentlyUsed = std::prev(_publishPropertiesCache.end());
+        auto evicted = _publishPropertiesIndex.equal_range(leastRecentlyUsed->key);
+        for (auto it = evicted.first; it != evicted.second; ++it) {
+            if (it->second == leastRecentlyUsed) {
+                _publishPropertiesIndex.erase(it);
+                break;
+            }
+        }
+        _publishPropertiesCache.erase(leastRecentlyUsed);
+    }
+    _publishPropertiesCache.push_front(
+            CachedUserProperties{key, prefixedCustomHeaders, userProperties});
+    _publishPropertiesIndex.emplace(key, _publishPropertiesCache.begin());
+    return true;
+}
+
+bool MosquittoConnection::createUserProperties(
+        const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
+        const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+        std::shared_ptr<mosquitto_property>& userProperties)
+{
+    mosquitto_property* props = nullptr;
+    for (const auto& header : prefixedCustomHeaders) {
+        const std::string& key = header.first;
+        const std::string& value = header.second;
         if (key.empty() || value.empty()) {
             JOYNR_LOG_WARN(logger(),
                            "[{}] Did not add MQTT empty user property {} / {}",
@@ -907,7 +970,7 @@ void MosquittoConnection::publishMessage(
             // This is a workaround of mosquitto bug
             continue;
         }
-        ret = mosquitto_property_add_string_pair(
+        int ret = mosquitto_property_add_string_pair(
                 &props, MQTT_PROP_USER_PROPERTY, key.c_str(), value.c_str());
         switch (ret) {
         case MOSQ_ERR_SUCCESS:
@@ -925,10 +988,52 @@ void MosquittoConnection::publishMessage(
                                 errorString);
             mosquitto_property_free_all(&props);
             onFailure(exceptions::JoynrMessageNotSentException(errorMsg));
-            return;
+            return false;
         }
     }
 
+    userProperties = std::shared_ptr<mosquitto_property>(
+            props, [](mosquitto_property* toBeFreed) { mosquitto_property_free_all(&toBeFreed); });
+    return true;
+}
+
+mosquitto_property* MosquittoConnection::createPublishProperties(
+        const std::uint32_t msgTtlSec,
+        const mosquitto_property* userProperties)
+{
+    mosquitto_property* props = nullptr;
+    int ret = mosquitto_property_copy_all(&props, userProperties);
+    if (ret == MOSQ_ERR_SUCCESS) {
+        ret = mosquitto_property_add_int32(&props, MQTT_PROP_MESSAGE_EXPIRY_INTERVAL, msgTtlSec);
+    }
+    switch (ret) {
+    case MOSQ_ERR_SUCCESS:
+        JOYNR_LOG_TRACE(
+                logger(), "[{}] Added MQTT message expiry date in Sec {}", _gbid, msgTtlSec);
+        break;
+    default:
+        // MOSQ_ERR_INVAL, MOSQ_ERR_NOMEM
+        const std::string errorString(getErrorString(ret));
+        std::string errorMsg = fmt::format(
+                "[{}] Adding MQTT message expiry interval property failed: error: {} ({})",
+                _gbid,
+                std::to_string(ret),
+                errorString);
+        mosquitto_property_free_all(&props);
+        throw exceptions::JoynrRuntimeException(errorMsg);
+    }
+    return props;
+}
+
+void MosquittoConnection::publishWithProperties(
+        const std::string& topic,
+        const int qosLevel,
+        const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+        const uint32_t payloadlen,
+        const void* payload,
+        const mosquitto_property* props)
+{
+    int mid;
     int rc = mosquitto_publish_v5(_mosq,
                                   &mid,
                                   topic.c_str(),
@@ -937,7 +1042,6 @@ void MosquittoConnection::publishMessage(
                                   qosLevel,
                                   isMqttRetain(),
                                   props);
-    mosquitto_property_free_all(&props);
     if (!(rc == MOSQ_ERR_SUCCESS)) {
         const std::string errorString(getErrorString(rc));
         if (rc == MOSQ_ERR_INVAL || rc == MOSQ_ERR_PAYLOAD_SIZE) {
@@ -997,6 +1101,11 @@ bool MosquittoConnection::isReadyToSend() const
     return _readyToSend;
 }
 
+bool MosquittoConnection::isPublishOnly() const
+{
+    return _isPublishOnly;
+}
+
 void MosquittoConnection::setReadyToSend(bool readyToSend)
 {
     if (this->_readyToSend != readyToSend) {
@@ -23,8 +23,11 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #pragma GCC diagnostic push
@@ -58,6 +61,14 @@ class MosquittoConnection
 {
 
 public:
+    /**
+     * @param isPublishOnly if true, the connection does not subscribe to any topic and is
+     * ready to send as soon as it is connected to the broker. Such connections are used to
+     * spread the outbound traffic of one GBID over several MQTT connections.
+     * @param connectionIndex index of the connection within the connections of its GBID,
+     * 0 for the main connection. It selects the name, CPU affinity and priority of the
+     * network thread from the MQTT thread pool configuration.
+     */
     explicit MosquittoConnection(const ClusterControllerSettings& ccSettings,
                                  BrokerUrl brokerUrl,
                                  std::chrono::seconds mqttKeepAliveTimeSeconds,
@@ -66,7 +77,9 @@ public:
                                  bool isMqttExponentialBackoffEnabled,
                                  const std::string& clientId,
                                  const std::string& gbid,
-                                 bool isMqttRetain);
+                                 bool isMqttRetain,
+                                 bool isPublishOnly = false,
+                                 std::uint32_t connectionIndex = 0);
 
     virtual ~MosquittoConnection();
 
@@ -92,9 +105,10 @@ public:
             const int qosLevel,
             const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
             const uint32_t msgTtlSec,
-            const std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+            const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
             const uint32_t payloadlen,
             const void* payload);
+
     virtual void subscribeToTopic(const std::string& topic);
     virtual void unsubscribeFromTopic(const std::string& topic);
     virtual void registerChannelId(const std::string& channelId);
@@ -102,6 +116,7 @@ public:
     virtual void registerReadyToSendChangedCallback(std::function<void(bool)> readyToSendCallback);
     virtual bool isSubscribedToChannelTopic() const;
     virtual bool isReadyToSend() const;
+    bool isPublishOnly() const;
 
 private:
     DISALLOW_COPY_AND_ASSIGN(MosquittoConnection);
@@ -154,6 +169,44 @@ private:
     void setReadyToSend(bool readyToSend);
     static std::string getErrorString(int rc);
 
+    /**
+     * Looks up the user property list for the custom headers of a message to be published.
+     * The cache holds one list per distinct set of headers and evicts the least recently
+     * used list when it is full. A cached list is only read (copied) by the publishing
+     * threads, hence it can be shared by several threads in parallel.
+     * Must be called with _publishPropertiesCacheMutex held.
+     * @param userProperties set to the property list, nullptr if there are no user properties
+     * @return false in case onFailure has been called
+     */
+    bool getUserPropertiesLocked(
+            const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
+            const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+            std::shared_ptr<mosquitto_property>& userProperties);
+    bool createUserProperties(
+            const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
+            const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+            std::shared_ptr<mosquitto_property>& userProperties);
+    /**
+     * Returns a copy of userProperties with the message expiry interval added. The copy is
+     * owned by the caller and must be freed with mosquitto_property_free_all.
+     */
+    mosquitto_property* createPublishProperties(const std::uint32_t msgTtlSec,
+                                                const mosquitto_property* userProperties);
+    void publishWithProperties(
+            const std::string& topic,
+            const int qosLevel,
+            const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure,
+            const uint32_t payloadlen,
+            const void* payload,
+            const mosquitto_property* props);
+
+    struct CachedUserProperties {
+        std::size_t key;
+        std::unordered_map<std::string, std::string> prefixedCustomHeaders;
+        std::shared_ptr<mosquitto_property> properties;
+    };
+    using UserPropertiesCache = std::list<CachedUserProperties>;
+
     const BrokerUrl _brokerUrl;
     const std::chrono::seconds _mqttKeepAliveTimeSeconds;
     const std::chrono::seconds _mqttReconnectDelayTimeSeconds;
@@ -194,6 +247,14 @@ private:
     struct mosquitto* _mosq;
     uint32_t _mqttMaximumPacketSize;
     std::string _gbid;
+    const bool _isPublishOnly;
+    const std::uint32_t _connectionIndex;
+
+    std::mutex _publishPropertiesCacheMutex;
+    // most recently used entry first
+    UserPropertiesCache _publishPropertiesCache;
+    std::unordered_multimap<std::size_t, UserPropertiesCache::iterator> _publishPropertiesIndex;
+    static constexpr std::size_t _publishPropertiesCacheCapacity = 256;
 
     static constexpr std::int32_t sessionExpiryInterval = std::numeric_limits<std::int32_t>::max();
 
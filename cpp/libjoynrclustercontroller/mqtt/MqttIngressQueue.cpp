@@ -0,0 +1,282 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include "MqttIngressQueue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <utility>
+
+#include "joynr/ThreadConfiguration.h"
+
+namespace joynr
+{
+
+MqttIngressQueue::MqttIngressQueue(const std::string& gbid,
+                                   std::size_t capacity,
+                                   std::uint32_t numberOfThreads,
+                                   std::chrono::milliseconds maxBackpressureDuration,
+                                   std::function<void(smrf::ByteVector&&)> onMessageReceived)
+        : _gbid(gbid),
+          _capacity(capacity),
+          _numberOfThreads(numberOfThreads),
+          _maxBackpressureDuration(maxBackpressureDuration),
+          _onMessageReceived(std::move(onMessageReceived)),
+          _workers(),
+          _queue(),
+          _mutex(),
+          _notEmpty(),
+          _drained(),
+          _isRunning(false),
+          _isBackpressureActive(false),
+          _backpressureDeadline(),
+          _droppedMessagesDuringBackpressure(0),
+          _maxQueueDepth(0),
+          _receivedMessages(0),
+          _processedMessages(0),
+          _droppedMessages(0),
+          _backpressureEvents(0),
+          _totalQueueingLatency(0),
+          _maxQueueingLatency(0),
+          _totalProcessingLatency(0),
+          _maxProcessingLatency(0),
+          _receivedCounter(MetricsRegistry::instance().getCounter(
+                  "joynr_mqtt_ingress_received_total",
+                  "MQTT messages handed over to the ingress queue",
+                  "gbid=\"" + gbid + "\"")),
+          _droppedCounter(MetricsRegistry::instance().getCounter(
+                  "joynr_mqtt_ingress_dropped_total",
+                  "MQTT messages dropped because the ingress queue was stopped or stayed full",
+                  "gbid=\"" + gbid + "\"")),
+          _queueDepthGauge(MetricsRegistry::instance().getGauge(
+                  "joynr_mqtt_ingress_queue_depth",
+                  "MQTT messages waiting in the ingress queue",
+                  "gbid=\"" + gbid + "\"")),
+          _queueingLatencyHistogram(MetricsRegistry::instance().getHistogram(
+                  "joynr_mqtt_ingress_queueing_seconds",
+                  "Time received MQTT messages wait in the ingress queue",
+                  "gbid=\"" + gbid + "\"")),
+          _processingLatencyHistogram(MetricsRegistry::instance().getHistogram(
+                  "joynr_mqtt_ingress_processing_seconds",
+                  "Time spent processing a received MQTT message",
+                  "gbid=\"" + gbid + "\""))
+{
+    assert(_capacity > 0);
+    assert(_numberOfThreads > 0);
+}
+
+MqttIngressQueue::~MqttIngressQueue()
+{
+    stop();
+}
+
+void MqttIngressQueue::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_isRunning) {
+        return;
+    }
+    _isRunning = true;
+    for (std::uint32_t i = 0; i < _numberOfThreads; ++i) {
+        _workers.emplace_back(&MqttIngressQueue::workerLoop, this, i);
+    }
+    JOYNR_LOG_DEBUG(logger(),
+                    "[{}] Started MQTT ingress queue with capacity {} and {} threads",
+                    _gbid,
+                    _capacity,
+                    _numberOfThreads);
+}
+
+void MqttIngressQueue::stop()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_isRunning) {
+            return;
+        }
+        _isRunning = false;
+        workers.swap(_workers);
+    }
+    // the workers process the messages still queued before they terminate
+    _notEmpty.notify_all();
+    _drained.notify_all();
+
+    for (std::thread& worker : workers) {
+        // do not cause an abort waiting for ourselves
+        if (std::this_thread::get_id() == worker.get_id()) {
+            worker.detach();
+        } else if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    const Metrics metrics = getMetrics();
+    JOYNR_LOG_INFO(logger(),
+                   "[{}] Stopped MQTT ingress queue: received {}, processed {}, dropped {}, "
+                   "max queue depth {}, backpressure events {}, average queueing latency {}us, "
+                   "average processing latency {}us",
+                   _gbid,
+                   metrics.receivedMessages,
+                   metrics.processedMessages,
+                   metrics.droppedMessages,
+                   metrics.maxQueueDepth,
+                   metrics.backpressureEvents,
+                   metrics.averageQueueingLatency.count(),
+                   metrics.averageProcessingLatency.count());
+}
+
+void MqttIngressQueue::push(smrf::ByteVector&& rawMessage)
+{
+    // called by the mosquitto network thread
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_isRunning && _queue.size() >= _capacity) {
+        if (!_isBackpressureActive) {
+            _isBackpressureActive = true;
+            _backpressureDeadline = std::chrono::steady_clock::now() + _maxBackpressureDuration;
+            ++_backpressureEvents;
+            JOYNR_LOG_WARN(logger(),
+                           "[{}] MQTT ingress queue is full ({} messages), pausing reception",
+                           _gbid,
+                           _capacity);
+        }
+        // the whole pause is bounded, otherwise the keep alive of the connection would expire
+        const bool isDrained = _drained.wait_until(lock, _backpressureDeadline, [this]() {
+            return !_isRunning || !_isBackpressureActive;
+        });
+        if (!isDrained) {
+            ++_droppedMessages;
+            _droppedCounter->increment();
+            if (_droppedMessagesDuringBackpressure++ == 0) {
+                JOYNR_LOG_WARN(logger(),
+                               "[{}] MQTT ingress queue not drained within {}ms, dropping "
+                               "received messages until it has been drained",
+                               _gbid,
+                               _maxBackpressureDuration.count());
+            }
+            JOYNR_LOG_DEBUG(
+                    logger(), "[{}] Dropping received message, MQTT ingress queue is full", _gbid);
+            return;
+        }
+    }
+    if (!_isRunning) {
+        ++_droppedMessages;
+        _droppedCounter->increment();
+        JOYNR_LOG_DEBUG(logger(),
+                        "[{}] Discarding received message, MQTT ingress queue is stopped",
+                        _gbid);
+        return;
+    }
+    ++_receivedMessages;
+    _receivedCounter->increment();
+    _queue.push_back(Entry{std::move(rawMessage), std::chrono::steady_clock::now()});
+    _maxQueueDepth = std::max(_maxQueueDepth, _queue.size());
+    _queueDepthGauge->set(static_cast<std::int64_t>(_queue.size()));
+    lock.unlock();
+    _notEmpty.notify_one();
+}
+
+bool MqttIngressQueue::isBackpressureActive() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _isBackpressureActive;
+}
+
+MqttIngressQueue::Metrics MqttIngressQueue::getMetrics() const
+{
+    using std::chrono::microseconds;
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto average = [this](microseconds total) {
+        if (_processedMessages == 0) {
+            return microseconds(0);
+        }
+        return microseconds(total.count() / static_cast<microseconds::rep>(_processedMessages));
+    };
+    return Metrics{_gbid,
+                   _queue.size(),
+                   _maxQueueDepth,
+                   _receivedMessages,
+                   _processedMessages,
+                   _droppedMessages,
+                   _backpressureEvents,
+                   average(_totalQueueingLatency),
+                   _maxQueueingLatency,
+                   average(_totalProcessingLatency),
+                   _maxProcessingLatency};
+}
+
+void MqttIngressQueue::workerLoop(std::uint32_t index)
+{
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
+
+    ThreadConfiguration::instance().applyToCurrentThread(
+            ThreadConfiguration::MQTT_INGRESS(), index);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _notEmpty.wait(lock, [this]() { return !_isRunning || !_queue.empty(); });
+        if (_queue.empty()) {
+            return;
+        }
+        Entry entry = std::move(_queue.front());
+        _queue.pop_front();
+        _queueDepthGauge->set(static_cast<std::int64_t>(_queue.size()));
+        const bool isDrained = _isBackpressureActive && _queue.size() <= _capacity / 2;
+        if (isDrained) {
+            _isBackpressureActive = false;
+            JOYNR_LOG_INFO(logger(),
+                           "[{}] MQTT ingress queue drained, resuming reception, {} messages "
+                           "dropped while it was full",
+                           _gbid,
+                           _droppedMessagesDuringBackpressure);
+            _droppedMessagesDuringBackpressure = 0;
+        }
+        lock.unlock();
+        if (isDrained) {
+            _drained.notify_one();
+        }
+
+        const steady_clock::time_point processingStart = steady_clock::now();
+        try {
+            _onMessageReceived(std::move(entry.rawMessage));
+        } catch (const std::exception& e) {
+            JOYNR_LOG_ERROR(logger(),
+                            "[{}] Processing of received message failed: {}",
+                            _gbid,
+                            e.what());
+        }
+        const steady_clock::time_point processingEnd = steady_clock::now();
+        const auto queueingLatency =
+                std::chrono::duration_cast<microseconds>(processingStart - entry.enqueueTime);
+        const auto processingLatency =
+                std::chrono::duration_cast<microseconds>(processingEnd - processingStart);
+        _queueingLatencyHistogram->record(queueingLatency);
+        _processingLatencyHistogram->record(processingLatency);
+
+        lock.lock();
+        ++_processedMessages;
+        _totalQueueingLatency += queueingLatency;
+        _maxQueueingLatency = std::max(_maxQueueingLatency, queueingLatency);
+        _totalProcessingLatency += processingLatency;
+        _maxProcessingLatency = std::max(_maxProcessingLatency, processingLatency);
+    }
+}
+
+} // namespace joynr
@@ -0,0 +1,165 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#ifndef MQTTINGRESSQUEUE_H
+#define MQTTINGRESSQUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <smrf/ByteVector.h>
+
+#include "joynr/Logger.h"
+#include "joynr/Metrics.h"
+#include "joynr/PrivateCopyAssign.h"
+
+namespace joynr
+{
+
+/**
+ * Bounded queue between the mosquitto network thread and the processing of received
+ * MQTT messages of one GBID.
+ *
+ * Messages are handed over by the network thread via push() and processed by a fixed
+ * number of worker threads. If the queue is full, push() pauses the network thread until the
+ * workers have drained the queue to half of its capacity. While paused, nothing is read from
+ * the socket, so the broker is throttled by TCP flow control. A pause also delays the keep
+ * alive of the connection, hence it is bounded by maxBackpressureDuration: messages received
+ * after that while the queue is still full are dropped until it has been drained.
+ *
+ * The metrics are exported per GBID via the MetricsRegistry.
+ */
+class MqttIngressQueue
+{
+public:
+    struct Metrics {
+        std::string gbid;
+        std::size_t queueDepth;
+        std::size_t maxQueueDepth;
+        std::uint64_t receivedMessages;
+        std::uint64_t processedMessages;
+        std::uint64_t droppedMessages;
+        std::uint64_t backpressureEvents;
+        /*! time between push() and the start of processing */
+        std::chrono::microseconds averageQueueingLatency;
+        std::chrono::microseconds maxQueueingLatency;
+        /*! time spent in the processing callback */
+        std::chrono::microseconds averageProcessingLatency;
+        std::chrono::microseconds maxProcessingLatency;
+    };
+
+    /**
+     * @param gbid the GBID of the connection the messages are received from
+     * @param capacity maximum number of queued messages, must be greater than 0
+     * @param numberOfThreads number of worker threads, the order of received
+     * messages is only preserved for a single thread
+     * @param maxBackpressureDuration maximum time the network thread is paused while the
+     * queue is full, must be well below the keep alive interval of the connection
+     * @param onMessageReceived callback invoked by the worker threads
+     */
+    MqttIngressQueue(const std::string& gbid,
+                     std::size_t capacity,
+                     std::uint32_t numberOfThreads,
+                     std::chrono::milliseconds maxBackpressureDuration,
+                     std::function<void(smrf::ByteVector&&)> onMessageReceived);
+
+    ~MqttIngressQueue();
+
+    /**
+     * Starts the worker threads.
+     */
+    void start();
+
+    /**
+     * Stops the worker threads after they have processed the messages still queued.
+     */
+    void stop();
+
+    /**
+     * Enqueues a received message. Blocks while the queue is full until it has been drained
+     * to half of its capacity, but not longer than maxBackpressureDuration after the queue
+     * has run full. The message is dropped if the queue is still full after that or if
+     * stop() has been called.
+     */
+    void push(smrf::ByteVector&& rawMessage);
+
+    /**
+     * @return true if the queue has run full and not yet been drained to half of
+     * its capacity, i.e. push() currently pauses the network thread
+     */
+    bool isBackpressureActive() const;
+
+    Metrics getMetrics() const;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(MqttIngressQueue);
+
+    struct Entry {
+        smrf::ByteVector rawMessage;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    void workerLoop(std::uint32_t index);
+
+    ADD_LOGGER(MqttIngressQueue)
+
+    const std::string _gbid;
+    const std::size_t _capacity;
+    const std::uint32_t _numberOfThreads;
+    const std::chrono::milliseconds _maxBackpressureDuration;
+    std::function<void(smrf::ByteVector&&)> _onMessageReceived;
+
+    std::vector<std::thread> _workers;
+    std::deque<Entry> _queue;
+    mutable std::mutex _mutex;
+    std::condition_variable _notEmpty;
+    std::condition_variable _drained;
+    bool _isRunning;
+    bool _isBackpressureActive;
+    std::chrono::steady_clock::time_point _backpressureDeadline;
+    std::uint64_t _droppedMessagesDuringBackpressure;
+
+    std::size_t _maxQueueDepth;
+    std::uint64_t _receivedMessages;
+    std::uint64_t _processedMessages;
+    std::uint64_t _droppedMessages;
+    std::uint64_t _backpressureEvents;
+    std::chrono::microseconds _totalQueueingLatency;
+    std::chrono::microseconds _maxQueueingLatency;
+    std::chrono::microseconds _totalProcessingLatency;
+    std::chrono::microseconds _maxProcessingLatency;
+
+    std::shared_ptr<MetricsCounter> _receivedCounter;
+    std::shared_ptr<MetricsCounter> _droppedCounter;
+    std::shared_ptr<MetricsGauge> _queueDepthGauge;
+    std::shared_ptr<LatencyHistogram> _queueingLatencyHistogram;
+    std::shared_ptr<LatencyHistogram> _processingLatencyHistogram;
+};
+
+} // namespace joynr
+
+#endif // MQTTINGRESSQUEUE_H
@@ -25,6 +25,7 @@
 
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/Metrics.h"
 #include "joynr/MqttReceiver.h"
 #include "joynr/Util.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -111,6 +112,8 @@ void MqttMessagingSkeleton::transmit(
 
 void MqttMessagingSkeleton::onMessageReceived(smrf::ByteVector&& rawMessage)
 {
+    static TransportTrafficCounter receivedTraffic("mqtt", "received");
+    receivedTraffic.count(rawMessage.size());
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
         immutableMessage = std::make_shared<ImmutableMessage>(std::move(rawMessage));
@@ -23,6 +23,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Message.h"
@@ -39,10 +40,31 @@ namespace joynr
 {
 
 MqttSender::MqttSender(std::shared_ptr<MosquittoConnection> mosquittoConnection)
-        : _mosquittoConnection(mosquittoConnection), _receiver()
+        : MqttSender(std::move(mosquittoConnection), {})
 {
 }
 
+MqttSender::MqttSender(std::shared_ptr<MosquittoConnection> mosquittoConnection,
+                       std::vector<std::shared_ptr<MosquittoConnection>> publishConnections)
+        : _mosquittoConnection(std::move(mosquittoConnection)), _connections(), _receiver()
+{
+    _connections.reserve(publishConnections.size() + 1);
+    _connections.push_back(_mosquittoConnection);
+    for (auto& publishConnection : publishConnections) {
+        _connections.push_back(std::move(publishConnection));
+    }
+}
+
+const std::shared_ptr<MosquittoConnection>& MqttSender::selectConnection(
+        const std::string& topic) const
+{
+    if (_connections.size() == 1) {
+        return _mosquittoConnection;
+    }
+    const std::size_t index = std::hash<std::string>{}(topic) % _connections.size();
+    return _connections[index];
+}
+
 void MqttSender::sendMessage(
         const system::RoutingTypes::Address& destinationAddress,
         std::shared_ptr<ImmutableMessage> message,
@@ -64,13 +86,22 @@ void MqttSender::sendMessage(
         return;
     }
     std::string topic;
-    if (message->getType() == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+    if (message->getMessageType() == MessageType::MULTICAST) {
         topic = mqttAddress->getTopic();
     } else {
         topic = mqttAddress->getTopic() + "/" + _mosquittoConnection->getMqttPrio();
     }
 
-    int qosLevel = _mosquittoConnection->getMqttQos();
+    const std::shared_ptr<MosquittoConnection>& connection = selectConnection(topic);
+    if (connection != _mosquittoConnection && !connection->isReadyToSend()) {
+        // do not fall back to another connection, this would reorder the messages of the topic
+        const std::string msg = "MqttSender publish connection is not ready, delaying message";
+        JOYNR_LOG_DEBUG(logger(), msg);
+        onFailure(exceptions::JoynrDelayMessageException(std::chrono::seconds(2), msg));
+        return;
+    }
+
+    int qosLevel = connection->getMqttQos();
 
     boost::optional<std::string> optionalEffort = message->getEffort();
     if (optionalEffort &&
@@ -81,14 +112,14 @@ void MqttSender::sendMessage(
     const smrf::ByteVector& rawMessage = message->getSerializedMessage();
 
     std::size_t mqttMaximumMessageSizeBytes =
-            static_cast<std::size_t>(_mosquittoConnection->getMqttMaximumPacketSize());
+            static_cast<std::size_t>(connection->getMqttMaximumPacketSize());
 
     const std::size_t fixedOverheadPerMessage = 32;
     const std::size_t fixedOverheadPerCustomHeader = 5;
 
     std::size_t mqttMessageSizeBytes = rawMessage.size() + fixedOverheadPerMessage + topic.length();
 
-    auto prefixedCustomHeaders = message->getPrefixedCustomHeaders();
+    const auto prefixedCustomHeaders = message->getPrefixedCustomHeaders();
     for (auto it = prefixedCustomHeaders.cbegin(); it != prefixedCustomHeaders.cend(); ++it) {
         mqttMessageSizeBytes +=
                 it->first.length() + it->second.length() + fixedOverheadPerCustomHeader;
@@ -114,13 +145,13 @@ void MqttSender::sendMessage(
     } else {
         ttlSec = static_cast<std::uint32_t>(std::ceil(msgExpiryDate.count() / 1000.0));
     }
-    _mosquittoConnection->publishMessage(topic,
-                                         qosLevel,
-                                         onFailure,
-                                         ttlSec,
-                                         message->getPrefixedCustomHeaders(),
-                                         rawMessage.size(),
-                                         rawMessage.data());
+    connection->publishMessage(topic,
+                               qosLevel,
+                               onFailure,
+                               ttlSec,
+                               prefixedCustomHeaders,
+                               rawMessage.size(),
+                               rawMessage.data());
 }
 
 } // namespace joynr
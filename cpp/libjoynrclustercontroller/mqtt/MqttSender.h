@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "joynr/ITransportMessageSender.h"
 #include "joynr/Logger.h"
@@ -54,6 +56,14 @@ class MqttSender : public ITransportMessageSender
 public:
     explicit MqttSender(std::shared_ptr<MosquittoConnection> mosquittoConnection);
 
+    /**
+     * @param mosquittoConnection the connection which is also used for receiving
+     * @param publishConnections additional publish only connections for the same GBID.
+     * Messages are assigned to one of the connections by their destination topic.
+     */
+    MqttSender(std::shared_ptr<MosquittoConnection> mosquittoConnection,
+               std::vector<std::shared_ptr<MosquittoConnection>> publishConnections);
+
     ~MqttSender() override = default;
 
     /**
@@ -67,7 +77,16 @@ public:
 private:
     DISALLOW_COPY_AND_ASSIGN(MqttSender);
 
+    /**
+     * Selects the connection for the given topic. All messages to the same topic use the
+     * same connection to preserve their order. Messages are delayed, not rerouted, while
+     * the selected publish only connection is not ready to send.
+     */
+    const std::shared_ptr<MosquittoConnection>& selectConnection(const std::string& topic) const;
+
     std::shared_ptr<MosquittoConnection> _mosquittoConnection;
+    // index 0 is _mosquittoConnection, followed by the publish only connections
+    std::vector<std::shared_ptr<MosquittoConnection>> _connections;
     std::shared_ptr<ITransportMessageReceiver> _receiver;
 
     ADD_LOGGER(MqttSender)
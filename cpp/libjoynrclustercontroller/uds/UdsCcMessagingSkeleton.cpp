@@ -29,6 +29,7 @@
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
 #include "joynr/Logger.h"
+#include "joynr/Metrics.h"
 #include "joynr/exceptions/JoynrException.h"
 
 namespace joynr
@@ -53,13 +54,17 @@ void UdsCcMessagingSkeleton::transmit(
 }
 
 void UdsCcMessagingSkeleton::onMessageReceived(smrf::ByteVector&& message,
-                                               const std::string& creator)
+                                               const std::string& creator,
+                                               InFlightBudget::Credit credit)
 {
+    static TransportTrafficCounter receivedTraffic("uds", "received");
+    receivedTraffic.count(message.size());
     // deserialize message and transmit
     std::shared_ptr<ImmutableMessage> immutableMessage;
     try {
         immutableMessage = std::make_shared<ImmutableMessage>(std::move(message));
         immutableMessage->setCreator(creator);
+        immutableMessage->setInFlightCredit(std::move(credit));
     } catch (const smrf::EncodingException& e) {
         JOYNR_LOG_ERROR(logger(), "Unable to deserialize message - error: {}", e.what());
         return;
@@ -24,6 +24,7 @@
 
 #include <smrf/ByteVector.h>
 
+#include "joynr/InFlightBudget.h"
 #include "joynr/Logger.h"
 #include "joynr/PrivateCopyAssign.h"
 
@@ -59,7 +60,12 @@ public:
     void transmit(std::shared_ptr<ImmutableMessage> message,
                   const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure);
 
-    void onMessageReceived(smrf::ByteVector&& message, const std::string& creator);
+    /**
+     * @param credit credit of the client connection, kept by the message until it is processed
+     */
+    void onMessageReceived(smrf::ByteVector&& message,
+                           const std::string& creator,
+                           InFlightBudget::Credit credit = nullptr);
 
 private:
     ADD_LOGGER(UdsCcMessagingSkeleton)
@@ -33,10 +33,13 @@
 #include "joynr/BoostIoserviceForwardDecl.h"
 #include "joynr/IMessageRouter.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/InFlightBudget.h"
 #include "joynr/Logger.h"
+#include "joynr/Metrics.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Semaphore.h"
 #include "joynr/SingleThreadedIOService.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/Util.h"
 #include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/WebSocketClientAddress.h"
@@ -61,6 +64,13 @@ public:
             const std::function<void(const exceptions::JoynrRuntimeException&)>& onFailure) = 0;
     virtual void init() = 0;
     virtual void shutdown() = 0;
+
+    /**
+     * Limits the resources a single client connection may use, see
+     * UdsServer::setFlowControlLimits(). Must be called before init().
+     */
+    virtual void setFlowControlLimits(std::size_t maxInFlightMessages,
+                                      std::size_t maxSendBufferBytes) = 0;
 };
 
 /**
@@ -86,7 +96,9 @@ public:
             : IWebsocketCcMessagingSkeleton(),
               std::enable_shared_from_this<WebSocketCcMessagingSkeleton<Config>>(),
               _ioService(ioService),
-              _webSocketPpSingleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+              _webSocketPpSingleThreadedIOService(
+                      std::make_shared<SingleThreadedIOService>(nullptr,
+                                                                ThreadConfiguration::WEBSOCKET())),
               _endpoint(),
               _clientsMutex(),
               _clients(),
@@ -94,10 +106,19 @@ public:
               _messageRouter(std::move(messageRouter)),
               _messagingStubFactory(std::move(messagingStubFactory)),
               _port(port),
-              _shuttingDown(false)
+              _shuttingDown(false),
+              _maxInFlightMessages(0),
+              _maxSendBufferBytes(0)
     {
     }
 
+    void setFlowControlLimits(std::size_t maxInFlightMessages,
+                              std::size_t maxSendBufferBytes) override
+    {
+        _maxInFlightMessages = maxInFlightMessages;
+        _maxSendBufferBytes = maxSendBufferBytes;
+    }
+
     virtual void init() override
     {
         _webSocketPpSingleThreadedIOService->start();
@@ -244,6 +265,8 @@ protected:
         CertEntry& operator=(CertEntry&&) = default;
         joynr::system::RoutingTypes::WebSocketClientAddress _webSocketClientAddress;
         std::string _ownerId;
+        // set once the connection has been initialized
+        std::shared_ptr<InFlightBudget> _inFlightBudget;
     };
 
     std::mutex _clientsMutex;
@@ -302,6 +325,9 @@ private:
 
             auto sender = std::make_shared<WebSocketPpSender<Server>>(_endpoint);
             sender->setConnectionHandle(hdl);
+            sender->setMaxBufferedBytes(_maxSendBufferBytes);
+            auto inFlightBudget =
+                    std::make_shared<InFlightBudget>(_maxInFlightMessages, "websocket");
 
             _messagingStubFactory->addClient(*clientAddress, std::move(sender));
 
@@ -320,9 +346,11 @@ private:
                 auto it = _clients.find(hdl);
                 if (it != _clients.cend()) {
                     it->second._webSocketClientAddress = *clientAddress;
+                    it->second._inFlightBudget = std::move(inFlightBudget);
                 } else {
                     // insecure connection, no CN exists
                     auto certEntry = CertEntry(*clientAddress, std::string());
+                    certEntry._inFlightBudget = std::move(inFlightBudget);
                     _clients[hdl] = std::move(certEntry);
                 }
             }
@@ -336,6 +364,8 @@ private:
 
     void onMessageReceived(ConnectionHandle&& hdl, smrf::ByteVector&& message)
     {
+        static TransportTrafficCounter receivedTraffic("websocket", "received");
+        receivedTraffic.count(message.size());
         // deserialize message and transmit
         std::shared_ptr<ImmutableMessage> immutableMessage;
         try {
@@ -354,6 +384,8 @@ private:
             JOYNR_LOG_TRACE(logger(), "<<< INCOMING <<< {}", immutableMessage->toLogMessage());
         }
 
+        acquireInFlightCredit(hdl, *immutableMessage);
+
         if (!preprocessIncomingMessage(immutableMessage)) {
             JOYNR_LOG_ERROR(logger(), "Dropping message {}", immutableMessage->getTrackingInfo());
             return;
@@ -374,6 +406,51 @@ private:
         transmit(std::move(immutableMessage), std::move(onFailure));
     }
 
+    /**
+     * Attaches a credit of the connection to the message and pauses reading from the
+     * connection if its budget is exhausted.
+     */
+    void acquireInFlightCredit(const ConnectionHandle& hdl, ImmutableMessage& message)
+    {
+        std::shared_ptr<InFlightBudget> inFlightBudget;
+        {
+            std::lock_guard<std::mutex> lock(_clientsMutex);
+            auto it = _clients.find(hdl);
+            if (it != _clients.cend()) {
+                inFlightBudget = it->second._inFlightBudget;
+            }
+        }
+        if (!inFlightBudget) {
+            return;
+        }
+        message.setInFlightCredit(inFlightBudget->acquire());
+
+        auto resume = [thisWeakPtr = joynr::util::as_weak_ptr(this->shared_from_this()), hdl]() {
+            if (auto thisSharedPtr = thisWeakPtr.lock()) {
+                thisSharedPtr->setReadingPaused(hdl, false);
+            }
+        };
+        if (inFlightBudget->pauseIfExhausted(std::move(resume))) {
+            setReadingPaused(hdl, true);
+        }
+    }
+
+    void setReadingPaused(const ConnectionHandle& hdl, bool paused)
+    {
+        websocketpp::lib::error_code websocketError;
+        typename Server::connection_ptr connection =
+                _endpoint.get_con_from_hdl(hdl, websocketError);
+        if (!websocketError) {
+            websocketError = paused ? connection->pause_reading() : connection->resume_reading();
+        }
+        if (websocketError) {
+            JOYNR_LOG_ERROR(logger(),
+                            "Unable to {} reading from websocket connection. Error: {}",
+                            paused ? "pause" : "resume",
+                            websocketError.message());
+        }
+    }
+
     bool isInitializationMessage(const std::string& message)
     {
         return boost::starts_with(
@@ -389,6 +466,8 @@ private:
     std::shared_ptr<WebSocketMessagingStubFactory> _messagingStubFactory;
     std::uint16_t _port;
     std::atomic<bool> _shuttingDown;
+    std::size_t _maxInFlightMessages;
+    std::size_t _maxSendBufferBytes;
 
     DISALLOW_COPY_AND_ASSIGN(WebSocketCcMessagingSkeleton);
 };
@@ -23,7 +23,11 @@ namespace joynr
 {
 
 JoynrClusterControllerMqttConnectionData::JoynrClusterControllerMqttConnectionData()
-        : mosquittoConnection(nullptr), mqttMessageReceiver(nullptr), mqttMessageSender(nullptr)
+        : mosquittoConnection(nullptr),
+          publishConnections(),
+          mqttMessageReceiver(nullptr),
+          mqttMessageSender(nullptr),
+          mqttIngressQueue(nullptr)
 {
 }
 
@@ -41,6 +45,18 @@ void JoynrClusterControllerMqttConnectionData::setMosquittoConnection(
     mosquittoConnection = value;
 }
 
+std::vector<std::shared_ptr<MosquittoConnection>> JoynrClusterControllerMqttConnectionData::
+        getPublishConnections() const
+{
+    return publishConnections;
+}
+
+void JoynrClusterControllerMqttConnectionData::setPublishConnections(
+        const std::vector<std::shared_ptr<MosquittoConnection>>& value)
+{
+    publishConnections = value;
+}
+
 std::shared_ptr<ITransportMessageReceiver> JoynrClusterControllerMqttConnectionData::
         getMqttMessageReceiver() const
 {
@@ -64,4 +80,16 @@ void JoynrClusterControllerMqttConnectionData::setMqttMessageSender(
 {
     mqttMessageSender = value;
 }
+
+std::shared_ptr<MqttIngressQueue> JoynrClusterControllerMqttConnectionData::getMqttIngressQueue()
+        const
+{
+    return mqttIngressQueue;
+}
+
+void JoynrClusterControllerMqttConnectionData::setMqttIngressQueue(
+        const std::shared_ptr<MqttIngressQueue>& value)
+{
+    mqttIngressQueue = value;
+}
 } // namespace joynr
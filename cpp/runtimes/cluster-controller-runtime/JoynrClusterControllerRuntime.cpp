@@ -41,20 +41,24 @@
 #include "joynr/IDispatcher.h"
 #include "joynr/IMessageSender.h"
 #include "joynr/IMulticastAddressCalculator.h"
+#include "joynr/IOServicePool.h"
 #include "joynr/IPlatformSecurityManager.h"
 #include "joynr/IProxyBuilder.h"
 #include "joynr/IProxyBuilderBase.h"
 #include "joynr/ITransportMessageReceiver.h"
+#include "joynr/InFlightBudget.h"
 #include "joynr/InProcessMessagingAddress.h"
 #include "joynr/JoynrClusterControllerMqttConnectionData.h"
 #include "joynr/JoynrMessagingConnectorFactory.h"
 #include "joynr/LocalCapabilitiesDirectory.h"
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
 #include "joynr/LocalDiscoveryAggregator.h"
+#include "joynr/MessageCompression.h"
 #include "joynr/MessageQueue.h"
 #include "joynr/MessageSender.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MessagingSettings.h"
+#include "joynr/Metrics.h"
 #include "joynr/MqttMessagingSkeleton.h"
 #include "joynr/MqttMulticastAddressCalculator.h"
 #include "joynr/MqttReceiver.h"
@@ -64,12 +68,14 @@
 #include "joynr/ProxyFactory.h"
 #include "joynr/PublicationManager.h"
 #include "joynr/Settings.h"
-#include "joynr/SingleThreadedIOService.h"
 #include "joynr/SubscriptionManager.h"
 #include "joynr/SystemServicesSettings.h"
 #include "joynr/TaskSequencer.h"
+#include "joynr/ThreadConfiguration.h"
+#include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/Url.h"
 #include "joynr/Util.h"
+#include "joynr/WarmRestartSnapshot.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/infrastructure/AccessControlListEditorProvider.h"
 #include "joynr/infrastructure/GlobalCapabilitiesDirectoryProxy.h"
@@ -102,6 +108,7 @@
 #include "libjoynrclustercontroller/messaging/MessagingPropertiesPersistence.h"
 #include "libjoynrclustercontroller/messaging/joynr-messaging/MqttMessagingStubFactory.h"
 #include "libjoynrclustercontroller/mqtt/MosquittoConnection.h"
+#include "libjoynrclustercontroller/mqtt/MqttIngressQueue.h"
 #include "libjoynrclustercontroller/mqtt/MqttSender.h"
 #include "libjoynrclustercontroller/mqtt/MqttTransportStatus.h"
 #include "libjoynrclustercontroller/uds/UdsCcMessagingSkeleton.h"
@@ -159,7 +166,10 @@ JoynrClusterControllerRuntime::JoynrClusterControllerRuntime(
           _dummyGlobalAddress(),
           _clusterControllerStartDateMs(TimePoint::now().toMilliseconds()),
           _removeStaleDelay(removeStaleDelayMs),
-          _removeStaleTimer(_singleThreadedIOService->getIOService())
+          _removeStaleTimer(_ioServicePool->getIOService()),
+          _metricsExportTimer(_ioServicePool->getIOService()),
+          _warmRestartSnapshotTimer(_ioServicePool->getIOService()),
+          _warmRestartSnapshotMutex()
 {
 }
 
@@ -336,6 +346,30 @@ void JoynrClusterControllerRuntime::init()
                                     brokerIndex);
                     connectionData->setMosquittoConnection(mosquittoConnection);
 
+                    if (!connectionData->getMqttMessageSender()) {
+                        std::vector<std::shared_ptr<MosquittoConnection>> publishConnections;
+                        const std::uint32_t connectionsPerGbid =
+                                _clusterControllerSettings.getMqttConnectionsPerGbid();
+                        const bool isPublishOnly = true;
+                        for (std::uint32_t connectionIndex = 1;
+                             connectionIndex < connectionsPerGbid;
+                             connectionIndex++) {
+                            publishConnections.push_back(std::make_shared<MosquittoConnection>(
+                                    _clusterControllerSettings,
+                                    brokerUrl,
+                                    mqttKeepAliveTimeSeconds,
+                                    mqttReconnectDelayTimeSeconds,
+                                    mqttReconnectMaxDelayTimeSeconds,
+                                    isMqttExponentialBackoffEnabled,
+                                    mqttClientId + "-pub" + std::to_string(connectionIndex),
+                                    _availableGbids[brokerIndex],
+                                    isRetained,
+                                    isPublishOnly,
+                                    connectionIndex));
+                        }
+                        connectionData->setPublishConnections(publishConnections);
+                    }
+
                     auto mqttTransportStatus = std::make_shared<MqttTransportStatus>(
                             mosquittoConnection, _availableGbids[brokerIndex]);
                     transportStatuses.emplace_back(std::move(mqttTransportStatus));
@@ -386,7 +420,7 @@ void JoynrClusterControllerRuntime::init()
             _messagingStubFactory,
             _multicastMessagingSkeletonDirectory,
             std::move(securityManager),
-            _singleThreadedIOService->getIOService(),
+            _ioServicePool->getIOService(),
             std::move(addressCalculator),
             globalClusterControllerAddress,
             _systemServicesSettings.getCcMessageNotificationProviderParticipantId(),
@@ -459,7 +493,7 @@ void JoynrClusterControllerRuntime::init()
     _messageSender = std::make_shared<MessageSender>(
             _ccMessageRouter, _keyChain, _messagingSettings.getTtlUpliftMs());
     _joynrDispatcher =
-            std::make_shared<Dispatcher>(_messageSender, _singleThreadedIOService->getIOService());
+            std::make_shared<Dispatcher>(_messageSender, _ioServicePool->getIOService());
     _joynrDispatcher->init();
     _messageSender->registerDispatcher(_joynrDispatcher);
     _messageSender->setReplyToAddress(globalClusterControllerAddress);
@@ -496,14 +530,47 @@ void JoynrClusterControllerRuntime::init()
                     _availableGbids[brokerIndex],
                     _messagingSettings.getTtlUpliftMs());
 
-            connectionData->getMqttMessageReceiver()->registerReceiveCallback(
-                    [mqttMessagingSkeletonWeakPtr = joynr::util::as_weak_ptr(
-                             mqttMessagingSkeleton)](smrf::ByteVector&& msg) {
-                        if (auto mqttMessagingSkeletonSharedPtr =
-                                    mqttMessagingSkeletonWeakPtr.lock()) {
-                            mqttMessagingSkeletonSharedPtr->onMessageReceived(std::move(msg));
-                        }
-                    });
+            auto onMessageReceived = [mqttMessagingSkeletonWeakPtr = joynr::util::as_weak_ptr(
+                                              mqttMessagingSkeleton)](smrf::ByteVector&& msg) {
+                if (auto mqttMessagingSkeletonSharedPtr = mqttMessagingSkeletonWeakPtr.lock()) {
+                    mqttMessagingSkeletonSharedPtr->onMessageReceived(std::move(msg));
+                }
+            };
+            const std::uint32_t ingressQueueCapacity =
+                    _clusterControllerSettings.getMqttIngressQueueCapacity();
+            if (ingressQueueCapacity > 0) {
+                // decouple message processing from the mosquitto network thread, which must
+                // not be paused for longer than a fraction of the keep alive interval
+                const std::chrono::seconds mqttKeepAliveTimeSeconds =
+                        brokerIndex == 0
+                                ? _messagingSettings.getMqttKeepAliveTimeSeconds()
+                                : _messagingSettings.getAdditionalBackendMqttKeepAliveTimeSeconds(
+                                          brokerIndex - 1);
+                const std::chrono::milliseconds maxBackpressureDuration =
+                        mqttKeepAliveTimeSeconds.count() > 0
+                                ? std::chrono::duration_cast<std::chrono::milliseconds>(
+                                          mqttKeepAliveTimeSeconds) /
+                                          4
+                                : std::chrono::milliseconds(1000);
+                auto mqttIngressQueue = std::make_shared<MqttIngressQueue>(
+                        _availableGbids[brokerIndex],
+                        ingressQueueCapacity,
+                        _clusterControllerSettings.getMqttIngressThreads(),
+                        maxBackpressureDuration,
+                        std::move(onMessageReceived));
+                mqttIngressQueue->start();
+                connectionData->getMqttMessageReceiver()->registerReceiveCallback(
+                        [mqttIngressQueueWeakPtr = joynr::util::as_weak_ptr(mqttIngressQueue)](
+                                smrf::ByteVector&& msg) {
+                            if (auto mqttIngressQueueSharedPtr = mqttIngressQueueWeakPtr.lock()) {
+                                mqttIngressQueueSharedPtr->push(std::move(msg));
+                            }
+                        });
+                connectionData->setMqttIngressQueue(std::move(mqttIngressQueue));
+            } else {
+                connectionData->getMqttMessageReceiver()->registerReceiveCallback(
+                        std::move(onMessageReceived));
+            }
             _multicastMessagingSkeletonDirectory
                     ->registerSkeleton<system::RoutingTypes::MqttAddress>(
                             std::move(mqttMessagingSkeleton), _availableGbids[brokerIndex]);
@@ -517,7 +584,8 @@ void JoynrClusterControllerRuntime::init()
                                 brokerIndex);
 
                 const auto& mqttMessageSender =
-                        std::make_shared<MqttSender>(connectionData->getMosquittoConnection());
+                        std::make_shared<MqttSender>(connectionData->getMosquittoConnection(),
+                                                     connectionData->getPublishConnections());
                 connectionData->setMqttMessageSender(std::move(mqttMessageSender));
             }
 
@@ -530,12 +598,19 @@ void JoynrClusterControllerRuntime::init()
      * libJoynr side
      *
      */
-    _publicationManager =
-            std::make_shared<PublicationManager>(_singleThreadedIOService->getIOService(),
-                                                 _messageSender,
-                                                 _messagingSettings.getTtlUpliftMs());
+    // periodic publications of providers and missed publication alerts of proxies
+    // share one scheduler which is shut down by the runtime
+    _subscriptionScheduler = std::make_shared<ThreadPoolDelayedScheduler>(
+            static_cast<std::uint8_t>(_messagingSettings.getSubscriptionSchedulerThreads()),
+            ThreadConfiguration::SUBSCRIPTIONS(),
+            _ioServicePool->getIOService());
+    const bool isSchedulerOwner = false;
+    _publicationManager = std::make_shared<PublicationManager>(_subscriptionScheduler,
+                                                               _messageSender,
+                                                               _messagingSettings.getTtlUpliftMs(),
+                                                               isSchedulerOwner);
     _subscriptionManager = std::make_shared<SubscriptionManager>(
-            _singleThreadedIOService->getIOService(), _ccMessageRouter);
+            _subscriptionScheduler, _ccMessageRouter, isSchedulerOwner);
 
     _dispatcherAddress = std::make_shared<InProcessMessagingAddress>(_libJoynrMessagingSkeleton);
 
@@ -546,22 +621,27 @@ void JoynrClusterControllerRuntime::init()
 
     // Set up the persistence file for storing provider participant ids
     std::string persistenceFilename = _libjoynrSettings.getParticipantIdsPersistenceFilename();
-    _participantIdStorage = std::make_shared<ParticipantIdStorage>(persistenceFilename);
+    _fileWriter =
+            std::make_shared<AsyncFileWriter>(_libjoynrSettings.getPersistenceCoalescingWindowMs());
+    _participantIdStorage =
+            std::make_shared<ParticipantIdStorage>(persistenceFilename, _fileWriter);
 
     auto provisionedDiscoveryEntries = getProvisionedEntries();
     _discoveryProxy = std::make_shared<LocalDiscoveryAggregator>(provisionedDiscoveryEntries);
 
+    // add and remove calls of different participants are independent of each other
     std::unique_ptr<TaskSequencer<void>> taskSequencer = std::make_unique<TaskSequencer<void>>(
-            std::chrono::milliseconds(MessagingQos().getTtl()));
+            _ioServicePool->getIOService(),
+            _clusterControllerSettings.getGlobalCapabilitiesDirectoryMaxConcurrentCalls());
     _globalCapabilitiesDirectoryClient = std::make_shared<GlobalCapabilitiesDirectoryClient>(
-            _clusterControllerSettings, std::move(taskSequencer));
+            _clusterControllerSettings, std::move(taskSequencer), _messagingSettings.getGbid());
     _localCapabilitiesDirectory = std::make_shared<LocalCapabilitiesDirectory>(
             _clusterControllerSettings,
             _globalCapabilitiesDirectoryClient,
             _localCapabilitiesDirectoryStore,
             globalClusterControllerAddress,
             _ccMessageRouter,
-            _singleThreadedIOService->getIOService(),
+            _ioServicePool->getIOService(),
             clusterControllerId,
             _availableGbids,
             _messagingSettings.getDiscoveryEntryExpiryIntervalMs());
@@ -573,6 +653,8 @@ void JoynrClusterControllerRuntime::init()
     MessagingQos messagingQos;
     messagingQos.setCompress(
             _clusterControllerSettings.isGlobalCapabilitiesDirectoryCompressedMessagesEnabled());
+    // the global capabilities directory is not a C++ runtime and only understands gzip
+    messagingQos.setCompressionCodec(MessageCompression::GZIP());
 
     {
         auto provisionedProviderDiscoveryEntry =
@@ -627,6 +709,12 @@ void JoynrClusterControllerRuntime::init()
     enableAccessController(provisionedDiscoveryEntries);
 
     registerInternalSystemServiceProviders();
+
+    // restore after the internal providers have been registered, so that multicast receivers
+    // of their broadcasts can be restored as well
+    if (_clusterControllerSettings.isWarmRestartSnapshotFileSet()) {
+        restoreWarmRestartSnapshot();
+    }
 }
 
 std::shared_ptr<IMessageRouter> JoynrClusterControllerRuntime::getMessageRouter()
@@ -676,7 +764,8 @@ void JoynrClusterControllerRuntime::enableAccessController(
                    _clusterControllerSettings.getAclEntriesDirectory());
 
     auto localDomainAccessStore = std::make_shared<joynr::LocalDomainAccessStore>(
-            _clusterControllerSettings.getLocalDomainAccessStorePersistenceFilename());
+            _clusterControllerSettings.getLocalDomainAccessStorePersistenceFilename(),
+            _fileWriter);
 
     namespace fs = boost::filesystem;
 
@@ -793,13 +882,16 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                         "");
 
                 _wsTLSCcMessagingSkeleton = std::make_shared<WebSocketCcMessagingSkeletonTLS>(
-                        _singleThreadedIOService->getIOService(),
+                        _ioServicePool->getIOService(),
                         _ccMessageRouter,
                         _wsMessagingStubFactory,
                         wsAddress,
                         certificateAuthorityPemFilename,
                         certificatePemFilename,
                         privateKeyPemFilename);
+                _wsTLSCcMessagingSkeleton->setFlowControlLimits(
+                        _clusterControllerSettings.getClientMaxInFlightMessages(),
+                        _clusterControllerSettings.getClientMaxSendBufferBytes());
                 _wsTLSCcMessagingSkeleton->init();
             }
         }
@@ -812,10 +904,13 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                     "");
 
             _wsCcMessagingSkeleton = std::make_shared<WebSocketCcMessagingSkeletonNonTLS>(
-                    _singleThreadedIOService->getIOService(),
+                    _ioServicePool->getIOService(),
                     _ccMessageRouter,
                     _wsMessagingStubFactory,
                     wsAddress);
+            _wsCcMessagingSkeleton->setFlowControlLimits(
+                    _clusterControllerSettings.getClientMaxInFlightMessages(),
+                    _clusterControllerSettings.getClientMaxSendBufferBytes());
             _wsCcMessagingSkeleton->init();
         }
     }
@@ -828,6 +923,8 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
         _udsServer->setConnectCallback([this](const system::RoutingTypes::UdsClientAddress& address,
                                               std::unique_ptr<IUdsSender> sender) {
             _udsMessagingStubFactory->addClient(address, std::move(sender));
+            _ccMessageRouter->sendQueuedMessages(
+                    std::make_shared<const system::RoutingTypes::UdsClientAddress>(address));
         });
         _udsServer->setDisconnectCallback(
                 [this](const system::RoutingTypes::UdsClientAddress& address) {
@@ -835,9 +932,13 @@ void JoynrClusterControllerRuntime::startLocalCommunication()
                 });
         _udsServer->setReceiveCallback([this](const system::RoutingTypes::UdsClientAddress&,
                                               smrf::ByteVector&& newMessage,
-                                              const std::string& creator) {
-            _udsCcMessagingSkeleton->onMessageReceived(std::move(newMessage), creator);
+                                              const std::string& creator,
+                                              InFlightBudget::Credit credit) {
+            _udsCcMessagingSkeleton->onMessageReceived(
+                    std::move(newMessage), creator, std::move(credit));
         });
+        _udsServer->setFlowControlLimits(_clusterControllerSettings.getClientMaxInFlightMessages(),
+                                         _clusterControllerSettings.getClientMaxSendBufferBytes());
         _udsServer->start();
     }
 }
@@ -854,6 +955,9 @@ void JoynrClusterControllerRuntime::startExternalCommunication()
     if (_doMqttMessaging && !_mqttMessagingIsRunning) {
         for (const auto& connectionData : _mqttConnectionDataVector) {
             connectionData->getMosquittoConnection()->start();
+            for (const auto& publishConnection : connectionData->getPublishConnections()) {
+                publishConnection->start();
+            }
         }
         _mqttMessagingIsRunning = true;
     }
@@ -865,6 +969,9 @@ void JoynrClusterControllerRuntime::stopExternalCommunication()
     if (_doMqttMessaging && _mqttMessagingIsRunning) {
         for (const auto& connecton : _mqttConnectionDataVector) {
             connecton->getMosquittoConnection()->stop();
+            for (const auto& publishConnection : connecton->getPublishConnections()) {
+                publishConnection->stop();
+            }
         }
         _mqttMessagingIsRunning = false;
     }
@@ -877,6 +984,13 @@ void JoynrClusterControllerRuntime::shutdown()
         return;
     }
     _isShuttingDown = true;
+
+    // save before the local transports are shut down and their routing entries are removed
+    if (_clusterControllerSettings.isWarmRestartSnapshotFileSet()) {
+        _warmRestartSnapshotTimer.cancel();
+        saveWarmRestartSnapshot();
+    }
+
     for (auto proxyBuilder : _proxyBuilders) {
         proxyBuilder->stop();
         proxyBuilder.reset();
@@ -897,6 +1011,9 @@ void JoynrClusterControllerRuntime::shutdown()
     if (_ccMessageRouter) {
         _ccMessageRouter->shutdown();
     }
+    if (_subscriptionScheduler) {
+        _subscriptionScheduler->shutdown();
+    }
     if (_publicationManager) {
         _publicationManager->shutdown();
     }
@@ -912,6 +1029,12 @@ void JoynrClusterControllerRuntime::shutdown()
 
     stop();
 
+    for (const auto& connectionData : _mqttConnectionDataVector) {
+        if (auto mqttIngressQueue = connectionData->getMqttIngressQueue()) {
+            mqttIngressQueue->stop();
+        }
+    }
+
     if (_multicastMessagingSkeletonDirectory) {
         _multicastMessagingSkeletonDirectory
                 ->unregisterSkeletons<system::RoutingTypes::MqttAddress>();
@@ -928,6 +1051,15 @@ void JoynrClusterControllerRuntime::shutdown()
     }
 
     _removeStaleTimer.cancel();
+
+    if (_clusterControllerSettings.isMetricsExportFileSet()) {
+        _metricsExportTimer.cancel();
+        exportMetrics();
+    }
+
+    if (_fileWriter) {
+        _fileWriter->flush();
+    }
 }
 
 void JoynrClusterControllerRuntime::shutdownClusterController()
@@ -971,10 +1103,17 @@ std::shared_ptr<JoynrClusterControllerRuntime> JoynrClusterControllerRuntime::cr
 
 void JoynrClusterControllerRuntime::start()
 {
-    _singleThreadedIOService->start();
+    _ioServicePool->start();
     startExternalCommunication();
     startLocalCommunication();
     scheduleRemoveStaleTimer();
+    if (_clusterControllerSettings.isMetricsExportFileSet()) {
+        scheduleMetricsExport();
+    }
+    if (_clusterControllerSettings.isWarmRestartSnapshotFileSet() &&
+        _clusterControllerSettings.getWarmRestartSnapshotIntervalMs() > 0) {
+        scheduleWarmRestartSnapshot();
+    }
 }
 
 void JoynrClusterControllerRuntime::scheduleRemoveStaleTimer()
@@ -1013,6 +1152,111 @@ void JoynrClusterControllerRuntime::scheduleRemoveStaleTimer()
     }
 }
 
+void JoynrClusterControllerRuntime::scheduleMetricsExport()
+{
+    boost::system::error_code timerError = boost::system::error_code();
+    _metricsExportTimer.expires_from_now(
+            std::chrono::milliseconds(_clusterControllerSettings.getMetricsExportIntervalMs()),
+            timerError);
+    if (timerError) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Error from metrics export timer in cluster controller: {}: {}",
+                        timerError.value(),
+                        timerError.message());
+        return;
+    }
+    _metricsExportTimer.async_wait([this](const boost::system::error_code& localTimerError) {
+        if (localTimerError) {
+            if (localTimerError != boost::asio::error::operation_aborted) {
+                JOYNR_LOG_ERROR(logger(),
+                                "Metrics export stopped because of error from metrics export "
+                                "timer: {}",
+                                localTimerError.message());
+            }
+            return;
+        }
+        exportMetrics();
+        scheduleMetricsExport();
+    });
+}
+
+void JoynrClusterControllerRuntime::exportMetrics()
+{
+    const std::string fileName = _clusterControllerSettings.getMetricsExportFile();
+    try {
+        MetricsRegistry::instance().writePrometheusTextFile(fileName);
+    } catch (const std::exception& e) {
+        JOYNR_LOG_WARN(logger(), "Could not export metrics to {}: {}", fileName, e.what());
+    }
+}
+
+void JoynrClusterControllerRuntime::scheduleWarmRestartSnapshot()
+{
+    boost::system::error_code timerError = boost::system::error_code();
+    const std::chrono::milliseconds interval(
+            _clusterControllerSettings.getWarmRestartSnapshotIntervalMs());
+    _warmRestartSnapshotTimer.expires_from_now(interval, timerError);
+    if (timerError) {
+        JOYNR_LOG_ERROR(logger(),
+                        "Error from warm restart snapshot timer in cluster controller: {}: {}",
+                        timerError.value(),
+                        timerError.message());
+        return;
+    }
+    _warmRestartSnapshotTimer.async_wait([this](const boost::system::error_code& localTimerError) {
+        if (localTimerError) {
+            if (localTimerError != boost::asio::error::operation_aborted) {
+                JOYNR_LOG_ERROR(logger(),
+                                "Warm restart snapshots stopped because of error from warm "
+                                "restart snapshot timer: {}",
+                                localTimerError.message());
+            }
+            return;
+        }
+        saveWarmRestartSnapshot();
+        scheduleWarmRestartSnapshot();
+    });
+}
+
+void JoynrClusterControllerRuntime::saveWarmRestartSnapshot()
+{
+    if (!_ccMessageRouter) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_warmRestartSnapshotMutex);
+    const std::string fileName = _clusterControllerSettings.getWarmRestartSnapshotFile();
+    WarmRestartSnapshot snapshot;
+    _ccMessageRouter->saveWarmRestartSnapshot(snapshot);
+    _localCapabilitiesDirectoryStore->saveWarmRestartSnapshot(snapshot);
+    try {
+        snapshot.saveToFile(fileName);
+        JOYNR_LOG_DEBUG(logger(),
+                        "Saved warm restart snapshot to {}: {} routing entries, {} multicast "
+                        "IDs, {} cached discovery entries",
+                        fileName,
+                        snapshot.routingEntries.size(),
+                        snapshot.multicastReceivers.size(),
+                        snapshot.globalCacheEntries.size());
+    } catch (const std::exception& e) {
+        JOYNR_LOG_WARN(
+                logger(), "Could not save warm restart snapshot to {}: {}", fileName, e.what());
+    }
+}
+
+void JoynrClusterControllerRuntime::restoreWarmRestartSnapshot()
+{
+    boost::optional<WarmRestartSnapshot> snapshot = WarmRestartSnapshot::loadFromFile(
+            _clusterControllerSettings.getWarmRestartSnapshotFile());
+    if (!snapshot) {
+        return;
+    }
+    _ccMessageRouter->restoreWarmRestartSnapshot(
+            *snapshot,
+            std::chrono::milliseconds(
+                    _clusterControllerSettings.getWarmRestartClientReconnectTimeoutMs()));
+    _localCapabilitiesDirectoryStore->restoreWarmRestartSnapshot(*snapshot);
+}
+
 void JoynrClusterControllerRuntime::stop()
 {
     stopExternalCommunication();
@@ -1020,8 +1264,8 @@ void JoynrClusterControllerRuntime::stop()
     // synchronously stop the underlying boost::asio::io_service
     // this ensures all asynchronous operations are stopped now
     // which allows a safe shutdown
-    if (_singleThreadedIOService) {
-        _singleThreadedIOService->stop();
+    if (_ioServicePool) {
+        _ioServicePool->stop();
     }
 }
 
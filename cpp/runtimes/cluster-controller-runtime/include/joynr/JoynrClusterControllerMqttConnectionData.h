@@ -18,6 +18,7 @@
  */
 
 #include <memory>
+#include <vector>
 
 #ifndef JOYNRCLUSTERCONTROLLERMQTTCONNECTIONDATA_H
 #define JOYNRCLUSTERCONTROLLERMQTTCONNECTIONDATA_H
@@ -28,6 +29,7 @@ namespace joynr
 class ITransportMessageReceiver;
 class ITransportMessageSender;
 class MosquittoConnection;
+class MqttIngressQueue;
 
 class JoynrClusterControllerMqttConnectionData
 {
@@ -39,16 +41,33 @@ public:
     virtual std::shared_ptr<MosquittoConnection> getMosquittoConnection() const;
     virtual void setMosquittoConnection(const std::shared_ptr<MosquittoConnection>& value);
 
+    /**
+     * Additional publish only connections for the same GBID, see
+     * ClusterControllerSettings::SETTING_MQTT_CONNECTIONS_PER_GBID
+     */
+    virtual std::vector<std::shared_ptr<MosquittoConnection>> getPublishConnections() const;
+    virtual void setPublishConnections(
+            const std::vector<std::shared_ptr<MosquittoConnection>>& value);
+
     virtual std::shared_ptr<ITransportMessageReceiver> getMqttMessageReceiver() const;
     virtual void setMqttMessageReceiver(const std::shared_ptr<ITransportMessageReceiver>& value);
 
     virtual std::shared_ptr<ITransportMessageSender> getMqttMessageSender() const;
     virtual void setMqttMessageSender(const std::shared_ptr<ITransportMessageSender>& value);
 
+    /**
+     * Queue decoupling received messages from the mosquitto network thread, see
+     * ClusterControllerSettings::SETTING_MQTT_INGRESS_QUEUE_CAPACITY
+     */
+    virtual std::shared_ptr<MqttIngressQueue> getMqttIngressQueue() const;
+    virtual void setMqttIngressQueue(const std::shared_ptr<MqttIngressQueue>& value);
+
 private:
     std::shared_ptr<MosquittoConnection> mosquittoConnection;
+    std::vector<std::shared_ptr<MosquittoConnection>> publishConnections;
     std::shared_ptr<ITransportMessageReceiver> mqttMessageReceiver;
     std::shared_ptr<ITransportMessageSender> mqttMessageSender;
+    std::shared_ptr<MqttIngressQueue> mqttIngressQueue;
 };
 
 } // namespace joynr
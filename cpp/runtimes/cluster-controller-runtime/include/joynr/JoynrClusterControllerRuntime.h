@@ -25,6 +25,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -216,6 +217,11 @@ private:
     const system::RoutingTypes::Address& getGlobalClusterControllerAddress() const;
     void scheduleRemoveStaleTimer();
     void sendScheduledRemoveStale(const boost::system::error_code& timerError);
+    void scheduleMetricsExport();
+    void exportMetrics();
+    void scheduleWarmRestartSnapshot();
+    void saveWarmRestartSnapshot();
+    void restoreWarmRestartSnapshot();
 
     std::shared_ptr<MulticastMessagingSkeletonDirectory> _multicastMessagingSkeletonDirectory;
 
@@ -244,6 +250,10 @@ private:
 
     const std::int64_t _removeStaleDelay;
     boost::asio::steady_timer _removeStaleTimer;
+    boost::asio::steady_timer _metricsExportTimer;
+    boost::asio::steady_timer _warmRestartSnapshotTimer;
+    // a periodic save may still run on another io_service thread when the final one starts
+    std::mutex _warmRestartSnapshotMutex;
     friend class WebSocketEnd2EndProxyBuilderRobustnessTest;
     friend class UdsEnd2EndProxyBuilderRobustnessTest;
 };
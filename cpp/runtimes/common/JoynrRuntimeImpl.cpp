@@ -21,9 +21,11 @@
 #include <cstdint>
 #include <limits>
 
+#include "joynr/IOServicePool.h"
 #include "joynr/Logger.h"
+#include "joynr/MessageCompression.h"
 #include "joynr/ProxyFactory.h"
-#include "joynr/SingleThreadedIOService.h"
+#include "joynr/ThreadConfiguration.h"
 #include "joynr/Util.h"
 #include "joynr/system/IDiscovery.h"
 #include "joynr/system/IRouting.h"
@@ -38,8 +40,10 @@ JoynrRuntimeImpl::JoynrRuntimeImpl(
         Settings& settings,
         std::function<void(const exceptions::JoynrRuntimeException&)>&& onFatalRuntimeError,
         std::shared_ptr<IKeychain> keyChain)
-        : _singleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+        : _ioServicePool(std::make_shared<IOServicePool>(
+                  MessagingSettings(settings).getIoServiceThreads())),
           _proxyFactory(nullptr),
+          _fileWriter(nullptr),
           _participantIdStorage(nullptr),
           _capabilitiesRegistrar(nullptr),
           _messagingSettings(settings),
@@ -48,8 +52,12 @@ JoynrRuntimeImpl::JoynrRuntimeImpl(
           _dispatcherAddress(nullptr),
           _discoveryProxy(nullptr),
           _publicationManager(nullptr),
+          _subscriptionScheduler(nullptr),
           _keyChain(std::move(keyChain))
 {
+    // the threads of the runtime are started later and pick up the configuration of their pool
+    ThreadConfiguration::instance().load(settings);
+    MessageCompression::instance().load(_messagingSettings);
     _messagingSettings.printSettings();
     _systemServicesSettings.printSettings();
 }
@@ -164,6 +164,55 @@ public:
         return participiantId;
     }
 
+    /**
+     * @brief Registers several providers with the joynr communication framework asynchronously.
+     *
+     * Each ProviderRegistration holds the parameters of one provider, which have the same meaning
+     * as the parameters of registerProviderAsync. The routing entries of all providers are added
+     * at once and their participant IDs are persisted with a single write.
+     *
+     * @param providerRegistrations The providers to register.
+     * @param onSucess: Will be invoked when all providers have been registered.
+     * @param onError: Will be invoked with the first error when at least one provider could not be
+     * registered, after all providers have been processed. The providers which have been
+     * registered successfully stay registered.
+     * @return The globally unique participant IDs of the providers, in the order of
+     * providerRegistrations.
+     */
+    std::vector<std::string> registerProvidersAsync(
+            std::vector<ProviderRegistration> providerRegistrations,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+    {
+        return _runtimeImpl->registerProvidersAsync(
+                std::move(providerRegistrations), std::move(onSuccess), std::move(onError));
+    }
+
+    /**
+     * @brief Registers several providers with the joynr communication framework, see
+     * registerProvidersAsync. Blocks until all providers have been processed and throws the
+     * first error if at least one provider could not be registered.
+     *
+     * @param providerRegistrations The providers to register.
+     * @return The globally unique participant IDs of the providers, in the order of
+     * providerRegistrations.
+     */
+    std::vector<std::string> registerProviders(
+            std::vector<ProviderRegistration> providerRegistrations)
+    {
+        Future<void> future;
+        auto onSuccess = [&future]() { future.onSuccess(); };
+        auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+            future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+        };
+
+        std::vector<std::string> participantIds = registerProvidersAsync(
+                std::move(providerRegistrations), std::move(onSuccess), std::move(onError));
+        future.get();
+        return participantIds;
+    }
+
+
     /**
      * @brief Registers a provider with the joynr communication framework asynchronously
      * in all backends known to the cluster controller (in case of global registration).
@@ -385,6 +434,43 @@ public:
         future.get();
     }
 
+    /**
+     * @brief Unregisters several providers, identified by their participant IDs, from the joynr
+     * communication framework asynchronously, see unregisterProviderAsync.
+     *
+     * @param participantIds The participantIds of the providers which shall be unregistered
+     * @param onSucess: Will be invoked when all providers have been unregistered.
+     * @param onError: Will be invoked with the first error when at least one provider could not be
+     * unregistered, after all providers have been processed.
+     */
+    void unregisterProvidersAsync(
+            const std::vector<std::string>& participantIds,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+    {
+        _runtimeImpl->unregisterProvidersAsync(
+                participantIds, std::move(onSuccess), std::move(onError));
+    }
+
+    /**
+     * @brief Unregisters several providers, identified by their participant IDs, from the joynr
+     * communication framework, see unregisterProvider. Throws the first error if at least one
+     * provider could not be unregistered.
+     *
+     * @param participantIds The participantIds of the providers which shall be unregistered
+     */
+    void unregisterProviders(const std::vector<std::string>& participantIds)
+    {
+        Future<void> future;
+        auto onSuccess = [&future]() { future.onSuccess(); };
+        auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+            future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+        };
+
+        unregisterProvidersAsync(participantIds, std::move(onSuccess), std::move(onError));
+        future.get();
+    }
+
     /**
      * @brief Unregister a provider from the joynr communication framework so that it can no longer
      * be called or discovered.
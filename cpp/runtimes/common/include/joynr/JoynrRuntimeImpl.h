@@ -28,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include "joynr/AsyncFileWriter.h"
 #include "joynr/CapabilitiesRegistrar.h"
 #include "joynr/Future.h"
 #include "joynr/GuidedProxyBuilder.h"
@@ -35,6 +36,7 @@
 #include "joynr/LocalDiscoveryAggregator.h"
 #include "joynr/MessagingSettings.h"
 #include "joynr/PrivateCopyAssign.h"
+#include "joynr/ProviderRegistration.h"
 #include "joynr/ProxyBuilder.h"
 #include "joynr/SystemServicesSettings.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -42,14 +44,15 @@
 namespace joynr
 {
 
+class DelayedScheduler;
 class IKeychain;
 class IMessageRouter;
+class IOServicePool;
 class IRequestCallerDirectory;
 class ParticipantIdStorage;
 class ProxyFactory;
 class PublicationManager;
 class Settings;
-class SingleThreadedIOService;
 
 struct Logger;
 
@@ -191,6 +194,56 @@ public:
         return participiantId;
     }
 
+    /**
+     * @brief Registers several providers with the joynr communication framework asynchronously.
+     *
+     * Each ProviderRegistration holds the parameters of one provider, which have the same meaning
+     * as the parameters of registerProviderAsync. The routing entries of all providers are added
+     * at once and their participant IDs are persisted with a single write.
+     *
+     * @param providerRegistrations The providers to register.
+     * @param onSucess: Will be invoked when all providers have been registered.
+     * @param onError: Will be invoked with the first error when at least one provider could not be
+     * registered, after all providers have been processed. The providers which have been
+     * registered successfully stay registered.
+     * @return The globally unique participant IDs of the providers, in the order of
+     * providerRegistrations.
+     */
+    std::vector<std::string> registerProvidersAsync(
+            std::vector<ProviderRegistration> providerRegistrations,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+    {
+        assert(_capabilitiesRegistrar);
+        return _capabilitiesRegistrar->addAsync(
+                std::move(providerRegistrations), std::move(onSuccess), std::move(onError));
+    }
+
+    /**
+     * @brief Registers several providers with the joynr communication framework, see
+     * registerProvidersAsync. Blocks until all providers have been processed and throws the
+     * first error if at least one provider could not be registered.
+     *
+     * @param providerRegistrations The providers to register.
+     * @return The globally unique participant IDs of the providers, in the order of
+     * providerRegistrations.
+     */
+    std::vector<std::string> registerProviders(
+            std::vector<ProviderRegistration> providerRegistrations)
+    {
+        Future<void> future;
+        auto onSuccess = [&future]() { future.onSuccess(); };
+        auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+            future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+        };
+
+        std::vector<std::string> participantIds = registerProvidersAsync(
+                std::move(providerRegistrations), std::move(onSuccess), std::move(onError));
+        future.get();
+        return participantIds;
+    }
+
+
     /**
      * @brief Registers a provider with the joynr communication framework asynchronously
      * in all backends known to the cluster controller (in case of global registration).
@@ -414,6 +467,44 @@ public:
         future.get();
     }
 
+    /**
+     * @brief Unregisters several providers, identified by their participant IDs, from the joynr
+     * communication framework asynchronously, see unregisterProviderAsync.
+     *
+     * @param participantIds The participantIds of the providers which shall be unregistered
+     * @param onSucess: Will be invoked when all providers have been unregistered.
+     * @param onError: Will be invoked with the first error when at least one provider could not be
+     * unregistered, after all providers have been processed.
+     */
+    void unregisterProvidersAsync(
+            const std::vector<std::string>& participantIds,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)> onError) noexcept
+    {
+        assert(_capabilitiesRegistrar);
+        _capabilitiesRegistrar->removeAsync(
+                participantIds, std::move(onSuccess), std::move(onError));
+    }
+
+    /**
+     * @brief Unregisters several providers, identified by their participant IDs, from the joynr
+     * communication framework, see unregisterProvider. Throws the first error if at least one
+     * provider could not be unregistered.
+     *
+     * @param participantIds The participantIds of the providers which shall be unregistered
+     */
+    void unregisterProviders(const std::vector<std::string>& participantIds)
+    {
+        Future<void> future;
+        auto onSuccess = [&future]() { future.onSuccess(); };
+        auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+            future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+        };
+
+        unregisterProvidersAsync(participantIds, std::move(onSuccess), std::move(onError));
+        future.get();
+    }
+
     /**
      * @brief Unregister a provider from the joynr communication framework so that it can no longer
      * be called or discovered.
@@ -550,10 +641,12 @@ protected:
     virtual std::map<std::string, joynr::types::DiscoveryEntryWithMetaInfo> getProvisionedEntries()
             const;
 
-    std::shared_ptr<SingleThreadedIOService> _singleThreadedIOService;
+    std::shared_ptr<IOServicePool> _ioServicePool;
 
     /** @brief Factory for creating proxy instances */
     std::unique_ptr<ProxyFactory> _proxyFactory;
+    /** @brief Writes the persistence files in the background */
+    std::shared_ptr<AsyncFileWriter> _fileWriter;
     /** @brief Creates and persists participant id */
     std::shared_ptr<ParticipantIdStorage> _participantIdStorage;
     /** @brief Class that handles provider registration/deregistration */
@@ -575,6 +668,11 @@ protected:
      * which are send back to the subscription manager.
      */
     std::shared_ptr<PublicationManager> _publicationManager;
+    /**
+     * @brief Scheduler shared by the publication and the subscription manager. It is owned
+     * and shut down by the runtime, not by the managers.
+     */
+    std::shared_ptr<DelayedScheduler> _subscriptionScheduler;
     std::shared_ptr<IKeychain> _keyChain;
     std::vector<std::shared_ptr<IProxyBuilderBase>> _proxyBuilders;
     std::mutex _proxyBuildersMutex;
@@ -33,6 +33,7 @@
 #include "joynr/IMessageSender.h"
 #include "joynr/IMiddlewareMessagingStubFactory.h"
 #include "joynr/IMulticastAddressCalculator.h"
+#include "joynr/IOServicePool.h"
 #include "joynr/IProxyBuilderBase.h"
 #include "joynr/InProcessMessagingAddress.h"
 #include "joynr/JoynrMessagingConnectorFactory.h"
@@ -47,9 +48,10 @@
 #include "joynr/ProxyFactory.h"
 #include "joynr/PublicationManager.h"
 #include "joynr/Settings.h"
-#include "joynr/SingleThreadedIOService.h"
 #include "joynr/SubscriptionManager.h"
 #include "joynr/SystemServicesSettings.h"
+#include "joynr/ThreadConfiguration.h"
+#include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/system/DiscoveryProxy.h"
 #include "joynr/system/RoutingProxy.h"
@@ -87,7 +89,7 @@ LibJoynrRuntime::LibJoynrRuntime(
           _libJoynrRuntimeIsShuttingDown(false)
 {
     _libjoynrSettings->printSettings();
-    _singleThreadedIOService->start();
+    _ioServicePool->start();
 }
 
 LibJoynrRuntime::~LibJoynrRuntime()
@@ -110,8 +112,8 @@ void LibJoynrRuntime::shutdown()
     // synchronously stop the underlying boost::asio::io_service
     // this ensures all asynchronous operations are stopped now
     // which allows a safe shutdown
-    assert(_singleThreadedIOService);
-    _singleThreadedIOService->stop();
+    assert(_ioServicePool);
+    _ioServicePool->stop();
 
     std::lock_guard<std::mutex> lock(_proxyBuildersMutex);
     for (auto proxyBuilder : _proxyBuilders) {
@@ -124,6 +126,9 @@ void LibJoynrRuntime::shutdown()
         _joynrDispatcher->shutdown();
         _joynrDispatcher.reset();
     }
+    if (_subscriptionScheduler) {
+        _subscriptionScheduler->shutdown();
+    }
     if (_publicationManager) {
         _publicationManager->shutdown();
     }
@@ -141,6 +146,9 @@ void LibJoynrRuntime::shutdown()
         _messagingStubFactory->shutdown();
         _messagingStubFactory.reset();
     }
+    if (_fileWriter) {
+        _fileWriter->flush();
+    }
 }
 
 void LibJoynrRuntime::init(
@@ -167,7 +175,7 @@ void LibJoynrRuntime::init(
             _messagingSettings,
             libjoynrMessagingAddress,
             _messagingStubFactory,
-            _singleThreadedIOService->getIOService(),
+            _ioServicePool->getIOService(),
             std::move(addressCalculator),
             std::vector<std::shared_ptr<ITransportStatus>>{},
             std::make_unique<MessageQueue<std::string>>(),
@@ -180,7 +188,7 @@ void LibJoynrRuntime::init(
     _messageSender = std::make_shared<MessageSender>(
             _libJoynrMessageRouter, _keyChain, _messagingSettings.getTtlUpliftMs());
     _joynrDispatcher =
-            std::make_shared<Dispatcher>(_messageSender, _singleThreadedIOService->getIOService());
+            std::make_shared<Dispatcher>(_messageSender, _ioServicePool->getIOService());
     _joynrDispatcher->init();
     _messageSender->registerDispatcher(_joynrDispatcher);
 
@@ -189,13 +197,20 @@ void LibJoynrRuntime::init(
     _dispatcherMessagingSkeleton = std::make_shared<InProcessMessagingSkeleton>(_joynrDispatcher);
     _dispatcherAddress = std::make_shared<InProcessMessagingAddress>(_dispatcherMessagingSkeleton);
 
-    _publicationManager =
-            std::make_shared<PublicationManager>(_singleThreadedIOService->getIOService(),
-                                                 _messageSender,
-                                                 _messagingSettings.getTtlUpliftMs());
+    // periodic publications of providers and missed publication alerts of proxies
+    // share one scheduler which is shut down by the runtime
+    _subscriptionScheduler = std::make_shared<ThreadPoolDelayedScheduler>(
+            static_cast<std::uint8_t>(_messagingSettings.getSubscriptionSchedulerThreads()),
+            ThreadConfiguration::SUBSCRIPTIONS(),
+            _ioServicePool->getIOService());
+    const bool isSchedulerOwner = false;
+    _publicationManager = std::make_shared<PublicationManager>(_subscriptionScheduler,
+                                                               _messageSender,
+                                                               _messagingSettings.getTtlUpliftMs(),
+                                                               isSchedulerOwner);
 
     _subscriptionManager = std::make_shared<SubscriptionManager>(
-            _singleThreadedIOService->getIOService(), _libJoynrMessageRouter);
+            _subscriptionScheduler, _libJoynrMessageRouter, isSchedulerOwner);
 
     auto joynrMessagingConnectorFactory =
             std::make_shared<JoynrMessagingConnectorFactory>(_messageSender, _subscriptionManager);
@@ -204,7 +219,10 @@ void LibJoynrRuntime::init(
 
     // Set up the persistence file for storing provider participant ids
     std::string persistenceFilename = _libjoynrSettings->getParticipantIdsPersistenceFilename();
-    _participantIdStorage = std::make_shared<ParticipantIdStorage>(persistenceFilename);
+    _fileWriter = std::make_shared<AsyncFileWriter>(
+            _libjoynrSettings->getPersistenceCoalescingWindowMs());
+    _participantIdStorage =
+            std::make_shared<ParticipantIdStorage>(persistenceFilename, _fileWriter);
 
     // initialize the dispatchers
     _joynrDispatcher->registerPublicationManager(_publicationManager);
@@ -25,8 +25,8 @@
 #include <websocketpp/common/connection_hdl.hpp>
 
 #include "joynr/IMulticastAddressCalculator.h"
+#include "joynr/IOServicePool.h"
 #include "joynr/Settings.h"
-#include "joynr/SingleThreadedIOService.h"
 #include "joynr/Util.h"
 #include "joynr/WebSocketMulticastAddressCalculator.h"
 #include "joynr/exceptions/JoynrException.h"
@@ -176,11 +176,11 @@ void LibJoynrWebSocketRuntime::createWebsocketClient()
 
         JOYNR_LOG_INFO(logger(), "Using TLS connection");
         _websocket = std::make_shared<WebSocketPpClientTLS>(
-                _wsSettings, _singleThreadedIOService->getIOService(), _keyChain);
+                _wsSettings, _ioServicePool->getIOService(), _keyChain);
     } else if (webSocketAddress.getProtocol() == system::RoutingTypes::WebSocketProtocol::WS) {
         JOYNR_LOG_INFO(logger(), "Using non-TLS connection");
         _websocket = std::make_shared<WebSocketPpClientNonTLS>(
-                _wsSettings, _singleThreadedIOService->getIOService());
+                _wsSettings, _ioServicePool->getIOService());
     } else {
         throw exceptions::JoynrRuntimeException(
                 "Unknown protocol used for settings property 'cluster-controller-messaging-url'");
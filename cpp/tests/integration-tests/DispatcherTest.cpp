@@ -425,6 +425,71 @@ TEST_F(DispatcherTest, receive_interpreteReplyAndCallReplyCaller)
     EXPECT_TRUE(semaphore->waitFor(std::chrono::milliseconds(5000)));
 }
 
+TEST_F(DispatcherTest, receive_batchRequestIsAnsweredWithOneBatchReply)
+{
+    EXPECT_CALL(*mockRequestCaller,
+                getLocationMock(
+                        A<std::function<void(const joynr::types::Localisation::GpsLocation&)>>(),
+                        A<std::function<void(const std::shared_ptr<
+                                             joynr::exceptions::ProviderRuntimeException>&)>>()))
+            .Times(2)
+            .WillRepeatedly(Invoke(this, &DispatcherTest::invokeOnSuccessWithGpsLocation));
+
+    qos.setTtl(1000);
+    std::vector<Request> requests(2);
+    for (Request& request : requests) {
+        request.setMethodName("getLocation");
+        request.setParams();
+        request.setParamDatatypes(std::vector<std::string>());
+    }
+
+    MutableMessage mutableMessage = messageFactory.createBatchRequest(
+            proxyParticipantId, providerParticipantId, qos, requests, isLocalMessage);
+
+    std::vector<Reply> replies(2);
+    for (std::size_t i = 0; i < replies.size(); ++i) {
+        replies[i].setResponse(gpsLocation1);
+        replies[i].setRequestReplyId(requests[i].getRequestReplyId());
+    }
+    MutableMessage expectedReply = messageFactory.createBatchReply(
+            proxyParticipantId, providerParticipantId, qos, {}, replies);
+    EXPECT_CALL(*mockMessageRouter,
+                route(AllOf(MessageHasType(joynr::Message::VALUE_MESSAGE_TYPE_BATCH_REPLY()),
+                            ImmutableMessageHasPayload(expectedReply.getPayload())),
+                      _))
+            .WillOnce(ReleaseSemaphore(getLocationCalledSemaphore));
+
+    dispatcher->addRequestCaller(providerParticipantId, mockRequestCaller);
+    dispatcher->receive(mutableMessage.getImmutableMessage());
+    EXPECT_TRUE(getLocationCalledSemaphore->waitFor(std::chrono::milliseconds(5000)));
+}
+
+TEST_F(DispatcherTest, receive_batchReplyCallsAllReplyCallers)
+{
+    auto semaphore = std::make_shared<Semaphore>(0);
+    EXPECT_CALL(*mockCallback, onSuccess(Eq(gpsLocation1)))
+            .Times(2)
+            .WillRepeatedly(ReleaseSemaphore(semaphore));
+    ON_CALL(*mockReplyCaller, getType())
+            .WillByDefault(Return(std::string("types::Localisation::GpsLocation")));
+
+    std::vector<Reply> replies(2);
+    replies[0].setRequestReplyId(requestReplyId);
+    replies[0].setResponse(gpsLocation1);
+    replies[1].setRequestReplyId(requestReplyId + "-2");
+    replies[1].setResponse(gpsLocation1);
+
+    MutableMessage mutableMessage = messageFactory.createBatchReply(
+            proxyParticipantId, providerParticipantId, qos, {}, replies);
+
+    dispatcher->addReplyCaller(requestReplyId, mockReplyCaller, qos);
+    dispatcher->addReplyCaller(requestReplyId + "-2", mockReplyCaller, qos);
+    dispatcher->receive(mutableMessage.getImmutableMessage());
+
+    EXPECT_TRUE(semaphore->waitFor(std::chrono::milliseconds(5000)));
+    EXPECT_TRUE(semaphore->waitFor(std::chrono::milliseconds(5000)));
+}
+
 TEST_F(DispatcherTest, receive_interpreteSubscriptionReplyAndCallSubscriptionCallback)
 {
     auto semaphore = std::make_shared<Semaphore>(0);
@@ -100,7 +100,8 @@ protected:
         result->setReceiveCallback(
                 [&mock](const system::RoutingTypes::UdsClientAddress& id,
                         smrf::ByteVector&& val,
-                        const std::string creator) { mock.received(id, std::move(val), creator); });
+                        const std::string creator,
+                        InFlightBudget::Credit) { mock.received(id, std::move(val), creator); });
         return result;
     }
 
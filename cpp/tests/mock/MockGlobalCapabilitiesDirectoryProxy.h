@@ -83,6 +83,23 @@ public:
                     std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
                     std::shared_ptr<MessagingQos> qos));
 
+    std::shared_ptr<Future<void>> addAsync(
+            const std::vector<GlobalDiscoveryEntry>& globalDiscoveryEntries,
+            std::function<void()> onSuccess,
+            std::function<void(const JoynrRuntimeException&)> onRuntimeError,
+            boost::optional<MessagingQos> qos) noexcept override
+    {
+        return addAsyncMock(globalDiscoveryEntries, onSuccess, onRuntimeError,
+                            std::make_shared<MessagingQos>(qos.get()));
+    }
+    MOCK_METHOD4(
+            addAsyncMock,
+            std::shared_ptr<Future<void>>(
+                    const std::vector<GlobalDiscoveryEntry>& globalDiscoveryEntries,
+                    std::function<void()> onSuccess,
+                    std::function<void(const JoynrRuntimeException& error)> onRuntimeError,
+                    std::shared_ptr<MessagingQos> qos));
+
     std::shared_ptr<Future<std::vector<GlobalDiscoveryEntry>>> lookupAsync(
             const std::vector<std::string>& domains,
             const std::string& interfaceName,
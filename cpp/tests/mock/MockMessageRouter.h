@@ -20,6 +20,8 @@
 #define TESTS_MOCK_MOCKMESSAGEROUTER_H
 
 #include <cstdint>
+#include <functional>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 #include <boost/asio.hpp>
@@ -43,6 +45,25 @@ public:
             onSuccess();
         }
     }
+    // adds the next hops one by one, so that expectations on addNextHop also cover addNextHops
+    void invokeAddNextHopForEachNextHop(
+            std::vector<NextHop> nextHops,
+            std::function<void(const std::vector<bool>& added)> onResult)
+    {
+        std::vector<bool> added(nextHops.size(), false);
+        for (std::size_t i = 0; i < nextHops.size(); ++i) {
+            addNextHop(nextHops[i]._participantId,
+                       nextHops[i]._address,
+                       nextHops[i]._isGloballyVisible,
+                       nextHops[i]._expiryDateMs,
+                       nextHops[i]._isSticky,
+                       [&added, i]() { added[i] = true; },
+                       [](const joynr::exceptions::ProviderRuntimeException&) {});
+        }
+        if (onResult) {
+            onResult(added);
+        }
+    }
     void invokeRemoveNextHopOnSuccessFct(
             const std::string& /*participantId*/,
             std::function<void()> onSuccess,
@@ -60,6 +81,9 @@ public:
         ON_CALL(*this, addNextHop(_, _, _, _, _, _, _))
                 .WillByDefault(
                         testing::Invoke(this, &MockMessageRouter::invokeAddNextHopOnSuccessFct));
+        ON_CALL(*this, addNextHops(_, _))
+                .WillByDefault(
+                        testing::Invoke(this, &MockMessageRouter::invokeAddNextHopForEachNextHop));
         ON_CALL(*this, removeNextHop(_, _, _))
                 .WillByDefault(
                         testing::Invoke(this, &MockMessageRouter::invokeRemoveNextHopOnSuccessFct));
@@ -90,6 +114,10 @@ public:
                  std::function<void()> onSuccess,
                  std::function<void(const joynr::exceptions::ProviderRuntimeException&)> onError));
 
+    MOCK_METHOD2(addNextHops,
+                 void(std::vector<NextHop> nextHops,
+                      std::function<void(const std::vector<bool>& added)> onResult));
+
     MOCK_METHOD3(
             removeNextHop,
             void(const std::string& participantId,
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "tests/utils/Gmock.h"
 
@@ -54,6 +55,14 @@ public:
                       std::shared_ptr<joynr::IReplyCaller> callback,
                       bool isLocalMessage));
 
+    MOCK_METHOD6(sendBatchRequest,
+                 void(const std::string& senderParticipantId,
+                      const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      const std::vector<joynr::Request>& requests,
+                      const std::vector<std::shared_ptr<joynr::IReplyCaller>>& callbacks,
+                      bool isLocalMessage));
+
     MOCK_METHOD5(sendOneWayRequest,
                  void(const std::string& senderParticipantId,
                       const std::string& receiverParticipantId,
@@ -68,6 +77,13 @@ public:
                       std::unordered_map<std::string, std::string> prefixedCustomHeaders,
                       const joynr::Reply& reply));
 
+    MOCK_METHOD5(sendBatchReply,
+                 void(const std::string& senderParticipantId,
+                      const std::string& receiverParticipantId,
+                      const joynr::MessagingQos& qos,
+                      std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+                      const std::vector<joynr::Reply>& replies));
+
     MOCK_METHOD5(sendSubscriptionRequest,
                  void(const std::string& senderParticipantId,
                       const std::string& receiverParticipantId,
@@ -36,7 +36,8 @@ public:
                             bool isMqttExponentialBackoffEnabled,
                             const std::string& clientId,
                             const std::string& gbid,
-                            const bool isMqttRetain)
+                            const bool isMqttRetain,
+                            const bool isPublishOnly = false)
             : MosquittoConnection(ccSettings,
                                   brokerUrl,
                                   mqttKeepAliveTimeSeconds,
@@ -45,7 +46,8 @@ public:
                                   isMqttExponentialBackoffEnabled,
                                   clientId,
                                   gbid,
-                                  isMqttRetain)
+                                  isMqttRetain,
+                                  isPublishOnly)
     {
     }
 
@@ -61,7 +63,7 @@ public:
                       const std::function<void(const joynr::exceptions::JoynrRuntimeException&)>&
                               onFailure,
                       const std::uint32_t msgTtlSec,
-                      std::unordered_map<std::string, std::string> prefixedCustomHeaders,
+                      const std::unordered_map<std::string, std::string>& prefixedCustomHeaders,
                       const std::uint32_t payloadlen,
                       const void* payload));
     MOCK_METHOD1(registerChannelId, void(const std::string& _channelId));
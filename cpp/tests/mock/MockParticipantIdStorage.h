@@ -38,6 +38,8 @@ public:
                              const std::string& interfaceName,
                              std::int32_t majorVersion,
                              const std::string& defaultValue));
+    MOCK_METHOD1(setProviderParticipantIds,
+                 void(const std::vector<ProviderParticipantId>& providerParticipantIds));
 };
 
 #endif // TESTS_MOCK_MOCKPARTICIPANTIDSTORAGE_H
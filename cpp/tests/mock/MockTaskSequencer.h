@@ -29,8 +29,7 @@ class MockTaskSequencer : public joynr::TaskSequencer<T>
 public:
     using MockTaskWithExpiryDate = typename TaskSequencer<T>::TaskWithExpiryDate;
 
-    MockTaskSequencer(std::chrono::milliseconds defaultTimeToWait)
-            : TaskSequencer<T>(defaultTimeToWait)
+    MockTaskSequencer(boost::asio::io_service& ioService) : TaskSequencer<T>(ioService)
     {
         // Do nothing
     }
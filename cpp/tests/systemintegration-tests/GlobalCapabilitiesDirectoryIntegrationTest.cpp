@@ -25,6 +25,7 @@
 #include "joynr/ClusterControllerSettings.h"
 #include "joynr/PrivateCopyAssign.h"
 #include "joynr/Settings.h"
+#include "joynr/SingleThreadedIOService.h"
 #include "joynr/SystemServicesSettings.h"
 #include "joynr/infrastructure/GlobalCapabilitiesDirectoryProxy.h"
 #include "joynr/system/DiscoveryProxy.h"
@@ -66,14 +67,17 @@ public:
     MessagingSettings messagingSettings;
     ClusterControllerSettings clusterControllerSettings;
     SystemServicesSettings sysSettings;
+    std::shared_ptr<SingleThreadedIOService> singleThreadedIOService;
 
     GlobalCapabilitiesDirectoryIntegrationTest()
             : runtime(),
               settings(std::make_unique<Settings>(std::get<0>(GetParam()))),
               messagingSettings(*settings),
               clusterControllerSettings(*settings),
-              sysSettings(*settings)
+              sysSettings(*settings),
+              singleThreadedIOService(std::make_shared<SingleThreadedIOService>())
     {
+        singleThreadedIOService->start();
         clusterControllerSettings.setCapabilitiesFreshnessUpdateIntervalMs(
                 std::chrono::milliseconds(500));
     }
@@ -94,6 +98,7 @@ public:
             runtime->shutdown();
             test::util::resetAndWaitUntilDestroyed(runtime);
         }
+        singleThreadedIOService->stop();
 
         // Delete persisted files
         test::util::removeAllCreatedSettingsAndPersistencyFiles();
@@ -126,7 +131,8 @@ TEST_P(GlobalCapabilitiesDirectoryIntegrationTest, registerAndRetrieveCapability
             std::make_unique<GlobalCapabilitiesDirectoryClient>(
                     clusterControllerSettings,
                     std::make_unique<TaskSequencer<void>>(
-                            std::chrono::milliseconds(MessagingQos().getTtl()))));
+                            singleThreadedIOService->getIOService()),
+                    messagingSettings.getGbid()));
     globalCapabilitiesDirectoryClient->setProxy(cabilitiesProxy);
 
     std::string capDomain("testDomain");
@@ -17,9 +17,14 @@
  * #L%
  */
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
 
+#include "joynr/ClusterControllerSettings.h"
 #include "joynr/OnChangeSubscriptionQos.h"
 #include "joynr/Semaphore.h"
 #include "joynr/Settings.h"
@@ -47,10 +52,15 @@ public:
               libjoynrProxyRuntime(),
               testDomain("testDomain"),
               settingsPath("test-resources/websocket-cc-tls.settings"),
-              semaphore(std::make_shared<Semaphore>(0))
+              semaphore(std::make_shared<Semaphore>(0)),
+              messageNotificationInterval(1000)
     {
+        auto settings = std::make_unique<Settings>(settingsPath);
+        ClusterControllerSettings clusterControllerSettings(*settings);
+        clusterControllerSettings.setMessageNotificationIntervalMs(
+                static_cast<std::uint32_t>(messageNotificationInterval.count()));
         clusterControllerRuntime = std::make_shared<TestJoynrClusterControllerRuntime>(
-                std::make_unique<Settings>(settingsPath), failOnFatalRuntimeError);
+                std::move(settings), failOnFatalRuntimeError);
         clusterControllerRuntime->init();
         clusterControllerRuntime->start();
     }
@@ -96,6 +106,7 @@ protected:
     const std::string testDomain;
     std::string settingsPath;
     std::shared_ptr<Semaphore> semaphore;
+    const std::chrono::milliseconds messageNotificationInterval;
 };
 
 class MockSubscriptionListener : public joynr::ISubscriptionListener<std::string, std::string>
@@ -179,3 +190,74 @@ TEST_F(MessageNotificationTest, messageToDisconnectedProviderCausesBroadcast)
     ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(3)));
     messageNotificationProxy->unsubscribeFromMessageQueuedForDeliveryBroadcast(subscriptionId);
 }
+
+TEST_F(MessageNotificationTest, messagesQueuedWithinIntervalCauseOneBroadcast)
+{
+    auto testProvider = std::make_shared<tests::DefaulttestProvider>();
+    joynr::types::ProviderQos providerQos;
+    providerQos.setScope(joynr::types::ProviderScope::LOCAL);
+    std::string providerParticipantId =
+            libjoynrProviderRuntime->registerProvider<tests::testProvider>(
+                    testDomain, testProvider, providerQos);
+
+    DiscoveryQos discoveryQos;
+    discoveryQos.setArbitrationStrategy(DiscoveryQos::ArbitrationStrategy::LAST_SEEN);
+    discoveryQos.setDiscoveryScope(joynr::types::DiscoveryScope::LOCAL_ONLY);
+    MessagingQos messagingQos;
+    messagingQos.setTtl(5000);
+
+    auto testProxy = libjoynrProxyRuntime->createProxyBuilder<tests::testProxy>(testDomain)
+                             ->setMessagingQos(messagingQos)
+                             ->setDiscoveryQos(discoveryQos)
+                             ->build();
+
+    Settings settings(settingsPath);
+    SystemServicesSettings systemSettings(settings);
+    DiscoveryQos messagingNotificationDiscoveryQos;
+    messagingNotificationDiscoveryQos.setArbitrationStrategy(
+            DiscoveryQos::ArbitrationStrategy::FIXED_PARTICIPANT);
+    messagingNotificationDiscoveryQos.addCustomParameter(
+            "fixedParticipantId", systemSettings.getCcMessageNotificationProviderParticipantId());
+    messagingNotificationDiscoveryQos.setDiscoveryScope(joynr::types::DiscoveryScope::LOCAL_ONLY);
+    auto messageNotificationProxy =
+            libjoynrProxyRuntime
+                    ->createProxyBuilder<joynr::system::MessageNotificationProxy>(
+                            systemSettings.getDomain())
+                    ->setMessagingQos(messagingQos)
+                    ->setDiscoveryQos(messagingNotificationDiscoveryQos)
+                    ->build();
+
+    auto broadcasts = std::make_shared<std::atomic<int>>(0);
+    auto mockListener = std::make_shared<MockSubscriptionListener>();
+    EXPECT_CALL(*mockListener, onSubscribed(_)).Times(1);
+    EXPECT_CALL(*mockListener, onError(_)).Times(0);
+    EXPECT_CALL(*mockListener, onReceive(Eq(providerParticipantId), _))
+            .WillRepeatedly(InvokeWithoutArgs([semaphore = semaphore, broadcasts]() {
+                ++(*broadcasts);
+                semaphore->notify();
+            }));
+
+    joynr::system::MessageNotificationMessageQueuedForDeliveryBroadcastFilterParameters
+            filterParameters;
+    filterParameters.setParticipantId(providerParticipantId);
+    auto future = messageNotificationProxy->subscribeToMessageQueuedForDeliveryBroadcast(
+            filterParameters, mockListener, std::make_shared<OnChangeSubscriptionQos>());
+    std::string subscriptionId;
+    future->get(subscriptionId);
+
+    libjoynrProviderRuntime->shutdown();
+    libjoynrProviderRuntime.reset();
+
+    auto onSuccess = [](const std::int32_t&) { FAIL(); };
+    auto onError = [](const joynr::exceptions::JoynrRuntimeException&) {};
+    for (int i = 0; i < 5; ++i) {
+        testProxy->addNumbersAsync(1, 2, 3, onSuccess, onError);
+    }
+
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(3)));
+    // the next broadcast for the provider is fired one interval after the first one at the
+    // earliest
+    std::this_thread::sleep_for(messageNotificationInterval / 2);
+    EXPECT_EQ(1, *broadcasts);
+    messageNotificationProxy->unsubscribeFromMessageQueuedForDeliveryBroadcast(subscriptionId);
+}
@@ -101,10 +101,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterAceOnly)
     masterAce.setDefaultConsumerPermission(Permission::YES);
     masterAce.setDefaultRequiredTrustLevel(TrustLevel::HIGH);
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce,
-            boost::optional<MasterAccessControlEntry>(),
-            boost::optional<OwnerAccessControlEntry>(),
-            TrustLevel::HIGH);
+            &masterAce, nullptr, nullptr, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::YES, consumerPermission);
 }
@@ -114,10 +111,7 @@ TEST_F(AccessControlAlgorithmTest, permissionMessageTrustLevelDoesntMatchAce)
     masterAce.setDefaultConsumerPermission(Permission::YES);
     masterAce.setDefaultRequiredTrustLevel(TrustLevel::MID);
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce,
-            boost::optional<MasterAccessControlEntry>(),
-            boost::optional<OwnerAccessControlEntry>(),
-            TrustLevel::LOW);
+            &masterAce, nullptr, nullptr, TrustLevel::LOW);
 
     EXPECT_EQ(Permission::NO, consumerPermission);
 }
@@ -126,10 +120,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithAllAceNull)
 {
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            boost::optional<MasterAccessControlEntry>(),
-            boost::optional<MasterAccessControlEntry>(),
-            boost::optional<OwnerAccessControlEntry>(),
-            TrustLevel::HIGH);
+            nullptr, nullptr, nullptr, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::NO, consumerPermission);
 }
@@ -145,7 +136,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterAndMediatorAce)
     mediatorAce.setDefaultRequiredTrustLevel(TrustLevel::LOW);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce, mediatorAce, boost::optional<OwnerAccessControlEntry>(), TrustLevel::LOW);
+            &masterAce, &mediatorAce, nullptr, TrustLevel::LOW);
 
     EXPECT_EQ(Permission::ASK, consumerPermission);
 }
@@ -155,10 +146,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMediatorOnly)
     mediatorAce.setDefaultConsumerPermission(Permission::YES);
     mediatorAce.setDefaultRequiredTrustLevel(TrustLevel::MID);
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            boost::optional<MasterAccessControlEntry>(),
-            mediatorAce,
-            boost::optional<OwnerAccessControlEntry>(),
-            TrustLevel::HIGH);
+            nullptr, &mediatorAce, nullptr, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::YES, consumerPermission);
 }
@@ -177,7 +165,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterAndInvalidMediatorAce)
     mediatorAce.setDefaultRequiredTrustLevel(TrustLevel::MID);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce, mediatorAce, boost::optional<OwnerAccessControlEntry>(), TrustLevel::HIGH);
+            &masterAce, &mediatorAce, nullptr, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::NO, consumerPermission);
 }
@@ -194,7 +182,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterMediatorAndOwnerAce)
     ownerAce.setRequiredTrustLevel(TrustLevel::MID);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce, mediatorAce, ownerAce, TrustLevel::MID);
+            &masterAce, &mediatorAce, &ownerAce, TrustLevel::MID);
 
     EXPECT_EQ(Permission::YES, consumerPermission);
 }
@@ -208,7 +196,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterAndOwnerAce)
     ownerAce.setRequiredTrustLevel(TrustLevel::HIGH);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce, mediatorAce, ownerAce, TrustLevel::HIGH);
+            &masterAce, &mediatorAce, &ownerAce, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::YES, consumerPermission);
 }
@@ -219,10 +207,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithOwnerAceOnly)
     ownerAce.setRequiredTrustLevel(TrustLevel::HIGH);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            boost::optional<MasterAccessControlEntry>(),
-            boost::optional<MasterAccessControlEntry>(),
-            ownerAce,
-            TrustLevel::HIGH);
+            nullptr, nullptr, &ownerAce, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::YES, consumerPermission);
 }
@@ -236,7 +221,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMediatorAndInvalidOwnerAce)
     ownerAce.setConsumerPermission(Permission::ASK);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            boost::optional<MasterAccessControlEntry>(), mediatorAce, ownerAce, TrustLevel::HIGH);
+            nullptr, &mediatorAce, &ownerAce, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::NO, consumerPermission);
 }
@@ -250,7 +235,7 @@ TEST_F(AccessControlAlgorithmTest, permissionWithMasterAndInvalidOwnerAce)
     ownerAce.setConsumerPermission(Permission::ASK);
 
     Permission::Enum consumerPermission = accessControlAlgorithm.getConsumerPermission(
-            masterAce, boost::optional<MasterAccessControlEntry>(), ownerAce, TrustLevel::HIGH);
+            &masterAce, nullptr, &ownerAce, TrustLevel::HIGH);
 
     EXPECT_EQ(Permission::NO, consumerPermission);
 }
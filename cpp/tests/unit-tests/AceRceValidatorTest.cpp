@@ -164,7 +164,7 @@ TYPED_TEST(AceRceValidatorTest, TestMediatorInvalidPossiblePermissions)
     possiblePermissions.push_back(Permission::ASK);
     possiblePermissions.push_back(Permission::YES);
     this->setPossiblePermissions(this->_mediatorEntry, possiblePermissions, TypeParam{});
-    Validator<TypeParam> validator(this->_masterEntry, this->_mediatorEntry, this->_ownerEntry);
+    Validator<TypeParam> validator(&this->_masterEntry, &this->_mediatorEntry, &this->_ownerEntry);
 
     EXPECT_FALSE(validator.isMediatorValid());
 }
@@ -175,21 +175,21 @@ TYPED_TEST(AceRceValidatorTest, TestMediatorInvalidPossibleTrustLevels)
     possibleRequiredTrustLevels.push_back(TrustLevel::HIGH);
     possibleRequiredTrustLevels.push_back(TrustLevel::MID);
     this->_mediatorEntry.setPossibleRequiredTrustLevels(possibleRequiredTrustLevels);
-    Validator<TypeParam> validator(this->_masterEntry, this->_mediatorEntry, this->_ownerEntry);
+    Validator<TypeParam> validator(&this->_masterEntry, &this->_mediatorEntry, &this->_ownerEntry);
 
     EXPECT_FALSE(validator.isMediatorValid());
 }
 
 TYPED_TEST(AceRceValidatorTest, TestMediatorValid)
 {
-    Validator<TypeParam> validator(this->_masterEntry, this->_mediatorEntry, this->_ownerEntry);
+    Validator<TypeParam> validator(&this->_masterEntry, &this->_mediatorEntry, &this->_ownerEntry);
 
     EXPECT_TRUE(validator.isMediatorValid());
 }
 
 TYPED_TEST(AceRceValidatorTest, TestOwnerValid)
 {
-    Validator<TypeParam> validator(this->_masterEntry, this->_mediatorEntry, this->_ownerEntry);
+    Validator<TypeParam> validator(&this->_masterEntry, &this->_mediatorEntry, &this->_ownerEntry);
 
     EXPECT_TRUE(validator.isOwnerValid());
 }
@@ -197,6 +197,6 @@ TYPED_TEST(AceRceValidatorTest, TestOwnerValid)
 TYPED_TEST(AceRceValidatorTest, TestOwnerInvalid)
 {
     this->setPermission(this->_ownerEntry, Permission::YES, TypeParam{});
-    Validator<TypeParam> validator(this->_masterEntry, this->_mediatorEntry, this->_ownerEntry);
+    Validator<TypeParam> validator(&this->_masterEntry, &this->_mediatorEntry, &this->_ownerEntry);
     EXPECT_FALSE(validator.isOwnerValid());
 }
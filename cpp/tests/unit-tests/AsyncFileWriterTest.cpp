@@ -0,0 +1,101 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/AsyncFileWriter.h"
+#include "joynr/Util.h"
+
+using namespace joynr;
+
+class AsyncFileWriterTest : public ::testing::Test
+{
+public:
+    AsyncFileWriterTest() : _fileName("test-AsyncFileWriterTest.persist")
+    {
+        std::remove(_fileName.c_str());
+    }
+
+    ~AsyncFileWriterTest() override
+    {
+        std::remove(_fileName.c_str());
+    }
+
+protected:
+    const std::string _fileName;
+};
+
+TEST_F(AsyncFileWriterTest, flushWritesReplacedFile)
+{
+    AsyncFileWriter fileWriter(std::chrono::hours(1));
+    fileWriter.replace(_fileName, "content");
+    EXPECT_FALSE(util::fileExists(_fileName));
+
+    fileWriter.flush();
+    EXPECT_EQ("content", util::loadStringFromFile(_fileName));
+    EXPECT_FALSE(util::fileExists(_fileName + ".tmp"));
+}
+
+TEST_F(AsyncFileWriterTest, writesWithinWindowAreCoalesced)
+{
+    util::saveStringToFile(_fileName, "old");
+    AsyncFileWriter fileWriter(std::chrono::hours(1));
+
+    fileWriter.append(_fileName, "1");
+    fileWriter.append(_fileName, "2");
+    fileWriter.flush();
+    EXPECT_EQ("old12", util::loadStringFromFile(_fileName));
+
+    fileWriter.append(_fileName, "3");
+    fileWriter.replace(_fileName, "new");
+    fileWriter.append(_fileName, "4");
+    fileWriter.flush();
+    EXPECT_EQ("new4", util::loadStringFromFile(_fileName));
+}
+
+TEST_F(AsyncFileWriterTest, flushWithoutPendingWritesReturns)
+{
+    AsyncFileWriter fileWriter(std::chrono::hours(1));
+    fileWriter.flush();
+    EXPECT_FALSE(util::fileExists(_fileName));
+}
+
+TEST_F(AsyncFileWriterTest, filesAreWrittenAfterCoalescingWindow)
+{
+    AsyncFileWriter fileWriter(std::chrono::milliseconds(10));
+    fileWriter.replace(_fileName, "content");
+
+    for (int i = 0; i < 100 && !util::fileExists(_fileName); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ("content", util::loadStringFromFile(_fileName));
+}
+
+TEST_F(AsyncFileWriterTest, destructorWritesPendingFiles)
+{
+    {
+        AsyncFileWriter fileWriter(std::chrono::hours(1));
+        fileWriter.replace(_fileName, "content");
+    }
+    EXPECT_EQ("content", util::loadStringFromFile(_fileName));
+}
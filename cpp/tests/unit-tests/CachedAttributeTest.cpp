@@ -0,0 +1,149 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/CachedAttribute.h"
+#include "joynr/Metrics.h"
+#include "joynr/SubscriptionQos.h"
+#include "joynr/exceptions/JoynrException.h"
+
+using namespace joynr;
+using std::chrono::milliseconds;
+
+class CachedAttributeTest : public ::testing::Test
+{
+public:
+    CachedAttributeTest() : _registry(MetricsRegistry::instance()), _cache()
+    {
+        _registry.reset();
+        _cache = std::make_shared<CachedAttribute<std::string>>();
+    }
+
+    ~CachedAttributeTest() override
+    {
+        _registry.reset();
+    }
+
+protected:
+    std::uint64_t getCount(const std::string& result)
+    {
+        return _registry
+                .getCounter("joynr_proxy_attribute_cache_lookups_total",
+                            "",
+                            "result=\"" + result + "\"")
+                ->get();
+    }
+
+    MetricsRegistry& _registry;
+    std::shared_ptr<CachedAttribute<std::string>> _cache;
+};
+
+TEST_F(CachedAttributeTest, disabledCacheReturnsNothing)
+{
+    _cache->update("value");
+    EXPECT_FALSE(_cache->isEnabled());
+    EXPECT_FALSE(_cache->get());
+    EXPECT_EQ(0U, getCount("miss"));
+}
+
+TEST_F(CachedAttributeTest, servesPublishedValueUntilMaxAge)
+{
+    _cache->enable(milliseconds(100), "subscriptionId");
+    EXPECT_TRUE(_cache->isEnabled());
+    EXPECT_FALSE(_cache->get());
+
+    _cache->update("value");
+    boost::optional<std::string> value = _cache->get();
+    ASSERT_TRUE(value);
+    EXPECT_EQ("value", *value);
+
+    std::this_thread::sleep_for(milliseconds(150));
+    EXPECT_FALSE(_cache->get());
+    EXPECT_EQ(1U, getCount("hit"));
+    EXPECT_EQ(2U, getCount("miss"));
+}
+
+TEST_F(CachedAttributeTest, disableReturnsSubscriptionIdAndDropsValue)
+{
+    _cache->enable(milliseconds(10000), "subscriptionId");
+    _cache->update("value");
+
+    EXPECT_EQ("subscriptionId", _cache->disable());
+    EXPECT_FALSE(_cache->isEnabled());
+    EXPECT_FALSE(_cache->get());
+    EXPECT_EQ("", _cache->disable());
+}
+
+TEST_F(CachedAttributeTest, listenerUpdatesAndInvalidatesCache)
+{
+    _cache->enable(milliseconds(10000), "subscriptionId");
+    CachedAttributeListener<std::string> listener(_cache);
+
+    listener.onReceive("value");
+    ASSERT_TRUE(_cache->get());
+    EXPECT_EQ("value", *_cache->get());
+
+    listener.onError(exceptions::PublicationMissedException("subscriptionId"));
+    EXPECT_FALSE(_cache->get());
+
+    _cache.reset();
+    listener.onReceive("ignored");
+}
+
+TEST_F(CachedAttributeTest, publicationsAreDiscardedWhileSetterIsPending)
+{
+    _cache->enable(milliseconds(10000), "subscriptionId");
+    _cache->update("old");
+
+    const std::uint64_t firstGeneration = _cache->beginSet();
+    EXPECT_FALSE(_cache->get());
+    const std::uint64_t secondGeneration = _cache->beginSet();
+    _cache->update("old");
+    EXPECT_FALSE(_cache->get());
+
+    _cache->endSet(firstGeneration);
+    _cache->update("old");
+    EXPECT_FALSE(_cache->get());
+
+    _cache->endSet(secondGeneration);
+    EXPECT_FALSE(_cache->get());
+    _cache->update("new");
+    ASSERT_TRUE(_cache->get());
+    EXPECT_EQ("new", *_cache->get());
+}
+
+TEST_F(CachedAttributeTest, subscriptionQosKeepsCacheFresh)
+{
+    auto qos = CachedAttribute<std::string>::createSubscriptionQos(milliseconds(1000));
+    EXPECT_EQ(SubscriptionQos::NO_EXPIRY_DATE(), qos->getExpiryDateMs());
+    EXPECT_EQ(0, qos->getMinIntervalMs());
+    EXPECT_EQ(500, qos->getMaxIntervalMs());
+    EXPECT_EQ(1000, qos->getAlertAfterIntervalMs());
+
+    qos = CachedAttribute<std::string>::createSubscriptionQos(milliseconds(10));
+    EXPECT_EQ(OnChangeWithKeepAliveSubscriptionQos::MIN_MAX_INTERVAL_MS(),
+              qos->getMaxIntervalMs());
+    EXPECT_LE(qos->getMaxIntervalMs(), qos->getAlertAfterIntervalMs());
+}
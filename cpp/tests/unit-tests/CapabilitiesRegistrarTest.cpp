@@ -514,3 +514,149 @@ TEST_F(CapabilitiesRegistrarTest, addToAll)
 
     EXPECT_EQ(_expectedParticipantId, participantId);
 }
+
+TEST_F(CapabilitiesRegistrarTest, addProvidersInBulk)
+{
+    types::ProviderQos testQos;
+    testQos.setPriority(100);
+    const std::string otherDomain("otherDomain");
+    const std::string otherParticipantId("otherParticipantId");
+    EXPECT_CALL(*_mockParticipantIdStorage,
+                getProviderParticipantId(
+                        _domain, MockProvider::INTERFACE_NAME(), MockProvider::MAJOR_VERSION))
+            .WillOnce(Return(_expectedParticipantId));
+    EXPECT_CALL(*_mockParticipantIdStorage,
+                getProviderParticipantId(
+                        otherDomain, MockProvider::INTERFACE_NAME(), MockProvider::MAJOR_VERSION))
+            .WillOnce(Return(otherParticipantId));
+    EXPECT_CALL(*_mockDispatcher, addRequestCaller(_expectedParticipantId, _)).Times(1);
+    EXPECT_CALL(*_mockDispatcher, addRequestCaller(otherParticipantId, _)).Times(1);
+    EXPECT_CALL(*_mockProvider, registerBroadcastListener(_)).Times(2);
+    EXPECT_CALL(*_mockMessageRouter, addNextHops(::testing::SizeIs(2), _)).Times(1);
+    // only the participantId of the provider to be persisted is written, and only once
+    EXPECT_CALL(*_mockParticipantIdStorage,
+                setProviderParticipantIds(::testing::ElementsAre(::testing::Field(
+                        &ParticipantIdStorage::ProviderParticipantId::participantId,
+                        Eq(_expectedParticipantId)))))
+            .Times(1);
+
+    auto mockFuture = std::make_shared<joynr::Future<void>>();
+    mockFuture->onSuccess();
+    EXPECT_CALL(*_mockDiscovery,
+                addAsyncMock(Property(&joynr::types::DiscoveryEntry::getParticipantId,
+                                      ::testing::AnyOf(Eq(_expectedParticipantId),
+                                                       Eq(otherParticipantId))),
+                             _,
+                             _,
+                             _,
+                             _,
+                             _,
+                             _))
+            .Times(2)
+            .WillRepeatedly(DoAll(InvokeArgument<3>(), Return(mockFuture)));
+
+    Future<void> future;
+    auto onSuccess = [&future]() { future.onSuccess(); };
+    auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+        future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+    };
+
+    const bool persist = false;
+    std::vector<ProviderRegistration> providerRegistrations;
+    providerRegistrations.emplace_back(_domain, _mockProvider, testQos);
+    providerRegistrations.emplace_back(otherDomain, _mockProvider, testQos, persist);
+    std::vector<std::string> participantIds = _capabilitiesRegistrar->addAsync(
+            std::move(providerRegistrations), onSuccess, onError);
+    future.get();
+
+    EXPECT_EQ(std::vector<std::string>({_expectedParticipantId, otherParticipantId}),
+              participantIds);
+}
+
+TEST_F(CapabilitiesRegistrarTest, addProvidersInBulk_failedProviderIsRolledBack)
+{
+    types::ProviderQos testQos;
+    const std::string otherDomain("otherDomain");
+    const std::string otherParticipantId("otherParticipantId");
+    EXPECT_CALL(*_mockParticipantIdStorage,
+                getProviderParticipantId(
+                        _domain, MockProvider::INTERFACE_NAME(), MockProvider::MAJOR_VERSION))
+            .WillOnce(Return(_expectedParticipantId));
+    EXPECT_CALL(*_mockParticipantIdStorage,
+                getProviderParticipantId(
+                        otherDomain, MockProvider::INTERFACE_NAME(), MockProvider::MAJOR_VERSION))
+            .WillOnce(Return(otherParticipantId));
+    EXPECT_CALL(*_mockParticipantIdStorage, setProviderParticipantIds(::testing::SizeIs(2)));
+
+    auto mockFuture = std::make_shared<joynr::Future<void>>();
+    mockFuture->onSuccess();
+    EXPECT_CALL(*_mockDiscovery,
+                addAsyncMock(Property(&joynr::types::DiscoveryEntry::getParticipantId,
+                                      Eq(_expectedParticipantId)),
+                             _,
+                             _,
+                             _,
+                             _,
+                             _,
+                             _))
+            .WillOnce(DoAll(InvokeArgument<3>(), Return(mockFuture)));
+    EXPECT_CALL(*_mockDiscovery,
+                addAsyncMock(Property(&joynr::types::DiscoveryEntry::getParticipantId,
+                                      Eq(otherParticipantId)),
+                             _,
+                             _,
+                             _,
+                             _,
+                             _,
+                             _))
+            .WillOnce(
+                    DoAll(InvokeArgument<5>(joynr::exceptions::JoynrRuntimeException("TestError")),
+                          Return(mockFuture)));
+    EXPECT_CALL(*_mockMessageRouter, removeNextHop(_expectedParticipantId, _, _)).Times(0);
+    EXPECT_CALL(*_mockMessageRouter, removeNextHop(otherParticipantId, _, _)).Times(1);
+    EXPECT_CALL(*_mockProvider,
+                unregisterBroadcastListener(A<std::shared_ptr<MulticastBroadcastListener>>()))
+            .Times(1);
+
+    Future<void> future;
+    auto onSuccess = [&future]() { future.onSuccess(); };
+    auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+        future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+    };
+
+    std::vector<ProviderRegistration> providerRegistrations;
+    providerRegistrations.emplace_back(_domain, _mockProvider, testQos);
+    providerRegistrations.emplace_back(otherDomain, _mockProvider, testQos);
+    _capabilitiesRegistrar->addAsync(std::move(providerRegistrations), onSuccess, onError);
+    try {
+        future.get();
+        FAIL() << "bulk registration did not fail";
+    } catch (const exceptions::JoynrRuntimeException& e) {
+        EXPECT_STREQ("TestError", e.what());
+    }
+}
+
+TEST_F(CapabilitiesRegistrarTest, removeProvidersInBulk)
+{
+    const std::string otherParticipantId("otherParticipantId");
+    auto mockFuture = std::make_shared<joynr::Future<void>>();
+    mockFuture->onSuccess();
+    EXPECT_CALL(*_mockDiscovery, removeAsyncMock(_expectedParticipantId, _, _, _))
+            .WillOnce(DoAll(InvokeArgument<1>(), Return(mockFuture)));
+    EXPECT_CALL(*_mockDiscovery, removeAsyncMock(otherParticipantId, _, _, _))
+            .WillOnce(DoAll(InvokeArgument<1>(), Return(mockFuture)));
+    EXPECT_CALL(*_mockDispatcher, removeRequestCaller(_expectedParticipantId)).Times(1);
+    EXPECT_CALL(*_mockDispatcher, removeRequestCaller(otherParticipantId)).Times(1);
+
+    Future<void> future;
+    auto onSuccess = [&future]() { future.onSuccess(); };
+    auto onError = [&future](const exceptions::JoynrRuntimeException& exception) {
+        future.onError(std::make_shared<exceptions::JoynrRuntimeException>(exception));
+    };
+
+    _capabilitiesRegistrar->removeAsync(
+            std::vector<std::string>{_expectedParticipantId, otherParticipantId},
+            onSuccess,
+            onError);
+    future.get();
+}
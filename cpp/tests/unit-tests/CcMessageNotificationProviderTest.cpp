@@ -0,0 +1,84 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <memory>
+#include <string>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/UnicastBroadcastListener.h"
+#include "libjoynrclustercontroller/messaging/CcMessageNotificationProvider.h"
+
+using namespace joynr;
+
+class CcMessageNotificationProviderTest : public ::testing::Test
+{
+public:
+    CcMessageNotificationProviderTest()
+            : _provider(std::make_shared<CcMessageNotificationProvider>()),
+              _broadcastName("messageQueuedForDelivery")
+    {
+    }
+
+protected:
+    std::shared_ptr<UnicastBroadcastListener> createListener(const std::string& subscriptionId)
+    {
+        return std::make_shared<UnicastBroadcastListener>(
+                subscriptionId, std::weak_ptr<PublicationManager>());
+    }
+
+    std::shared_ptr<CcMessageNotificationProvider> _provider;
+    const std::string _broadcastName;
+};
+
+TEST_F(CcMessageNotificationProviderTest, hasListenersWhileAtLeastOneIsRegistered)
+{
+    auto listener1 = createListener("subscription1");
+    auto listener2 = createListener("subscription2");
+    EXPECT_FALSE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->registerBroadcastListener(_broadcastName, listener1);
+    _provider->registerBroadcastListener(_broadcastName, listener2);
+    EXPECT_TRUE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->unregisterBroadcastListener(_broadcastName, listener1);
+    EXPECT_TRUE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->unregisterBroadcastListener(_broadcastName, listener2);
+    EXPECT_FALSE(_provider->hasMessageQueuedForDeliveryListeners());
+}
+
+TEST_F(CcMessageNotificationProviderTest, unregisteringUnknownListenerDoesNotChangeListenerCount)
+{
+    auto listener = createListener("subscription");
+    auto unknownListener = createListener("unknownSubscription");
+
+    _provider->unregisterBroadcastListener(_broadcastName, unknownListener);
+    EXPECT_FALSE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->registerBroadcastListener(_broadcastName, listener);
+    _provider->unregisterBroadcastListener(_broadcastName, unknownListener);
+    EXPECT_TRUE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->unregisterBroadcastListener(_broadcastName, listener);
+    _provider->unregisterBroadcastListener(_broadcastName, listener);
+    EXPECT_FALSE(_provider->hasMessageQueuedForDeliveryListeners());
+
+    _provider->registerBroadcastListener(_broadcastName, listener);
+    EXPECT_TRUE(_provider->hasMessageQueuedForDeliveryListeners());
+}
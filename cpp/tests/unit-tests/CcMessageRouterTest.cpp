@@ -17,8 +17,10 @@
  * #L%
  */
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 #include "tests/utils/Gmock.h"
@@ -28,6 +30,7 @@
 
 #include "joynr/IPlatformSecurityManager.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/InFlightBudget.h"
 #include "joynr/InProcessMessagingAddress.h"
 #include "joynr/Logger.h"
 #include "joynr/MessageQueue.h"
@@ -37,7 +40,9 @@
 #include "joynr/MutableMessageFactory.h"
 #include "joynr/Semaphore.h"
 #include "joynr/SingleThreadedIOService.h"
+#include "joynr/TimePoint.h"
 #include "joynr/Util.h"
+#include "joynr/WarmRestartSnapshot.h"
 #include "joynr/WebSocketMulticastAddressCalculator.h"
 #include "joynr/access-control/IAccessController.h"
 #include "joynr/system/RoutingTypes/Address.h"
@@ -55,6 +60,7 @@
 #include "tests/mock/MockMessagingMulticastSubscriber.h"
 
 using ::testing::_;
+using ::testing::A;
 using ::testing::AtLeast;
 using ::testing::DoAll;
 using ::testing::Eq;
@@ -176,6 +182,51 @@ TEST_F(CcMessageRouterTest, routeMessageToUdsClientAddress)
     this->routeMessageToAddress();
 }
 
+TEST_F(CcMessageRouterTest, floodingClientCanReachOtherRecipientWhileUnreachableOneIsQueued)
+{
+    const std::size_t maxInFlightMessages = 4;
+    auto inFlightBudget = std::make_shared<InFlightBudget>(maxInFlightMessages, "test");
+    auto routeWithCredit = [this, &inFlightBudget](const std::string& recipient) {
+        MutableMessage mutableMessage;
+        mutableMessage.setType(Message::VALUE_MESSAGE_TYPE_ONE_WAY());
+        mutableMessage.setSender("floodingClient");
+        mutableMessage.setRecipient(recipient);
+        mutableMessage.setExpiryDate(TimePoint::now() + std::chrono::milliseconds(60000));
+        std::shared_ptr<ImmutableMessage> immutableMessage = mutableMessage.getImmutableMessage();
+        immutableMessage->setInFlightCredit(inFlightBudget->acquire());
+        this->_messageRouter->route(immutableMessage);
+        return immutableMessage;
+    };
+
+    // the parked messages must not keep the credits of the client
+    for (std::size_t i = 0; i < 3 * maxInFlightMessages; ++i) {
+        routeWithCredit("unreachableParticipant");
+        EXPECT_FALSE(inFlightBudget->pauseIfExhausted([]() {}));
+    }
+    EXPECT_EQ(3 * maxInFlightMessages, this->_messageQueue->getQueueLength());
+    EXPECT_EQ(0, inFlightBudget->getStatistics().inFlight);
+
+    const std::string reachableParticipantId = "reachableParticipant";
+    auto address = std::make_shared<const joynr::system::RoutingTypes::UdsClientAddress>(
+            "reachableUdsClient");
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    this->_messageRouter->addNextHop(
+            reachableParticipantId, address, _DEFAULT_IS_GLOBALLY_VISIBLE, expiryDateMs, false);
+
+    Semaphore transmitted(0);
+    auto mockMessagingStub = std::make_shared<MockMessagingStub>();
+    ON_CALL(*(this->_messagingStubFactory), create(udsClientAddress("reachableUdsClient")))
+            .WillByDefault(Return(mockMessagingStub));
+    EXPECT_CALL(*mockMessagingStub,
+                transmit(_,
+                         A<const std::function<void(
+                                 const joynr::exceptions::JoynrRuntimeException&)>&>()))
+            .WillOnce(ReleaseSemaphore(&transmitted));
+    routeWithCredit(reachableParticipantId);
+    EXPECT_TRUE(transmitted.waitFor(std::chrono::seconds(2)));
+    EXPECT_EQ(0, inFlightBudget->getStatistics().inFlight);
+}
+
 TEST_F(CcMessageRouterTest, removeMulticastReceiver_failsIfProviderAddressNotAvailable)
 {
     const std::string multicastId("multicastId");
@@ -1632,6 +1683,155 @@ TEST_F(CcMessageRouterTest, addressValidation_allowUpdateOfMqttAddress)
     _messageRouter->removeNextHop(testParticipantId);
 }
 
+TEST_F(CcMessageRouterTest, addNextHopWithUnchangedRoutingEntrySucceeds)
+{
+    const std::string testParticipantId = "unchangedRoutingEntryParticipantId";
+    auto address =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("testbrokerUri", "testTopic");
+    addNewRoutingEntry(testParticipantId, address);
+
+    const bool isParticipantGloballyVisible = true;
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    Semaphore addNextHopDone(0);
+    auto onSuccess = [&addNextHopDone]() { addNextHopDone.notify(); };
+    auto onError = [](const joynr::exceptions::ProviderRuntimeException& e) {
+        FAIL() << "onError: " << e.getMessage();
+    };
+
+    // same address instance and an equal address instance
+    _messageRouter->addNextHop(testParticipantId,
+                               address,
+                               isParticipantGloballyVisible,
+                               expiryDateMs,
+                               false,
+                               onSuccess,
+                               onError);
+    EXPECT_TRUE(addNextHopDone.waitFor(std::chrono::milliseconds(1000)));
+    _messageRouter->addNextHop(
+            testParticipantId,
+            std::make_shared<const system::RoutingTypes::MqttAddress>("testbrokerUri", "testTopic"),
+            isParticipantGloballyVisible,
+            expiryDateMs,
+            false,
+            onSuccess,
+            onError);
+    EXPECT_TRUE(addNextHopDone.waitFor(std::chrono::milliseconds(1000)));
+
+    // a changed sticky flag is still applied
+    _messageRouter->addNextHop(testParticipantId,
+                               address,
+                               isParticipantGloballyVisible,
+                               expiryDateMs,
+                               true,
+                               onSuccess,
+                               onError);
+    EXPECT_TRUE(addNextHopDone.waitFor(std::chrono::milliseconds(1000)));
+
+    auto newAddress =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("testbrokerUri", "newTopic");
+    Semaphore addNextHopFailed(0);
+    _messageRouter->addNextHop(testParticipantId,
+                               newAddress,
+                               isParticipantGloballyVisible,
+                               expiryDateMs,
+                               false,
+                               []() { FAIL() << "onSuccess called for sticky routing entry"; },
+                               [&addNextHopFailed](
+                                       const joynr::exceptions::ProviderRuntimeException&) {
+                                   addNextHopFailed.notify();
+                               });
+    EXPECT_TRUE(addNextHopFailed.waitFor(std::chrono::milliseconds(1000)));
+
+    // cleanup
+    _messageRouter->removeNextHop(testParticipantId);
+}
+
+TEST_F(CcMessageRouterTest, addNextHopWithUnchangedRoutingEntrySendsQueuedMessages)
+{
+    const std::string testParticipantId = "unchangedRoutingEntryQueuedMessagesParticipantId";
+    auto address =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("testbrokerUri", "testTopic");
+    addNewRoutingEntry(testParticipantId, address);
+
+    // the message is queued because the creation of the messaging stub fails
+    EXPECT_CALL(*_messagingStubFactory, create(Pointee(Eq(*address)))).WillOnce(Return(nullptr));
+    _mutableMessage.setExpiryDate(TimePoint::now() + std::chrono::milliseconds(10000));
+    _mutableMessage.setType(joynr::Message::VALUE_MESSAGE_TYPE_REQUEST());
+    _mutableMessage.setRecipient(testParticipantId);
+    std::shared_ptr<ImmutableMessage> immutableMessage = _mutableMessage.getImmutableMessage();
+    _messageRouter->route(immutableMessage);
+    EXPECT_EQ(1, _messageQueue->getQueueLength());
+    Mock::VerifyAndClearExpectations(_messagingStubFactory.get());
+
+    Semaphore semaphore(0);
+    auto mockMessagingStub = std::make_shared<MockMessagingStub>();
+    EXPECT_CALL(*_messagingStubFactory, create(Pointee(Eq(*address))))
+            .WillOnce(Return(mockMessagingStub));
+    EXPECT_CALL(*mockMessagingStub, transmit(Eq(immutableMessage), _))
+            .WillOnce(ReleaseSemaphore(&semaphore));
+
+    const bool isParticipantGloballyVisible = true;
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const bool isSticky = false;
+    _messageRouter->addNextHop(
+            testParticipantId, address, isParticipantGloballyVisible, expiryDateMs, isSticky);
+
+    EXPECT_TRUE(semaphore.waitFor(std::chrono::milliseconds(1000)));
+    EXPECT_EQ(0, _messageQueue->getQueueLength());
+
+    // cleanup
+    _messageRouter->removeNextHop(testParticipantId);
+}
+
+TEST_F(CcMessageRouterTest, addNextHopsAddsValidEntriesAndSendsQueuedMessages)
+{
+    const std::string mqttParticipantId = "addNextHopsMqttParticipantId";
+    auto mqttAddress =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("testbrokerUri", "testTopic");
+    const std::string webSocketParticipantId = "addNextHopsWebSocketParticipantId";
+    const std::string inProcessParticipantId = "addNextHopsInProcessParticipantId";
+
+    // queued until the next hop of the recipient is known
+    Semaphore semaphore(0);
+    _mutableMessage.setExpiryDate(TimePoint::now() + std::chrono::milliseconds(1024));
+    _mutableMessage.setType(joynr::Message::VALUE_MESSAGE_TYPE_REQUEST());
+    _mutableMessage.setRecipient(mqttParticipantId);
+    std::shared_ptr<ImmutableMessage> immutableMessage = _mutableMessage.getImmutableMessage();
+    _messageRouter->route(immutableMessage);
+
+    auto mockMessagingStub = std::make_shared<MockMessagingStub>();
+    EXPECT_CALL(*_messagingStubFactory, create(Pointee(Eq(*mqttAddress))))
+            .WillOnce(Return(mockMessagingStub));
+    EXPECT_CALL(*mockMessagingStub, transmit(Eq(immutableMessage), _))
+            .WillOnce(ReleaseSemaphore(&semaphore));
+
+    constexpr std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    std::vector<IMessageRouter::NextHop> nextHops{
+            {mqttParticipantId, mqttAddress, true, expiryDateMs, false},
+            {webSocketParticipantId,
+             std::make_shared<const system::RoutingTypes::WebSocketAddress>(),
+             false,
+             expiryDateMs,
+             false},
+            {inProcessParticipantId,
+             std::make_shared<const InProcessMessagingAddress>(),
+             false,
+             expiryDateMs,
+             false}};
+    std::vector<bool> added;
+    _messageRouter->addNextHops(
+            nextHops, [&added](const std::vector<bool>& result) { added = result; });
+
+    EXPECT_EQ(std::vector<bool>({true, false, true}), added);
+    EXPECT_TRUE(semaphore.waitFor(std::chrono::milliseconds(1000)));
+    Mock::VerifyAndClearExpectations(_messagingStubFactory.get());
+    Mock::VerifyAndClearExpectations(mockMessagingStub.get());
+
+    // cleanup
+    _messageRouter->removeNextHop(mqttParticipantId);
+    _messageRouter->removeNextHop(inProcessParticipantId);
+}
+
 TEST_F(CcMessageRouterTest, DISABLED_addressValidation_allowUpdateOfWebSocketAddress)
 {
     // Disabled: WebSocketAddress is not allowed in CcMessageRouter
@@ -2083,3 +2283,189 @@ TEST_F(CcMessageRouterTest, accessControllerIsCalledWithCorrectIsLocalRecipient)
     this->_messageRouter->route(immutableMessage3);
     this->_messageRouter->route(immutableMessage4);
 }
+
+TEST_F(CcMessageRouterTest, warmRestartSnapshot_restoresRoutingEntries)
+{
+    const std::string globalParticipantId("globalParticipantId");
+    const std::string inProcessParticipantId("inProcessParticipantId");
+    const std::string expiredParticipantId("expiredParticipantId");
+    const std::string knownParticipantId("knownParticipantId");
+    const bool isSticky = false;
+    const std::int64_t expiryDateMs = TimePoint::fromRelativeMs(60000).toMilliseconds();
+
+    auto globalAddress =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("brokerUri", "topic");
+    auto dispatcher = std::make_shared<MockDispatcher>();
+    auto skeleton = std::make_shared<MockInProcessMessagingSkeleton>(dispatcher);
+    auto inProcessAddress = std::make_shared<const InProcessMessagingAddress>(skeleton);
+    _messageRouter->addNextHop(globalParticipantId,
+                               globalAddress,
+                               _DEFAULT_IS_GLOBALLY_VISIBLE,
+                               expiryDateMs,
+                               isSticky);
+    _messageRouter->addNextHop(inProcessParticipantId,
+                               inProcessAddress,
+                               _DEFAULT_IS_GLOBALLY_VISIBLE,
+                               expiryDateMs,
+                               isSticky);
+
+    WarmRestartSnapshot snapshot;
+    _messageRouter->saveWarmRestartSnapshot(snapshot);
+    auto containsParticipant = [&snapshot](const std::string& participantId) {
+        return std::any_of(snapshot.routingEntries.cbegin(),
+                           snapshot.routingEntries.cend(),
+                           [&participantId](const WarmRestartSnapshot::RoutingEntry& entry) {
+                               return entry.participantId == participantId;
+                           });
+    };
+    EXPECT_TRUE(containsParticipant(globalParticipantId));
+    EXPECT_FALSE(containsParticipant(inProcessParticipantId));
+
+    const std::int64_t expiredMs = TimePoint::now().toMilliseconds() - 1;
+    snapshot.routingEntries.push_back(
+            {expiredParticipantId, globalAddress, _DEFAULT_IS_GLOBALLY_VISIBLE, expiredMs});
+    snapshot.routingEntries.push_back(
+            {knownParticipantId, globalAddress, _DEFAULT_IS_GLOBALLY_VISIBLE, expiryDateMs});
+
+    _messageRouter->shutdown();
+    _messageRouter = createMessageRouter();
+    auto knownAddress = std::make_shared<const system::RoutingTypes::MqttAddress>(
+            "brokerUri", "knownTopic");
+    _messageRouter->addNextHop(
+            knownParticipantId, knownAddress, _DEFAULT_IS_GLOBALLY_VISIBLE, expiryDateMs, isSticky);
+
+    _messageRouter->restoreWarmRestartSnapshot(snapshot, std::chrono::milliseconds(60000));
+
+    checkResolveNextHop(globalParticipantId, true);
+    checkResolveNextHop(inProcessParticipantId, false);
+    checkResolveNextHop(expiredParticipantId, false);
+
+    WarmRestartSnapshot restored;
+    _messageRouter->saveWarmRestartSnapshot(restored);
+    auto knownEntry =
+            std::find_if(restored.routingEntries.cbegin(),
+                         restored.routingEntries.cend(),
+                         [&knownParticipantId](const WarmRestartSnapshot::RoutingEntry& entry) {
+                             return entry.participantId == knownParticipantId;
+                         });
+    ASSERT_NE(restored.routingEntries.cend(), knownEntry);
+    EXPECT_EQ(*knownAddress, *knownEntry->address);
+}
+
+TEST_F(CcMessageRouterTest, warmRestartSnapshot_restoredClientEntryExpiresUnlessClientReconnects)
+{
+    const std::string clientParticipantId("clientParticipantId");
+    const std::string globalParticipantId("globalParticipantId");
+    const std::int64_t expiryDateMs = std::numeric_limits<std::int64_t>::max();
+    const std::chrono::milliseconds clientReconnectTimeout(60000);
+
+    auto clientAddress =
+            std::make_shared<const system::RoutingTypes::WebSocketClientAddress>("clientId");
+    auto globalAddress =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("brokerUri", "topic");
+    WarmRestartSnapshot snapshot;
+    snapshot.routingEntries.push_back(
+            {clientParticipantId, clientAddress, _DEFAULT_IS_GLOBALLY_VISIBLE, expiryDateMs});
+    snapshot.routingEntries.push_back(
+            {globalParticipantId, globalAddress, _DEFAULT_IS_GLOBALLY_VISIBLE, expiryDateMs});
+
+    const std::int64_t maxClientExpiryDateMs =
+            TimePoint::now().toMilliseconds() + clientReconnectTimeout.count();
+    _messageRouter->restoreWarmRestartSnapshot(snapshot, clientReconnectTimeout);
+
+    auto getExpiryDateMs = [this](const std::string& participantId) {
+        WarmRestartSnapshot restored;
+        _messageRouter->saveWarmRestartSnapshot(restored);
+        auto entry =
+                std::find_if(restored.routingEntries.cbegin(),
+                             restored.routingEntries.cend(),
+                             [&participantId](const WarmRestartSnapshot::RoutingEntry& entry) {
+                                 return entry.participantId == participantId;
+                             });
+        EXPECT_NE(restored.routingEntries.cend(), entry);
+        return entry == restored.routingEntries.cend() ? std::int64_t(0) : entry->expiryDateMs;
+    };
+    EXPECT_LE(getExpiryDateMs(clientParticipantId), maxClientExpiryDateMs);
+    EXPECT_EQ(expiryDateMs, getExpiryDateMs(globalParticipantId));
+
+    _messageRouter->sendQueuedMessages(clientAddress);
+    EXPECT_EQ(expiryDateMs, getExpiryDateMs(clientParticipantId));
+}
+
+TEST_F(CcMessageRouterTest, warmRestartSnapshot_restoredMulticastReceiverIsRegisteredOnce)
+{
+    const std::string subscriberParticipantId("subscriberPartId1");
+    const std::string providerParticipantId("providerParticipantId");
+    const std::string multicastId("providerParticipantId/methodName/partition0");
+
+    auto providerAddress = std::make_shared<const joynr::system::RoutingTypes::MqttAddress>();
+    _messageRouter->addProvisionedNextHop(
+            providerParticipantId, providerAddress, _DEFAULT_IS_GLOBALLY_VISIBLE);
+
+    auto mockMqttMessagingMulticastSubscriber =
+            std::make_shared<MockMessagingMulticastSubscriber>();
+    std::shared_ptr<IMessagingMulticastSubscriber> mqttMessagingMulticastSubscriber =
+            mockMqttMessagingMulticastSubscriber;
+    _multicastMessagingSkeletonDirectory->registerSkeleton<system::RoutingTypes::MqttAddress>(
+            mqttMessagingMulticastSubscriber);
+
+    EXPECT_CALL(*mockMqttMessagingMulticastSubscriber, registerMulticastSubscription(multicastId))
+            .Times(1);
+
+    WarmRestartSnapshot snapshot;
+    snapshot.multicastReceivers.push_back({multicastId, {subscriberParticipantId}});
+    _messageRouter->restoreWarmRestartSnapshot(snapshot, std::chrono::milliseconds(60000));
+
+    WarmRestartSnapshot restored;
+    _messageRouter->saveWarmRestartSnapshot(restored);
+    ASSERT_EQ(1, restored.multicastReceivers.size());
+    EXPECT_EQ(multicastId, restored.multicastReceivers[0].multicastId);
+    EXPECT_EQ(std::vector<std::string>{subscriberParticipantId},
+              restored.multicastReceivers[0].receiverIds);
+
+    // the reconnecting subscriber adds its receiver again
+    Semaphore successCallbackCalled;
+    _messageRouter->addMulticastReceiver(
+            multicastId,
+            subscriberParticipantId,
+            providerParticipantId,
+            [&successCallbackCalled]() { successCallbackCalled.notify(); },
+            [](const joynr::exceptions::ProviderRuntimeException&) { FAIL() << "onError called"; });
+    EXPECT_TRUE(successCallbackCalled.waitFor(std::chrono::milliseconds(5000)));
+}
+
+TEST_F(CcMessageRouterTest, warmRestartSnapshot_restoredMulticastReceiverExpiresWithoutReconnect)
+{
+    const std::string subscriberParticipantId("subscriberPartId1");
+    const std::string providerParticipantId("providerParticipantId");
+    const std::string multicastId("providerParticipantId/methodName/partition0");
+
+    auto providerAddress = std::make_shared<const joynr::system::RoutingTypes::MqttAddress>();
+    _messageRouter->addProvisionedNextHop(
+            providerParticipantId, providerAddress, _DEFAULT_IS_GLOBALLY_VISIBLE);
+
+    auto mockMqttMessagingMulticastSubscriber =
+            std::make_shared<MockMessagingMulticastSubscriber>();
+    std::shared_ptr<IMessagingMulticastSubscriber> mqttMessagingMulticastSubscriber =
+            mockMqttMessagingMulticastSubscriber;
+    _multicastMessagingSkeletonDirectory->registerSkeleton<system::RoutingTypes::MqttAddress>(
+            mqttMessagingMulticastSubscriber);
+
+    Semaphore unregistered;
+    EXPECT_CALL(*mockMqttMessagingMulticastSubscriber, registerMulticastSubscription(multicastId))
+            .Times(1);
+    EXPECT_CALL(*mockMqttMessagingMulticastSubscriber,
+                unregisterMulticastSubscription(multicastId))
+            .WillOnce(ReleaseSemaphore(&unregistered));
+
+    WarmRestartSnapshot snapshot;
+    snapshot.multicastReceivers.push_back({multicastId, {subscriberParticipantId}});
+    _messageRouter->restoreWarmRestartSnapshot(snapshot, std::chrono::milliseconds(100));
+
+    // the subscriber does not reconnect within the client reconnect timeout
+    EXPECT_TRUE(unregistered.waitFor(std::chrono::milliseconds(5000)));
+
+    WarmRestartSnapshot restored;
+    _messageRouter->saveWarmRestartSnapshot(restored);
+    EXPECT_TRUE(restored.multicastReceivers.empty());
+}
@@ -68,6 +68,29 @@ TEST(ClusterControllerSettingsTest, initializedWithDefaultSettings)
 
     EXPECT_EQ(clusterControllerSettings.getMessageQueueLimit(),
               ClusterControllerSettings::DEFAULT_MESSAGE_QUEUE_LIMIT());
+    EXPECT_EQ(clusterControllerSettings.getMqttConnectionsPerGbid(),
+              ClusterControllerSettings::DEFAULT_MQTT_CONNECTIONS_PER_GBID());
+    EXPECT_EQ(clusterControllerSettings.getMqttIngressQueueCapacity(),
+              ClusterControllerSettings::DEFAULT_MQTT_INGRESS_QUEUE_CAPACITY());
+    EXPECT_EQ(clusterControllerSettings.getMqttIngressThreads(),
+              ClusterControllerSettings::DEFAULT_MQTT_INGRESS_THREADS());
+    EXPECT_EQ(clusterControllerSettings.getClientMaxInFlightMessages(),
+              ClusterControllerSettings::DEFAULT_CLIENT_MAX_INFLIGHT_MESSAGES());
+    EXPECT_EQ(clusterControllerSettings.getClientMaxSendBufferBytes(),
+              ClusterControllerSettings::DEFAULT_CLIENT_MAX_SEND_BUFFER_BYTES());
+    EXPECT_EQ(clusterControllerSettings.getGlobalCapabilitiesDirectoryMaxConcurrentCalls(),
+              ClusterControllerSettings::
+                      DEFAULT_GLOBAL_CAPABILITIES_DIRECTORY_MAX_CONCURRENT_CALLS());
+    EXPECT_FALSE(clusterControllerSettings.isMetricsExportFileSet());
+    EXPECT_EQ(clusterControllerSettings.getMetricsExportIntervalMs(),
+              ClusterControllerSettings::DEFAULT_METRICS_EXPORT_INTERVAL_MS());
+    EXPECT_FALSE(clusterControllerSettings.isWarmRestartSnapshotFileSet());
+    EXPECT_EQ(clusterControllerSettings.getWarmRestartSnapshotIntervalMs(),
+              ClusterControllerSettings::DEFAULT_WARM_RESTART_SNAPSHOT_INTERVAL_MS());
+    EXPECT_EQ(clusterControllerSettings.getWarmRestartClientReconnectTimeoutMs(),
+              ClusterControllerSettings::DEFAULT_WARM_RESTART_CLIENT_RECONNECT_TIMEOUT_MS());
+    EXPECT_EQ(clusterControllerSettings.getMessageNotificationIntervalMs(),
+              ClusterControllerSettings::DEFAULT_MESSAGE_NOTIFICATION_INTERVAL_MS());
 }
 
 // check specific non-default settings
@@ -177,3 +177,25 @@ TEST_F(FutureTest, waitForFinishWithTimerForVoid)
         EXPECT_EQ(StatusCodeEnum::WAIT_TIMED_OUT, voidFuture.getStatus());
     }
 }
+
+TEST_F(FutureTest, completionCallbackInvokedOnceAfterResultReceived)
+{
+    int invocations = 0;
+    intFuture.onCompletion([&invocations]() { invocations++; });
+    ASSERT_EQ(0, invocations);
+    intFuture.onSuccess(10);
+    ASSERT_EQ(1, invocations);
+
+    // callbacks registered after completion are invoked immediately
+    intFuture.onCompletion([&invocations]() { invocations++; });
+    ASSERT_EQ(2, invocations);
+}
+
+TEST_F(FutureTest, completionCallbackInvokedAfterFailureReceivedForVoid)
+{
+    bool invoked = false;
+    voidFuture.onCompletion([&invoked]() { invoked = true; });
+    voidFuture.onError(
+            std::make_shared<exceptions::ProviderRuntimeException>("exceptionMessageVoidFuture"));
+    ASSERT_TRUE(invoked);
+}
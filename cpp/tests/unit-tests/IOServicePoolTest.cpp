@@ -0,0 +1,113 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/strand.hpp>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/IOServicePool.h"
+#include "joynr/Semaphore.h"
+
+using namespace joynr;
+
+class IOServicePoolTest : public ::testing::Test
+{
+protected:
+    const std::chrono::milliseconds _waitTime{5000};
+};
+
+TEST_F(IOServicePoolTest, poolHasAtLeastOneThread)
+{
+    EXPECT_EQ(4u, std::make_shared<IOServicePool>(4)->getNumberOfThreads());
+    EXPECT_EQ(1u, std::make_shared<IOServicePool>(0)->getNumberOfThreads());
+}
+
+TEST_F(IOServicePoolTest, handlersAreDistributedOverAllThreads)
+{
+    const std::uint32_t numberOfThreads = 4;
+    auto ioServicePool = std::make_shared<IOServicePool>(numberOfThreads);
+    ioServicePool->start();
+
+    // every handler blocks until all handlers are running, which only succeeds if each of
+    // them runs on a thread of its own
+    std::mutex mutex;
+    std::condition_variable allRunning;
+    std::set<std::thread::id> threadIds;
+    Semaphore handlerFinished(0);
+    for (std::uint32_t i = 0; i < numberOfThreads; ++i) {
+        ioServicePool->getIOService().post([&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            threadIds.insert(std::this_thread::get_id());
+            allRunning.notify_all();
+            allRunning.wait_for(
+                    lock, _waitTime, [&threadIds]() { return threadIds.size() == numberOfThreads; });
+            handlerFinished.notify();
+        });
+    }
+    for (std::uint32_t i = 0; i < numberOfThreads; ++i) {
+        ASSERT_TRUE(handlerFinished.waitFor(_waitTime));
+    }
+    ioServicePool->stop();
+
+    EXPECT_EQ(numberOfThreads, threadIds.size());
+    EXPECT_EQ(0u, threadIds.count(std::this_thread::get_id()));
+}
+
+TEST_F(IOServicePoolTest, strandWrappedHandlersNeverRunConcurrently)
+{
+    auto ioServicePool = std::make_shared<IOServicePool>(4);
+    ioServicePool->start();
+    boost::asio::io_service::strand strand(ioServicePool->getIOService());
+
+    const int numberOfHandlers = 200;
+    std::atomic<int> runningHandlers(0);
+    std::atomic<int> maxRunningHandlers(0);
+    Semaphore handlerFinished(0);
+    for (int i = 0; i < numberOfHandlers; ++i) {
+        // unrelated handlers keep the other threads busy in parallel
+        ioServicePool->getIOService().post(
+                []() { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+        strand.post([&]() {
+            const int running = ++runningHandlers;
+            int maxRunning = maxRunningHandlers;
+            while (running > maxRunning &&
+                   !maxRunningHandlers.compare_exchange_weak(maxRunning, running)) {
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            --runningHandlers;
+            handlerFinished.notify();
+        });
+    }
+    for (int i = 0; i < numberOfHandlers; ++i) {
+        ASSERT_TRUE(handlerFinished.waitFor(_waitTime));
+    }
+    ioServicePool->stop();
+
+    EXPECT_EQ(1, maxRunningHandlers);
+}
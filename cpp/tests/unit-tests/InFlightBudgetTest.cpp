@@ -0,0 +1,91 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/InFlightBudget.h"
+
+using namespace joynr;
+
+TEST(InFlightBudgetTest, creditIsReturnedWhenReleased)
+{
+    auto budget = std::make_shared<InFlightBudget>(2, "test");
+    InFlightBudget::Credit credit = budget->acquire();
+    InFlightBudget::Credit copiedCredit = credit;
+    EXPECT_EQ(1, budget->getStatistics().inFlight);
+
+    credit.reset();
+    EXPECT_EQ(1, budget->getStatistics().inFlight);
+    copiedCredit.reset();
+    EXPECT_EQ(0, budget->getStatistics().inFlight);
+    EXPECT_EQ(1, budget->getStatistics().maxInFlight);
+}
+
+TEST(InFlightBudgetTest, pausesWhenExhaustedAndResumesAtHalfOfLimit)
+{
+    constexpr std::size_t limit = 4;
+    auto budget = std::make_shared<InFlightBudget>(limit, "test");
+    std::size_t resumed = 0;
+    auto resume = [&resumed]() { ++resumed; };
+
+    std::vector<InFlightBudget::Credit> credits;
+    for (std::size_t i = 0; i < limit - 1; ++i) {
+        credits.push_back(budget->acquire());
+        EXPECT_FALSE(budget->pauseIfExhausted(resume));
+    }
+    credits.push_back(budget->acquire());
+    EXPECT_TRUE(budget->pauseIfExhausted(resume));
+
+    credits.pop_back();
+    EXPECT_EQ(0, resumed);
+    credits.pop_back();
+    EXPECT_EQ(1, resumed);
+    credits.clear();
+    EXPECT_EQ(1, resumed) << "resume must be invoked only once per pause";
+
+    const InFlightBudget::Statistics statistics = budget->getStatistics();
+    EXPECT_EQ(0, statistics.inFlight);
+    EXPECT_EQ(limit, statistics.maxInFlight);
+    EXPECT_EQ(1, statistics.pauses);
+}
+
+TEST(InFlightBudgetTest, creditMayOutliveBudgetOwner)
+{
+    auto budget = std::make_shared<InFlightBudget>(1, "test");
+    std::weak_ptr<InFlightBudget> budgetWeakPtr = budget;
+    InFlightBudget::Credit credit = budget->acquire();
+    budget.reset();
+    EXPECT_FALSE(budgetWeakPtr.expired());
+    credit.reset();
+    EXPECT_TRUE(budgetWeakPtr.expired());
+}
+
+TEST(InFlightBudgetTest, zeroLimitNeverPauses)
+{
+    auto budget = std::make_shared<InFlightBudget>(0, "test");
+    std::vector<InFlightBudget::Credit> credits;
+    for (std::size_t i = 0; i < 100; ++i) {
+        credits.push_back(budget->acquire());
+        EXPECT_FALSE(budget->pauseIfExhausted([]() { FAIL() << "resume not expected"; }));
+    }
+    EXPECT_EQ(100, budget->getStatistics().inFlight);
+}
@@ -27,6 +27,7 @@
 #include <boost/optional.hpp>
 
 #include "joynr/LCDUtil.h"
+#include "joynr/ParsedAddressCache.h"
 #include "joynr/serializer/Serializer.h"
 #include "joynr/system/RoutingTypes/MqttAddress.h"
 #include "joynr/types/DiscoveryEntry.h"
@@ -336,7 +337,8 @@ TEST(LCDUtilTest, test_replaceGbidWithEmptyString)
     discoveryEntryVector.push_back(firstEntry);
     discoveryEntryVector.push_back(otherEntry);
 
-    LCDUtil::replaceGbidWithEmptyString(discoveryEntryVector);
+    ParsedAddressCache addressCache;
+    LCDUtil::replaceGbidWithEmptyString(discoveryEntryVector, addressCache);
 
     for (auto entry : discoveryEntryVector) {
         const std::string& serializedAddress = entry.getAddress();
@@ -17,6 +17,8 @@
  * #L%
  */
 
+#include <thread>
+
 #include "tests/utils/Gtest.h"
 
 #include "tests/JoynrTest.h"
@@ -961,6 +963,118 @@ TEST_F(LocalDomainAccessStoreTest, containsOnlyWildcardOperations)
             _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1));
 }
 
+TEST_F(LocalDomainAccessStoreTest, snapshotIsNotChangedByUpdates)
+{
+    _localDomainAccessStore.updateMasterAccessControlEntry(_expectedMasterAccessControlEntry);
+    std::shared_ptr<const access_control::AccessControlSnapshot> snapshot =
+            _localDomainAccessStore.getAccessControlSnapshot();
+
+    EXPECT_TRUE(_localDomainAccessStore.removeMasterAccessControlEntry(
+            _expectedMasterAccessControlEntry.getUid(),
+            _expectedMasterAccessControlEntry.getDomain(),
+            _expectedMasterAccessControlEntry.getInterfaceName(),
+            _expectedMasterAccessControlEntry.getOperation()));
+
+    // a reader keeps a consistent view while the store is changed
+    const MasterAccessControlEntry* entry =
+            snapshot->getMasterAccessControlEntry(_TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(_expectedMasterAccessControlEntry, *entry);
+
+    EXPECT_NE(snapshot, _localDomainAccessStore.getAccessControlSnapshot());
+    EXPECT_EQ(nullptr,
+              _localDomainAccessStore.getAccessControlSnapshot()->getMasterAccessControlEntry(
+                      _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1));
+}
+
+TEST_F(LocalDomainAccessStoreTest, snapshotIsRecompiledOnceAfterSeveralUpdates)
+{
+    const std::shared_ptr<const access_control::AccessControlSnapshot> emptySnapshot =
+            _localDomainAccessStore.getAccessControlSnapshot();
+    EXPECT_EQ(emptySnapshot, _localDomainAccessStore.getAccessControlSnapshot());
+
+    _localDomainAccessStore.updateMasterAccessControlEntry(_expectedMasterAccessControlEntry);
+    _localDomainAccessStore.updateOwnerAccessControlEntry(_expectedOwnerAccessControlEntry);
+    const std::shared_ptr<const access_control::AccessControlSnapshot> snapshot =
+            _localDomainAccessStore.getAccessControlSnapshot();
+
+    EXPECT_NE(emptySnapshot, snapshot);
+    EXPECT_EQ(snapshot, _localDomainAccessStore.getAccessControlSnapshot());
+    EXPECT_NE(nullptr,
+              snapshot->getMasterAccessControlEntry(_TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1));
+    EXPECT_NE(nullptr,
+              snapshot->getOwnerAccessControlEntry(_TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1));
+}
+
+TEST_F(LocalDomainAccessStoreTest, snapshotCachedByThreadReflectsUpdateFromOtherThread)
+{
+    EXPECT_EQ(nullptr,
+              _localDomainAccessStore.getAccessControlSnapshot()->getMasterAccessControlEntry(
+                      _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1));
+
+    std::thread updater([this]() {
+        _localDomainAccessStore.updateMasterAccessControlEntry(_expectedMasterAccessControlEntry);
+    });
+    updater.join();
+
+    const MasterAccessControlEntry* entry =
+            _localDomainAccessStore.getAccessControlSnapshot()->getMasterAccessControlEntry(
+                    _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(_expectedMasterAccessControlEntry, *entry);
+}
+
+TEST_F(LocalDomainAccessStoreTest, removedWildcardEntryDoesNotMatch)
+{
+    MasterAccessControlEntry wildcardDomainAce(_expectedMasterAccessControlEntry);
+    wildcardDomainAce.setDomain("domain*");
+    _localDomainAccessStore.updateMasterAccessControlEntry(wildcardDomainAce);
+    EXPECT_TRUE(_localDomainAccessStore.getMasterAccessControlEntry(
+            _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1, _TEST_OPERATION1));
+
+    EXPECT_TRUE(_localDomainAccessStore.removeMasterAccessControlEntry(
+            wildcardDomainAce.getUid(),
+            wildcardDomainAce.getDomain(),
+            wildcardDomainAce.getInterfaceName(),
+            wildcardDomainAce.getOperation()));
+    EXPECT_FALSE(_localDomainAccessStore.getMasterAccessControlEntry(
+            _TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1, _TEST_OPERATION1));
+}
+
+TEST_F(LocalDomainAccessStoreTest, snapshotPrefersClosestWildcardEntry)
+{
+    MasterAccessControlEntry ace(_expectedMasterAccessControlEntry);
+    const std::vector<std::pair<std::string, std::string>> domainsAndInterfaces = {
+            {"*", "*"}, {"dom*", "*"}, {"domain*", "*"}, {"domain*", "interface*"}};
+    for (const auto& domainAndInterface : domainsAndInterfaces) {
+        ace.setDomain(domainAndInterface.first);
+        ace.setInterfaceName(domainAndInterface.second);
+        _localDomainAccessStore.updateMasterAccessControlEntry(ace);
+    }
+    auto snapshot = _localDomainAccessStore.getAccessControlSnapshot();
+
+    const MasterAccessControlEntry* entry =
+            snapshot->getMasterAccessControlEntry(_TEST_USER1, _TEST_DOMAIN1, _TEST_INTERFACE1);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ("domain*", entry->getDomain());
+    EXPECT_EQ("interface*", entry->getInterfaceName());
+
+    entry = snapshot->getMasterAccessControlEntry(_TEST_USER1, _TEST_DOMAIN1, "other");
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ("domain*", entry->getDomain());
+    EXPECT_EQ("*", entry->getInterfaceName());
+
+    entry = snapshot->getMasterAccessControlEntry(_TEST_USER1, "dom", "other");
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ("dom*", entry->getDomain());
+
+    entry = snapshot->getMasterAccessControlEntry(_TEST_USER1, "other", "other");
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ("*", entry->getDomain());
+
+    EXPECT_EQ(nullptr, snapshot->getMasterAccessControlEntry(_TEST_USER2, "other", "other"));
+}
+
 /*
  * The test only works with MasterAccessControlEntry.
  * It could be extended to include all other types but it mainly focuses on the correctness
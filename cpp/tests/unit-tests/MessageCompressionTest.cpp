@@ -0,0 +1,178 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/ICompressionCodec.h"
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/MessageCompression.h"
+#include "joynr/MessagingSettings.h"
+#include "joynr/MutableMessage.h"
+#include "joynr/Settings.h"
+
+using namespace joynr;
+
+namespace
+{
+
+// reverses the body, enough to tell compressed from uncompressed payloads
+class ReversingCodec : public ICompressionCodec
+{
+public:
+    explicit ReversingCodec(const std::string& id) : _id(id)
+    {
+    }
+
+    const std::string& getId() const override
+    {
+        return _id;
+    }
+
+    smrf::ByteVector compress(const smrf::ByteArrayView& data) const override
+    {
+        return reverse(data);
+    }
+
+    smrf::ByteVector decompress(const smrf::ByteArrayView& data) const override
+    {
+        return reverse(data);
+    }
+
+private:
+    static smrf::ByteVector reverse(const smrf::ByteArrayView& data)
+    {
+        return smrf::ByteVector(std::reverse_iterator<const smrf::Byte*>(data.data() + data.size()),
+                                std::reverse_iterator<const smrf::Byte*>(data.data()));
+    }
+
+    std::string _id;
+};
+
+} // namespace
+
+class MessageCompressionTest : public ::testing::Test
+{
+public:
+    MessageCompressionTest() : _compression(MessageCompression::instance())
+    {
+        _compression.reset();
+        _compression.registerCodec(std::make_shared<ReversingCodec>("reverse"));
+    }
+
+    ~MessageCompressionTest() override
+    {
+        _compression.reset();
+    }
+
+protected:
+    std::unique_ptr<ImmutableMessage> createImmutableMessage(const std::string& codec)
+    {
+        MutableMessage message;
+        message.setPayload("payload");
+        message.setCompress(true);
+        message.setCompressionCodec(codec);
+        return message.getImmutableMessage();
+    }
+
+    static std::string getBody(const ImmutableMessage& message)
+    {
+        smrf::ByteArrayView body = message.getUnencryptedBody();
+        return std::string(body.data(), body.data() + body.size());
+    }
+
+    MessageCompression& _compression;
+};
+
+TEST_F(MessageCompressionTest, selectCodec)
+{
+    EXPECT_EQ(MessageCompression::GZIP(), _compression.selectCodec("", 10));
+    EXPECT_EQ(MessageCompression::GZIP(), _compression.selectCodec(MessageCompression::GZIP(), 10));
+    EXPECT_EQ("reverse", _compression.selectCodec("reverse", 10));
+    EXPECT_EQ(MessageCompression::GZIP(), _compression.selectCodec("unknown", 10));
+
+    _compression.setDefaultCodec("reverse");
+    EXPECT_EQ("reverse", _compression.selectCodec("", 10));
+    EXPECT_EQ("reverse", _compression.selectCodec("unknown", 10));
+
+    _compression.setDefaultCodec("unknown");
+    EXPECT_EQ(MessageCompression::GZIP(), _compression.selectCodec("", 10));
+}
+
+TEST_F(MessageCompressionTest, smallBodiesAreNotCompressed)
+{
+    _compression.setMinimumSize(8);
+    EXPECT_EQ("", _compression.selectCodec("reverse", 7));
+    EXPECT_EQ("reverse", _compression.selectCodec("reverse", 8));
+
+    std::unique_ptr<ImmutableMessage> message = createImmutableMessage("reverse");
+    EXPECT_FALSE(message->isCompressed());
+    EXPECT_EQ("", message->getCompressionCodec());
+    EXPECT_EQ("payload", getBody(*message));
+}
+
+TEST_F(MessageCompressionTest, gzipUsesSmrfCompression)
+{
+    std::unique_ptr<ImmutableMessage> message = createImmutableMessage(MessageCompression::GZIP());
+    EXPECT_TRUE(message->isCompressed());
+    EXPECT_EQ(MessageCompression::GZIP(), message->getCompressionCodec());
+    EXPECT_EQ(0, message->getHeaders().count(Message::HEADER_COMPRESSION_CODEC()));
+    EXPECT_EQ("payload", getBody(*message));
+}
+
+TEST_F(MessageCompressionTest, registeredCodecIsSignalledByHeader)
+{
+    std::unique_ptr<ImmutableMessage> message = createImmutableMessage("reverse");
+    EXPECT_TRUE(message->isCompressed());
+    EXPECT_EQ("reverse", message->getCompressionCodec());
+    EXPECT_EQ("reverse", message->getHeaders().at(Message::HEADER_COMPRESSION_CODEC()));
+    const smrf::ByteVector& serializedMessage = message->getSerializedMessage();
+    const std::string serialized(serializedMessage.cbegin(), serializedMessage.cend());
+    EXPECT_NE(std::string::npos, serialized.find("daolyap"));
+    EXPECT_EQ("payload", getBody(*message));
+}
+
+TEST_F(MessageCompressionTest, unknownCodecOfReceivedMessageThrows)
+{
+    std::unique_ptr<ImmutableMessage> message = createImmutableMessage("reverse");
+    _compression.reset();
+    EXPECT_THROW(message->getUnencryptedBody(), std::invalid_argument);
+}
+
+TEST_F(MessageCompressionTest, loadSettings)
+{
+    Settings settings;
+    MessagingSettings messagingSettings(settings);
+    messagingSettings.setCompressionCodec("reverse");
+    messagingSettings.setCompressionMinSize(100);
+    messagingSettings.setCompressionInterfaceCodecs(
+            " tests/Test = reverse , invalid, =gzip, other/Interface=gzip");
+
+    _compression.load(messagingSettings);
+
+    EXPECT_EQ("", _compression.selectCodec("", 99));
+    EXPECT_EQ("reverse", _compression.selectCodec("", 100));
+    EXPECT_EQ("reverse", _compression.getInterfaceCodec("tests/Test"));
+    EXPECT_EQ(MessageCompression::GZIP(), _compression.getInterfaceCodec("other/Interface"));
+    EXPECT_EQ("", _compression.getInterfaceCodec("invalid"));
+}
@@ -169,6 +169,22 @@ TEST_F(MessageQueueTest, queueDequeueMultipleMessagesForOneParticipant)
     EXPECT_EQ(_messageQueue.getQueueLength(), 0);
 }
 
+TEST_F(MessageQueueTest, containsMessagesFor)
+{
+    MutableMessage mutableMessage;
+    const std::string participantId("TEST");
+    mutableMessage.setRecipient(participantId);
+    mutableMessage.setExpiryDate(_expiryDate);
+    EXPECT_FALSE(_messageQueue.containsMessagesFor(participantId));
+
+    _messageQueue.queueMessage(participantId, mutableMessage.getImmutableMessage());
+    EXPECT_TRUE(_messageQueue.containsMessagesFor(participantId));
+    EXPECT_FALSE(_messageQueue.containsMessagesFor("OTHER"));
+
+    _messageQueue.getNextMessageFor(participantId);
+    EXPECT_FALSE(_messageQueue.containsMessagesFor(participantId));
+}
+
 TEST_F(MessageQueueTest, dequeueInvalidParticipantId)
 {
     EXPECT_EQ(_messageQueue.getNextMessageFor("TEST"), nullptr);
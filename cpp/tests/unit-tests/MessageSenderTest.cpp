@@ -41,6 +41,7 @@
 #include "joynr/SubscriptionPublication.h"
 #include "joynr/SubscriptionReply.h"
 #include "joynr/SubscriptionRequest.h"
+#include "joynr/exceptions/JoynrException.h"
 
 #include "tests/JoynrTest.h"
 #include "tests/mock/MockDispatcher.h"
@@ -170,6 +171,46 @@ TEST_F(MessageSenderTest, sendReply_normal)
     messageSender.sendReply(senderID, receiverID, qosSettings, {}, reply);
 }
 
+TEST_F(MessageSenderTest, sendBatchRequest_normal)
+{
+    std::vector<Request> requests(2);
+    requests[0].setMethodName("methodName");
+    requests[0].setParams(42);
+    requests[0].setParamDatatypes({"java.lang.Integer"});
+    requests[1].setMethodName("otherMethodName");
+    std::vector<std::shared_ptr<IReplyCaller>> callBacks(2);
+
+    MutableMessage mutableMessage = messageFactory.createBatchRequest(
+            senderID, receiverID, qosSettings, requests, isLocalMessage);
+
+    expectRoutedMessage(Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST(), mutableMessage.getPayload());
+    EXPECT_CALL(*mockDispatcher, addReplyCaller(Eq(requests[0].getRequestReplyId()), _, _));
+    EXPECT_CALL(*mockDispatcher, addReplyCaller(Eq(requests[1].getRequestReplyId()), _, _));
+
+    MessageSender messageSender(mockMessageRouter, nullptr);
+    messageSender.registerDispatcher(mockDispatcher);
+    messageSender.sendBatchRequest(
+            senderID, receiverID, qosSettings, requests, callBacks, isLocalMessage);
+}
+
+TEST_F(MessageSenderTest, sendBatchReply_normal)
+{
+    std::vector<Reply> replies(2);
+    replies[0].setRequestReplyId(util::createUuid());
+    replies[0].setResponse(std::string("response"));
+    replies[1].setRequestReplyId(util::createUuid());
+    replies[1].setError(std::make_shared<exceptions::ProviderRuntimeException>("error"));
+
+    MutableMessage mutableMessage =
+            messageFactory.createBatchReply(senderID, receiverID, qosSettings, {}, replies);
+
+    expectRoutedMessage(Message::VALUE_MESSAGE_TYPE_BATCH_REPLY(), mutableMessage.getPayload());
+
+    MessageSender messageSender(mockMessageRouter, nullptr);
+    messageSender.registerDispatcher(mockDispatcher);
+    messageSender.sendBatchReply(senderID, receiverID, qosSettings, {}, replies);
+}
+
 TEST_F(MessageSenderTest, sendSubscriptionRequest_normal)
 {
     std::int64_t period = 2000;
@@ -17,6 +17,10 @@
  * #L%
  */
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "tests/utils/Gtest.h"
 #include <boost/optional/optional_io.hpp>
 
@@ -149,3 +153,37 @@ TEST_F(ImmutableMessageTest, isCompressed)
     auto immutableMessage = _mutableMessage.getImmutableMessage();
     EXPECT_EQ(immutableMessage->isCompressed(), expectedValue);
 }
+
+TEST_F(ImmutableMessageTest, decodeMessageType)
+{
+    const std::vector<std::pair<std::string, MessageType>> types = {
+            {Message::VALUE_MESSAGE_TYPE_ONE_WAY(), MessageType::ONE_WAY},
+            {Message::VALUE_MESSAGE_TYPE_REPLY(), MessageType::REPLY},
+            {Message::VALUE_MESSAGE_TYPE_REQUEST(), MessageType::REQUEST},
+            {Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST(), MessageType::BATCH_REQUEST},
+            {Message::VALUE_MESSAGE_TYPE_BATCH_REPLY(), MessageType::BATCH_REPLY},
+            {Message::VALUE_MESSAGE_TYPE_PUBLICATION(), MessageType::PUBLICATION},
+            {Message::VALUE_MESSAGE_TYPE_MULTICAST(), MessageType::MULTICAST},
+            {Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY(), MessageType::SUBSCRIPTION_REPLY},
+            {Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST(), MessageType::SUBSCRIPTION_REQUEST},
+            {Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST(),
+             MessageType::MULTICAST_SUBSCRIPTION_REQUEST},
+            {Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST(),
+             MessageType::BROADCAST_SUBSCRIPTION_REQUEST},
+            {Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP(), MessageType::SUBSCRIPTION_STOP}};
+
+    for (const auto& type : types) {
+        EXPECT_EQ(type.second, Message::decodeMessageType(type.first)) << type.first;
+
+        _mutableMessage.setType(type.first);
+        auto immutableMessage = _mutableMessage.getImmutableMessage();
+        EXPECT_EQ(type.first, immutableMessage->getType());
+        EXPECT_EQ(type.second, immutableMessage->getMessageType()) << type.first;
+    }
+
+    EXPECT_EQ(MessageType::UNKNOWN, Message::decodeMessageType(""));
+    EXPECT_EQ(MessageType::UNKNOWN, Message::decodeMessageType("x"));
+    EXPECT_EQ(MessageType::UNKNOWN, Message::decodeMessageType("rx"));
+    EXPECT_EQ(MessageType::UNKNOWN, Message::decodeMessageType("rqx"));
+    EXPECT_EQ(MessageType::UNKNOWN, Message::decodeMessageType("request"));
+}
@@ -86,6 +86,10 @@ TEST_F(MessagingSettingsTest, intializedWithDefaultSettings)
               MessagingSettings::DEFAULT_ROUTING_TABLE_CLEANUP_INTERVAL_MS());
     EXPECT_EQ(messagingSettings.getDiscardUnroutableRepliesAndPublications(),
               MessagingSettings::DEFAULT_DISCARD_UNROUTABLE_REPLIES_AND_PUBLICATIONS());
+    EXPECT_EQ(messagingSettings.getSubscriptionSchedulerThreads(),
+              MessagingSettings::DEFAULT_SUBSCRIPTION_SCHEDULER_THREADS());
+    EXPECT_EQ(messagingSettings.getIoServiceThreads(),
+              MessagingSettings::DEFAULT_IO_SERVICE_THREADS());
 }
 
 TEST_F(MessagingSettingsTest, overrideDefaultSettings)
@@ -0,0 +1,129 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Metrics.h"
+
+using namespace joynr;
+using std::chrono::microseconds;
+
+class MetricsTest : public ::testing::Test
+{
+public:
+    MetricsTest() : _registry(MetricsRegistry::instance())
+    {
+        _registry.reset();
+    }
+
+    ~MetricsTest() override
+    {
+        _registry.reset();
+    }
+
+protected:
+    MetricsRegistry& _registry;
+};
+
+TEST_F(MetricsTest, bucketsCoverAllValuesWithBoundedRelativeError)
+{
+    std::size_t previousIndex = 0;
+    for (std::uint64_t value = 0; value < 100000; ++value) {
+        const std::size_t index = LatencyHistogram::bucketIndex(value);
+        EXPECT_GE(index, previousIndex);
+        const std::uint64_t upperBound = LatencyHistogram::bucketUpperBound(index);
+        ASSERT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / 8);
+        previousIndex = index;
+    }
+}
+
+TEST_F(MetricsTest, histogramReportsPercentiles)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(microseconds(0), histogram.getValueAtPercentile(50));
+
+    for (std::int64_t i = 1; i <= 1000; ++i) {
+        histogram.record(microseconds(i));
+    }
+    const LatencyHistogram::Snapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(1000u, snapshot.count);
+    EXPECT_EQ(microseconds(500500), snapshot.sum);
+    EXPECT_EQ(microseconds(1000), snapshot.max);
+    EXPECT_GE(snapshot.p50, microseconds(500));
+    EXPECT_LE(snapshot.p50, microseconds(500 + 500 / 8));
+    EXPECT_GE(snapshot.p99, microseconds(990));
+    EXPECT_LE(snapshot.p999, snapshot.max);
+    EXPECT_EQ(microseconds(1000), histogram.getValueAtPercentile(100));
+}
+
+TEST_F(MetricsTest, concurrentUpdatesAreNotLost)
+{
+    auto counter = _registry.getCounter("test_counter_total", "test counter");
+    auto histogram = _registry.getHistogram("test_latency_seconds", "test latency");
+    const int numberOfThreads = 4;
+    const int numberOfUpdates = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numberOfThreads; ++i) {
+        threads.emplace_back([&counter, &histogram]() {
+            for (int j = 0; j < numberOfUpdates; ++j) {
+                counter->increment();
+                histogram->record(microseconds(j));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(static_cast<std::uint64_t>(numberOfThreads * numberOfUpdates), counter->get());
+    EXPECT_EQ(static_cast<std::uint64_t>(numberOfThreads * numberOfUpdates),
+              histogram->getSnapshot().count);
+}
+
+TEST_F(MetricsTest, registryReturnsSameInstanceForSameNameAndLabels)
+{
+    auto mqttCounter = _registry.getCounter("test_total", "test", "transport=\"mqtt\"");
+    auto udsCounter = _registry.getCounter("test_total", "test", "transport=\"uds\"");
+    EXPECT_EQ(mqttCounter, _registry.getCounter("test_total", "test", "transport=\"mqtt\""));
+    EXPECT_NE(mqttCounter, udsCounter);
+    EXPECT_THROW(_registry.getGauge("test_total", "test"), std::invalid_argument);
+}
+
+TEST_F(MetricsTest, prometheusTextContainsAllMetrics)
+{
+    _registry.getCounter("test_messages_total", "messages", "transport=\"mqtt\"")->increment(3);
+    _registry.getGauge("test_queue_depth", "queue depth")->set(7);
+    _registry.getHistogram("test_route_seconds", "route latency")->record(microseconds(250));
+
+    const std::string text = _registry.toPrometheusText();
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_messages_total counter\n"));
+    EXPECT_NE(std::string::npos, text.find("test_messages_total{transport=\"mqtt\"} 3\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_queue_depth gauge\n"));
+    EXPECT_NE(std::string::npos, text.find("test_queue_depth 7\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_route_seconds summary\n"));
+    EXPECT_NE(std::string::npos, text.find("test_route_seconds{quantile=\"0.5\"} 0.000250\n"));
+    EXPECT_NE(std::string::npos, text.find("test_route_seconds_sum 0.000250\n"));
+    EXPECT_NE(std::string::npos, text.find("test_route_seconds_count 1\n"));
+}
@@ -18,6 +18,7 @@
  */
 
 #include <string>
+#include <unordered_set>
 
 #include "tests/utils/Gmock.h"
 #include "tests/utils/Gtest.h"
@@ -224,3 +225,18 @@ TEST_F(MulticastReceiverDirectoryTest, getMulticastIds)
     EXPECT_THAT(multicastIds, Contains(multicastId));
     EXPECT_THAT(multicastIds, Contains(multicastId2));
 }
+
+TEST_F(MulticastReceiverDirectoryTest, getAllReceiversDoesNotMatchMulticastIds)
+{
+    const std::string wildcardMulticastId("providerParticipantId/broadcast/+");
+    const std::string partitionMulticastId("providerParticipantId/broadcast/partition");
+    multicastReceiverDirectory.registerMulticastReceiver(wildcardMulticastId, receiverId);
+    multicastReceiverDirectory.registerMulticastReceiver(partitionMulticastId, "otherReceiverId");
+
+    const auto allReceivers = multicastReceiverDirectory.getAllReceivers();
+
+    ASSERT_EQ(2, allReceivers.size());
+    EXPECT_EQ(std::unordered_set<std::string>({receiverId}), allReceivers.at(wildcardMulticastId));
+    EXPECT_EQ(std::unordered_set<std::string>({"otherReceiverId"}),
+              allReceivers.at(partitionMulticastId));
+}
@@ -0,0 +1,90 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/ParsedAddressCache.h"
+#include "joynr/serializer/Serializer.h"
+#include "joynr/system/RoutingTypes/Address.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+#include "joynr/system/RoutingTypes/WebSocketAddress.h"
+
+using namespace joynr;
+
+TEST(ParsedAddressCacheTest, parseReturnsSharedAddressForSameSerializedAddress)
+{
+    ParsedAddressCache addressCache;
+    const system::RoutingTypes::MqttAddress mqttAddress("brokerUri", "topic");
+    const std::string serializedAddress = joynr::serializer::serializeToJson(mqttAddress);
+
+    auto address = addressCache.parse(serializedAddress);
+    auto parsedMqttAddress =
+            std::dynamic_pointer_cast<const system::RoutingTypes::MqttAddress>(address);
+    ASSERT_TRUE(parsedMqttAddress);
+    EXPECT_EQ(mqttAddress, *parsedMqttAddress);
+    EXPECT_EQ(address, addressCache.parse(serializedAddress));
+}
+
+TEST(ParsedAddressCacheTest, parseThrowsForInvalidAddress)
+{
+    ParsedAddressCache addressCache;
+    EXPECT_THROW(addressCache.parse("invalid"), std::invalid_argument);
+    EXPECT_THROW(addressCache.replaceGbidWithEmptyString("invalid"), std::invalid_argument);
+}
+
+TEST(ParsedAddressCacheTest, parseIsBoundedByCapacity)
+{
+    ParsedAddressCache addressCache(1);
+    const std::string firstAddress = joynr::serializer::serializeToJson(
+            system::RoutingTypes::MqttAddress("brokerUri", "topic1"));
+    const std::string secondAddress = joynr::serializer::serializeToJson(
+            system::RoutingTypes::MqttAddress("brokerUri", "topic2"));
+
+    auto first = addressCache.parse(firstAddress);
+    addressCache.parse(secondAddress);
+    auto reparsedFirst = addressCache.parse(firstAddress);
+    EXPECT_NE(first, reparsedFirst);
+    EXPECT_EQ(*first, *reparsedFirst);
+}
+
+TEST(ParsedAddressCacheTest, replaceGbidWithEmptyString)
+{
+    ParsedAddressCache addressCache;
+    const std::string serializedAddress = joynr::serializer::serializeToJson(
+            system::RoutingTypes::MqttAddress("brokerUri", "topic"));
+    const std::string expectedAddress =
+            joynr::serializer::serializeToJson(system::RoutingTypes::MqttAddress("", "topic"));
+
+    EXPECT_EQ(expectedAddress, addressCache.replaceGbidWithEmptyString(serializedAddress));
+    EXPECT_EQ(expectedAddress, addressCache.replaceGbidWithEmptyString(serializedAddress));
+    EXPECT_EQ(expectedAddress, addressCache.replaceGbidWithEmptyString(expectedAddress));
+}
+
+TEST(ParsedAddressCacheTest, replaceGbidWithEmptyStringKeepsOtherAddressTypes)
+{
+    ParsedAddressCache addressCache;
+    const std::string serializedAddress =
+            joynr::serializer::serializeToJson(system::RoutingTypes::WebSocketAddress(
+                    system::RoutingTypes::WebSocketProtocol::WS, "host", 4242, "path"));
+
+    EXPECT_EQ(serializedAddress, addressCache.replaceGbidWithEmptyString(serializedAddress));
+}
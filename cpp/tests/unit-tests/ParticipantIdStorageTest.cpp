@@ -20,15 +20,19 @@
 #pragma GCC diagnostic ignored "-Wunsafe-loop-optimizations"
 
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <vector>
 
 #include "tests/utils/Gtest.h"
 
+#include "joynr/AsyncFileWriter.h"
 #include "joynr/ParticipantIdStorage.h"
 #include "joynr/Util.h"
 
@@ -180,6 +184,62 @@ TEST(ParticipantIdStorageTest, writeIniFile)
     EXPECT_EQ(entriesToWrite, numberOfEntriesInFile);
 }
 
+TEST(ParticipantIdStorageTest, setProviderParticipantIdsPersistsAllEntries)
+{
+    std::remove(storageFile.c_str());
+    std::vector<ParticipantIdStorage::ProviderParticipantId> providerParticipantIds;
+    {
+        ParticipantIdStorage store(storageFile);
+        const int entriesToWrite = 100;
+        for (int i = 0; i < entriesToWrite; ++i) {
+            providerParticipantIds.push_back(ParticipantIdStorage::ProviderParticipantId{
+                    "domain" + std::to_string(i), "interfaceName", 1, joynr::util::createUuid()});
+        }
+        store.setProviderParticipantIds(providerParticipantIds);
+        // entries which are already stored are not written again
+        store.setProviderParticipantIds(providerParticipantIds);
+
+        std::ifstream fileStream(storageFile.c_str());
+        std::int32_t numberOfEntriesInFile = std::count(
+                std::istreambuf_iterator<char>(fileStream), std::istreambuf_iterator<char>(), '\n');
+        EXPECT_EQ(entriesToWrite, numberOfEntriesInFile);
+    }
+
+    ParticipantIdStorage store(storageFile);
+    for (const auto& providerParticipantId : providerParticipantIds) {
+        EXPECT_EQ(providerParticipantId.participantId,
+                  store.getProviderParticipantId(providerParticipantId.domain,
+                                                 providerParticipantId.interfaceName,
+                                                 providerParticipantId.majorVersion));
+    }
+}
+
+TEST(ParticipantIdStorageTest, asyncFileWriterPersistsEntriesOnFlush)
+{
+    std::remove(storageFile.c_str());
+    auto fileWriter = std::make_shared<AsyncFileWriter>(std::chrono::hours(1));
+    std::vector<std::string> participantIds;
+    {
+        ParticipantIdStorage store(storageFile, fileWriter);
+        const int entriesToWrite = 10;
+        for (int i = 0; i < entriesToWrite; ++i) {
+            participantIds.push_back(joynr::util::createUuid());
+            store.setProviderParticipantId(
+                    "domain" + std::to_string(i), "interfaceName", 1, participantIds.back());
+        }
+        // the coalescing window has not ended yet
+        EXPECT_FALSE(joynr::util::fileExists(storageFile));
+        fileWriter->flush();
+    }
+
+    ParticipantIdStorage store(storageFile);
+    for (std::size_t i = 0; i < participantIds.size(); ++i) {
+        EXPECT_EQ(participantIds[i],
+                  store.getProviderParticipantId(
+                          "domain" + std::to_string(i), "interfaceName", 1, "default"));
+    }
+}
+
 TEST(ParticipantIdStorageTest, deleteCorruptedFile)
 {
 
@@ -0,0 +1,157 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/PoolAllocator.h"
+
+using namespace joynr;
+
+namespace
+{
+
+struct Counted {
+    explicit Counted(int& instances) : _instances(instances)
+    {
+        ++_instances;
+    }
+
+    ~Counted()
+    {
+        --_instances;
+    }
+
+    int& _instances;
+    std::string _payload;
+};
+
+} // namespace
+
+TEST(PoolAllocatorTest, freedBlockIsReusedByAllocatingThread)
+{
+    PoolAllocator<std::uint64_t> allocator;
+    std::uint64_t* first = allocator.allocate(1);
+    allocator.deallocate(first, 1);
+    std::uint64_t* second = allocator.allocate(1);
+    EXPECT_EQ(first, second);
+    allocator.deallocate(second, 1);
+}
+
+TEST(PoolAllocatorTest, arraysAreNotPooled)
+{
+    std::vector<std::uint64_t, PoolAllocator<std::uint64_t>> values;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(999, values.back());
+}
+
+TEST(PoolAllocatorTest, makePooledSharedConstructsAndDestroysObject)
+{
+    int instances = 0;
+    {
+        std::shared_ptr<Counted> counted = util::makePooledShared<Counted>(instances);
+        counted->_payload = "payload";
+        EXPECT_EQ(1, instances);
+        std::weak_ptr<Counted> weakCounted = counted;
+        counted.reset();
+        EXPECT_EQ(0, instances);
+        EXPECT_TRUE(weakCounted.expired());
+    }
+    EXPECT_EQ(0, instances);
+}
+
+TEST(PoolAllocatorTest, objectCanBeFreedByOtherThread)
+{
+    int instances = 0;
+    std::vector<std::shared_ptr<Counted>> counted;
+    for (int i = 0; i < 1000; ++i) {
+        counted.push_back(util::makePooledShared<Counted>(instances));
+    }
+    EXPECT_EQ(1000, instances);
+
+    std::thread otherThread([&counted]() {
+        counted.clear();
+        // the freed blocks are returned to the allocating thread, this thread uses its own pool
+        int otherInstances = 0;
+        auto reused = util::makePooledShared<Counted>(otherInstances);
+        EXPECT_EQ(1, otherInstances);
+    });
+    otherThread.join();
+    EXPECT_EQ(0, instances);
+
+    auto allocatedAgain = util::makePooledShared<Counted>(instances);
+    EXPECT_EQ(1, instances);
+}
+
+TEST(PoolAllocatorTest, blockFreedByOtherThreadIsReusedByAllocatingThread)
+{
+    PoolAllocator<std::uint64_t> allocator;
+    std::uint64_t* first = allocator.allocate(1);
+    std::thread otherThread([&allocator, first]() { allocator.deallocate(first, 1); });
+    otherThread.join();
+    std::uint64_t* second = allocator.allocate(1);
+    EXPECT_EQ(first, second);
+    allocator.deallocate(second, 1);
+}
+
+TEST(PoolAllocatorTest, blocksReturnedByOtherThreadAreCachedUpToLimit)
+{
+    // a size no other test uses, so the pool of this thread starts empty
+    struct Payload {
+        char _data[232];
+    };
+    using Pool = detail::ThreadLocalBlockPool<sizeof(Payload)>;
+    PoolAllocator<Payload> allocator;
+    const std::size_t maxCachedBlocks = Pool::MAX_CACHED_BLOCKS;
+    const std::size_t numberOfBlocks = maxCachedBlocks + 100;
+    std::vector<Payload*> blocks;
+    for (std::size_t i = 0; i < numberOfBlocks; ++i) {
+        blocks.push_back(allocator.allocate(1));
+    }
+    std::thread otherThread([&allocator, &blocks]() {
+        for (Payload* block : blocks) {
+            allocator.deallocate(block, 1);
+        }
+    });
+    otherThread.join();
+    EXPECT_EQ(0u, Pool::numberOfCachedBlocks());
+
+    // taking over the returned blocks keeps at most MAX_CACHED_BLOCKS of them
+    Payload* reused = allocator.allocate(1);
+    EXPECT_EQ(maxCachedBlocks - 1, Pool::numberOfCachedBlocks());
+    allocator.deallocate(reused, 1);
+    EXPECT_EQ(maxCachedBlocks, Pool::numberOfCachedBlocks());
+}
+
+TEST(PoolAllocatorTest, blockCanBeFreedAfterAllocatingThreadHasExited)
+{
+    PoolAllocator<std::uint64_t> allocator;
+    std::uint64_t* block = nullptr;
+    std::thread allocatingThread([&allocator, &block]() { block = allocator.allocate(1); });
+    allocatingThread.join();
+    ASSERT_NE(nullptr, block);
+    *block = 42;
+    allocator.deallocate(block, 1);
+}
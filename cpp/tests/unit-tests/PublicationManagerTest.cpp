@@ -31,6 +31,7 @@
 #include "joynr/InterfaceRegistrar.h"
 #include "joynr/LibjoynrSettings.h"
 #include "joynr/Logger.h"
+#include "joynr/Metrics.h"
 #include "joynr/MulticastSubscriptionQos.h"
 #include "joynr/OnChangeSubscriptionQos.h"
 #include "joynr/PeriodicSubscriptionQos.h"
@@ -39,27 +40,33 @@
 #include "joynr/SubscriptionAttributeListener.h"
 #include "joynr/SubscriptionPublication.h"
 #include "joynr/SubscriptionReply.h"
+#include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/UnicastBroadcastListener.h"
 #include "joynr/exceptions/MethodInvocationException.h"
+#include "joynr/tests/TestLocationUpdateSelectiveBroadcastFilterParameters.h"
 #include "joynr/tests/testRequestInterpreter.h"
 #include "tests/utils/TimeUtils.h"
 
 #include "tests/JoynrTest.h"
+#include "tests/mock/MockLocationUpdatedSelectiveFilter.h"
 #include "tests/mock/MockMessageSender.h"
 #include "tests/mock/MockPublicationSender.h"
 #include "tests/mock/MockTestRequestCaller.h"
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::AllOf;
 using ::testing::AtLeast;
 using ::testing::AtMost;
 using ::testing::Between;
 using ::testing::ByRef;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::MakeMatcher;
 using ::testing::Matcher;
 using ::testing::MatcherInterface;
 using ::testing::MatchResultListener;
+using ::testing::Property;
 using ::testing::ReturnRef;
 
 using namespace joynr;
@@ -175,6 +182,54 @@ TEST_F(PublicationManagerTest, add_requestCallerIsCalledCorrectlyByPublisherRunn
     publicationManager->shutdown();
 }
 
+TEST_F(PublicationManagerTest, periodicSubscriptionsWithSamePeriodArePolledInOneTick)
+{
+    InterfaceRegistrar::instance().registerRequestInterpreter<joynr::tests::testRequestInterpreter>(
+            joynr::tests::testProvider::INTERFACE_NAME());
+
+    auto mockPublicationSender = std::make_shared<MockPublicationSender>();
+    auto requestCaller = std::make_shared<MockTestRequestCaller>(AtLeast(6));
+    EXPECT_CALL(*mockPublicationSender, sendSubscriptionPublicationMock(_, _, _, _))
+            .Times(AtLeast(6));
+
+    auto scheduler = std::make_shared<ThreadPoolDelayedScheduler>(
+            2, "PublicationManagerTest", _singleThreadedIOService->getIOService());
+    auto publicationManager = std::make_shared<PublicationManager>(scheduler, _messageSender);
+    std::shared_ptr<LatencyHistogram> tickLateness = MetricsRegistry::instance().getHistogram(
+            "joynr_publication_tick_lateness_seconds",
+            "Delay between the planned and the actual start of periodic publication ticks");
+    const std::uint64_t recordedTicksBefore = tickLateness->getSnapshot().count;
+
+    std::int64_t period_ms = 100;
+    std::int64_t validity_ms = 2000;
+    std::int64_t alertInterval_ms = 3000;
+    std::int64_t publicationTtl_ms = 2000;
+    auto qos = std::make_shared<PeriodicSubscriptionQos>(
+            validity_ms, publicationTtl_ms, period_ms, alertInterval_ms);
+
+    SubscriptionRequest subscriptionRequest1;
+    subscriptionRequest1.setSubscribeToName("Location");
+    subscriptionRequest1.setQos(qos);
+    SubscriptionRequest subscriptionRequest2;
+    subscriptionRequest2.setSubscribeToName("Location");
+    subscriptionRequest2.setQos(qos);
+    publicationManager->add(
+            "SenderId", "ReceiverId", requestCaller, subscriptionRequest1, mockPublicationSender);
+    publicationManager->add(
+            "SenderId", "ReceiverId", requestCaller, subscriptionRequest2, mockPublicationSender);
+    std::this_thread::sleep_for(std::chrono::milliseconds(550));
+
+    // a single tick polls both subscriptions
+    const PublicationManager::SchedulerMetrics metrics = publicationManager->getSchedulerMetrics();
+    EXPECT_GE(metrics.periodicTicks, 2u);
+    EXPECT_LE(metrics.periodicTicks, 6u);
+    EXPECT_GT(metrics.polledSubscriptions, metrics.periodicTicks);
+    // the lateness of every tick is exported
+    EXPECT_GE(tickLateness->getSnapshot().count - recordedTicksBefore, metrics.periodicTicks);
+
+    publicationManager->shutdown();
+}
+
 TEST_F(PublicationManagerTest, stop_publications)
 {
     auto mockPublicationSender = std::make_shared<MockPublicationSender>();
@@ -1087,6 +1142,72 @@ TEST_F(PublicationManagerTest, broadcast_add_withExistingSubscriptionId_testQos_
     publicationManager->shutdown();
 }
 
+TEST_F(PublicationManagerTest, selectiveBroadcast_filterChainRunsOncePerFilterParameters)
+{
+    auto mockPublicationSender = std::make_shared<MockPublicationSender>();
+    auto requestCaller = std::make_shared<MockTestRequestCaller>();
+    auto filter = std::make_shared<MockLocationUpdatedSelectiveFilter>();
+    const std::vector<std::shared_ptr<MockLocationUpdatedSelectiveFilter>> filters{filter};
+    const std::string broadcastName("locationUpdateSelective");
+    joynr::types::Localisation::GpsLocation broadcastValue;
+
+    EXPECT_CALL(*requestCaller, registerBroadcastListener(broadcastName, _)).Times(3);
+    EXPECT_CALL(*requestCaller, unregisterBroadcastListener(broadcastName, _)).Times(AtMost(3));
+
+    auto publicationManager = std::make_shared<PublicationManager>(
+            _singleThreadedIOService->getIOService(), _messageSender);
+
+    const std::int64_t now =
+            static_cast<std::int64_t>(joynr::TimeUtils::getCurrentMillisSinceEpoch());
+    std::vector<std::string> subscriptionIds;
+    for (const char* country : {"DE", "FR", "DE"}) {
+        tests::TestLocationUpdateSelectiveBroadcastFilterParameters filterParameters;
+        filterParameters.setFilterParameter("country", country);
+        auto qos = std::make_shared<OnChangeSubscriptionQos>();
+        qos->setExpiryDateMs(now + 5000);
+        BroadcastSubscriptionRequest subscriptionRequest;
+        subscriptionRequest.setSubscribeToName(broadcastName);
+        subscriptionRequest.setQos(qos);
+        subscriptionRequest.setFilterParameters(filterParameters);
+        subscriptionIds.push_back(subscriptionRequest.getSubscriptionId());
+        publicationManager->add("senderId",
+                                "receiverId",
+                                requestCaller,
+                                subscriptionRequest,
+                                mockPublicationSender);
+    }
+
+    // the filter chain runs once for DE and once for FR, only DE is forwarded
+    EXPECT_CALL(*filter, filter(Eq(broadcastValue), _))
+            .Times(2)
+            .WillRepeatedly(Invoke(
+                    [](const joynr::types::Localisation::GpsLocation&,
+                       const tests::TestLocationUpdateSelectiveBroadcastFilterParameters&
+                               filterParameters) {
+                        return filterParameters.getFilterParameter("country") == "DE";
+                    }));
+    EXPECT_CALL(*mockPublicationSender,
+                sendSubscriptionPublicationMock(
+                        _,
+                        _,
+                        _,
+                        AllOf(A<const SubscriptionPublication&>(),
+                              Property(&SubscriptionPublication::getSubscriptionId,
+                                       Eq(subscriptionIds[0])))));
+    EXPECT_CALL(*mockPublicationSender,
+                sendSubscriptionPublicationMock(
+                        _,
+                        _,
+                        _,
+                        AllOf(A<const SubscriptionPublication&>(),
+                              Property(&SubscriptionPublication::getSubscriptionId,
+                                       Eq(subscriptionIds[2])))));
+
+    publicationManager->selectiveBroadcastOccurred(subscriptionIds, filters, broadcastValue);
+
+    publicationManager->shutdown();
+}
+
 TEST_F(PublicationManagerTest, remove_onChangeSubscription)
 {
     // Register the request interpreter that calls the request caller
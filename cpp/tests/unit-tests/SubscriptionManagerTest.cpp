@@ -29,13 +29,17 @@
 #include "joynr/OnChangeSubscriptionQos.h"
 #include "joynr/PeriodicSubscriptionQos.h"
 #include "joynr/Runnable.h"
+#include "joynr/Semaphore.h"
 #include "joynr/SingleThreadedIOService.h"
 #include "joynr/SubscriptionManager.h"
 #include "joynr/SubscriptionRequest.h"
+#include "joynr/ThreadPoolDelayedScheduler.h"
 #include "joynr/UnicastSubscriptionCallback.h"
 #include "joynr/Util.h"
 
+#include "tests/JoynrTest.h"
 #include "tests/mock/MockDelayedScheduler.h"
+#include "tests/mock/MockRunnable.h"
 #include "tests/mock/MockSubscriptionListener.h"
 #include "tests/utils/TimeUtils.h"
 
@@ -44,6 +48,7 @@ using ::testing::A;
 using ::testing::AtLeast;
 using ::testing::AtMost;
 using ::testing::Between;
+using ::testing::NiceMock;
 
 MATCHER_P(publicationMissedException, subscriptionId, "")
 {
@@ -251,6 +256,24 @@ TEST_F(SubscriptionManagerTest, registerSubscription_withoutExpiryDate)
                                               subscriptionRequest);
 }
 
+TEST_F(SubscriptionManagerTest, sharedSchedulerIsNotShutDownBySubscriptionManager)
+{
+    auto scheduler = std::make_shared<ThreadPoolDelayedScheduler>(
+            1, "SubscriptionManagerTest", singleThreadedIOService->getIOService());
+    const bool isSchedulerOwner = false;
+    auto subscriptionManager =
+            std::make_shared<SubscriptionManager>(scheduler, nullptr, isSchedulerOwner);
+    subscriptionManager->shutdown();
+    subscriptionManager.reset();
+
+    Semaphore runnableExecuted(0);
+    auto runnable = std::make_shared<NiceMock<MockRunnable>>();
+    EXPECT_CALL(*runnable, run()).WillOnce(ReleaseSemaphore(&runnableExecuted));
+    scheduler->schedule(runnable, std::chrono::milliseconds(1));
+    EXPECT_TRUE(runnableExecuted.waitFor(std::chrono::seconds(1)));
+    scheduler->shutdown();
+}
+
 DelayedScheduler::RunnableHandle internalRunnableHandle = 1;
 
 DelayedScheduler::RunnableHandle runnableHandle()
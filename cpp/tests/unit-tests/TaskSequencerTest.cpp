@@ -28,6 +28,7 @@
 #include "tests/utils/Gtest.h"
 
 #include "joynr/Semaphore.h"
+#include "joynr/SingleThreadedIOService.h"
 #include "joynr/TaskSequencer.h"
 #include "joynr/TimePoint.h"
 
@@ -38,7 +39,8 @@ class TaskSequencerTest : public ::testing::Test
 {
 public:
     TaskSequencerTest()
-            : _creationCounter{0},
+            : _singleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+              _creationCounter{0},
               _executionCounter{0},
               _actualTimeoutDateMs(),
               _fulfillDelayedFuture(false)
@@ -51,6 +53,17 @@ protected:
         std::unique_lock<std::mutex> lock(_actualTimeoutDateMsMutex);
         _actualTimeoutDateMs.clear();
         _fulfillDelayedFuture = false;
+        _singleThreadedIOService->start();
+    }
+
+    void TearDown() override
+    {
+        _singleThreadedIOService->stop();
+    }
+
+    boost::asio::io_service& getIOService()
+    {
+        return _singleThreadedIOService->getIOService();
     }
 
     class TestFuture : public Future<std::uint64_t>
@@ -133,6 +146,7 @@ protected:
 
     void waitForTimeouts(size_t expectedNumberOfTimeouts, TimePoint expectedTimeout);
 
+    std::shared_ptr<SingleThreadedIOService> _singleThreadedIOService;
     std::uint64_t _creationCounter;
     std::uint64_t _executionCounter;
 
@@ -149,16 +163,15 @@ protected:
 
 TEST_F(TaskSequencerTest, CtorDtor)
 {
-    std::unique_ptr<TestTaskSequencer> instance(new TestTaskSequencer());
-    std::this_thread::yield(); // Wait for TestTaskSequencer orchestration thread
-    auto callDtor = std::async([&] { instance.reset(); });
+    std::unique_ptr<TestTaskSequencer> instance(new TestTaskSequencer(getIOService()));
+        auto callDtor = std::async([&] { instance.reset(); });
     ASSERT_EQ(callDtor.wait_for(std::chrono::seconds(10)), std::future_status::ready)
             << "DTOR hangs forever";
 }
 
 TEST_F(TaskSequencerTest, addSequence)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     static constexpr std::uint64_t numberOfTasks = 1000;
     std::vector<TaskState> expectedSequence;
     for (std::uint64_t i = 0; i < numberOfTasks; i++) {
@@ -172,7 +185,7 @@ TEST_F(TaskSequencerTest, addSequence)
 
 TEST_F(TaskSequencerTest, addConcurrency)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     static constexpr std::uint64_t numberOfTasks = 1000;
     std::vector<TestTaskSequencer::TaskWithExpiryDate> tasks;
     std::set<std::uint64_t> expectedExecutions;
@@ -196,9 +209,8 @@ TEST_F(TaskSequencerTest, addConcurrency)
 
 TEST_F(TaskSequencerTest, cancelBeforeDtor)
 {
-    std::unique_ptr<TestTaskSequencer> instance(new TestTaskSequencer());
-    std::this_thread::yield(); // Wait for TestTaskSequencer orchestration thread
-    instance->cancel();
+    std::unique_ptr<TestTaskSequencer> instance(new TestTaskSequencer(getIOService()));
+        instance->cancel();
     auto callDtor = std::async([&] { instance.reset(); });
     ASSERT_EQ(callDtor.wait_for(std::chrono::seconds(10)), std::future_status::ready)
             << "DTOR hangs forever after cancel";
@@ -206,7 +218,7 @@ TEST_F(TaskSequencerTest, cancelBeforeDtor)
 
 TEST_F(TaskSequencerTest, cancelOngoingTask)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     test.add(createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000)));
     test.add(createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(6000), false));
     test.add(createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(8000)));
@@ -219,7 +231,7 @@ TEST_F(TaskSequencerTest, cancelOngoingTask)
 
 TEST_F(TaskSequencerTest, cancelReleasesTaskMemory)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     auto sharedPromise = std::make_shared<std::uint64_t>(42);
     std::weak_ptr<std::uint64_t> refPromise(sharedPromise);
     test.add(createTestTaskWithExpiryDate(
@@ -236,7 +248,7 @@ TEST_F(TaskSequencerTest, cancelReleasesTaskMemory)
 
 TEST_F(TaskSequencerTest, cancelReleasesFutureMemory)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     auto sharedPromise = std::make_shared<std::uint64_t>(42);
     std::weak_ptr<std::uint64_t> refPromise(sharedPromise);
     test.add({[sharedPromise]() {
@@ -254,7 +266,7 @@ TEST_F(TaskSequencerTest, cancelReleasesFutureMemory)
 
 TEST_F(TaskSequencerTest, runRobustness)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     test.add({[]() { return std::shared_ptr<TestFuture>(); }, TimePoint::fromRelativeMs(5000),
               []() {}});
     test.add({[]() -> std::shared_ptr<TestFuture> { throw 42; }, TimePoint::fromRelativeMs(5000),
@@ -287,7 +299,7 @@ TEST_F(TaskSequencerTest, taskTimeoutCalledForQueuedTasksWhenOtherTaskIsRunning)
 {
     // This test checks that starting a long running task does not delay the cancellation
     // of expired tasks that are already queued
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     TimePoint expectedTimeoutDateMs = TimePoint::fromRelativeMs(1500);
     // add a task that blocks the sequencer until the other tasks are enqueued
     TestTaskSequencer::TaskWithExpiryDate task1 =
@@ -301,8 +313,7 @@ TEST_F(TaskSequencerTest, taskTimeoutCalledForQueuedTasksWhenOtherTaskIsRunning)
             createTestTaskWithExpiryDate(expectedTimeoutDateMs);
     test.add(task1);
     auto sequence = waitForTestFutureCreation(1, std::chrono::seconds{10});
-    // TaskSequencer is blocked now until the future of task1 is ready because it waits forever by
-    // default.
+    // TaskSequencer is blocked now until the future of task1 is ready
     test.add(task2);
     test.add(task3);
     test.add(task4);
@@ -328,7 +339,7 @@ TEST_F(TaskSequencerTest, taskTimeoutCalledForNewTasksWhenOtherTaskIsRunning)
     // This test checks that a long running task does not delay the cancellation
     // of expired tasks that are added to the sequencer when the long running task
     // is already running
-    TestTaskSequencer test(std::chrono::milliseconds(1000));
+    TestTaskSequencer test(getIOService());
     TimePoint expectedTimeoutDateMs = TimePoint::fromRelativeMs(1500);
     // add a task that won't be finished and blocks the following tasks
     TestTaskSequencer::TaskWithExpiryDate task1 =
@@ -356,7 +367,7 @@ TEST_F(TaskSequencerTest, taskTimeoutCalledForNewTasksWhenOtherTaskIsRunning)
 
 TEST_F(TaskSequencerTest, testTaskTimeoutNotCalledWithoutExpiredTasks)
 {
-    TestTaskSequencer test(std::chrono::milliseconds(1000));
+    TestTaskSequencer test(getIOService());
     TestTaskSequencer::TaskWithExpiryDate task1 =
             createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(500));
     // add a task that won't be finished and blocks the following tasks
@@ -388,7 +399,7 @@ TEST_F(TaskSequencerTest, testTaskTimeoutNotCalledWithoutExpiredTasks)
  */
 TEST_F(TaskSequencerTest, testTaskTimeoutCalledForTaskToBeExecutedNext)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     // add already expired task to the queue
     TestTaskSequencer::TaskWithExpiryDate task1 =
             createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(-10000));
@@ -413,26 +424,25 @@ TEST_F(TaskSequencerTest, testTaskTimeoutCalledForTaskToBeExecutedNext)
 
 TEST_F(TaskSequencerTest, testTaskTimeoutCalledForQueuedTasksBeforeOtherTaskIsStarted)
 {
-    TestTaskSequencer test;
+    TestTaskSequencer test(getIOService());
     // add a task that blocks the sequencer until the other tasks are enqueued
     TestTaskSequencer::TaskWithExpiryDate task1 =
             createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(2000), true, true);
     TestTaskSequencer::TaskWithExpiryDate task2 =
             createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(1000));
-    // add task that will be removed after the future of task1 is ready, during calculation of
-    // timeToWait for task2
+    // add task that is already expired when it is added and will be removed before the future of
+    // task1 is ready
     TestTaskSequencer::TaskWithExpiryDate task3 = createTestTaskWithExpiryDate(TimePoint::now());
     TestTaskSequencer::TaskWithExpiryDate task4 =
             createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(10000));
     test.add(task1);
     auto sequence = waitForTestFutureCreation(1, std::chrono::seconds{10});
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    // TaskSequencer is blocked now until the future of task1 is ready because it waits forever by
-    // default.
+    // TaskSequencer is blocked now until the future of task1 is ready
+    TimePoint expectedTimeoutDateMs = TimePoint::now();
     test.add(task2);
     test.add(task3);
     test.add(task4);
-    TimePoint expectedTimeoutDateMs = TimePoint::now();
     _fulfillDelayedFuture = true;
     sequence = waitForTestFutureCreation(3, std::chrono::seconds{10});
     EXPECT_EQ(3, sequence.size());
@@ -446,7 +456,7 @@ TEST_F(TaskSequencerTest, testStartedTaskDoesNotBlockTaskQueue)
 {
     // This test verifies that already started tasks do not prevent new tasks from being inserted
     // into the TaskQueue while running
-    auto test = std::make_shared<TestTaskSequencer>();
+    auto test = std::make_shared<TestTaskSequencer>(getIOService());
     // First semaphore to signal tot the test that the running task reached the blocking point
     auto semaphore1 = std::make_shared<joynr::Semaphore>(0);
     // Second semaphore to actually block the running task
@@ -481,3 +491,73 @@ TEST_F(TaskSequencerTest, testStartedTaskDoesNotBlockTaskQueue)
     semaphore2->notify();
     taskAddingThread.join();
 }
+
+TEST_F(TaskSequencerTest, tasksWithDifferentKeysRunConcurrently)
+{
+    TestTaskSequencer test(getIOService(), 2);
+    // futures of tasks with different keys are pending at the same time
+    TestTaskSequencer::TaskWithExpiryDate task1 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000), false);
+    task1._key = "participant1";
+    TestTaskSequencer::TaskWithExpiryDate task2 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000), false);
+    task2._key = "participant2";
+    // exceeds the maximum number of concurrent tasks
+    TestTaskSequencer::TaskWithExpiryDate task3 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000), false);
+    task3._key = "participant3";
+    test.add(task1);
+    test.add(task2);
+    test.add(task3);
+    auto sequence = waitForTestFutureCreation(3, std::chrono::seconds{1});
+    EXPECT_EQ(2, sequence.size());
+}
+
+TEST_F(TaskSequencerTest, tasksWithSameKeyRunInSequence)
+{
+    TestTaskSequencer test(getIOService(), 4);
+    TestTaskSequencer::TaskWithExpiryDate task1 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000), true, true);
+    task1._key = "participant1";
+    TestTaskSequencer::TaskWithExpiryDate task2 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000));
+    task2._key = "participant1";
+    // does not wait for the tasks of participant1
+    TestTaskSequencer::TaskWithExpiryDate task3 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000));
+    task3._key = "participant2";
+    test.add(task1);
+    test.add(task2);
+    test.add(task3);
+    auto sequence = waitForTestFutureCreation(3, std::chrono::seconds{1});
+    ASSERT_EQ(2, sequence.size());
+    EXPECT_EQ(0, sequence[0].creationNo);
+    EXPECT_EQ(2, sequence[1].creationNo);
+    _fulfillDelayedFuture = true;
+    sequence = waitForTestFutureCreation(3, std::chrono::seconds{10});
+    ASSERT_EQ(3, sequence.size());
+    EXPECT_EQ(1, sequence[2].creationNo);
+}
+
+TEST_F(TaskSequencerTest, taskWithoutKeyWaitsForAllPreviousTasks)
+{
+    TestTaskSequencer test(getIOService(), 4);
+    TestTaskSequencer::TaskWithExpiryDate task1 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000), true, true);
+    task1._key = "participant1";
+    TestTaskSequencer::TaskWithExpiryDate task2 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000));
+    // is not started before task2 has completed
+    TestTaskSequencer::TaskWithExpiryDate task3 =
+            createTestTaskWithExpiryDate(TimePoint::fromRelativeMs(5000));
+    task3._key = "participant2";
+    test.add(task1);
+    test.add(task2);
+    test.add(task3);
+    auto sequence = waitForTestFutureCreation(2, std::chrono::seconds{1});
+    EXPECT_EQ(1, sequence.size());
+    _fulfillDelayedFuture = true;
+    sequence = waitForTestFutureCreation(3, std::chrono::seconds{10});
+    std::vector<TaskState> expectedSequence{{0, 0}, {1, 1}, {2, 2}};
+    EXPECT_THAT(sequence, ::testing::ContainerEq(expectedSequence));
+}
@@ -19,15 +19,21 @@
 #include "tests/unit-tests/AbstractSyncAsyncTest.cpp"
 
 #include <string>
+#include <thread>
 
 #include "tests/utils/Gmock.h"
 
 #include "joynr/IReplyCaller.h"
+#include "joynr/ISubscriptionListener.h"
 #include "joynr/ISubscriptionCallback.h"
+#include "joynr/Message.h"
 #include "joynr/MulticastSubscriptionQos.h"
+#include "joynr/SubscriptionRequest.h"
 #include "joynr/tests/Itest.h"
 #include "joynr/tests/ItestConnector.h"
+#include "joynr/types/CustomParameter.h"
 #include "joynr/types/DiscoveryEntryWithMetaInfo.h"
+#include "joynr/types/ProviderQos.h"
 
 #include "tests/JoynrTest.h"
 #include "tests/mock/MockGpsFloatSubscriptionListener.h"
@@ -36,11 +42,14 @@
 using ::testing::_;
 using ::testing::A;
 using ::testing::AllOf;
+using ::testing::AnyNumber;
+using ::testing::DoAll;
 using ::testing::Eq;
 using ::testing::Invoke;
 using ::testing::NotNull;
 using ::testing::Property;
 using ::testing::Return;
+using ::testing::SaveArg;
 using ::testing::Unused;
 
 using namespace joynr;
@@ -99,12 +108,19 @@ public:
     float floatValue;
     Semaphore semaphore;
 
-    std::shared_ptr<tests::testJoynrMessagingConnector> createConnector()
+    std::shared_ptr<tests::testJoynrMessagingConnector> createConnector(
+            bool providerSupportsBatchRequests = true)
     {
         types::DiscoveryEntryWithMetaInfo discoveryEntry;
 
         discoveryEntry.setParticipantId(providerParticipantId);
         discoveryEntry.setIsLocal(false);
+        if (providerSupportsBatchRequests) {
+            types::ProviderQos providerQos;
+            providerQos.setCustomParameters(
+                    {types::CustomParameter(Message::CUSTOM_PARAMETER_BATCH_REQUESTS(), "true")});
+            discoveryEntry.setQos(providerQos);
+        }
 
         return std::make_shared<tests::testJoynrMessagingConnector>(mockMessageSender,
                                                                     mockSubscriptionManager,
@@ -349,3 +365,180 @@ TEST_F(TestJoynrMessagingConnectorTest, testDestructorRemoveRoutingEntry)
 
     connector.reset();
 }
+
+TEST_F(TestJoynrMessagingConnectorTest, batchedRequestsAreSentInOneMessage)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    std::vector<Request> requests;
+    std::vector<std::shared_ptr<IReplyCaller>> replyCallers;
+    EXPECT_CALL(*mockMessageSender, sendRequest(_, _, _, _, _, _)).Times(0);
+    EXPECT_CALL(*mockMessageSender,
+                sendBatchRequest(Eq(proxyParticipantId), Eq(providerParticipantId), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<3>(&requests), SaveArg<4>(&replyCallers)));
+
+    connector->startBatch();
+    auto future1 = connector->voidOperationAsync();
+    auto future2 = connector->methodWithNoInputParametersAsync();
+    auto future3 = connector->voidOperationAsync();
+    connector->sendBatch();
+
+    ASSERT_EQ(3, requests.size());
+    ASSERT_EQ(3, replyCallers.size());
+    EXPECT_EQ("voidOperation", requests[0].getMethodName());
+    EXPECT_EQ("methodWithNoInputParameters", requests[1].getMethodName());
+    EXPECT_EQ("voidOperation", requests[2].getMethodName());
+
+    // every reply completes the future of its own call
+    Reply reply;
+    reply.setRequestReplyId(requests[2].getRequestReplyId());
+    replyCallers[2]->execute(std::move(reply));
+    replyCallers[0]->returnError(std::make_shared<exceptions::ProviderRuntimeException>("error"));
+    EXPECT_EQ(StatusCodeEnum::ERROR, future1->getStatus());
+    EXPECT_EQ(StatusCodeEnum::IN_PROGRESS, future2->getStatus());
+    EXPECT_EQ(StatusCodeEnum::SUCCESS, future3->getStatus());
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, batchWithSingleRequestIsSentAsRequest)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+    setExpectationsForSendRequestCall("voidOperation").Times(1);
+
+    connector->startBatch();
+    auto future = connector->voidOperationAsync();
+    connector->sendBatch();
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, pendingBatchFailsWhenConnectorIsDestroyed)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    EXPECT_CALL(*mockMessageSender, sendRequest(_, _, _, _, _, _)).Times(0);
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+
+    connector->startBatch();
+    auto future = connector->voidOperationAsync();
+    connector.reset();
+
+    EXPECT_EQ(StatusCodeEnum::ERROR, future->getStatus());
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, noBatchIsStartedIfProviderDoesNotSupportBatchRequests)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector(false));
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+    setExpectationsForSendRequestCall("voidOperation").Times(2);
+
+    connector->startBatch();
+    auto future1 = connector->voidOperationAsync();
+    auto future2 = connector->voidOperationAsync();
+    connector->sendBatch();
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, syncCallIsNotAddedToBatch)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+    setExpectationsForSendRequestCall("methodWithNoInputParameters")
+            .WillOnce(Invoke(&callBackActions, &CallBackActions::executeCallBackIntResult));
+
+    connector->startBatch();
+    int result;
+    connector->methodWithNoInputParameters(result);
+    EXPECT_EQ(expectedInt, result);
+    connector->sendBatch();
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, callsOfOtherThreadsAreNotAddedToBatch)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+    setExpectationsForSendRequestCall("voidOperation").Times(1);
+
+    connector->startBatch();
+    std::thread otherThread([connector]() { connector->voidOperationAsync(); });
+    otherThread.join();
+    EXPECT_TRUE(testing::Mock::VerifyAndClearExpectations(mockMessageSender.get()));
+
+    // the batch of this thread is still pending and sent as single request
+    EXPECT_CALL(*mockMessageSender, sendBatchRequest(_, _, _, _, _, _)).Times(0);
+    setExpectationsForSendRequestCall("methodWithNoInputParameters").Times(1);
+    auto future = connector->methodWithNoInputParametersAsync();
+    connector->sendBatch();
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, getAttributeCached)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    std::shared_ptr<ISubscriptionListenerBase> listener;
+    SubscriptionRequest subscriptionRequest;
+    EXPECT_CALL(*mockSubscriptionManager, registerSubscription(_, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockSubscriptionManager, registerSubscription(Eq("location"), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&listener), SaveArg<4>(&subscriptionRequest)));
+    EXPECT_CALL(*mockMessageSender, sendSubscriptionRequest(_, _, _, _, _)).Times(AnyNumber());
+
+    connector->enableAttributeCache(60000);
+    auto locationListener = std::dynamic_pointer_cast<
+            ISubscriptionListener<types::Localisation::GpsLocation>>(listener);
+    ASSERT_TRUE(locationListener);
+    locationListener->onReceive(gpsLocation);
+
+    // the getter is answered by the cache
+    EXPECT_CALL(*mockMessageSender, sendRequest(_, _, _, _, _, _)).Times(0);
+    types::Localisation::GpsLocation location;
+    connector->getLocation(location);
+    EXPECT_EQ(gpsLocation, location);
+    EXPECT_TRUE(testing::Mock::VerifyAndClearExpectations(mockMessageSender.get()));
+
+    EXPECT_CALL(*mockSubscriptionManager, unregisterSubscription(_)).Times(AnyNumber());
+    EXPECT_CALL(*mockSubscriptionManager,
+                unregisterSubscription(Eq(subscriptionRequest.getSubscriptionId())));
+    EXPECT_CALL(*mockMessageSender, sendSubscriptionStop(_, _, _, _)).Times(AnyNumber());
+    connector->disableAttributeCache();
+
+    setExpectationsForSendRequestCall("getLocation");
+    connector->getLocationAsync();
+}
+
+TEST_F(TestJoynrMessagingConnectorTest, getAttributeAfterSetIsNotAnsweredWithPreviousValue)
+{
+    std::shared_ptr<tests::testJoynrMessagingConnector> connector(createConnector());
+    std::shared_ptr<ISubscriptionListenerBase> listener;
+    EXPECT_CALL(*mockSubscriptionManager, registerSubscription(_, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockSubscriptionManager, registerSubscription(Eq("location"), _, _, _, _))
+            .WillOnce(SaveArg<2>(&listener));
+    EXPECT_CALL(*mockMessageSender, sendSubscriptionRequest(_, _, _, _, _)).Times(AnyNumber());
+
+    connector->enableAttributeCache(60000);
+    auto locationListener = std::dynamic_pointer_cast<
+            ISubscriptionListener<types::Localisation::GpsLocation>>(listener);
+    ASSERT_TRUE(locationListener);
+    locationListener->onReceive(gpsLocation);
+
+    types::Localisation::GpsLocation newLocation(gpsLocation);
+    newLocation.setAltitude(gpsLocation.getAltitude() + 1.0);
+    std::shared_ptr<IReplyCaller> setterReplyCaller;
+    setExpectationsForSendRequestCall("setLocation").WillOnce(SaveArg<4>(&setterReplyCaller));
+    auto setterFuture = connector->setLocationAsync(newLocation);
+    ASSERT_TRUE(setterReplyCaller);
+
+    // a keep alive publication sent before the provider processed the setter
+    locationListener->onReceive(gpsLocation);
+    std::dynamic_pointer_cast<ReplyCaller<void>>(setterReplyCaller)->returnValue();
+    setterFuture->get();
+
+    // the getter is sent to the provider until the next publication arrives
+    setExpectationsForSendRequestCall("getLocation")
+            .WillOnce(Invoke(&callBackActions, &CallBackActions::executeCallBackGpsLocationResult));
+    types::Localisation::GpsLocation location;
+    connector->getLocation(location);
+    EXPECT_TRUE(testing::Mock::VerifyAndClearExpectations(mockMessageSender.get()));
+
+    locationListener->onReceive(newLocation);
+    EXPECT_CALL(*mockMessageSender, sendRequest(_, _, _, _, _, _)).Times(0);
+    connector->getLocation(location);
+    EXPECT_EQ(newLocation, location);
+
+    EXPECT_CALL(*mockSubscriptionManager, unregisterSubscription(_)).Times(AnyNumber());
+    EXPECT_CALL(*mockMessageSender, sendSubscriptionStop(_, _, _, _)).Times(AnyNumber());
+    connector->disableAttributeCache();
+}
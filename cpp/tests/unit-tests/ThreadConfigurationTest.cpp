@@ -0,0 +1,132 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Settings.h"
+#include "joynr/ThreadConfiguration.h"
+
+using namespace joynr;
+
+class ThreadConfigurationTest : public ::testing::Test
+{
+public:
+    ThreadConfigurationTest() : _configuration(ThreadConfiguration::instance())
+    {
+        _configuration.reset();
+    }
+
+    ~ThreadConfigurationTest() override
+    {
+        _configuration.reset();
+    }
+
+protected:
+    ThreadConfiguration& _configuration;
+};
+
+TEST_F(ThreadConfigurationTest, parseCpuList)
+{
+    EXPECT_EQ(std::vector<std::uint32_t>({0, 1, 2, 3, 6}),
+              ThreadConfiguration::parseCpuList("0-3,6"));
+    EXPECT_EQ(std::vector<std::uint32_t>({2, 4}), ThreadConfiguration::parseCpuList(" 4 , 2,4"));
+    EXPECT_TRUE(ThreadConfiguration::parseCpuList("").empty());
+    EXPECT_THROW(ThreadConfiguration::parseCpuList("a"), std::invalid_argument);
+    EXPECT_THROW(ThreadConfiguration::parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(ThreadConfiguration::parseCpuList("1x"), std::invalid_argument);
+    EXPECT_THROW(ThreadConfiguration::parseCpuList("0-100000"), std::invalid_argument);
+}
+
+TEST_F(ThreadConfigurationTest, threadNamesFitIntoFifteenCharacters)
+{
+    EXPECT_EQ("dispatcher-0", ThreadConfiguration::getThreadName("dispatcher", 0));
+    EXPECT_EQ("subscriptions-1", ThreadConfiguration::getThreadName("subscriptions", 1));
+    EXPECT_EQ("subscription-12", ThreadConfiguration::getThreadName("subscriptions", 12));
+    for (const std::string& pool : ThreadConfiguration::getPoolNames()) {
+        EXPECT_LE(ThreadConfiguration::getThreadName(pool, 0).size(), 15);
+    }
+}
+
+TEST_F(ThreadConfigurationTest, loadFromSettings)
+{
+    Settings settings;
+    settings.set("threads/dispatcher-threads", 4);
+    settings.set("threads/dispatcher-cpu-affinity", "2-3");
+    settings.set("threads/router-realtime-priority", 10);
+    // 0 disables realtime scheduling
+    settings.set("threads/arbitration-threads", 2);
+    settings.set("threads/arbitration-realtime-priority", 0);
+    // invalid values are ignored
+    settings.set("threads/mqtt-cpu-affinity", "x");
+    settings.set("threads/uds-realtime-priority", 100);
+    settings.set("threads/persistence-threads", 2);
+    settings.set("threads/persistence-realtime-priority", -1);
+    settings.set("threads/unknown-threads", 2);
+    _configuration.load(settings);
+
+    const ThreadConfiguration::PoolConfiguration dispatcher =
+            _configuration.getPoolConfiguration(ThreadConfiguration::DISPATCHER());
+    EXPECT_EQ(4, dispatcher.numberOfThreads);
+    EXPECT_EQ(std::vector<std::uint32_t>({2, 3}), dispatcher.cpus);
+    EXPECT_EQ(0, dispatcher.realtimePriority);
+    EXPECT_EQ(4, _configuration.getNumberOfThreads(ThreadConfiguration::DISPATCHER(), 1));
+
+    const ThreadConfiguration::PoolConfiguration router =
+            _configuration.getPoolConfiguration(ThreadConfiguration::MESSAGE_ROUTER());
+    EXPECT_EQ(0, router.numberOfThreads);
+    EXPECT_EQ(10, router.realtimePriority);
+    EXPECT_EQ(1, _configuration.getNumberOfThreads(ThreadConfiguration::MESSAGE_ROUTER(), 1));
+
+    const ThreadConfiguration::PoolConfiguration arbitration =
+            _configuration.getPoolConfiguration(ThreadConfiguration::ARBITRATION());
+    EXPECT_EQ(2, arbitration.numberOfThreads);
+    EXPECT_EQ(0, arbitration.realtimePriority);
+
+    EXPECT_TRUE(_configuration.getPoolConfiguration(ThreadConfiguration::MQTT()).cpus.empty());
+    EXPECT_EQ(0,
+              _configuration.getPoolConfiguration(ThreadConfiguration::UDS()).realtimePriority);
+    EXPECT_EQ(0,
+              _configuration.getPoolConfiguration(ThreadConfiguration::PERSISTENCE())
+                      .numberOfThreads);
+    EXPECT_EQ(3, _configuration.getNumberOfThreads("unknown", 3));
+}
+
+#if defined(__linux__)
+TEST_F(ThreadConfigurationTest, applyToCurrentThreadNamesThread)
+{
+    std::string threadName;
+    std::thread thread([&threadName]() {
+        ThreadConfiguration::instance().applyToCurrentThread(ThreadConfiguration::DISPATCHER(), 2);
+        char name[16] = {0};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        threadName = name;
+    });
+    thread.join();
+    EXPECT_EQ("dispatcher-2", threadName);
+}
+#endif
@@ -18,6 +18,7 @@
  */
 #include <limits>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "muesli/detail/IncrementalTypeList.h"
@@ -365,6 +366,38 @@ TEST(UtilTest, writeToFileException)
             util::writeToFile(folderName, "testString", std::ios::out, false), std::runtime_error);
     std::remove(folderName.c_str());
 }
+TEST(UtilTest, saveStringToFileAtomicallyFromSeveralThreads)
+{
+    const std::string directoryName = "test-saveStringToFileAtomically";
+    boost::filesystem::remove_all(directoryName);
+    boost::filesystem::create_directory(directoryName);
+    const std::string filename = directoryName + "/test.out";
+
+    std::vector<std::string> contents;
+    std::vector<std::thread> threads;
+    for (char c = 'a'; c < 'e'; ++c) {
+        contents.push_back(std::string(100000, c));
+    }
+    for (const std::string& content : contents) {
+        threads.emplace_back([&filename, &content]() {
+            for (int i = 0; i < 20; ++i) {
+                util::saveStringToFileAtomically(filename, content, false);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // the file has the complete content of one of the threads, no temporary file is left
+    EXPECT_TRUE(util::vectorContains(contents, util::loadStringFromFile(filename)));
+    const auto numberOfFiles =
+            std::distance(boost::filesystem::directory_iterator(directoryName),
+                          boost::filesystem::directory_iterator());
+    EXPECT_EQ(1, numberOfFiles);
+    boost::filesystem::remove_all(directoryName);
+}
+
 TEST(UtilTest, loadStringFromFileTest)
 {
     std::string filename = "test.out";
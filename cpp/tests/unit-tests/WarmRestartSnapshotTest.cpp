@@ -0,0 +1,115 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/TimePoint.h"
+#include "joynr/Util.h"
+#include "joynr/WarmRestartSnapshot.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+
+using namespace joynr;
+
+static const std::string snapshotFile("test-WarmRestartSnapshotTest.snapshot");
+
+class WarmRestartSnapshotTest : public ::testing::Test
+{
+public:
+    WarmRestartSnapshotTest()
+    {
+        std::remove(snapshotFile.c_str());
+    }
+
+    ~WarmRestartSnapshotTest() override
+    {
+        std::remove(snapshotFile.c_str());
+    }
+};
+
+TEST_F(WarmRestartSnapshotTest, saveAndLoad)
+{
+    WarmRestartSnapshot snapshot;
+
+    WarmRestartSnapshot::RoutingEntry routingEntry;
+    routingEntry.participantId = "participantId";
+    routingEntry.address =
+            std::make_shared<const system::RoutingTypes::MqttAddress>("brokerUri", "topic");
+    routingEntry.isGloballyVisible = true;
+    routingEntry.expiryDateMs = TimePoint::fromRelativeMs(60000).toMilliseconds();
+    snapshot.routingEntries.push_back(routingEntry);
+
+    WarmRestartSnapshot::MulticastReceivers multicastReceivers;
+    multicastReceivers.multicastId = "providerId/broadcast";
+    multicastReceivers.receiverIds = {"receiver1", "receiver2"};
+    snapshot.multicastReceivers.push_back(multicastReceivers);
+
+    WarmRestartSnapshot::GlobalCacheEntry globalCacheEntry;
+    globalCacheEntry.discoveryEntry.setParticipantId("globalParticipantId");
+    globalCacheEntry.discoveryEntry.setDomain("domain");
+    globalCacheEntry.gbids = {"gbid1", "gbid2"};
+    globalCacheEntry.cachedSinceMs = 42;
+    snapshot.globalCacheEntries.push_back(globalCacheEntry);
+
+    snapshot.saveToFile(snapshotFile);
+
+    boost::optional<WarmRestartSnapshot> loaded = WarmRestartSnapshot::loadFromFile(snapshotFile);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(snapshot.creationDateMs, loaded->creationDateMs);
+
+    ASSERT_EQ(1, loaded->routingEntries.size());
+    EXPECT_EQ(routingEntry.participantId, loaded->routingEntries[0].participantId);
+    ASSERT_TRUE(loaded->routingEntries[0].address);
+    EXPECT_EQ(*routingEntry.address, *loaded->routingEntries[0].address);
+    EXPECT_TRUE(loaded->routingEntries[0].isGloballyVisible);
+    EXPECT_EQ(routingEntry.expiryDateMs, loaded->routingEntries[0].expiryDateMs);
+
+    ASSERT_EQ(1, loaded->multicastReceivers.size());
+    EXPECT_EQ(multicastReceivers.multicastId, loaded->multicastReceivers[0].multicastId);
+    EXPECT_EQ(multicastReceivers.receiverIds, loaded->multicastReceivers[0].receiverIds);
+
+    ASSERT_EQ(1, loaded->globalCacheEntries.size());
+    EXPECT_EQ(globalCacheEntry.discoveryEntry, loaded->globalCacheEntries[0].discoveryEntry);
+    EXPECT_EQ(globalCacheEntry.gbids, loaded->globalCacheEntries[0].gbids);
+    EXPECT_EQ(globalCacheEntry.cachedSinceMs, loaded->globalCacheEntries[0].cachedSinceMs);
+}
+
+TEST_F(WarmRestartSnapshotTest, missingFileIsNotLoaded)
+{
+    EXPECT_FALSE(WarmRestartSnapshot::loadFromFile(snapshotFile));
+}
+
+TEST_F(WarmRestartSnapshotTest, invalidFileIsNotLoaded)
+{
+    util::saveStringToFile(snapshotFile, "no snapshot");
+    EXPECT_FALSE(WarmRestartSnapshot::loadFromFile(snapshotFile));
+}
+
+TEST_F(WarmRestartSnapshotTest, snapshotOfOtherVersionIsNotLoaded)
+{
+    WarmRestartSnapshot snapshot;
+    snapshot.version = WarmRestartSnapshot::VERSION() + 1;
+    snapshot.saveToFile(snapshotFile);
+
+    EXPECT_FALSE(WarmRestartSnapshot::loadFromFile(snapshotFile));
+}
@@ -16,7 +16,9 @@
  * limitations under the License.
  * #L%
  */
+#include <atomic>
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 #include "tests/utils/Gmock.h"
@@ -28,6 +30,7 @@
 #include "joynr/Message.h"
 #include "joynr/MessagingSettings.h"
 #include "joynr/Settings.h"
+#include "joynr/SingleThreadedIOService.h"
 #include "joynr/StatusCode.h"
 #include "libjoynrclustercontroller/capabilities-directory/GlobalCapabilitiesDirectoryClient.h"
 #include "tests/JoynrTest.h"
@@ -45,11 +48,12 @@ class GlobalCapabilitiesDirectoryClientTest : public TestWithParam<std::string>
 
 public:
     GlobalCapabilitiesDirectoryClientTest()
-            : settings(std::make_unique<Settings>()),
+            : singleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+              settings(std::make_unique<Settings>()),
               messagingSettings(*settings),
               clusterControllerSettings(*settings),
               taskSequencer(std::make_unique<TaskSequencer<void>>(
-                      std::chrono::milliseconds(MessagingQos().getTtl()))),
+                      singleThreadedIOService->getIOService())),
               mockJoynrRuntime(std::make_shared<MockJoynrRuntime>(*settings)),
               mockMessageSender(std::make_shared<MockMessageSender>()),
               joynrMessagingConnectorFactory(
@@ -61,7 +65,8 @@ public:
               mockLCDStore(std::make_shared<MockLocalCapabilitiesDirectoryStore>()),
               globalCapabilitiesDirectoryClient(std::make_shared<GlobalCapabilitiesDirectoryClient>(
                       clusterControllerSettings,
-                      std::move(taskSequencer))),
+                      std::move(taskSequencer),
+                      "gbid1")),
               capDomain("testDomain"),
               capInterface("testInterface"),
               capParticipantId("testParticipantId"),
@@ -103,6 +108,7 @@ public:
     {
     }
 
+    std::shared_ptr<SingleThreadedIOService> singleThreadedIOService;
     std::unique_ptr<Settings> settings;
     MessagingSettings messagingSettings;
     ClusterControllerSettings clusterControllerSettings;
@@ -116,6 +122,7 @@ public:
 
     void SetUp() override
     {
+        singleThreadedIOService->start();
         globalCapabilitiesDirectoryClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
     }
 
@@ -128,6 +135,7 @@ public:
              */
             globalCapabilitiesDirectoryClient->shutdown();
         }
+        singleThreadedIOService->stop();
     }
 
 protected:
@@ -175,7 +183,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
        testAddTaskTimeoutFunctionCallsOnRuntimeErrorCorrectly)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
 
@@ -185,7 +193,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
 
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
 
     bool onRuntimeErrorCalled = false;
     bool exceptionMessageFound = false;
@@ -211,7 +219,7 @@ void GlobalCapabilitiesDirectoryClientTest::testAddTaskExpiryDateHasCorrectValue
         const TimePoint& expectedTaskExpiryDate)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     globalDiscoveryEntry.setExpiryDateMs(expectedTaskExpiryDate.toMilliseconds());
@@ -221,7 +229,7 @@ void GlobalCapabilitiesDirectoryClientTest::testAddTaskExpiryDateHasCorrectValue
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     gcdClient->add(globalDiscoveryEntry,
                    awaitGlobalRegistration,
                    gbids,
@@ -262,7 +270,7 @@ joynr::TimePoint GlobalCapabilitiesDirectoryClientTest::getAddTaskExpiryDateForP
 {
     bool awaitGlobalRegistration = false;
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-        std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+        std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     globalDiscoveryEntry.setExpiryDateMs(expiryDateMs);
@@ -272,7 +280,7 @@ joynr::TimePoint GlobalCapabilitiesDirectoryClientTest::getAddTaskExpiryDateForP
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     gcdClient->add(globalDiscoveryEntry,
                    awaitGlobalRegistration,
                    gbids,
@@ -303,7 +311,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
        testReAddTask_onSuccessForAllEntries_proxyCalledAndResultFutureResolved)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     EXPECT_CALL(*mockTaskSequencer, add(_))
@@ -311,7 +319,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     gcdClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
 
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture1;
@@ -392,7 +400,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
        testReAddTask_mixOfOnSuccessOnError_proxyCalledAndResultFutureResolved)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     EXPECT_CALL(*mockTaskSequencer, add(_))
@@ -400,7 +408,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     gcdClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
 
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture1;
@@ -519,7 +527,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
        testReAddTask_noEntries_resultFutureResolvedAndProxyNotCalled)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     EXPECT_CALL(*mockTaskSequencer, add(_))
@@ -528,7 +536,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
 
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
 
     gcdClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
 
@@ -552,7 +560,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
 TEST_F(GlobalCapabilitiesDirectoryClientTest, testReAddTask_entryWithoutGbids_resultFutureResolved)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     EXPECT_CALL(*mockTaskSequencer, add(_))
@@ -560,7 +568,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testReAddTask_entryWithoutGbids_re
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     gcdClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
 
     std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
@@ -819,6 +827,180 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest,
     onApplicationErrorCallback(types::DiscoveryError::Enum::UNKNOWN_GBID);
 }
 
+TEST_F(GlobalCapabilitiesDirectoryClientTest,
+       testAdd_WithoutAwaitGlobalRegistration_singleGbid_queuedAddsAreSentInOneCall)
+{
+    const std::vector<std::string> singleGbid{gbids[0]};
+    std::function<void()> onFirstAddSuccessCallback;
+    std::function<void()> onBatchSuccessCallback;
+    std::shared_ptr<joynr::MessagingQos> messagingQosCapture;
+    auto semaphore = std::make_shared<Semaphore>();
+    std::atomic_int successCount(0);
+    auto countSuccess = [&successCount]() { successCount++; };
+
+    globalDiscoveryEntry.setExpiryDateMs(TimePoint::fromRelativeMs(capExpiryDateMs).toMilliseconds());
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("ParticipantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("ParticipantId3");
+    const std::vector<types::GlobalDiscoveryEntry> expectedBatch{
+            globalDiscoveryEntry2, globalDiscoveryEntry3};
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(singleGbid), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&onFirstAddSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy, addAsyncMock(Eq(expectedBatch), _, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&onBatchSuccessCallback),
+                            SaveArg<3>(&messagingQosCapture),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, singleGbid, countSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    // queued while the first add is pending
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry2, false, singleGbid, countSuccess, onError, onRuntimeError);
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry3, false, singleGbid, countSuccess, onError, onRuntimeError);
+    onFirstAddSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    testMessagingQosForCustomHeaderGbidKey(gbids[0], messagingQosCapture);
+
+    onBatchSuccessCallback();
+    EXPECT_EQ(3, successCount);
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest,
+       testAdd_WithoutAwaitGlobalRegistration_otherGbidThanGcdGbid_addsAreNotBatched)
+{
+    const std::vector<std::string> otherGbid{gbids[1]};
+    std::function<void()> onFirstAddSuccessCallback;
+    auto semaphore = std::make_shared<Semaphore>();
+
+    globalDiscoveryEntry.setExpiryDateMs(TimePoint::fromRelativeMs(capExpiryDateMs).toMilliseconds());
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("ParticipantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("ParticipantId3");
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy, addAsyncMock(_, _, _, _)).Times(0);
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(otherGbid), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&onFirstAddSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry2), Eq(otherGbid), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry3), Eq(otherGbid), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, false, otherGbid, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry2, false, otherGbid, onSuccess, onError, onRuntimeError);
+    globalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry3, false, otherGbid, onSuccess, onError, onRuntimeError);
+    onFirstAddSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest,
+       testAdd_WithoutAwaitGlobalRegistration_batchDoesNotWaitForTasksOfOtherParticipants)
+{
+    auto concurrentGlobalCapabilitiesDirectoryClient =
+            std::make_shared<GlobalCapabilitiesDirectoryClient>(
+                    clusterControllerSettings,
+                    std::make_unique<TaskSequencer<void>>(
+                            singleThreadedIOService->getIOService(), 2),
+                    gbids[0]);
+    concurrentGlobalCapabilitiesDirectoryClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
+    const std::vector<std::string> singleGbid{gbids[0]};
+    auto semaphore = std::make_shared<Semaphore>();
+
+    globalDiscoveryEntry.setExpiryDateMs(TimePoint::fromRelativeMs(capExpiryDateMs).toMilliseconds());
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("ParticipantId2");
+
+    // the add of the first participant stays pending
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(singleGbid), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry2), Eq(singleGbid), _, _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+
+    concurrentGlobalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry, true, singleGbid, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+    concurrentGlobalCapabilitiesDirectoryClient->add(
+            globalDiscoveryEntry2, false, singleGbid, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    concurrentGlobalCapabilitiesDirectoryClient->shutdown();
+}
+
+TEST_F(GlobalCapabilitiesDirectoryClientTest,
+       testAdd_WithoutAwaitGlobalRegistration_participantJoinsBatchAfterTaskCreationFailed)
+{
+    // without proxy, the remove reports a runtime error while its task is created
+    auto gcdClient = std::make_shared<GlobalCapabilitiesDirectoryClient>(
+            clusterControllerSettings,
+            std::make_unique<TaskSequencer<void>>(singleThreadedIOService->getIOService()),
+            gbids[0]);
+    const std::vector<std::string> singleGbid{gbids[0]};
+    std::function<void()> onFirstAddSuccessCallback;
+    auto semaphore = std::make_shared<Semaphore>();
+
+    globalDiscoveryEntry.setExpiryDateMs(TimePoint::fromRelativeMs(capExpiryDateMs).toMilliseconds());
+    types::GlobalDiscoveryEntry globalDiscoveryEntry2(globalDiscoveryEntry);
+    globalDiscoveryEntry2.setParticipantId("ParticipantId2");
+    types::GlobalDiscoveryEntry globalDiscoveryEntry3(globalDiscoveryEntry);
+    globalDiscoveryEntry3.setParticipantId("ParticipantId3");
+    const std::vector<types::GlobalDiscoveryEntry> expectedBatch{
+            globalDiscoveryEntry2, globalDiscoveryEntry3};
+
+    gcdClient->remove(globalDiscoveryEntry3.getParticipantId(),
+                      std::vector<std::string>{singleGbid},
+                      onRemoveSuccess,
+                      onRemoveError,
+                      [semaphore](const exceptions::JoynrRuntimeException&,
+                                  const std::vector<std::string>&) {
+                          semaphore->notify();
+                          throw std::runtime_error("failure in callback");
+                      });
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "remove not executed.";
+    gcdClient->setProxy(mockGlobalCapabilitiesDirectoryProxy);
+
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry), Eq(singleGbid), _, _, _, _))
+            .WillOnce(DoAll(SaveArg<2>(&onFirstAddSuccessCallback),
+                            ReleaseSemaphore(semaphore),
+                            Return(mockFuture)));
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy,
+                addAsyncMock(Eq(globalDiscoveryEntry3), _, _, _, _, _))
+            .Times(0);
+    EXPECT_CALL(*mockGlobalCapabilitiesDirectoryProxy, addAsyncMock(Eq(expectedBatch), _, _, _))
+            .WillOnce(DoAll(ReleaseSemaphore(semaphore), Return(mockFuture)));
+
+    gcdClient->add(globalDiscoveryEntry, false, singleGbid, onSuccess, onError, onRuntimeError);
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    // the failed remove does not keep the participantId from joining the batch
+    gcdClient->add(globalDiscoveryEntry2, false, singleGbid, onSuccess, onError, onRuntimeError);
+    gcdClient->add(globalDiscoveryEntry3, false, singleGbid, onSuccess, onError, onRuntimeError);
+    onFirstAddSuccessCallback();
+    ASSERT_TRUE(semaphore->waitFor(std::chrono::seconds(10))) << "GCD Proxy not called.";
+
+    gcdClient->shutdown();
+}
+
 TEST_F(GlobalCapabilitiesDirectoryClientTest, testLookupDomainInterface)
 {
     std::function<void(const std::vector<types::GlobalDiscoveryEntry>& result)> onSuccessForLookup =
@@ -883,7 +1065,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemove)
 TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveTaskExpiryDateHasCorrectValue)
 {
     std::unique_ptr<MockTaskSequencer<void>> mockTaskSequencer =
-            std::make_unique<MockTaskSequencer<void>>(std::chrono::milliseconds(60000));
+            std::make_unique<MockTaskSequencer<void>>(singleThreadedIOService->getIOService());
     auto semaphore = std::make_shared<Semaphore>();
     MockTaskSequencer<void>::MockTaskWithExpiryDate capturedTask;
     EXPECT_CALL(*mockTaskSequencer, add(_))
@@ -891,7 +1073,7 @@ TEST_F(GlobalCapabilitiesDirectoryClientTest, testRemoveTaskExpiryDateHasCorrect
             .WillOnce(DoAll(SaveArg<0>(&capturedTask), ReleaseSemaphore(semaphore)));
     std::shared_ptr<GlobalCapabilitiesDirectoryClient> gcdClient =
             std::make_shared<GlobalCapabilitiesDirectoryClient>(
-                    clusterControllerSettings, std::move(mockTaskSequencer));
+                    clusterControllerSettings, std::move(mockTaskSequencer), "gbid1");
     TimePoint expectedTaskExpiryDate = TimePoint::max();
 
     gcdClient->remove(capParticipantId,
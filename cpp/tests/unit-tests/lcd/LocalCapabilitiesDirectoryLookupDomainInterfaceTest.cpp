@@ -346,8 +346,12 @@ protected:
         types::GlobalDiscoveryEntry capEntry;
         capEntry.setParticipantId(participantId);
         capEntry.setAddress(serializedAddress);
-        auto validGlobalEntries =
-                _localCapabilitiesDirectory->registerReceivedCapabilities({capEntry});
+        std::vector<types::DiscoveryEntryWithMetaInfo> validGlobalEntries;
+        _localCapabilitiesDirectory->registerReceivedCapabilities(
+                {capEntry},
+                [&validGlobalEntries](std::vector<types::DiscoveryEntryWithMetaInfo>&& entries) {
+                    validGlobalEntries = std::move(entries);
+                });
         ASSERT_EQ(validGlobalEntries.size(), 1);
         ASSERT_TRUE(validGlobalEntries[0].getParticipantId() == capEntry.getParticipantId());
     }
@@ -2425,3 +2429,149 @@ TEST_F(LocalCapabilitiesDirectoryLookupDomainInterfaceTest,
 
     ASSERT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
 }
+
+TEST_F(LocalCapabilitiesDirectoryLookupDomainInterfaceTest,
+       lookupByDomainInterface_concurrentIdenticalLookups_invokeGcdOnce)
+{
+    _discoveryQos.setDiscoveryScope(types::DiscoveryScope::GLOBAL_ONLY);
+    _discoveryQos.setDiscoveryTimeout(10000);
+    const std::vector<types::GlobalDiscoveryEntry> discoveryEntriesResultList =
+            getGlobalDiscoveryEntries(2);
+    std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onGcdLookupSuccess;
+    EXPECT_CALL(
+            *_globalCapabilitiesDirectoryClient,
+            lookup(ElementsAre(_DOMAIN_1_NAME), _INTERFACE_1_NAME, Eq(_KNOWN_GBIDS), _, _, _, _))
+            .Times(1)
+            .WillOnce(SaveArg<4>(&onGcdLookupSuccess));
+    EXPECT_CALL(*_mockMessageRouter, addNextHop(_, _, _, _, _, _, _))
+            .Times(2)
+            .WillRepeatedly(InvokeArgument<5>());
+
+    initializeMockLocalCapabilitiesDirectoryStore();
+    finalizeTestSetupAfterMockExpectationsAreDone();
+
+    auto onSuccess = [this, &discoveryEntriesResultList](
+                             const std::vector<types::DiscoveryEntryWithMetaInfo>& result) {
+        EXPECT_EQ(discoveryEntriesResultList.size(), result.size());
+        _semaphore->notify();
+    };
+
+    _localCapabilitiesDirectory->lookup({_DOMAIN_1_NAME},
+                                        _INTERFACE_1_NAME,
+                                        _discoveryQos,
+                                        onSuccess,
+                                        _unexpectedProviderRuntimeExceptionFunction);
+    // the second lookup expires later than the first one and is joined to it
+    _discoveryQos.setDiscoveryTimeout(20000);
+    _localCapabilitiesDirectory->lookup({_DOMAIN_1_NAME},
+                                        _INTERFACE_1_NAME,
+                                        _discoveryQos,
+                                        onSuccess,
+                                        _unexpectedProviderRuntimeExceptionFunction);
+
+    ASSERT_TRUE(onGcdLookupSuccess);
+    onGcdLookupSuccess(discoveryEntriesResultList);
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
+}
+
+TEST_F(LocalCapabilitiesDirectoryLookupDomainInterfaceTest,
+       lookupByDomainInterface_concurrentLookupWithShorterTimeout_invokesGcdAgain)
+{
+    _discoveryQos.setDiscoveryScope(types::DiscoveryScope::GLOBAL_ONLY);
+    _discoveryQos.setDiscoveryTimeout(20000);
+    std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onGcdLookupSuccess1;
+    std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onGcdLookupSuccess2;
+    EXPECT_CALL(
+            *_globalCapabilitiesDirectoryClient,
+            lookup(ElementsAre(_DOMAIN_1_NAME), _INTERFACE_1_NAME, Eq(_KNOWN_GBIDS), _, _, _, _))
+            .Times(2)
+            .WillOnce(SaveArg<4>(&onGcdLookupSuccess1))
+            .WillOnce(SaveArg<4>(&onGcdLookupSuccess2));
+    EXPECT_CALL(*_mockMessageRouter, addNextHop(_, _, _, _, _, _, _)).Times(0);
+
+    initializeMockLocalCapabilitiesDirectoryStore();
+    finalizeTestSetupAfterMockExpectationsAreDone();
+
+    auto onSuccess = [this](const std::vector<types::DiscoveryEntryWithMetaInfo>& result) {
+        EXPECT_EQ(0, result.size());
+        _semaphore->notify();
+    };
+
+    _localCapabilitiesDirectory->lookup({_DOMAIN_1_NAME},
+                                        _INTERFACE_1_NAME,
+                                        _discoveryQos,
+                                        onSuccess,
+                                        _unexpectedProviderRuntimeExceptionFunction);
+    // the pending lookup would outlive the discovery timeout of the second lookup
+    _discoveryQos.setDiscoveryTimeout(10000);
+    _localCapabilitiesDirectory->lookup({_DOMAIN_1_NAME},
+                                        _INTERFACE_1_NAME,
+                                        _discoveryQos,
+                                        onSuccess,
+                                        _unexpectedProviderRuntimeExceptionFunction);
+
+    ASSERT_TRUE(onGcdLookupSuccess2);
+    onGcdLookupSuccess2({});
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
+    EXPECT_FALSE(_semaphore->waitFor(std::chrono::milliseconds(10)));
+    ASSERT_TRUE(onGcdLookupSuccess1);
+    onGcdLookupSuccess1({});
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
+}
+
+TEST_F(LocalCapabilitiesDirectoryLookupDomainInterfaceTest,
+       lookupByDomainInterface_pendingLookupTimesOut_joinedLookupIsRetried)
+{
+    _discoveryQos.setDiscoveryScope(types::DiscoveryScope::GLOBAL_ONLY);
+    _discoveryQos.setDiscoveryTimeout(10);
+    const std::vector<types::GlobalDiscoveryEntry> discoveryEntriesResultList =
+            getGlobalDiscoveryEntries(2);
+    std::function<void(const exceptions::JoynrRuntimeException&)> onGcdLookupRuntimeError;
+    std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onGcdLookupSuccess;
+    std::int64_t retriedLookupTimeout = 0;
+    EXPECT_CALL(
+            *_globalCapabilitiesDirectoryClient,
+            lookup(ElementsAre(_DOMAIN_1_NAME), _INTERFACE_1_NAME, Eq(_KNOWN_GBIDS), _, _, _, _))
+            .Times(2)
+            .WillOnce(SaveArg<6>(&onGcdLookupRuntimeError))
+            .WillOnce(DoAll(SaveArg<3>(&retriedLookupTimeout), SaveArg<4>(&onGcdLookupSuccess)));
+    EXPECT_CALL(*_mockMessageRouter, addNextHop(_, _, _, _, _, _, _))
+            .Times(2)
+            .WillRepeatedly(InvokeArgument<5>());
+
+    initializeMockLocalCapabilitiesDirectoryStore();
+    finalizeTestSetupAfterMockExpectationsAreDone();
+
+    Semaphore errorSemaphore(0);
+    auto onError = [&errorSemaphore](const exceptions::ProviderRuntimeException&) {
+        errorSemaphore.notify();
+    };
+    auto onSuccess = [this, &discoveryEntriesResultList](
+                             const std::vector<types::DiscoveryEntryWithMetaInfo>& result) {
+        EXPECT_EQ(discoveryEntriesResultList.size(), result.size());
+        _semaphore->notify();
+    };
+
+    _localCapabilitiesDirectory->lookup(
+            {_DOMAIN_1_NAME}, _INTERFACE_1_NAME, _discoveryQos, onSuccess, onError);
+    _discoveryQos.setDiscoveryTimeout(20000);
+    _localCapabilitiesDirectory->lookup({_DOMAIN_1_NAME},
+                                        _INTERFACE_1_NAME,
+                                        _discoveryQos,
+                                        onSuccess,
+                                        _unexpectedProviderRuntimeExceptionFunction);
+
+    // the pending lookup times out: only its own caller fails, the joined lookup is sent again
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(onGcdLookupRuntimeError);
+    onGcdLookupRuntimeError(exceptions::JoynrTimeOutException("timeout"));
+    EXPECT_TRUE(errorSemaphore.waitFor(std::chrono::milliseconds(_TIMEOUT)));
+    EXPECT_FALSE(_semaphore->waitFor(std::chrono::milliseconds(10)));
+
+    ASSERT_TRUE(onGcdLookupSuccess);
+    EXPECT_GT(retriedLookupTimeout, 0);
+    EXPECT_LE(retriedLookupTimeout, 20000);
+    onGcdLookupSuccess(discoveryEntriesResultList);
+    EXPECT_TRUE(_semaphore->waitFor(std::chrono::milliseconds(_TIMEOUT)));
+}
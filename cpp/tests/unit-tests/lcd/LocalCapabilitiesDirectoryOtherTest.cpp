@@ -364,8 +364,12 @@ protected:
         types::GlobalDiscoveryEntry capEntry;
         capEntry.setParticipantId(participantId);
         capEntry.setAddress(serializedAddress);
-        auto validGlobalEntries =
-                _localCapabilitiesDirectory->registerReceivedCapabilities({capEntry});
+        std::vector<types::DiscoveryEntryWithMetaInfo> validGlobalEntries;
+        _localCapabilitiesDirectory->registerReceivedCapabilities(
+                {capEntry},
+                [&validGlobalEntries](std::vector<types::DiscoveryEntryWithMetaInfo>&& entries) {
+                    validGlobalEntries = std::move(entries);
+                });
         ASSERT_EQ(validGlobalEntries.size(), 1);
         ASSERT_TRUE(validGlobalEntries[0].getParticipantId() == capEntry.getParticipantId());
     }
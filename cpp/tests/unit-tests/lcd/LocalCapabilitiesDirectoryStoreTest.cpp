@@ -30,6 +30,8 @@
 #include "joynr/InterfaceAddress.h"
 #include "joynr/LocalCapabilitiesDirectory.h"
 #include "joynr/LocalCapabilitiesDirectoryStore.h"
+#include "joynr/TimePoint.h"
+#include "joynr/WarmRestartSnapshot.h"
 #include "joynr/types/DiscoveryEntry.h"
 #include "joynr/types/DiscoveryScope.h"
 #include "joynr/types/ProviderQos.h"
@@ -694,3 +696,44 @@ TEST_F(LocalCapabilitiesDirectoryStoreTest, getAwaitGlobalRegistration_eraseLast
     ASSERT_FALSE(
             _localCapabilitiesDirectoryStore.getAwaitGlobalRegistration(participantId, cacheLock));
 }
+
+TEST_F(LocalCapabilitiesDirectoryStoreTest, warmRestartSnapshot_restoresGlobalLookupCache)
+{
+    const std::vector<std::string> gbids = {"gbid1", "gbid2"};
+    types::DiscoveryEntry globalEntry(_globalEntry);
+    globalEntry.setExpiryDateMs(TimePoint::fromRelativeMs(60000).toMilliseconds());
+    _localCapabilitiesDirectoryStore.insertInGlobalLookupCache(globalEntry, gbids);
+
+    WarmRestartSnapshot snapshot;
+    _localCapabilitiesDirectoryStore.saveWarmRestartSnapshot(snapshot);
+    ASSERT_EQ(1, snapshot.globalCacheEntries.size());
+    EXPECT_EQ(globalEntry, snapshot.globalCacheEntries[0].discoveryEntry);
+    EXPECT_EQ(gbids, snapshot.globalCacheEntries[0].gbids);
+
+    // cache ages are preserved
+    const std::int64_t cachedSinceMs = TimePoint::fromRelativeMs(-5000).toMilliseconds();
+    snapshot.globalCacheEntries[0].cachedSinceMs = cachedSinceMs;
+
+    types::DiscoveryEntry expiredEntry(globalEntry);
+    expiredEntry.setParticipantId("expiredParticipantId");
+    expiredEntry.setExpiryDateMs(TimePoint::now().toMilliseconds() - 1);
+    snapshot.globalCacheEntries.push_back({expiredEntry, gbids, cachedSinceMs});
+
+    LocalCapabilitiesDirectoryStore restoredStore;
+    restoredStore.restoreWarmRestartSnapshot(snapshot);
+
+    std::unique_lock<std::recursive_mutex> cacheLock(restoredStore.getCacheLock());
+    auto globalLookupCache = restoredStore.getGlobalLookupCache(cacheLock);
+    EXPECT_EQ(1, globalLookupCache->size());
+    boost::optional<types::DiscoveryEntry> restoredEntry =
+            globalLookupCache->lookupByParticipantId(globalEntry.getParticipantId());
+    ASSERT_TRUE(restoredEntry);
+    EXPECT_EQ(globalEntry, *restoredEntry);
+    EXPECT_FALSE(globalLookupCache->lookupByParticipantId(expiredEntry.getParticipantId()));
+    EXPECT_EQ(gbids,
+              restoredStore.getGbidsForParticipantId(globalEntry.getParticipantId(), cacheLock));
+    EXPECT_FALSE(globalLookupCache->lookupCacheByParticipantId(
+            globalEntry.getParticipantId(), std::chrono::milliseconds(1000)));
+    EXPECT_TRUE(globalLookupCache->lookupCacheByParticipantId(
+            globalEntry.getParticipantId(), std::chrono::milliseconds(60000)));
+}
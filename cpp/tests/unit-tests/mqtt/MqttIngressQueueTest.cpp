@@ -0,0 +1,279 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tests/utils/Gtest.h"
+
+#include "joynr/Metrics.h"
+#include "joynr/Semaphore.h"
+
+#include "libjoynrclustercontroller/mqtt/MqttIngressQueue.h"
+
+using namespace ::testing;
+
+namespace joynr
+{
+
+class MqttIngressQueueTest : public testing::Test
+{
+public:
+    MqttIngressQueueTest()
+            : _gbid("testGbid"),
+              _waitTime(std::chrono::milliseconds(1000)),
+              _receivedMessages(),
+              _receivedMessagesMutex(),
+              _messageProcessed(0)
+    {
+    }
+
+protected:
+    std::unique_ptr<MqttIngressQueue> createQueue(
+            std::size_t capacity,
+            std::function<void()> beforeProcessing = []() {},
+            std::chrono::milliseconds maxBackpressureDuration = std::chrono::milliseconds(10000))
+    {
+        return std::make_unique<MqttIngressQueue>(
+                _gbid,
+                capacity,
+                1,
+                maxBackpressureDuration,
+                [this, beforeProcessing](smrf::ByteVector&& rawMessage) {
+                    beforeProcessing();
+                    {
+                        std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+                        _receivedMessages.push_back(std::move(rawMessage));
+                    }
+                    _messageProcessed.notify();
+                });
+    }
+
+    static smrf::ByteVector createMessage(std::uint8_t value)
+    {
+        return smrf::ByteVector{value};
+    }
+
+    const std::string _gbid;
+    const std::chrono::milliseconds _waitTime;
+    std::vector<smrf::ByteVector> _receivedMessages;
+    std::mutex _receivedMessagesMutex;
+    Semaphore _messageProcessed;
+};
+
+TEST_F(MqttIngressQueueTest, messagesAreProcessedInOrderOutsideOfPushingThread)
+{
+    const std::thread::id pushingThreadId = std::this_thread::get_id();
+    std::thread::id processingThreadId;
+    auto queue = createQueue(
+            16, [&processingThreadId]() { processingThreadId = std::this_thread::get_id(); });
+    queue->start();
+
+    const std::uint8_t numberOfMessages = 10;
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        queue->push(createMessage(i));
+    }
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        ASSERT_TRUE(_messageProcessed.waitFor(_waitTime));
+    }
+
+    EXPECT_NE(pushingThreadId, processingThreadId);
+    std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+    ASSERT_EQ(numberOfMessages, _receivedMessages.size());
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        EXPECT_EQ(createMessage(i), _receivedMessages[i]);
+    }
+    queue->stop();
+}
+
+TEST_F(MqttIngressQueueTest, pushPausesPushingThreadWhileQueueIsFull)
+{
+    Semaphore processingStarted(0);
+    Semaphore continueProcessing(0);
+    auto queue = createQueue(2, [&processingStarted, &continueProcessing]() {
+        processingStarted.notify();
+        continueProcessing.wait();
+    });
+    queue->start();
+
+    // first message is taken by the worker thread, the next two fill the queue
+    queue->push(createMessage(0));
+    ASSERT_TRUE(processingStarted.waitFor(_waitTime));
+    queue->push(createMessage(1));
+    queue->push(createMessage(2));
+    EXPECT_FALSE(queue->isBackpressureActive());
+
+    std::atomic<bool> isPushed(false);
+    std::thread pushingThread([&queue, &isPushed]() {
+        queue->push(createMessage(3));
+        isPushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(isPushed);
+    EXPECT_TRUE(queue->isBackpressureActive());
+
+    // taking the next message drains the queue to half of its capacity
+    continueProcessing.notify();
+    pushingThread.join();
+    EXPECT_TRUE(isPushed);
+    EXPECT_FALSE(queue->isBackpressureActive());
+
+    const std::uint8_t numberOfMessages = 4;
+    for (std::uint8_t i = 1; i < numberOfMessages; ++i) {
+        continueProcessing.notify();
+    }
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        ASSERT_TRUE(_messageProcessed.waitFor(_waitTime));
+    }
+    {
+        std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+        ASSERT_EQ(numberOfMessages, _receivedMessages.size());
+        for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+            EXPECT_EQ(createMessage(i), _receivedMessages[i]);
+        }
+    }
+
+    const MqttIngressQueue::Metrics metrics = queue->getMetrics();
+    EXPECT_EQ(_gbid, metrics.gbid);
+    EXPECT_EQ(4u, metrics.receivedMessages);
+    EXPECT_EQ(4u, metrics.processedMessages);
+    EXPECT_EQ(0u, metrics.droppedMessages);
+    EXPECT_EQ(1u, metrics.backpressureEvents);
+    EXPECT_EQ(2u, metrics.maxQueueDepth);
+    queue->stop();
+}
+
+TEST_F(MqttIngressQueueTest, pushDropsMessagesWhenBlockedWorkerDoesNotDrainQueueInTime)
+{
+    Semaphore processingStarted(0);
+    Semaphore continueProcessing(0);
+    const std::chrono::milliseconds maxBackpressureDuration(100);
+    auto queue = createQueue(2,
+                             [&processingStarted, &continueProcessing]() {
+                                 processingStarted.notify();
+                                 continueProcessing.wait();
+                             },
+                             maxBackpressureDuration);
+    queue->start();
+
+    // the worker thread blocks on the first message, the next two fill the queue
+    queue->push(createMessage(0));
+    ASSERT_TRUE(processingStarted.waitFor(_waitTime));
+    queue->push(createMessage(1));
+    queue->push(createMessage(2));
+
+    const auto pushStart = std::chrono::steady_clock::now();
+    queue->push(createMessage(3));
+    EXPECT_GE(std::chrono::steady_clock::now() - pushStart, maxBackpressureDuration);
+    EXPECT_TRUE(queue->isBackpressureActive());
+
+    // the pause is over, further messages are dropped without pausing again
+    queue->push(createMessage(4));
+    EXPECT_LT(std::chrono::steady_clock::now() - pushStart, _waitTime);
+
+    MqttIngressQueue::Metrics metrics = queue->getMetrics();
+    EXPECT_EQ(3u, metrics.receivedMessages);
+    EXPECT_EQ(2u, metrics.droppedMessages);
+    EXPECT_EQ(1u, metrics.backpressureEvents);
+
+    // after the queue has been drained, messages are accepted again
+    for (std::uint8_t i = 0; i < 3; ++i) {
+        continueProcessing.notify();
+        ASSERT_TRUE(_messageProcessed.waitFor(_waitTime));
+    }
+    EXPECT_FALSE(queue->isBackpressureActive());
+    queue->push(createMessage(5));
+    continueProcessing.notify();
+    ASSERT_TRUE(_messageProcessed.waitFor(_waitTime));
+
+    {
+        std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+        const std::vector<smrf::ByteVector> expectedMessages = {
+                createMessage(0), createMessage(1), createMessage(2), createMessage(5)};
+        EXPECT_EQ(expectedMessages, _receivedMessages);
+    }
+    metrics = queue->getMetrics();
+    EXPECT_EQ(4u, metrics.processedMessages);
+    EXPECT_EQ(2u, metrics.droppedMessages);
+    queue->stop();
+}
+
+TEST_F(MqttIngressQueueTest, queuedMessagesAreProcessedOnStop)
+{
+    Semaphore processingStarted(0);
+    Semaphore continueProcessing(0);
+    auto queue = createQueue(16, [&processingStarted, &continueProcessing]() {
+        processingStarted.notify();
+        continueProcessing.wait();
+    });
+    queue->start();
+
+    const std::uint8_t numberOfMessages = 3;
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        queue->push(createMessage(i));
+    }
+    ASSERT_TRUE(processingStarted.waitFor(_waitTime));
+    for (std::uint8_t i = 0; i < numberOfMessages; ++i) {
+        continueProcessing.notify();
+    }
+    queue->stop();
+
+    const MqttIngressQueue::Metrics metrics = queue->getMetrics();
+    EXPECT_EQ(3u, metrics.processedMessages);
+    EXPECT_EQ(0u, metrics.droppedMessages);
+    EXPECT_EQ(0u, metrics.queueDepth);
+}
+
+TEST_F(MqttIngressQueueTest, messagesAreDiscardedAfterStop)
+{
+    auto queue = createQueue(16);
+    queue->start();
+    queue->stop();
+
+    queue->push(createMessage(0));
+    EXPECT_FALSE(_messageProcessed.waitFor(std::chrono::milliseconds(100)));
+
+    const MqttIngressQueue::Metrics metrics = queue->getMetrics();
+    EXPECT_EQ(0u, metrics.receivedMessages);
+    EXPECT_EQ(1u, metrics.droppedMessages);
+}
+
+TEST_F(MqttIngressQueueTest, metricsAreExportedPerGbid)
+{
+    MetricsRegistry::instance().reset();
+    auto queue = createQueue(16);
+    queue->start();
+    queue->push(createMessage(0));
+    ASSERT_TRUE(_messageProcessed.waitFor(_waitTime));
+    queue->stop();
+    queue->push(createMessage(1));
+
+    const std::string text = MetricsRegistry::instance().toPrometheusText();
+    EXPECT_THAT(text, HasSubstr("joynr_mqtt_ingress_received_total{gbid=\"testGbid\"} 1"));
+    EXPECT_THAT(text, HasSubstr("joynr_mqtt_ingress_dropped_total{gbid=\"testGbid\"} 1"));
+    EXPECT_THAT(text, HasSubstr("joynr_mqtt_ingress_queue_depth{gbid=\"testGbid\"} 0"));
+    EXPECT_THAT(text,
+                HasSubstr("joynr_mqtt_ingress_processing_seconds_count{gbid=\"testGbid\"} 1"));
+}
+
+} // namespace joynr
@@ -230,6 +230,30 @@ TEST_F(MqttMessagingSkeletonTest, transmitTestWithMqttReplyToAddress)
     mqttMessagingSkeleton.transmit(immutableMessage, onFailure);
 }
 
+TEST_F(MqttMessagingSkeletonTest, replyToAddressIsSharedBetweenMessagesWithSameReplyTo)
+{
+    std::shared_ptr<const joynr::system::RoutingTypes::Address> firstAddress;
+    std::shared_ptr<const joynr::system::RoutingTypes::Address> secondAddress;
+    EXPECT_CALL(*_mockMessageRouter, route(_, _)).Times(2);
+    EXPECT_CALL(*_mockMessageRouter, addNextHop(_, _, _, _, _, _, _))
+            .WillOnce(SaveArg<1>(&firstAddress))
+            .WillOnce(SaveArg<1>(&secondAddress));
+
+    MqttMessagingSkeleton mqttMessagingSkeleton(
+            _mockMessageRouter, nullptr, _ccSettings.getMqttMulticastTopicPrefix(), _testGbid);
+    auto onFailure = [](const exceptions::JoynrRuntimeException&) { FAIL() << "onFailure called"; };
+    mqttMessagingSkeleton.transmit(_mutableMessage.getImmutableMessage(), onFailure);
+    mqttMessagingSkeleton.transmit(_mutableMessage.getImmutableMessage(), onFailure);
+
+    ASSERT_TRUE(firstAddress);
+    EXPECT_EQ(firstAddress, secondAddress);
+    auto mqttAddress =
+            std::dynamic_pointer_cast<const joynr::system::RoutingTypes::MqttAddress>(firstAddress);
+    ASSERT_TRUE(mqttAddress);
+    EXPECT_EQ(_testGbid, mqttAddress->getBrokerUri());
+    EXPECT_EQ(_mqttAddress->getTopic(), mqttAddress->getTopic());
+}
+
 TEST_F(MqttMessagingSkeletonTest, transmitTestWithBrokenReplyToAddress)
 {
     EXPECT_CALL(*_mockMessageRouter, route(_, _)).Times(0);
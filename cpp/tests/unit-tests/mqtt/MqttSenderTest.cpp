@@ -83,6 +83,37 @@ protected:
         mqttSender = std::make_shared<MqttSender>(mockMosquittoConnection);
     }
 
+    std::shared_ptr<MockMosquittoConnection> createPublishConnection(bool isReadyToSend)
+    {
+        Settings testSettings("test-resources/MqttSenderTestWithMaxMessageSizeLimits2.settings");
+        const ClusterControllerSettings ccSettings(testSettings);
+        auto publishConnection =
+                std::make_shared<MockMosquittoConnection>(ccSettings,
+                                                          BrokerUrl("mqtt://testBrokerHost:1883"),
+                                                          std::chrono::seconds(1),
+                                                          std::chrono::seconds(1),
+                                                          std::chrono::seconds(1),
+                                                          false,
+                                                          "testClientId-pub",
+                                                          "gbid",
+                                                          false,
+                                                          true);
+        ON_CALL(*publishConnection, isReadyToSend()).WillByDefault(Return(isReadyToSend));
+        ON_CALL(*publishConnection, getMqttQos()).WillByDefault(Return(0));
+        ON_CALL(*publishConnection, getMqttMaximumPacketSize()).WillByDefault(Return(0));
+        return publishConnection;
+    }
+
+    std::shared_ptr<joynr::ImmutableMessage> createRequest()
+    {
+        MutableMessage mutableMessage;
+        mutableMessage.setType(joynr::Message::VALUE_MESSAGE_TYPE_REQUEST());
+        mutableMessage.setSender("testSender");
+        mutableMessage.setRecipient("testRecipient");
+        mutableMessage.setPayload("shortMessage");
+        return mutableMessage.getImmutableMessage();
+    }
+
     ADD_LOGGER(MqttSenderTest)
     joynr::system::RoutingTypes::MqttAddress mqttAddress;
 
@@ -376,4 +407,80 @@ TEST_F(MqttSenderTest, TestWithDisabledMessageSizeCheck)
     EXPECT_FALSE(gotCalled);
 }
 
+TEST_F(MqttSenderTest, messagesToSameTopicArePublishedOnSameConnection)
+{
+    createMosquittoConnection("test-resources/MqttSenderTestWithMaxMessageSizeLimits2.settings",
+                              MqttSenderTest::noMqttMessagePacketSize);
+    auto publishConnection1 = createPublishConnection(true);
+    auto publishConnection2 = createPublishConnection(true);
+    mqttSender = std::make_shared<MqttSender>(
+            mockMosquittoConnection,
+            std::vector<std::shared_ptr<MosquittoConnection>>{
+                    publishConnection1, publishConnection2});
+
+    const std::vector<std::shared_ptr<MosquittoConnection>> connections{
+            mockMosquittoConnection, publishConnection1, publishConnection2};
+    const std::size_t numberOfTopics = 20;
+    const int messagesPerTopic = 3;
+    std::vector<std::size_t> expectedPublishCalls(connections.size(), 0);
+    for (std::size_t i = 0; i < numberOfTopics; i++) {
+        const system::RoutingTypes::MqttAddress address("brokerUri", "topic" + std::to_string(i));
+        const std::string expectedTopic = address.getTopic() + "/low";
+        const std::size_t index = std::hash<std::string>{}(expectedTopic) % connections.size();
+        expectedPublishCalls[index] += messagesPerTopic;
+    }
+    EXPECT_CALL(*mockMosquittoConnection, publishMessage(_, _, _, _, _, _, _))
+            .Times(static_cast<int>(expectedPublishCalls[0]));
+    EXPECT_CALL(*publishConnection1, publishMessage(_, _, _, _, _, _, _))
+            .Times(static_cast<int>(expectedPublishCalls[1]));
+    EXPECT_CALL(*publishConnection2, publishMessage(_, _, _, _, _, _, _))
+            .Times(static_cast<int>(expectedPublishCalls[2]));
+
+    for (std::size_t i = 0; i < numberOfTopics; i++) {
+        const system::RoutingTypes::MqttAddress address("brokerUri", "topic" + std::to_string(i));
+        for (int j = 0; j < messagesPerTopic; j++) {
+            mqttSender->sendMessage(
+                    address, createRequest(), [](const exceptions::JoynrRuntimeException& e) {
+                        FAIL() << "sendMessage failed: " << e.getMessage();
+                    });
+        }
+    }
+}
+
+TEST_F(MqttSenderTest, messageIsDelayedIfPublishConnectionOfTopicIsNotReady)
+{
+    createMosquittoConnection("test-resources/MqttSenderTestWithMaxMessageSizeLimits2.settings",
+                              MqttSenderTest::noMqttMessagePacketSize);
+    auto publishConnection = createPublishConnection(false);
+    mqttSender = std::make_shared<MqttSender>(
+            mockMosquittoConnection,
+            std::vector<std::shared_ptr<MosquittoConnection>>{publishConnection});
+
+    const std::size_t numberOfTopics = 10;
+    int expectedDelayedMessages = 0;
+    for (std::size_t i = 0; i < numberOfTopics; i++) {
+        const std::string expectedTopic = "topic" + std::to_string(i) + "/low";
+        if (std::hash<std::string>{}(expectedTopic) % 2 == 1) {
+            expectedDelayedMessages++;
+        }
+    }
+    EXPECT_CALL(*publishConnection, publishMessage(_, _, _, _, _, _, _)).Times(0);
+    EXPECT_CALL(*mockMosquittoConnection, publishMessage(_, _, _, _, _, _, _))
+            .Times(static_cast<int>(numberOfTopics) - expectedDelayedMessages);
+
+    int delayedMessages = 0;
+    for (std::size_t i = 0; i < numberOfTopics; i++) {
+        const system::RoutingTypes::MqttAddress address("brokerUri", "topic" + std::to_string(i));
+        mqttSender->sendMessage(
+                address,
+                createRequest(),
+                [&delayedMessages](const exceptions::JoynrRuntimeException& e) {
+                    ASSERT_NE(nullptr,
+                              dynamic_cast<const exceptions::JoynrDelayMessageException*>(&e));
+                    delayedMessages++;
+                });
+    }
+    EXPECT_EQ(expectedDelayedMessages, delayedMessages);
+}
+
 } // namespace joynr
@@ -26,6 +26,7 @@
 
 #include "joynr/BroadcastSubscriptionRequest.h"
 #include "joynr/ImmutableMessage.h"
+#include "joynr/InFlightBudget.h"
 #include "joynr/Message.h"
 #include "joynr/MessagingQos.h"
 #include "joynr/MulticastPublication.h"
@@ -127,6 +128,25 @@ TEST_F(UdsCcMessagingSkeletonTest, onMessageReceivedTest)
     udsCcMessagingSkeleton.onMessageReceived(std::move(serializedMessage), creator);
 }
 
+TEST_F(UdsCcMessagingSkeletonTest, onMessageReceivedKeepsCreditUntilMessageIsReleased)
+{
+    std::unique_ptr<ImmutableMessage> immutableMessage = _mutableMessage.getImmutableMessage();
+    std::shared_ptr<ImmutableMessage> routedMessage;
+    EXPECT_CALL(*_mockMessageRouter, route(_, _)).WillOnce(SaveArg<0>(&routedMessage));
+
+    UdsCcMessagingSkeleton udsCcMessagingSkeleton(_mockMessageRouter);
+    auto inFlightBudget = std::make_shared<InFlightBudget>(1, "uds");
+
+    smrf::ByteVector serializedMessage = immutableMessage->getSerializedMessage();
+    udsCcMessagingSkeleton.onMessageReceived(
+            std::move(serializedMessage), "creator", inFlightBudget->acquire());
+    ASSERT_TRUE(routedMessage);
+    EXPECT_EQ(1, inFlightBudget->getStatistics().inFlight);
+
+    routedMessage.reset();
+    EXPECT_EQ(0, inFlightBudget->getStatistics().inFlight);
+}
+
 TEST_F(UdsCcMessagingSkeletonTest, transmitDoesNotSetReceivedFromGlobalForMulticastPublications)
 {
     MulticastPublication publication;
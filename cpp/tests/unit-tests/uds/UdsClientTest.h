@@ -223,7 +223,8 @@ protected:
         _server->setReceiveCallback(
                 [this](const joynr::system::RoutingTypes::UdsClientAddress& address,
                        smrf::ByteVector&& message,
-                       const std::string& creator) {
+                       const std::string& creator,
+                       joynr::InFlightBudget::Credit) {
                     std::ignore = creator;
                     std::lock_guard<std::mutex> lck(_connectedClientsMutex);
                     auto clientInfo =
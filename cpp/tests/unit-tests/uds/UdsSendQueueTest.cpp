@@ -142,6 +142,41 @@ TEST_F(UdsSendQueueTest, queueLimitExceeded)
             << "Unexpected data reported by error call backs";
 }
 
+TEST_F(UdsSendQueueTest, queueByteLimitExceeded)
+{
+    constexpr std::size_t hugeLimitNeverReached = 10;
+    const std::size_t frameBytes = boost::asio::buffer_size(createFrame(0).raw());
+    _queuedFrameData.clear();
+    UdsSendQueue<UdsFrameBufferV1> test(hugeLimitNeverReached, 3 * frameBytes);
+
+    for (smrf::Byte i = 0; i < 3; i++) {
+        test.pushBack(createFrame(i), [this, i](const exceptions::JoynrRuntimeException& ex) {
+            _queuedErrorCallbacks.push_back({i, ex});
+        });
+    }
+    EXPECT_EQ(_queuedErrorCallbacks.size(), 0)
+            << "Error callbacks executed, though byte limit has not been exceeded.";
+
+    constexpr smrf::Byte latestValue{3};
+    test.pushBack(createFrame(latestValue),
+                  [this, latestValue](const exceptions::JoynrRuntimeException& ex) {
+                      _queuedErrorCallbacks.push_back({latestValue, ex});
+                  });
+
+    EXPECT_EQ(latestValue, extractBodyData(test.showFront()))
+            << "Front queue element not the one inserted after byte limit reached.";
+    _queuedFrameData.pop_back();
+    EXPECT_EQ(getErrorCallbackData(), _queuedFrameData)
+            << "Unexpected data reported by error call backs";
+
+    // bytes of frames handed to the socket are no longer counted
+    for (smrf::Byte i = 10; i < 13; i++) {
+        test.pushBack(createFrame(i));
+    }
+    EXPECT_EQ(_queuedErrorCallbacks.size(), 3)
+            << "Frame in sending buffer counted for the byte limit.";
+}
+
 TEST_F(UdsSendQueueTest, queueLimitExceededWhileSending)
 {
     constexpr smrf::Byte testLimit{3};
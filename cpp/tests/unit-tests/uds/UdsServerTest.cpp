@@ -18,6 +18,8 @@
  */
 #include "UdsServerTest.h"
 
+#include <algorithm>
+
 #include "libjoynr/uds/UdsFrameBufferV1.h"
 
 #include "joynr/Semaphore.h"
@@ -601,3 +603,81 @@ TEST_F(UdsServerTest, getCorrectUsernameAfterConnection)
     std::string expectedUsername = getUserName();
     ASSERT_EQ(capturedUsername, expectedUsername);
 }
+
+TEST_F(UdsServerTest, flowControl_slowConsumerPausesReadingFromFloodingClient)
+{
+    constexpr std::size_t maxInFlightMessages = 4;
+    constexpr std::size_t numberOfMessages = 20;
+    std::vector<joynr::InFlightBudget::Credit> heldCredits;
+    std::shared_ptr<joynr::IUdsSender> sender;
+    auto server = std::make_unique<joynr::UdsServer>(_udsSettings);
+    server->setFlowControlLimits(maxInFlightMessages, 0);
+    server->setConnectCallback([&sender](const joynr::system::RoutingTypes::UdsClientAddress&,
+                                         std::unique_ptr<joynr::IUdsSender> connection) {
+        sender = std::move(connection);
+    });
+    // slow consumer: messages are processed by the test, not within the callback
+    server->setReceiveCallback([this, &heldCredits](
+                                       const joynr::system::RoutingTypes::UdsClientAddress&,
+                                       smrf::ByteVector&&,
+                                       const std::string&,
+                                       joynr::InFlightBudget::Credit credit) {
+        std::lock_guard<std::mutex> lck(_syncAllMutex);
+        heldCredits.push_back(std::move(credit));
+    });
+    server->start();
+    ASSERT_EQ(waitClientConnected(true), true) << "Failed to receive connection callback.";
+
+    for (std::size_t i = 0; i < numberOfMessages; i++) {
+        sendFromClient(static_cast<smrf::Byte>(i));
+    }
+
+    std::size_t processedMessages = 0;
+    while (processedMessages < numberOfMessages) {
+        const std::size_t expected =
+                std::min(maxInFlightMessages, numberOfMessages - processedMessages);
+        ASSERT_EQ(waitFor(heldCredits, expected), expected);
+        // give the server the chance to read more messages than allowed
+        std::this_thread::sleep_for(_retryIntervalDuringClientServerCommunication);
+        std::lock_guard<std::mutex> lck(_syncAllMutex);
+        ASSERT_EQ(heldCredits.size(), expected) << "Server did not pause reading.";
+        processedMessages += heldCredits.size();
+        // returning the credits resumes reading
+        heldCredits.clear();
+    }
+}
+
+TEST_F(UdsServerTest, flowControl_sendQueueOfSlowConsumerIsLimited)
+{
+    auto connectionSemaphore = std::make_shared<Semaphore>();
+    auto sendFailedSemaphore = std::make_shared<Semaphore>(0);
+    MockUdsServerCallbacks mockUdsServerCallbacks;
+    std::shared_ptr<joynr::IUdsSender> tmpClientSender, blockingClientSender;
+    EXPECT_CALL(mockUdsServerCallbacks, connectedMock(_, _))
+            .Times(2)
+            .WillRepeatedly(
+                    DoAll(SaveArg<1>(&tmpClientSender), ReleaseSemaphore(connectionSemaphore)));
+    EXPECT_CALL(mockUdsServerCallbacks, disconnected(_)).Times(AnyNumber());
+    EXPECT_CALL(mockUdsServerCallbacks, sendFailed(_))
+            .WillRepeatedly(ReleaseSemaphore(sendFailedSemaphore));
+    auto server = createServer(mockUdsServerCallbacks);
+    server->setFlowControlLimits(0, 64 * 1024);
+    server->start();
+    ASSERT_TRUE(connectionSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for nominal client.";
+
+    _udsSettings.setClientId("blockMessageProcessing");
+    BlockReceptionClient blockingClient(_udsSettings);
+    blockingClient.start();
+    ASSERT_TRUE(connectionSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Failed to receive connection callback for blocking client.";
+    blockingClientSender = tmpClientSender;
+
+    // flood the slow consumer with more data than the OS UDS buffer and the send queue can hold
+    for (unsigned int i = 0; i < 1024; i++) {
+        sendToClient(blockingClientSender, smrf::ByteVector(1024, 1), mockUdsServerCallbacks);
+    }
+    ASSERT_TRUE(sendFailedSemaphore->waitFor(_waitPeriodForClientServerCommunication))
+            << "Send queue of slow consumer not limited.";
+    blockingClient.stopBlocking();
+}
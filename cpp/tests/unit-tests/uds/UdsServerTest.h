@@ -182,7 +182,8 @@ protected:
         udsServerTest->setReceiveCallback(
                 [&mock](const joynr::system::RoutingTypes::UdsClientAddress& id,
                         smrf::ByteVector&& val,
-                        const std::string& creator) {
+                        const std::string& creator,
+                        joynr::InFlightBudget::Credit) {
                     mock.received(id, std::move(val), creator);
                 });
         return udsServerTest;
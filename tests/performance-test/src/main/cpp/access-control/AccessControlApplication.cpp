@@ -0,0 +1,76 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "AccessControlTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::size_t runs;
+    std::size_t numberOfEntries;
+    std::size_t numberOfThreads;
+    bool concurrentUpdates = false;
+
+    auto validateAtLeast = [](const std::string& name, std::size_t minimum) {
+        return [name, minimum](std::size_t value) {
+            if (value < minimum) {
+                throw po::validation_error(
+                        po::validation_error::invalid_option_value, name, std::to_string(value));
+            }
+        };
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "runs,r",
+            po::value(&runs)->required()->notifier(validateAtLeast("runs", 1)),
+            "number of runs per thread, each run evaluates 1000 consumer permissions")(
+            "entries,e",
+            po::value(&numberOfEntries)
+                    ->default_value(100000)
+                    ->notifier(validateAtLeast("entries", 10)),
+            "number of ACEs in the access store")(
+            "threads,t",
+            po::value(&numberOfThreads)->default_value(1)->notifier(validateAtLeast("threads", 1)),
+            "number of threads evaluating permissions")(
+            "concurrent-updates,u",
+            po::bool_switch(&concurrentUpdates),
+            "keep updating an ACE while permissions are evaluated");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        AccessControlTest test(runs, numberOfEntries, numberOfThreads, concurrentUpdates);
+        test.evaluateConsumerPermissions();
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
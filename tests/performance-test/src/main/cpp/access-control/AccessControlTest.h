@@ -0,0 +1,263 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef ACCESS_CONTROL_TEST_H
+#define ACCESS_CONTROL_TEST_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/Util.h"
+#include "joynr/infrastructure/DacTypes/MasterAccessControlEntry.h"
+#include "joynr/infrastructure/DacTypes/OwnerAccessControlEntry.h"
+#include "joynr/serializer/Serializer.h"
+#include "libjoynrclustercontroller/access-control/AccessControlAlgorithm.h"
+#include "libjoynrclustercontroller/access-control/LocalDomainAccessStore.h"
+
+/**
+ * Measures consumer permission evaluations as done by the AccessController against a store
+ * with many master and owner ACEs. Every 10th ACE has a wildcard domain and every 10th a
+ * wildcard interface, every 50th applies to all users. A quarter of the queries matches an ACE
+ * exactly, a quarter a wildcard domain, a quarter a wildcard interface and a quarter does not
+ * match at all.
+ * With concurrentUpdates, an additional thread keeps changing an ACE while the permissions
+ * are evaluated, each change recompiles the snapshot of the store.
+ */
+struct AccessControlTest : public PerformanceTest {
+    AccessControlTest(std::uint64_t runs,
+                      std::size_t numberOfEntries,
+                      std::size_t numberOfThreads,
+                      bool concurrentUpdates)
+            : runs(runs),
+              numberOfEntries(numberOfEntries),
+              numberOfThreads(numberOfThreads),
+              concurrentUpdates(concurrentUpdates),
+              store(),
+              queries()
+    {
+        fillStore();
+        createQueries();
+    }
+
+    void evaluateConsumerPermissions()
+    {
+        using namespace joynr::infrastructure::DacTypes;
+
+        std::atomic<bool> stopUpdates(false);
+        std::uint64_t numberOfUpdates = 0;
+        std::thread updater;
+        if (concurrentUpdates) {
+            updater = std::thread([this, &stopUpdates, &numberOfUpdates]() {
+                MasterAccessControlEntry entry = createMasterAce("updater", "domain", "interface");
+                while (!stopUpdates) {
+                    entry.setDefaultConsumerPermission(numberOfUpdates % 2 == 0 ? Permission::NO
+                                                                                : Permission::YES);
+                    store.updateMasterAccessControlEntry(entry);
+                    ++numberOfUpdates;
+                }
+            });
+        }
+
+        std::vector<std::vector<ClockResolution>> durations(numberOfThreads);
+        std::vector<std::thread> threads;
+        std::atomic<std::uint64_t> permitted(0);
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < numberOfThreads; ++i) {
+            threads.emplace_back([this, i, &durations, &permitted]() {
+                joynr::AccessControlAlgorithm algorithm;
+                std::size_t next = i * queriesPerRun;
+                std::uint64_t threadPermitted = 0;
+                durations[i] = benchmark(runs, [&]() {
+                    for (std::size_t j = 0; j < queriesPerRun; ++j) {
+                        const Query& query = queries[next++ % queries.size()];
+                        if (getConsumerPermission(algorithm, query) == Permission::YES) {
+                            ++threadPermitted;
+                        }
+                    }
+                });
+                permitted += threadPermitted;
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const auto end = Clock::now();
+        stopUpdates = true;
+        if (updater.joinable()) {
+            updater.join();
+        }
+
+        std::vector<ClockResolution> allDurations;
+        for (const std::vector<ClockResolution>& threadDurations : durations) {
+            allDurations.insert(
+                    allDurations.end(), threadDurations.cbegin(), threadDurations.cend());
+        }
+        std::cerr << "Testcase: evaluateConsumerPermissions, entries: " << numberOfEntries
+                  << ", threads: " << numberOfThreads
+                  << ", queries per run: " << queriesPerRun << std::endl;
+        std::cerr << "permitted queries: " << permitted << " of "
+                  << runs * numberOfThreads * queriesPerRun << std::endl;
+        if (concurrentUpdates) {
+            std::cerr << "concurrent updates: " << numberOfUpdates << std::endl;
+        }
+        printStatistics(allDurations, std::chrono::duration_cast<ClockResolution>(end - start));
+    }
+
+private:
+    struct Query {
+        std::string uid;
+        std::string domain;
+        std::string interfaceName;
+    };
+
+    static constexpr std::size_t queriesPerRun = 1000;
+    static constexpr std::size_t numberOfUsers = 1000;
+
+    joynr::infrastructure::DacTypes::Permission::Enum getConsumerPermission(
+            joynr::AccessControlAlgorithm& algorithm,
+            const Query& query) const
+    {
+        using namespace joynr::access_control;
+        const AccessControlSnapshot& snapshot = *store.getAccessControlSnapshot();
+        return algorithm.getConsumerPermission(
+                snapshot.getMasterAccessControlEntry(query.uid, query.domain, query.interfaceName),
+                snapshot.getMediatorAccessControlEntry(
+                        query.uid, query.domain, query.interfaceName),
+                snapshot.getOwnerAccessControlEntry(query.uid, query.domain, query.interfaceName),
+                joynr::infrastructure::DacTypes::TrustLevel::HIGH);
+    }
+
+    static std::string uidOf(std::size_t index)
+    {
+        return index % 50 == 2 ? joynr::access_control::WILDCARD
+                               : "user-" + std::to_string(index % numberOfUsers);
+    }
+
+    static std::string domainOf(std::size_t index)
+    {
+        const std::string domain = "com.example.vehicle" + std::to_string(index / 10);
+        return index % 10 == 0 ? domain + "." + joynr::access_control::WILDCARD : domain;
+    }
+
+    static std::string interfaceOf(std::size_t index)
+    {
+        return index % 10 == 1 ? "vehicle/Service*"
+                               : "vehicle/Service" + std::to_string(index % 10);
+    }
+
+    static joynr::infrastructure::DacTypes::MasterAccessControlEntry createMasterAce(
+            const std::string& uid,
+            const std::string& domain,
+            const std::string& interfaceName)
+    {
+        using namespace joynr::infrastructure::DacTypes;
+        const std::vector<TrustLevel::Enum> trustLevels = {
+                TrustLevel::LOW, TrustLevel::MID, TrustLevel::HIGH};
+        return MasterAccessControlEntry(uid,
+                                        domain,
+                                        interfaceName,
+                                        TrustLevel::LOW,
+                                        trustLevels,
+                                        TrustLevel::LOW,
+                                        trustLevels,
+                                        joynr::access_control::WILDCARD,
+                                        Permission::NO,
+                                        {Permission::YES, Permission::NO});
+    }
+
+    void fillStore()
+    {
+        using namespace joynr::infrastructure::DacTypes;
+
+        // updating the entries one by one would recompile the snapshot for every entry,
+        // load them at once from a file instead as done for ACL entry files
+        std::vector<MasterAccessControlEntry> masterAces;
+        std::vector<OwnerAccessControlEntry> ownerAces;
+        for (std::size_t i = 0; i < numberOfEntries; ++i) {
+            if (i % 2 == 0) {
+                masterAces.push_back(createMasterAce(uidOf(i), domainOf(i), interfaceOf(i)));
+            } else {
+                ownerAces.push_back(OwnerAccessControlEntry(uidOf(i),
+                                                            domainOf(i),
+                                                            interfaceOf(i),
+                                                            TrustLevel::LOW,
+                                                            TrustLevel::LOW,
+                                                            joynr::access_control::WILDCARD,
+                                                            Permission::YES));
+            }
+        }
+        const std::string fileName = "performance-access-control.persist";
+        joynr::util::saveStringToFile(
+                fileName,
+                "{\"masterAccessTable\":" + joynr::serializer::serializeToJson(masterAces) +
+                        ",\"mediatorAccessTable\":[],\"ownerAccessTable\":" +
+                        joynr::serializer::serializeToJson(ownerAces) +
+                        ",\"masterRegistrationTable\":[],\"mediatorRegistrationTable\":[]," +
+                        "\"ownerRegistrationTable\":[],\"domainRoleTable\":[]}");
+
+        const auto start = Clock::now();
+        store.mergeDomainAccessStore(joynr::LocalDomainAccessStore(fileName));
+        const auto end = Clock::now();
+        std::remove(fileName.c_str());
+        std::cerr << "loaded and compiled " << numberOfEntries << " entries in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                  << " [ms]" << std::endl;
+    }
+
+    void createQueries()
+    {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<std::size_t> indexDistribution(0, numberOfEntries / 10 - 1);
+        for (std::size_t i = 0; i < 10000; ++i) {
+            // entry 10 * k has a wildcard domain, entry 10 * k + 1 a wildcard interface
+            const std::size_t index = 10 * indexDistribution(generator);
+            const std::string domain = "com.example.vehicle" + std::to_string(index / 10);
+            switch (i % 4) {
+            case 0:
+                queries.push_back(Query{uidOf(index + 3), domain, interfaceOf(index + 3)});
+                break;
+            case 1:
+                queries.push_back(Query{uidOf(index), domain + ".rear", interfaceOf(index)});
+                break;
+            case 2:
+                queries.push_back(Query{uidOf(index + 1), domain, "vehicle/ServiceExtension"});
+                break;
+            default:
+                queries.push_back(Query{"unknown-user", "org.example.other", "other/Service"});
+                break;
+            }
+        }
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfEntries;
+    const std::size_t numberOfThreads;
+    const bool concurrentUpdates;
+    joynr::LocalDomainAccessStore store;
+    std::vector<Query> queries;
+};
+
+#endif // ACCESS_CONTROL_TEST_H
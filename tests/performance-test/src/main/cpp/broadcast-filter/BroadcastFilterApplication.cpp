@@ -0,0 +1,75 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "BroadcastFilterTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::size_t runs;
+    std::size_t numberOfSubscriptions;
+    std::size_t numberOfFilterSettings;
+
+    auto validatePositive = [](const std::string& name) {
+        return [name](std::size_t value) {
+            if (value == 0) {
+                throw po::validation_error(
+                        po::validation_error::invalid_option_value, name, std::to_string(value));
+            }
+        };
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "runs,r",
+            po::value(&runs)->required()->notifier(validatePositive("runs")),
+            "number of broadcasts")(
+            "subscriptions,s",
+            po::value(&numberOfSubscriptions)
+                    ->default_value(1000)
+                    ->notifier(validatePositive("subscriptions")),
+            "number of subscriptions of the selective broadcast")(
+            "filter-settings,f",
+            po::value(&numberOfFilterSettings)
+                    ->default_value(10)
+                    ->notifier(validatePositive("filter-settings")),
+            "number of distinct filter parameters among the subscriptions");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        BroadcastFilterTest test(runs, numberOfSubscriptions, numberOfFilterSettings);
+        test.broadcastFiredByProvider();
+        test.broadcastOccurredBySubscriptionId();
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,266 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef BROADCAST_FILTER_TEST_H
+#define BROADCAST_FILTER_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/AbstractJoynrProvider.h"
+#include "joynr/BroadcastFilterParameters.h"
+#include "joynr/BroadcastSubscriptionRequest.h"
+#include "joynr/IPublicationSender.h"
+#include "joynr/MessagingQos.h"
+#include "joynr/OnChangeSubscriptionQos.h"
+#include "joynr/PublicationManager.h"
+#include "joynr/RequestCaller.h"
+#include "joynr/SingleThreadedIOService.h"
+#include "joynr/SubscriptionPublication.h"
+#include "joynr/SubscriptionReply.h"
+#include "joynr/types/Version.h"
+
+using namespace joynr;
+
+/**
+ * Counts the publications instead of sending them, so that only the bookkeeping
+ * of the PublicationManager is measured.
+ */
+class CountingPublicationSender : public IPublicationSender
+{
+public:
+    CountingPublicationSender() : _publications(0), _subscriptionReplies(0)
+    {
+    }
+
+    void sendSubscriptionPublication(const std::string& /*senderParticipantId*/,
+                                     const std::string& /*receiverParticipantId*/,
+                                     const MessagingQos& /*qos*/,
+                                     SubscriptionPublication&& /*subscriptionPublication*/) override
+    {
+        ++_publications;
+    }
+
+    void sendSubscriptionReply(const std::string& /*senderParticipantId*/,
+                               const std::string& /*receiverParticipantId*/,
+                               const MessagingQos& /*qos*/,
+                               const SubscriptionReply& /*subscriptionReply*/) override
+    {
+        ++_subscriptionReplies;
+    }
+
+    std::uint64_t getAndResetPublications()
+    {
+        return _publications.exchange(0);
+    }
+
+    std::uint64_t getSubscriptionReplies() const
+    {
+        return _subscriptionReplies;
+    }
+
+private:
+    std::atomic<std::uint64_t> _publications;
+    std::atomic<std::uint64_t> _subscriptionReplies;
+};
+
+/**
+ * Forwards a distance if it is within the radius given by the filter parameters,
+ * counts how often it is run.
+ */
+class RadiusFilter
+{
+public:
+    RadiusFilter() : _runs(0)
+    {
+    }
+
+    bool filterForward(const double& distance, const BroadcastFilterParameters& filterParameters)
+    {
+        ++_runs;
+        return distance <= std::stod(filterParameters.getFilterParameter("radius"));
+    }
+
+    std::uint64_t getAndResetRuns()
+    {
+        return _runs.exchange(0);
+    }
+
+private:
+    std::atomic<std::uint64_t> _runs;
+};
+
+/**
+ * Provider with a selective broadcast of a distance.
+ */
+class DistanceProvider : public AbstractJoynrProvider
+{
+public:
+    const std::string& getInterfaceName() const override
+    {
+        static const std::string interfaceName("tests/performance/Distance");
+        return interfaceName;
+    }
+
+    void fireDistanceChanged(const std::vector<std::shared_ptr<RadiusFilter>>& filters,
+                             double distance)
+    {
+        fireSelectiveBroadcast("distanceChanged", filters, distance);
+    }
+};
+
+class DistanceRequestCaller : public RequestCaller
+{
+public:
+    explicit DistanceRequestCaller(std::shared_ptr<DistanceProvider> provider)
+            : RequestCaller(provider->getInterfaceName(), types::Version(1, 0)),
+              _provider(std::move(provider))
+    {
+    }
+
+protected:
+    std::shared_ptr<IJoynrProvider> getProvider() override
+    {
+        return _provider;
+    }
+
+private:
+    std::shared_ptr<DistanceProvider> _provider;
+};
+
+/**
+ * Measures a selective broadcast fanned out to many subscriptions which use only a few distinct
+ * filter parameters, e.g. a radius. Reports how often the filter chain runs per broadcast.
+ */
+struct BroadcastFilterTest : public PerformanceTest {
+    BroadcastFilterTest(std::uint64_t runs,
+                        std::size_t numberOfSubscriptions,
+                        std::size_t numberOfFilterSettings)
+            : runs(runs),
+              numberOfFilterSettings(numberOfFilterSettings),
+              singleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+              provider(std::make_shared<DistanceProvider>()),
+              publicationSender(std::make_shared<CountingPublicationSender>()),
+              filter(std::make_shared<RadiusFilter>()),
+              publicationManager(),
+              subscriptionIds()
+    {
+        singleThreadedIOService->start();
+        publicationManager = std::make_shared<PublicationManager>(
+                singleThreadedIOService->getIOService(), std::weak_ptr<IMessageSender>());
+
+        auto requestCaller = std::make_shared<DistanceRequestCaller>(provider);
+        const std::int64_t validityMs = 60 * 60 * 1000;
+        const std::int64_t publicationTtlMs = 10000;
+        const std::int64_t minIntervalMs = 0;
+        for (std::size_t i = 0; i < numberOfSubscriptions; i++) {
+            BroadcastFilterParameters filterParameters;
+            filterParameters.setFilterParameter(
+                    "radius", std::to_string(100 * (i % numberOfFilterSettings + 1)));
+            BroadcastSubscriptionRequest subscriptionRequest;
+            subscriptionRequest.setSubscribeToName("distanceChanged");
+            subscriptionRequest.setQos(std::make_shared<OnChangeSubscriptionQos>(
+                    validityMs, publicationTtlMs, minIntervalMs));
+            subscriptionRequest.setFilterParameters(filterParameters);
+            subscriptionIds.push_back(subscriptionRequest.getSubscriptionId());
+            publicationManager->add("proxyParticipantId",
+                                    "providerParticipantId",
+                                    requestCaller,
+                                    subscriptionRequest,
+                                    publicationSender);
+        }
+        waitForSubscriptionReplies(numberOfSubscriptions);
+    }
+
+    ~BroadcastFilterTest()
+    {
+        publicationManager->shutdown();
+        singleThreadedIOService->stop();
+    }
+
+    /**
+     * Fires the broadcast via the provider, i.e. all subscriptions are handled at once.
+     */
+    void broadcastFiredByProvider()
+    {
+        run("broadcastFiredByProvider",
+            [this](double distance) { provider->fireDistanceChanged({filter}, distance); });
+    }
+
+    /**
+     * Notifies the PublicationManager of the broadcast for single subscriptions, which runs
+     * the filter chain for every subscription.
+     */
+    void broadcastOccurredBySubscriptionId()
+    {
+        run("broadcastOccurredBySubscriptionId", [this](double distance) {
+            const std::vector<std::shared_ptr<RadiusFilter>> filters{filter};
+            for (const std::string& subscriptionId : subscriptionIds) {
+                publicationManager->selectiveBroadcastOccurred(subscriptionId, filters, distance);
+            }
+        });
+    }
+
+private:
+    template <typename Function>
+    void run(const std::string& name, Function&& fireBroadcast)
+    {
+        filter->getAndResetRuns();
+        publicationSender->getAndResetPublications();
+        // half of the filter settings forward the broadcast
+        const double distance = 100.0 * numberOfFilterSettings / 2;
+        runAndPrintAverage(runs,
+                           name + ", subscriptions: " + std::to_string(subscriptionIds.size()) +
+                                   ", filter settings: " + std::to_string(numberOfFilterSettings),
+                           [&fireBroadcast, distance]() { fireBroadcast(distance); });
+        std::cerr << "filter runs/broadcast:\t" << filter->getAndResetRuns() / runs << std::endl;
+        std::cerr << "publications/broadcast:\t"
+                  << publicationSender->getAndResetPublications() / runs << std::endl;
+    }
+
+    void waitForSubscriptionReplies(std::uint64_t expectedReplies)
+    {
+        const auto timeout = std::chrono::seconds(60);
+        const auto start = Clock::now();
+        while (publicationSender->getSubscriptionReplies() < expectedReplies) {
+            if (Clock::now() - start > timeout) {
+                throw std::runtime_error("subscription replies were not sent in time");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfFilterSettings;
+    std::shared_ptr<SingleThreadedIOService> singleThreadedIOService;
+    std::shared_ptr<DistanceProvider> provider;
+    std::shared_ptr<CountingPublicationSender> publicationSender;
+    std::shared_ptr<RadiusFilter> filter;
+    std::shared_ptr<PublicationManager> publicationManager;
+    std::vector<std::string> subscriptionIds;
+};
+
+#endif // BROADCAST_FILTER_TEST_H
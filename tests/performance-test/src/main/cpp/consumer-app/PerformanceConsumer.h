@@ -31,6 +31,7 @@
 #include "../common/PerformanceTest.h"
 #include "joynr/DiscoveryQos.h"
 #include "joynr/JoynrRuntime.h"
+#include "joynr/Metrics.h"
 #include "joynr/ProxyBuilder.h"
 
 #include "joynr/tests/performance/EchoProxy.h"
@@ -44,6 +45,8 @@ struct IPerformanceConsumer {
     virtual void runByteArrayWithSizeTimesK() = 0;
     virtual void runString() = 0;
     virtual void runStruct() = 0;
+    virtual void runAttribute() = 0;
+    virtual void enableAttributeCache(std::int64_t maxAgeMs) = 0;
 };
 
 template <typename Impl>
@@ -61,7 +64,8 @@ public:
                         std::size_t messageCount,
                         std::size_t stringLength,
                         std::size_t byteArraySize,
-                        const std::string& domain)
+                        const std::string& domain,
+                        const std::string& compressionCodec = std::string())
             : runtime(std::move(joynrRuntime)),
               messageCount(messageCount),
               stringLength(stringLength),
@@ -83,9 +87,16 @@ public:
         discoveryQos.setCacheMaxAgeMs(std::numeric_limits<std::int64_t>::max());
         discoveryQos.setArbitrationStrategy(DiscoveryQos::ArbitrationStrategy::HIGHEST_PRIORITY);
 
+        // an empty codec keeps the payload uncompressed
+        MessagingQos messagingQos(ttl);
+        if (!compressionCodec.empty()) {
+            messagingQos.setCompress(true);
+            messagingQos.setCompressionCodec(compressionCodec);
+        }
+
         try {
             // Build a proxy
-            echoProxy = proxyBuilder->setMessagingQos(MessagingQos(ttl))
+            echoProxy = proxyBuilder->setMessagingQos(messagingQos)
                                 ->setDiscoveryQos(discoveryQos)
                                 ->build();
         } catch (const std::exception& e) {
@@ -116,6 +127,22 @@ public:
         run(&Impl::loopStruct, getFilledStruct());
     }
 
+    void runAttribute() override
+    {
+        run(&Impl::loopAttribute);
+        if (attributeCacheEnabled) {
+            printAttributeCacheStatistics();
+        }
+    }
+
+    // getters which are not answered by the cache are sent to the provider, this includes the
+    // getters called before the initial publication of the cache subscription has arrived
+    void enableAttributeCache(std::int64_t maxAgeMs) override
+    {
+        echoProxy->enableAttributeCache(maxAgeMs);
+        attributeCacheEnabled = true;
+    }
+
     template <typename LoopFun, typename... Args>
     void run(LoopFun fun, Args&&... args)
     {
@@ -165,6 +192,16 @@ protected:
         return data;
     }
 
+    static void printAttributeCacheStatistics()
+    {
+        MetricsRegistry& registry = MetricsRegistry::instance();
+        const std::string name("joynr_proxy_attribute_cache_lookups_total");
+        std::cerr << "cacheHits:\t\t" << registry.getCounter(name, "", "result=\"hit\"")->get()
+                  << std::endl;
+        std::cerr << "sentGetters:\t\t"
+                  << registry.getCounter(name, "", "result=\"miss\"")->get() << std::endl;
+    }
+
     ByteArray getFilledByteArrayWithSizeTimesK() const
     {
         ByteArray data(byteArraySize * 1000);
@@ -182,6 +219,7 @@ protected:
 private:
     std::shared_ptr<JoynrRuntime> runtime;
     std::uint64_t ttl = 600000;
+    bool attributeCacheEnabled = false;
 };
 
 class SyncEchoConsumer : public PerformanceConsumer<SyncEchoConsumer>
@@ -212,6 +250,13 @@ public:
         loop(fun);
     }
 
+    void loopAttribute()
+    {
+        std::string value;
+        auto fun = [this, &value]() { echoProxy->getSimpleAttribute(value); };
+        loop(fun);
+    }
+
 private:
     template <typename Fun>
     void loop(Fun&& fun)
@@ -252,6 +297,18 @@ public:
         loop(fun);
     }
 
+    void loopAttribute()
+    {
+        auto fun = [this](auto onSuccess) { echoProxy->getSimpleAttributeAsync(onSuccess); };
+        loop(fun);
+    }
+
+    // with a batch size > 1, the calls are sent in batches of batchSize requests
+    void setBatchSize(std::size_t size)
+    {
+        batchSize = size;
+    }
+
     void notifyDone()
     {
         std::unique_lock<std::mutex> lock(mutex);
@@ -280,7 +337,13 @@ private:
                     this->notifyDone();
                 }
             };
+            if (batchSize > 1 && i % batchSize == 0) {
+                echoProxy->startBatch();
+            }
             fun(onSuccess);
+            if (batchSize > 1 && ((i + 1) % batchSize == 0 || i + 1 == messageCount)) {
+                echoProxy->sendBatch();
+            }
         }
 
         std::unique_lock<std::mutex> lock(mutex);
@@ -288,6 +351,7 @@ private:
     }
 
     std::atomic<uint32_t> msgCounterReceived;
+    std::size_t batchSize = 1;
     bool done = false;
     std::mutex mutex;
     std::condition_variable cv;
@@ -18,6 +18,7 @@
  */
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -39,7 +40,9 @@
 #endif // JOYNR_ENABLE_DLT_LOGGING
 
 JOYNR_ENUM(SyncMode, (SYNC)(ASYNC));
-JOYNR_ENUM(TestCase, (SEND_STRING)(SEND_BYTEARRAY)(SEND_BYTEARRAY_WITH_SIZE_TIMES_K)(SEND_STRUCT));
+JOYNR_ENUM(TestCase,
+           (SEND_STRING)(SEND_BYTEARRAY)(SEND_BYTEARRAY_WITH_SIZE_TIMES_K)(SEND_STRUCT)(
+                   GET_ATTRIBUTE));
 
 int main(int argc, char* argv[])
 {
@@ -56,6 +59,9 @@ int main(int argc, char* argv[])
     TestCase testCase;
     std::size_t byteArraySize;
     std::size_t stringLength;
+    std::size_t batchSize;
+    std::int64_t attributeCacheMaxAgeMs;
+    std::string compressionCodec;
     bool useKeyChain = false;
     const std::string ccUrlForTLS("wss://localhost:4243");
     joynr::tests::DummyKeyChainParameters keyChainInputParams;
@@ -73,10 +79,21 @@ int main(int argc, char* argv[])
             "runs,r", po::value(&runs)->required()->notifier(validateRuns), "number of runs")(
             "testCase,t",
             po::value(&testCase)->required(),
-            "SEND_STRING|SEND_BYTEARRAY|SEND_BYTEARRAY_WITH_SIZE_TIMES_K|SEND_STRUCT")(
+            "SEND_STRING|SEND_BYTEARRAY|SEND_BYTEARRAY_WITH_SIZE_TIMES_K|SEND_STRUCT|"
+            "GET_ATTRIBUTE")(
             "syncMode,s", po::value(&syncMode)->required(), "SYNC|ASYNC")(
             "stringLength,l", po::value(&stringLength)->required(), "length of string")(
             "byteArraySize,b", po::value(&byteArraySize)->required(), "size of bytearray")(
+            "batchSize",
+            po::value(&batchSize)->default_value(1),
+            "number of calls sent in one batch request, ASYNC only. Default: 1 (no batching).")(
+            "attributeCacheMaxAgeMs",
+            po::value(&attributeCacheMaxAgeMs)->default_value(0),
+            "max age of values served by the attribute cache of the proxy, GET_ATTRIBUTE only. "
+            "Default: 0 (no cache).")(
+            "compressionCodec",
+            po::value(&compressionCodec)->default_value(""),
+            "codec compressing the payloads, e.g. gzip or zstd. Default: empty (no compression).")(
             "useKeychain",
             po::value(&useKeyChain)->default_value(false),
             "Should KeyChain be used? Default: false.")(
@@ -133,11 +150,25 @@ int main(int argc, char* argv[])
         std::unique_ptr<joynr::IPerformanceConsumer> consumer;
 
         if (syncMode == SyncMode::SYNC) {
-            consumer = std::make_unique<joynr::SyncEchoConsumer>(
-                    std::move(runtime), runs, stringLength, byteArraySize, domain);
+            consumer = std::make_unique<joynr::SyncEchoConsumer>(std::move(runtime),
+                                                                 runs,
+                                                                 stringLength,
+                                                                 byteArraySize,
+                                                                 domain,
+                                                                 compressionCodec);
         } else {
-            consumer = std::make_unique<joynr::AsyncEchoConsumer>(
-                    std::move(runtime), runs, stringLength, byteArraySize, domain);
+            auto asyncConsumer = std::make_unique<joynr::AsyncEchoConsumer>(std::move(runtime),
+                                                                            runs,
+                                                                            stringLength,
+                                                                            byteArraySize,
+                                                                            domain,
+                                                                            compressionCodec);
+            asyncConsumer->setBatchSize(batchSize);
+            consumer = std::move(asyncConsumer);
+        }
+
+        if (attributeCacheMaxAgeMs > 0) {
+            consumer->enableAttributeCache(attributeCacheMaxAgeMs);
         }
 
         switch (testCase) {
@@ -153,6 +184,9 @@ int main(int argc, char* argv[])
         case TestCase::SEND_STRUCT:
             consumer->runStruct();
             break;
+        case TestCase::GET_ATTRIBUTE:
+            consumer->runAttribute();
+            break;
         }
     } catch (const std::exception& e) {
         std::cerr << e.what();
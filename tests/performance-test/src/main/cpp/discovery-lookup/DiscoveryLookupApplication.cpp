@@ -0,0 +1,88 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "DiscoveryLookupTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::size_t runs;
+    std::size_t numberOfProxies;
+    std::size_t roundTripTimeMs;
+    std::size_t numberOfEntries;
+    std::size_t numberOfAddresses;
+    std::string gbid;
+
+    auto validatePositive = [](const std::string& name) {
+        return [name](std::size_t value) {
+            if (value == 0) {
+                throw po::validation_error(
+                        po::validation_error::invalid_option_value, name, std::to_string(value));
+            }
+        };
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "runs,r",
+            po::value(&runs)->required()->notifier(validatePositive("runs")),
+            "number of runs, each run issues a burst of lookups")(
+            "proxies,p",
+            po::value(&numberOfProxies)->default_value(200)->notifier(validatePositive("proxies")),
+            "number of lookups per burst, one per proxy")(
+            "round-trip-time-ms,t",
+            po::value(&roundTripTimeMs)->default_value(10),
+            "time in milliseconds until the GCD stand-in replies to a lookup")(
+            "entries,e",
+            po::value(&numberOfEntries)->default_value(1000)->notifier(validatePositive("entries")),
+            "number of providers the GCD stand-in returns for a large lookup result")(
+            "addresses,a",
+            po::value(&numberOfAddresses)
+                    ->default_value(10)
+                    ->notifier(validatePositive("addresses")),
+            "number of distinct cluster controller addresses in a large lookup result")(
+            "gbid,g",
+            po::value(&gbid)->default_value("joynrdefaultgbid"),
+            "GBID known to the cluster controller, an empty GBID makes the cluster controller "
+            "replace the GBIDs in the addresses of lookup results");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        DiscoveryLookupTest test(
+                runs, numberOfProxies, std::chrono::milliseconds(roundTripTimeMs), gbid);
+        test.lookupBurst(false);
+        test.lookupBurst(true);
+        test.lookupLargeResult(numberOfEntries, numberOfAddresses);
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
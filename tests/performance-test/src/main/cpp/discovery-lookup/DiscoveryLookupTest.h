@@ -0,0 +1,489 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef DISCOVERY_LOOKUP_TEST_H
+#define DISCOVERY_LOOKUP_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/ClusterControllerSettings.h"
+#include "joynr/IMessageRouter.h"
+#include "joynr/IOServicePool.h"
+#include "joynr/LocalCapabilitiesDirectory.h"
+#include "joynr/LocalCapabilitiesDirectoryStore.h"
+#include "joynr/Semaphore.h"
+#include "joynr/Settings.h"
+#include "joynr/TimePoint.h"
+#include "joynr/serializer/Serializer.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+#include "joynr/types/DiscoveryQos.h"
+#include "joynr/types/DiscoveryScope.h"
+#include "joynr/types/ProviderQos.h"
+#include "joynr/types/ProviderScope.h"
+#include "libjoynrclustercontroller/capabilities-directory/IGlobalCapabilitiesDirectoryClient.h"
+
+using namespace joynr;
+
+/**
+ * Stand-in for the global capabilities directory which answers every lookup after a fixed round
+ * trip time and counts the lookups it receives. A lookup by domain and interface returns
+ * numberOfEntries providers of that interface, spread over numberOfAddresses cluster controllers.
+ */
+class GcdStandIn : public IGlobalCapabilitiesDirectoryClient
+{
+public:
+    GcdStandIn(boost::asio::io_service& ioService, std::chrono::milliseconds roundTripTime)
+            : ioService(ioService),
+              roundTripTime(roundTripTime),
+              lookups(0),
+              numberOfEntries(0),
+              serializedAddresses()
+    {
+        setNumberOfAddresses(1);
+    }
+
+    void setNumberOfEntries(std::size_t entries)
+    {
+        numberOfEntries = entries;
+    }
+
+    // must not be called while lookups are pending
+    void setNumberOfAddresses(std::size_t addresses)
+    {
+        serializedAddresses.clear();
+        for (std::size_t i = 0; i < addresses; ++i) {
+            serializedAddresses.push_back(serializer::serializeToJson(
+                    system::RoutingTypes::MqttAddress("tcp://localhost:1883",
+                                                      "clusterController-" + std::to_string(i))));
+        }
+    }
+
+    void add(const types::GlobalDiscoveryEntry&,
+             const bool,
+             const std::vector<std::string>&,
+             std::function<void()> onSuccess,
+             std::function<void(const types::DiscoveryError::Enum&)>,
+             std::function<void(const exceptions::JoynrRuntimeException&)>) override
+    {
+        onSuccess();
+    }
+
+    void remove(const std::string&,
+                std::vector<std::string>&& gbids,
+                std::function<void(const std::vector<std::string>&)> onSuccess,
+                std::function<void(const types::DiscoveryError::Enum&,
+                                   const std::vector<std::string>&)>,
+                std::function<void(const exceptions::JoynrRuntimeException&,
+                                   const std::vector<std::string>&)>) override
+    {
+        onSuccess(gbids);
+    }
+
+    void lookup(const std::vector<std::string>& domains,
+                const std::string& interfaceName,
+                const std::vector<std::string>&,
+                std::int64_t,
+                std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onSuccess,
+                std::function<void(const types::DiscoveryError::Enum&)>,
+                std::function<void(const exceptions::JoynrRuntimeException&)>) override
+    {
+        reply(std::move(onSuccess), createEntries(domains.front(), interfaceName));
+    }
+
+    void lookup(const std::string&,
+                const std::vector<std::string>&,
+                std::int64_t,
+                std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onSuccess,
+                std::function<void(const types::DiscoveryError::Enum&)>,
+                std::function<void(const exceptions::JoynrRuntimeException&)>) override
+    {
+        reply(std::move(onSuccess), {});
+    }
+
+    void removeStale(const std::string&,
+                     std::int64_t,
+                     const std::string,
+                     std::function<void()> onSuccess,
+                     std::function<void(const exceptions::JoynrRuntimeException&)>) override
+    {
+        onSuccess();
+    }
+
+    void touch(const std::string&,
+               const std::vector<std::string>&,
+               const std::string&,
+               std::function<void()> onSuccess,
+               std::function<void(const exceptions::JoynrRuntimeException&)>) override
+    {
+        onSuccess();
+    }
+
+    void reAdd(std::shared_ptr<LocalCapabilitiesDirectoryStore>, const std::string&) override
+    {
+    }
+
+    std::uint64_t getAndResetLookups()
+    {
+        return lookups.exchange(0);
+    }
+
+private:
+    std::vector<types::GlobalDiscoveryEntry> createEntries(const std::string& domain,
+                                                           const std::string& interfaceName) const
+    {
+        types::ProviderQos providerQos;
+        providerQos.setScope(types::ProviderScope::GLOBAL);
+        const std::int64_t now = TimePoint::now().toMilliseconds();
+        std::vector<types::GlobalDiscoveryEntry> entries;
+        entries.reserve(numberOfEntries);
+        for (std::size_t i = 0; i < numberOfEntries; ++i) {
+            entries.emplace_back(types::Version(),
+                                 domain,
+                                 interfaceName,
+                                 interfaceName + "-participantId-" + std::to_string(i),
+                                 providerQos,
+                                 now,
+                                 now + 60 * 60 * 1000,
+                                 "publicKeyId",
+                                 serializedAddresses[i % serializedAddresses.size()]);
+        }
+        return entries;
+    }
+
+    void reply(std::function<void(const std::vector<types::GlobalDiscoveryEntry>&)> onSuccess,
+               std::vector<types::GlobalDiscoveryEntry> result)
+    {
+        ++lookups;
+        auto timer = std::make_shared<boost::asio::steady_timer>(ioService, roundTripTime);
+        timer->async_wait(
+                [timer, onSuccess = std::move(onSuccess), result = std::move(result)](
+                        const boost::system::error_code&) { onSuccess(result); });
+    }
+
+    boost::asio::io_service& ioService;
+    const std::chrono::milliseconds roundTripTime;
+    std::atomic<std::uint64_t> lookups;
+    std::atomic<std::size_t> numberOfEntries;
+    std::vector<std::string> serializedAddresses;
+};
+
+/**
+ * Stand-in for the message router of the cluster controller which accepts every next hop.
+ */
+class MessageRouterStandIn : public IMessageRouter
+{
+public:
+    void route(std::shared_ptr<ImmutableMessage>, std::uint32_t) override
+    {
+    }
+
+    void addNextHop(const std::string&,
+                    const std::shared_ptr<const system::RoutingTypes::Address>&,
+                    bool,
+                    const std::int64_t,
+                    const bool,
+                    std::function<void()> onSuccess,
+                    std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void addNextHops(std::vector<NextHop> nextHops,
+                     std::function<void(const std::vector<bool>&)> onResult) override
+    {
+        if (onResult) {
+            onResult(std::vector<bool>(nextHops.size(), true));
+        }
+    }
+
+    void removeNextHop(const std::string&,
+                       std::function<void()> onSuccess,
+                       std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void addMulticastReceiver(
+            const std::string&,
+            const std::string&,
+            const std::string&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void removeMulticastReceiver(
+            const std::string&,
+            const std::string&,
+            const std::string&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void sendQueuedMessages(std::shared_ptr<const system::RoutingTypes::Address>) override
+    {
+    }
+
+    void setToKnown(const std::string&) override
+    {
+    }
+};
+
+/**
+ * Measures discovery lookups at the LocalCapabilitiesDirectory.
+ * A burst of lookups as issued by many proxies which are built at the same time, e.g.
+ * at startup, when none of the providers is known to the LocalCapabilitiesDirectory yet.
+ * Reports the number of lookups which reach the global capabilities directory and the latency
+ * of the single lookups. Identical lookups share one lookup at the global capabilities directory,
+ * lookups for distinct interfaces show the behavior without that.
+ * If the only GBID known to the cluster controller is empty, the GBIDs of the addresses returned
+ * by the global capabilities directory are replaced with the empty string.
+ */
+struct DiscoveryLookupTest : public PerformanceTest {
+    DiscoveryLookupTest(std::uint64_t runs,
+                        std::size_t numberOfProxies,
+                        std::chrono::milliseconds roundTripTime,
+                        const std::string& gbid)
+            : runs(runs),
+              numberOfProxies(numberOfProxies),
+              settings(),
+              clusterControllerSettings(settings),
+              ioServicePool(std::make_shared<IOServicePool>(1)),
+              gcdStandInPool(std::make_shared<IOServicePool>(1)),
+              gcdStandIn(std::make_shared<GcdStandIn>(gcdStandInPool->getIOService(),
+                                                      roundTripTime)),
+              messageRouter(std::make_shared<MessageRouterStandIn>()),
+              localCapabilitiesDirectory()
+    {
+        ioServicePool->start();
+        gcdStandInPool->start();
+        localCapabilitiesDirectory = std::make_shared<LocalCapabilitiesDirectory>(
+                clusterControllerSettings,
+                gcdStandIn,
+                std::make_shared<LocalCapabilitiesDirectoryStore>(),
+                "localAddress",
+                messageRouter,
+                ioServicePool->getIOService(),
+                "clusterControllerId",
+                std::vector<std::string>{gbid},
+                60 * 60 * 1000);
+    }
+
+    ~DiscoveryLookupTest()
+    {
+        localCapabilitiesDirectory->shutdown();
+        gcdStandInPool->stop();
+        ioServicePool->stop();
+    }
+
+    /**
+     * Looks up the same domain and interface numberOfProxies times without waiting for the
+     * results in between, or a distinct interface per lookup if identicalLookups is false.
+     */
+    void lookupBurst(bool identicalLookups)
+    {
+        std::vector<ClockResolution> durations;
+        durations.reserve(runs * numberOfProxies);
+        std::uint64_t gcdLookups = 0;
+        const auto start = Clock::now();
+        for (std::uint64_t run = 0; run < runs; ++run) {
+            lookupAll(identicalLookups, durations);
+            gcdLookups += gcdStandIn->getAndResetLookups();
+        }
+        const auto end = Clock::now();
+        std::cerr << "Testcase: lookupBurst, "
+                  << (identicalLookups ? "identical lookups" : "distinct interfaces")
+                  << ", proxies: " << numberOfProxies << std::endl;
+        std::cerr << "GCD lookups:\t\t" << gcdLookups << " of " << runs * numberOfProxies
+                  << std::endl;
+        printStatistics(durations, std::chrono::duration_cast<ClockResolution>(end - start));
+    }
+
+    /**
+     * Looks up a distinct interface per run for which the global capabilities directory returns
+     * numberOfEntries providers of numberOfAddresses cluster controllers, i.e. with
+     * numberOfAddresses distinct serialized addresses, while another thread keeps looking up a
+     * locally registered provider. Reports the latency of the global lookups and of the
+     * concurrent local lookups, which must not wait until the routing entries of the global
+     * result have been added.
+     */
+    void lookupLargeResult(std::size_t numberOfEntries, std::size_t numberOfAddresses)
+    {
+        registerLocalProvider();
+        gcdStandIn->setNumberOfEntries(numberOfEntries);
+        gcdStandIn->setNumberOfAddresses(numberOfAddresses);
+
+        std::atomic<bool> stopLocalLookups(false);
+        std::vector<ClockResolution> localDurations;
+        const auto localStart = Clock::now();
+        std::thread localLookups([this, &stopLocalLookups, &localDurations]() {
+            do {
+                const auto lookupStart = Clock::now();
+                lookupLocalProvider();
+                localDurations.push_back(
+                        std::chrono::duration_cast<ClockResolution>(Clock::now() - lookupStart));
+            } while (!stopLocalLookups);
+        });
+
+        std::uint64_t run = 0;
+        runAndPrintAverage(runs,
+                           "lookupLargeResult, entries " + std::to_string(numberOfEntries) +
+                                   ", addresses " + std::to_string(numberOfAddresses),
+                           [&]() {
+                               lookupGlobalProviders("vehicle/LargeService" +
+                                                     std::to_string(run++));
+                           });
+        stopLocalLookups = true;
+        localLookups.join();
+        const auto localEnd = Clock::now();
+        gcdStandIn->setNumberOfEntries(0);
+        gcdStandIn->setNumberOfAddresses(1);
+
+        std::cerr << "Testcase: concurrent local lookups" << std::endl;
+        printStatistics(localDurations,
+                        std::chrono::duration_cast<ClockResolution>(localEnd - localStart));
+    }
+
+private:
+    void registerLocalProvider()
+    {
+        types::ProviderQos providerQos;
+        providerQos.setScope(types::ProviderScope::LOCAL);
+        const std::int64_t now = TimePoint::now().toMilliseconds();
+        types::DiscoveryEntry entry(types::Version(),
+                                    "com.example.vehicle",
+                                    "vehicle/LocalService",
+                                    "localParticipantId",
+                                    providerQos,
+                                    now,
+                                    now + 60 * 60 * 1000,
+                                    "publicKeyId");
+        Semaphore added(0);
+        localCapabilitiesDirectory->add(
+                entry,
+                false,
+                {},
+                [&added]() { added.notify(); },
+                [&added](const types::DiscoveryError::Enum&) { added.notify(); });
+        added.wait();
+    }
+
+    void lookupLocalProvider()
+    {
+        types::DiscoveryQos discoveryQos;
+        discoveryQos.setDiscoveryScope(types::DiscoveryScope::LOCAL_ONLY);
+        lookupAndWait("vehicle/LocalService", discoveryQos);
+    }
+
+    void lookupGlobalProviders(const std::string& interfaceName)
+    {
+        types::DiscoveryQos discoveryQos;
+        discoveryQos.setDiscoveryScope(types::DiscoveryScope::GLOBAL_ONLY);
+        discoveryQos.setDiscoveryTimeout(60000);
+        discoveryQos.setCacheMaxAge(0);
+        lookupAndWait(interfaceName, discoveryQos);
+    }
+
+    void lookupAndWait(const std::string& interfaceName, const types::DiscoveryQos& discoveryQos)
+    {
+        Semaphore finished(0);
+        localCapabilitiesDirectory->lookup(
+                {"com.example.vehicle"},
+                interfaceName,
+                discoveryQos,
+                {},
+                [&finished](const std::vector<types::DiscoveryEntryWithMetaInfo>&) {
+                    finished.notify();
+                },
+                [&finished](const types::DiscoveryError::Enum&) { finished.notify(); });
+        if (!finished.waitFor(std::chrono::seconds(60))) {
+            throw std::runtime_error("lookup timed out");
+        }
+    }
+
+    void lookupAll(bool identicalLookups, std::vector<ClockResolution>& durations)
+    {
+        types::DiscoveryQos discoveryQos;
+        discoveryQos.setDiscoveryScope(types::DiscoveryScope::LOCAL_THEN_GLOBAL);
+        discoveryQos.setDiscoveryTimeout(60000);
+        discoveryQos.setCacheMaxAge(0);
+
+        Semaphore finished(0);
+        std::mutex durationsMutex;
+        for (std::size_t i = 0; i < numberOfProxies; ++i) {
+            const std::string interfaceName =
+                    identicalLookups ? "vehicle/Service" : "vehicle/Service" + std::to_string(i);
+            const auto lookupStart = Clock::now();
+            auto onSuccess = [lookupStart, &finished, &durations, &durationsMutex](
+                                     const std::vector<types::DiscoveryEntryWithMetaInfo>&) {
+                {
+                    std::lock_guard<std::mutex> lock(durationsMutex);
+                    durations.push_back(std::chrono::duration_cast<ClockResolution>(
+                            Clock::now() - lookupStart));
+                }
+                finished.notify();
+            };
+            auto onError = [&finished](const types::DiscoveryError::Enum&) {
+                finished.notify();
+            };
+            localCapabilitiesDirectory->lookup(
+                    {"com.example.vehicle"}, interfaceName, discoveryQos, {}, onSuccess, onError);
+        }
+        for (std::size_t i = 0; i < numberOfProxies; ++i) {
+            if (!finished.waitFor(std::chrono::seconds(60))) {
+                throw std::runtime_error("lookup timed out");
+            }
+        }
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfProxies;
+    Settings settings;
+    ClusterControllerSettings clusterControllerSettings;
+    std::shared_ptr<IOServicePool> ioServicePool;
+    std::shared_ptr<IOServicePool> gcdStandInPool;
+    std::shared_ptr<GcdStandIn> gcdStandIn;
+    std::shared_ptr<MessageRouterStandIn> messageRouter;
+    std::shared_ptr<LocalCapabilitiesDirectory> localCapabilitiesDirectory;
+};
+
+#endif // DISCOVERY_LOOKUP_TEST_H
@@ -0,0 +1,119 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef GCD_REGISTRATION_TEST_H
+#define GCD_REGISTRATION_TEST_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/Future.h"
+#include "joynr/IOServicePool.h"
+#include "joynr/Semaphore.h"
+#include "joynr/TaskSequencer.h"
+#include "joynr/TimePoint.h"
+
+using namespace joynr;
+
+/**
+ * Measures the time until a number of providers is registered at the global capabilities
+ * directory, i.e. until the futures of all add calls queued in the TaskSequencer of the
+ * GlobalCapabilitiesDirectoryClient have completed. The GCD is replaced by a stand-in which
+ * replies to every call after a fixed round trip time, so the result only depends on how many
+ * calls the TaskSequencer keeps in flight.
+ */
+struct GcdRegistrationTest : public PerformanceTest {
+    GcdRegistrationTest(std::uint64_t runs,
+                        std::size_t numberOfProviders,
+                        std::chrono::milliseconds roundTripTime)
+            : runs(runs),
+              numberOfProviders(numberOfProviders),
+              roundTripTime(roundTripTime),
+              ioServicePool(std::make_shared<IOServicePool>(1)),
+              gcdStandIn(std::make_shared<IOServicePool>(1))
+    {
+        ioServicePool->start();
+        gcdStandIn->start();
+    }
+
+    ~GcdRegistrationTest()
+    {
+        gcdStandIn->stop();
+        ioServicePool->stop();
+    }
+
+    /**
+     * Registers numberOfProviders providers with distinct participantIds, keeping at most
+     * maxConcurrentCalls add calls pending at the same time.
+     */
+    void registerProviders(std::size_t maxConcurrentCalls)
+    {
+        runAndPrintAverage(
+                runs,
+                "registerProviders, maxConcurrentCalls " + std::to_string(maxConcurrentCalls),
+                [this, maxConcurrentCalls]() { registerAll(maxConcurrentCalls); });
+    }
+
+private:
+    void registerAll(std::size_t maxConcurrentCalls)
+    {
+        TaskSequencer<void> sequencer(ioServicePool->getIOService(), maxConcurrentCalls);
+        Semaphore registered(0);
+        for (std::size_t i = 0; i < numberOfProviders; ++i) {
+            TaskSequencer<void>::TaskWithExpiryDate addTask;
+            addTask._expiryDate = TimePoint::max();
+            addTask._timeout = []() {};
+            addTask._key = "participantId-" + std::to_string(i);
+            addTask._task = [this, &registered]() { return add(registered); };
+            sequencer.add(addTask);
+        }
+        for (std::size_t i = 0; i < numberOfProviders; ++i) {
+            if (!registered.waitFor(std::chrono::seconds(60))) {
+                throw std::runtime_error("registration timed out");
+            }
+        }
+    }
+
+    std::shared_ptr<Future<void>> add(Semaphore& registered)
+    {
+        auto future = std::make_shared<Future<void>>();
+        auto reply = std::make_shared<boost::asio::steady_timer>(gcdStandIn->getIOService(),
+                                                                 roundTripTime);
+        reply->async_wait([reply, future, &registered](const boost::system::error_code&) {
+            future->onSuccess();
+            registered.notify();
+        });
+        return future;
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfProviders;
+    const std::chrono::milliseconds roundTripTime;
+    std::shared_ptr<IOServicePool> ioServicePool;
+    std::shared_ptr<IOServicePool> gcdStandIn;
+};
+
+#endif // GCD_REGISTRATION_TEST_H
@@ -0,0 +1,83 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "IOServicePoolTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::uint32_t numberOfThreads;
+    std::size_t runs;
+    std::size_t numberOfTimers;
+    std::size_t handlerDurationUs;
+    bool blockingHandlers;
+
+    auto validatePositive = [](const std::string& name) {
+        return [name](std::size_t value) {
+            if (value == 0) {
+                throw po::validation_error(
+                        po::validation_error::invalid_option_value, name, std::to_string(value));
+            }
+        };
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "threads,t",
+            po::value(&numberOfThreads)->default_value(1)->notifier(validatePositive("threads")),
+            "number of threads of the io service pool")(
+            "runs,r",
+            po::value(&runs)->required()->notifier(validatePositive("runs")),
+            "number of expirations per timer and number of posted handlers")(
+            "timers,n",
+            po::value(&numberOfTimers)->default_value(10)->notifier(validatePositive("timers")),
+            "number of periodic timers")(
+            "handler-duration-us,d",
+            po::value(&handlerDurationUs)->default_value(500),
+            "time in microseconds each handler keeps its thread busy")(
+            "blocking,b",
+            po::bool_switch(&blockingHandlers),
+            "handlers sleep instead of spinning, e.g. to simulate blocking file I/O");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        IOServicePoolTest test(numberOfThreads,
+                               runs,
+                               numberOfTimers,
+                               std::chrono::microseconds(handlerDurationUs),
+                               blockingHandlers);
+        test.timerLateness();
+        test.postedHandlers();
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef IO_SERVICE_POOL_TEST_H
+#define IO_SERVICE_POOL_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/IOServicePool.h"
+#include "joynr/Semaphore.h"
+
+using namespace joynr;
+
+/**
+ * Measures how an IOServicePool with a given number of threads copes with handlers which
+ * occupy a thread for some time, e.g. a routing table cleanup (CPU bound) or a synchronous
+ * persistence (blocking). CPU bound handlers only profit from more threads on multiple cores.
+ */
+struct IOServicePoolTest : public PerformanceTest {
+    IOServicePoolTest(std::uint32_t numberOfThreads,
+                      std::uint64_t runs,
+                      std::size_t numberOfTimers,
+                      std::chrono::microseconds handlerDuration,
+                      bool blockingHandlers)
+            : runs(runs),
+              numberOfTimers(numberOfTimers),
+              handlerDuration(handlerDuration),
+              blockingHandlers(blockingHandlers),
+              ioServicePool(std::make_shared<IOServicePool>(numberOfThreads))
+    {
+        ioServicePool->start();
+    }
+
+    ~IOServicePoolTest()
+    {
+        ioServicePool->stop();
+    }
+
+    /**
+     * Runs numberOfTimers periodic timers, each expiring runs times. Reports the lateness of
+     * the handler invocations compared to the expiry time of the timer.
+     */
+    void timerLateness()
+    {
+        const auto period = std::chrono::milliseconds(10);
+        const std::uint64_t expectedExpirations = runs * numberOfTimers;
+        std::vector<ClockResolution> lateness;
+        lateness.reserve(expectedExpirations);
+        std::mutex latenessMutex;
+        Semaphore finished(0);
+
+        std::vector<std::unique_ptr<PeriodicTimer>> timers;
+        for (std::size_t i = 0; i < numberOfTimers; ++i) {
+            timers.push_back(std::make_unique<PeriodicTimer>(
+                    ioServicePool->getIOService(), period, runs, [&](ClockResolution late) {
+                        occupyThread();
+                        std::lock_guard<std::mutex> lock(latenessMutex);
+                        lateness.push_back(late);
+                        if (lateness.size() == expectedExpirations) {
+                            finished.notify();
+                        }
+                    }));
+        }
+
+        const auto start = Clock::now();
+        for (std::unique_ptr<PeriodicTimer>& timer : timers) {
+            timer->start();
+        }
+        waitFor(finished, period * runs);
+        const auto end = Clock::now();
+
+        std::cerr << "Testcase: timerLateness, threads: " << ioServicePool->getNumberOfThreads()
+                  << ", timers: " << numberOfTimers << std::endl;
+        printStatistics(lateness, std::chrono::duration_cast<ClockResolution>(end - start));
+    }
+
+    /**
+     * Posts runs handlers at once and reports the time from posting until each handler
+     * has been executed.
+     */
+    void postedHandlers()
+    {
+        std::vector<ClockResolution> delays(runs);
+        std::atomic<std::uint64_t> executed(0);
+        Semaphore finished(0);
+
+        const auto start = Clock::now();
+        for (std::uint64_t i = 0; i < runs; ++i) {
+            const auto posted = Clock::now();
+            ioServicePool->getIOService().post([&, i, posted]() {
+                occupyThread();
+                delays[i] = std::chrono::duration_cast<ClockResolution>(Clock::now() - posted);
+                if (++executed == runs) {
+                    finished.notify();
+                }
+            });
+        }
+        waitFor(finished, handlerDuration * runs);
+        const auto end = Clock::now();
+
+        std::cerr << "Testcase: postedHandlers, threads: " << ioServicePool->getNumberOfThreads()
+                  << std::endl;
+        printStatistics(delays, std::chrono::duration_cast<ClockResolution>(end - start));
+    }
+
+private:
+    class PeriodicTimer
+    {
+    public:
+        PeriodicTimer(boost::asio::io_service& ioService,
+                      std::chrono::milliseconds period,
+                      std::uint64_t expirations,
+                      std::function<void(ClockResolution)> onExpired)
+                : _timer(ioService),
+                  _period(period),
+                  _remainingExpirations(expirations),
+                  _onExpired(std::move(onExpired))
+        {
+        }
+
+        void start()
+        {
+            _timer.expires_from_now(_period);
+            wait();
+        }
+
+    private:
+        void wait()
+        {
+            _timer.async_wait([this](const boost::system::error_code& error) {
+                if (error) {
+                    return;
+                }
+                const auto expiry = _timer.expires_at();
+                _onExpired(std::chrono::duration_cast<ClockResolution>(
+                        std::chrono::steady_clock::now() - expiry));
+                if (--_remainingExpirations > 0) {
+                    _timer.expires_at(expiry + _period);
+                    wait();
+                }
+            });
+        }
+
+        boost::asio::steady_timer _timer;
+        const std::chrono::milliseconds _period;
+        std::uint64_t _remainingExpirations;
+        std::function<void(ClockResolution)> _onExpired;
+    };
+
+    /**
+     * Either spins (CPU bound handler) or sleeps (handler blocked by I/O) for handlerDuration.
+     */
+    void occupyThread() const
+    {
+        const auto end = Clock::now() + handlerDuration;
+        if (blockingHandlers) {
+            std::this_thread::sleep_until(end);
+            return;
+        }
+        while (Clock::now() < end) {
+        }
+    }
+
+    static void waitFor(Semaphore& semaphore, std::chrono::microseconds expectedDuration)
+    {
+        // generous timeout, a single thread may be overloaded by design of the test
+        const auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+                expectedDuration * 100 + std::chrono::seconds(10));
+        if (!semaphore.waitFor(timeout)) {
+            throw std::runtime_error("handlers were not executed in time");
+        }
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfTimers;
+    const std::chrono::microseconds handlerDuration;
+    const bool blockingHandlers;
+    std::shared_ptr<IOServicePool> ioServicePool;
+};
+
+#endif // IO_SERVICE_POOL_TEST_H
@@ -0,0 +1,81 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef LOGGING_TEST_H
+#define LOGGING_TEST_H
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/Logger.h"
+
+/**
+ * Measures the time a thread spends in a log statement while other threads log concurrently.
+ * Run with JOYNR_LOG_LEVEL=DEBUG and with or without JOYNR_LOG_ASYNC=BLOCK|DROP to compare
+ * synchronous and asynchronous logging; redirect stdout to keep the terminal out of the result.
+ */
+struct LoggingTest : public PerformanceTest {
+    LoggingTest(std::uint64_t runs, std::size_t numberOfThreads)
+            : runs(runs), numberOfThreads(numberOfThreads)
+    {
+    }
+
+    void logConcurrently()
+    {
+        std::vector<std::vector<ClockResolution>> durations(numberOfThreads);
+        std::vector<std::thread> threads;
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < numberOfThreads; ++i) {
+            threads.emplace_back([this, i, &durations]() {
+                const std::string participantId = "participantId-" + std::to_string(i);
+                std::uint64_t counter = 0;
+                durations[i] = benchmark(runs, [&participantId, &counter]() {
+                    JOYNR_LOG_DEBUG(logger(),
+                                    "Route message with messageId {} to participantId {}",
+                                    counter++,
+                                    participantId);
+                });
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const auto end = Clock::now();
+
+        std::vector<ClockResolution> allDurations;
+        allDurations.reserve(runs * numberOfThreads);
+        for (const std::vector<ClockResolution>& threadDurations : durations) {
+            allDurations.insert(
+                    allDurations.end(), threadDurations.cbegin(), threadDurations.cend());
+        }
+        std::cerr << "Testcase: logConcurrently, threads: " << numberOfThreads << std::endl;
+        printStatistics(allDurations, std::chrono::duration_cast<ClockResolution>(end - start));
+    }
+
+private:
+    ADD_LOGGER(LoggingTest)
+
+    const std::uint64_t runs;
+    const std::size_t numberOfThreads;
+};
+
+#endif // LOGGING_TEST_H
@@ -0,0 +1,166 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef MESSAGE_NOTIFICATION_TEST_H
+#define MESSAGE_NOTIFICATION_TEST_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/CcMessageRouter.h"
+#include "joynr/ClusterControllerSettings.h"
+#include "joynr/IMessagingStubFactory.h"
+#include "joynr/IOServicePool.h"
+#include "joynr/IPlatformSecurityManager.h"
+#include "joynr/ITransportStatus.h"
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/MessageQueue.h"
+#include "joynr/MessagingSettings.h"
+#include "joynr/MqttMulticastAddressCalculator.h"
+#include "joynr/MulticastMessagingSkeletonDirectory.h"
+#include "joynr/MutableMessage.h"
+#include "joynr/Settings.h"
+#include "joynr/TimePoint.h"
+#include "joynr/UnicastBroadcastListener.h"
+#include "joynr/system/MessageNotificationProvider.h"
+#include "joynr/system/RoutingTypes/Address.h"
+
+using namespace joynr;
+
+/**
+ * Stub factory of a cluster controller whose transports are all down: every message to an
+ * unknown participant is queued.
+ */
+class UnavailableMessagingStubFactory : public IMessagingStubFactory
+{
+public:
+    std::shared_ptr<IMessagingStub> create(
+            const std::shared_ptr<const system::RoutingTypes::Address>&) override
+    {
+        return nullptr;
+    }
+
+    void remove(const std::shared_ptr<const system::RoutingTypes::Address>&) override
+    {
+    }
+
+    bool contains(const std::shared_ptr<const system::RoutingTypes::Address>&) override
+    {
+        return false;
+    }
+
+    void shutdown() override
+    {
+    }
+};
+
+/**
+ * Measures how fast the cluster controller queues messages for unreachable participants, with
+ * and without a subscriber of the messageQueuedForDelivery broadcast of its MessageNotification
+ * provider.
+ */
+struct MessageNotificationTest : public PerformanceTest {
+    MessageNotificationTest(std::uint64_t runs, std::size_t numberOfParticipants)
+            : runs(runs),
+              settings(),
+              messagingSettings(settings),
+              clusterControllerSettings(settings),
+              ioServicePool(std::make_shared<IOServicePool>(1)),
+              ownAddress(),
+              messages()
+    {
+        ioServicePool->start();
+        const std::vector<std::string> gbids = {"joynrdefaultgbid"};
+        messageRouter = std::make_shared<CcMessageRouter>(
+                messagingSettings,
+                clusterControllerSettings,
+                std::make_shared<UnavailableMessagingStubFactory>(),
+                std::make_shared<MulticastMessagingSkeletonDirectory>(),
+                std::unique_ptr<IPlatformSecurityManager>(),
+                ioServicePool->getIOService(),
+                std::make_unique<MqttMulticastAddressCalculator>(
+                        clusterControllerSettings.getMqttMulticastTopicPrefix(), gbids),
+                "globalAddress",
+                "messageNotificationProviderParticipantId",
+                std::vector<std::shared_ptr<ITransportStatus>>(),
+                std::make_unique<MessageQueue<std::string>>(),
+                std::make_unique<MessageQueue<std::shared_ptr<ITransportStatus>>>(),
+                ownAddress,
+                gbids);
+        messageRouter->init();
+
+        for (std::size_t i = 0; i < messagesPerRun; ++i) {
+            MutableMessage message;
+            message.setType(Message::VALUE_MESSAGE_TYPE_REQUEST());
+            message.setSender("consumer");
+            message.setRecipient("participantId-" + std::to_string(i % numberOfParticipants));
+            // the queue only holds references to the messages, they are queued in every run
+            message.setExpiryDate(TimePoint::fromRelativeMs(3600000));
+            messages.push_back(message.getImmutableMessage());
+        }
+    }
+
+    ~MessageNotificationTest()
+    {
+        messageRouter->shutdown();
+        ioServicePool->stop();
+    }
+
+    void queueMessages(bool withSubscriber)
+    {
+        std::shared_ptr<UnicastBroadcastListener> listener;
+        if (withSubscriber) {
+            listener = std::make_shared<UnicastBroadcastListener>(
+                    "subscriptionId", std::weak_ptr<PublicationManager>());
+            messageRouter->getMessageNotificationProvider()->registerBroadcastListener(
+                    "messageQueuedForDelivery", listener);
+        }
+        const std::string testName = std::string("queue ") + std::to_string(messagesPerRun) +
+                                     " messages, " + (withSubscriber ? "one" : "no") +
+                                     " subscriber";
+        runAndPrintAverage(runs, testName, [this]() {
+            for (const auto& message : messages) {
+                messageRouter->route(message);
+            }
+        });
+        if (listener) {
+            messageRouter->getMessageNotificationProvider()->unregisterBroadcastListener(
+                    "messageQueuedForDelivery", listener);
+        }
+    }
+
+private:
+    static constexpr std::size_t messagesPerRun = 1000;
+
+    const std::uint64_t runs;
+    Settings settings;
+    MessagingSettings messagingSettings;
+    ClusterControllerSettings clusterControllerSettings;
+    std::shared_ptr<IOServicePool> ioServicePool;
+    const system::RoutingTypes::Address ownAddress;
+    std::vector<std::shared_ptr<ImmutableMessage>> messages;
+    std::shared_ptr<CcMessageRouter> messageRouter;
+};
+
+#endif // MESSAGE_NOTIFICATION_TEST_H
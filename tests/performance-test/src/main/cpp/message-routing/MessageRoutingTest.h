@@ -0,0 +1,211 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef MESSAGE_ROUTING_TEST_H
+#define MESSAGE_ROUTING_TEST_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/MutableMessage.h"
+
+/**
+ * Measures the decisions taken on the type of every routed message: the dispatch of a received
+ * message, the reply check of the cluster controller router, the consumer permission check of
+ * the access controller and the registration of the replyTo address of global requests.
+ * classifyByTypeString compares the type header with the type strings as done before the type
+ * was decoded into a MessageType, classifyByMessageType uses the decoded MessageType.
+ */
+struct MessageRoutingTest : public PerformanceTest {
+    explicit MessageRoutingTest(std::uint64_t runs) : runs(runs), messages()
+    {
+        using joynr::Message;
+        const std::vector<std::string> types = {
+                Message::VALUE_MESSAGE_TYPE_ONE_WAY(),
+                Message::VALUE_MESSAGE_TYPE_REPLY(),
+                Message::VALUE_MESSAGE_TYPE_REQUEST(),
+                Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST(),
+                Message::VALUE_MESSAGE_TYPE_BATCH_REPLY(),
+                Message::VALUE_MESSAGE_TYPE_PUBLICATION(),
+                Message::VALUE_MESSAGE_TYPE_MULTICAST(),
+                Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY(),
+                Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST(),
+                Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST(),
+                Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST(),
+                Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP()};
+        for (const std::string& type : types) {
+            joynr::MutableMessage message;
+            message.setType(type);
+            messages.push_back(message.getImmutableMessage());
+        }
+    }
+
+    void classifyByTypeString()
+    {
+        runAndPrintAverage(runs, "classifyByTypeString", [this]() {
+            std::uint64_t decisions = 0;
+            for (std::size_t i = 0; i < messagesPerRun; ++i) {
+                for (const auto& message : messages) {
+                    decisions += classify(message->getType());
+                }
+            }
+            return decisions;
+        });
+    }
+
+    void classifyByMessageType()
+    {
+        runAndPrintAverage(runs, "classifyByMessageType", [this]() {
+            std::uint64_t decisions = 0;
+            for (std::size_t i = 0; i < messagesPerRun; ++i) {
+                for (const auto& message : messages) {
+                    decisions += classify(message->getMessageType());
+                }
+            }
+            return decisions;
+        });
+    }
+
+private:
+    static constexpr std::size_t messagesPerRun = 1000;
+
+    static std::uint64_t classify(const std::string& type)
+    {
+        using joynr::Message;
+        std::uint64_t result = 0;
+        if (type == Message::VALUE_MESSAGE_TYPE_REQUEST()) {
+            result = 1;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_REPLY()) {
+            result = 2;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST()) {
+            result = 3;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_BATCH_REPLY()) {
+            result = 4;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_ONE_WAY()) {
+            result = 5;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST()) {
+            result = 6;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST()) {
+            result = 7;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+            result = 8;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+            result = 9;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_MULTICAST()) {
+            result = 10;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_PUBLICATION()) {
+            result = 11;
+        } else if (type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_STOP()) {
+            result = 12;
+        }
+        if (type == Message::VALUE_MESSAGE_TYPE_REPLY() ||
+            type == Message::VALUE_MESSAGE_TYPE_BATCH_REPLY() ||
+            type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY() ||
+            type == Message::VALUE_MESSAGE_TYPE_PUBLICATION()) {
+            result += 16;
+        }
+        if (type == Message::VALUE_MESSAGE_TYPE_MULTICAST() ||
+            type == Message::VALUE_MESSAGE_TYPE_PUBLICATION() ||
+            type == Message::VALUE_MESSAGE_TYPE_REPLY() ||
+            type == Message::VALUE_MESSAGE_TYPE_BATCH_REPLY() ||
+            type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REPLY()) {
+            result += 32;
+        }
+        if (type == Message::VALUE_MESSAGE_TYPE_REQUEST() ||
+            type == Message::VALUE_MESSAGE_TYPE_BATCH_REQUEST() ||
+            type == Message::VALUE_MESSAGE_TYPE_SUBSCRIPTION_REQUEST() ||
+            type == Message::VALUE_MESSAGE_TYPE_BROADCAST_SUBSCRIPTION_REQUEST() ||
+            type == Message::VALUE_MESSAGE_TYPE_MULTICAST_SUBSCRIPTION_REQUEST()) {
+            result += 64;
+        }
+        return result;
+    }
+
+    static std::uint64_t classify(joynr::MessageType type)
+    {
+        using joynr::MessageType;
+        std::uint64_t result = 0;
+        switch (type) {
+        case MessageType::REQUEST:
+            result = 1;
+            break;
+        case MessageType::REPLY:
+            result = 2;
+            break;
+        case MessageType::BATCH_REQUEST:
+            result = 3;
+            break;
+        case MessageType::BATCH_REPLY:
+            result = 4;
+            break;
+        case MessageType::ONE_WAY:
+            result = 5;
+            break;
+        case MessageType::SUBSCRIPTION_REQUEST:
+            result = 6;
+            break;
+        case MessageType::BROADCAST_SUBSCRIPTION_REQUEST:
+            result = 7;
+            break;
+        case MessageType::MULTICAST_SUBSCRIPTION_REQUEST:
+            result = 8;
+            break;
+        case MessageType::SUBSCRIPTION_REPLY:
+            result = 9;
+            break;
+        case MessageType::MULTICAST:
+            result = 10;
+            break;
+        case MessageType::PUBLICATION:
+            result = 11;
+            break;
+        case MessageType::SUBSCRIPTION_STOP:
+            result = 12;
+            break;
+        case MessageType::UNKNOWN:
+            break;
+        }
+        if (type == MessageType::REPLY || type == MessageType::BATCH_REPLY ||
+            type == MessageType::SUBSCRIPTION_REPLY || type == MessageType::PUBLICATION) {
+            result += 16;
+        }
+        if (type == MessageType::MULTICAST || type == MessageType::PUBLICATION ||
+            type == MessageType::REPLY || type == MessageType::BATCH_REPLY ||
+            type == MessageType::SUBSCRIPTION_REPLY) {
+            result += 32;
+        }
+        if (type == MessageType::REQUEST || type == MessageType::BATCH_REQUEST ||
+            type == MessageType::SUBSCRIPTION_REQUEST ||
+            type == MessageType::BROADCAST_SUBSCRIPTION_REQUEST ||
+            type == MessageType::MULTICAST_SUBSCRIPTION_REQUEST) {
+            result += 64;
+        }
+        return result;
+    }
+
+    const std::uint64_t runs;
+    std::vector<std::unique_ptr<joynr::ImmutableMessage>> messages;
+};
+
+#endif // MESSAGE_ROUTING_TEST_H
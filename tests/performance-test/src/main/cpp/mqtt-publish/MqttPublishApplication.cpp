@@ -0,0 +1,71 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "MqttPublishTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::string brokerUrl;
+    std::size_t runs;
+    std::uint32_t maxConnections;
+    std::size_t payloadSize;
+
+    auto validateRuns = [](std::size_t value) {
+        if (value == 0) {
+            throw po::validation_error(
+                    po::validation_error::invalid_option_value, "runs", std::to_string(value));
+        }
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "brokerUrl,b",
+            po::value(&brokerUrl)->default_value("mqtt://localhost:1883"),
+            "url of the local MQTT broker")(
+            "runs,r", po::value(&runs)->required()->notifier(validateRuns), "number of messages")(
+            "maxConnections,c",
+            po::value(&maxConnections)->default_value(4),
+            "measure with 1 up to maxConnections connections")(
+            "payloadSize,p", po::value(&payloadSize)->default_value(100), "payload size in bytes");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        const std::size_t numberOfTopics = 64;
+        MqttPublishTest test(brokerUrl, runs, payloadSize, numberOfTopics);
+        for (std::uint32_t connections = 1; connections <= maxConnections; connections++) {
+            test.publishSingle(connections);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef MQTT_PUBLISH_TEST_H
+#define MQTT_PUBLISH_TEST_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/BrokerUrl.h"
+#include "joynr/ClusterControllerSettings.h"
+#include "joynr/ImmutableMessage.h"
+#include "joynr/Message.h"
+#include "joynr/MutableMessage.h"
+#include "joynr/Settings.h"
+#include "joynr/exceptions/JoynrException.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+
+#include "libjoynrclustercontroller/mqtt/MosquittoConnection.h"
+#include "libjoynrclustercontroller/mqtt/MqttSender.h"
+
+using namespace joynr;
+
+/**
+ * Measures the publish throughput of MqttSender and MosquittoConnection against a local
+ * MQTT broker, depending on the number of MQTT connections per GBID.
+ */
+struct MqttPublishTest : public PerformanceTest {
+    MqttPublishTest(const std::string& brokerUrl,
+                    std::uint64_t runs,
+                    std::size_t payloadSize,
+                    std::size_t numberOfTopics)
+            : brokerUrl(brokerUrl),
+              runs(runs),
+              settings(std::make_unique<Settings>()),
+              ccSettings(*settings),
+              addresses(),
+              messages()
+    {
+        for (std::size_t i = 0; i < numberOfTopics; i++) {
+            addresses.emplace_back(brokerUrl, "mqtt-publish-benchmark/topic" + std::to_string(i));
+        }
+        for (std::size_t i = 0; i < numberOfTopics; i++) {
+            MutableMessage mutableMessage;
+            mutableMessage.setType(Message::VALUE_MESSAGE_TYPE_ONE_WAY());
+            mutableMessage.setSender("mqtt-publish-benchmark-sender");
+            mutableMessage.setRecipient("mqtt-publish-benchmark-recipient" + std::to_string(i));
+            mutableMessage.setExpiryDate(TimePoint::fromRelativeMs(60000));
+            mutableMessage.setPayload(std::string(payloadSize, '#'));
+            messages.push_back(mutableMessage.getImmutableMessage());
+        }
+    }
+
+    /**
+     * Sends the messages one by one through an MqttSender using the given number of
+     * connections.
+     */
+    void publishSingle(std::uint32_t numberOfConnections)
+    {
+        auto connections = startConnections(numberOfConnections);
+        MqttSender sender(connections.front(),
+                          std::vector<std::shared_ptr<MosquittoConnection>>(
+                                  connections.begin() + 1, connections.end()));
+        std::uint64_t failures = 0;
+        auto onFailure = [&failures](const exceptions::JoynrRuntimeException&) { failures++; };
+
+        std::size_t index = 0;
+        auto fun = [&]() {
+            sender.sendMessage(addresses[index], messages[index], onFailure);
+            index = (index + 1) % messages.size();
+        };
+        runAndPrintAverage(runs,
+                           "MqttSender::sendMessage connections: " +
+                                   std::to_string(numberOfConnections),
+                           fun);
+        std::cerr << "failures:\t\t" << failures << std::endl;
+        stopConnections(connections);
+    }
+
+private:
+    std::vector<std::shared_ptr<MosquittoConnection>> startConnections(
+            std::uint32_t numberOfConnections)
+    {
+        std::vector<std::shared_ptr<MosquittoConnection>> connections;
+        const std::string clientId = "mqtt-publish-benchmark-" + std::to_string(getpid());
+        for (std::uint32_t i = 0; i < numberOfConnections; i++) {
+            const bool isPublishOnly = i > 0;
+            auto connection = std::make_shared<MosquittoConnection>(
+                    ccSettings,
+                    BrokerUrl(brokerUrl),
+                    std::chrono::seconds(60),
+                    std::chrono::seconds(1),
+                    std::chrono::seconds(1),
+                    false,
+                    isPublishOnly ? clientId + "-pub" + std::to_string(i) : clientId,
+                    "mqtt-publish-benchmark",
+                    false,
+                    isPublishOnly,
+                    i);
+            if (!isPublishOnly) {
+                connection->registerChannelId(clientId);
+            }
+            connection->start();
+            connections.push_back(std::move(connection));
+        }
+        for (const auto& connection : connections) {
+            while (!(connection->isPublishOnly() ? connection->isReadyToSend()
+                                                 : connection->isSubscribedToChannelTopic())) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+        return connections;
+    }
+
+    void stopConnections(std::vector<std::shared_ptr<MosquittoConnection>>& connections)
+    {
+        for (const auto& connection : connections) {
+            connection->stop();
+        }
+        connections.clear();
+    }
+
+    const std::string brokerUrl;
+    const std::uint64_t runs;
+    std::unique_ptr<Settings> settings;
+    ClusterControllerSettings ccSettings;
+    std::vector<system::RoutingTypes::MqttAddress> addresses;
+    std::vector<std::shared_ptr<ImmutableMessage>> messages;
+};
+
+#endif // MQTT_PUBLISH_TEST_H
@@ -0,0 +1,182 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef ON_CHANGE_PUBLICATION_TEST_H
+#define ON_CHANGE_PUBLICATION_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/IPublicationSender.h"
+#include "joynr/InterfaceRegistrar.h"
+#include "joynr/MessagingQos.h"
+#include "joynr/OnChangeSubscriptionQos.h"
+#include "joynr/PublicationManager.h"
+#include "joynr/SingleThreadedIOService.h"
+#include "joynr/SubscriptionPublication.h"
+#include "joynr/SubscriptionReply.h"
+#include "joynr/SubscriptionRequest.h"
+#include "joynr/tests/performance/DefaultEchoProvider.h"
+#include "joynr/tests/performance/EchoRequestCaller.h"
+#include "joynr/tests/performance/EchoRequestInterpreter.h"
+
+using namespace joynr;
+
+/**
+ * Counts the publications instead of sending them, so that only the bookkeeping
+ * of the PublicationManager is measured.
+ */
+class CountingPublicationSender : public IPublicationSender
+{
+public:
+    CountingPublicationSender() : _publications(0)
+    {
+    }
+
+    void sendSubscriptionPublication(const std::string& /*senderParticipantId*/,
+                                     const std::string& /*receiverParticipantId*/,
+                                     const MessagingQos& /*qos*/,
+                                     SubscriptionPublication&& /*subscriptionPublication*/) override
+    {
+        ++_publications;
+    }
+
+    void sendSubscriptionReply(const std::string& /*senderParticipantId*/,
+                               const std::string& /*receiverParticipantId*/,
+                               const MessagingQos& /*qos*/,
+                               const SubscriptionReply& /*subscriptionReply*/) override
+    {
+    }
+
+    std::uint64_t getPublications() const
+    {
+        return _publications;
+    }
+
+private:
+    std::atomic<std::uint64_t> _publications;
+};
+
+/**
+ * Measures the attribute change handling of the PublicationManager for a provider
+ * with many on-change subscriptions of the same attribute.
+ */
+struct OnChangePublicationTest : public PerformanceTest {
+    OnChangePublicationTest(std::uint64_t runs, std::size_t numberOfSubscriptions)
+            : runs(runs),
+              singleThreadedIOService(std::make_shared<SingleThreadedIOService>()),
+              provider(std::make_shared<tests::performance::DefaultEchoProvider>()),
+              publicationSender(std::make_shared<CountingPublicationSender>()),
+              publicationManager(),
+              subscriptionIds()
+    {
+        singleThreadedIOService->start();
+        InterfaceRegistrar::instance()
+                .registerRequestInterpreter<tests::performance::EchoRequestInterpreter>(
+                        tests::performance::EchoProvider::INTERFACE_NAME());
+        publicationManager = std::make_shared<PublicationManager>(
+                singleThreadedIOService->getIOService(), std::weak_ptr<IMessageSender>());
+
+        auto requestCaller = std::make_shared<tests::performance::EchoRequestCaller>(provider);
+        const std::int64_t validityMs = 60 * 60 * 1000;
+        const std::int64_t publicationTtlMs = 10000;
+        const std::int64_t minIntervalMs = 0;
+        for (std::size_t i = 0; i < numberOfSubscriptions; i++) {
+            SubscriptionRequest subscriptionRequest;
+            subscriptionRequest.setSubscribeToName("simpleAttribute");
+            subscriptionRequest.setQos(std::make_shared<OnChangeSubscriptionQos>(
+                    validityMs, publicationTtlMs, minIntervalMs));
+            subscriptionIds.push_back(subscriptionRequest.getSubscriptionId());
+            publicationManager->add("proxyParticipantId",
+                                    "providerParticipantId",
+                                    requestCaller,
+                                    subscriptionRequest,
+                                    publicationSender);
+        }
+        waitForPublications(numberOfSubscriptions);
+    }
+
+    ~OnChangePublicationTest()
+    {
+        publicationManager->shutdown();
+        singleThreadedIOService->stop();
+    }
+
+    /**
+     * Changes the attribute via the provider, i.e. every attribute listener is notified.
+     */
+    void attributeChangedByProvider()
+    {
+        std::uint64_t counter = 0;
+        auto fun = [this, &counter]() {
+            provider->simpleAttributeChanged("value" + std::to_string(counter++));
+        };
+        runAndPrintAverage(runs,
+                           "attributeChangedByProvider, subscriptions: " +
+                                   std::to_string(subscriptionIds.size()),
+                           fun);
+    }
+
+    /**
+     * Notifies the PublicationManager of a changed value for single subscriptions,
+     * which requires a lookup by subscriptionId.
+     */
+    void attributeValueChangedBySubscriptionId()
+    {
+        std::uint64_t counter = 0;
+        auto fun = [this, &counter]() {
+            const std::string& subscriptionId = subscriptionIds[counter % subscriptionIds.size()];
+            publicationManager->attributeValueChanged(
+                    subscriptionId, "value" + std::to_string(counter++));
+        };
+        runAndPrintAverage(runs,
+                           "attributeValueChangedBySubscriptionId, subscriptions: " +
+                                   std::to_string(subscriptionIds.size()),
+                           fun);
+    }
+
+private:
+    void waitForPublications(std::uint64_t expectedPublications)
+    {
+        const auto timeout = std::chrono::seconds(60);
+        const auto start = Clock::now();
+        while (publicationSender->getPublications() < expectedPublications) {
+            if (Clock::now() - start > timeout) {
+                throw std::runtime_error("initial publications were not sent in time");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    const std::uint64_t runs;
+    std::shared_ptr<SingleThreadedIOService> singleThreadedIOService;
+    std::shared_ptr<tests::performance::DefaultEchoProvider> provider;
+    std::shared_ptr<CountingPublicationSender> publicationSender;
+    std::shared_ptr<PublicationManager> publicationManager;
+    std::vector<std::string> subscriptionIds;
+};
+
+#endif // ON_CHANGE_PUBLICATION_TEST_H
@@ -0,0 +1,87 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#include <boost/program_options.hpp>
+
+#include "ProviderRegistrationTest.h"
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::size_t runs;
+    std::size_t numberOfProviders;
+    std::size_t roundTripTimeMs;
+    std::size_t syncDelayMs;
+    std::size_t coalescingWindowMs;
+
+    auto validatePositive = [](const std::string& name) {
+        return [name](std::size_t value) {
+            if (value == 0) {
+                throw po::validation_error(
+                        po::validation_error::invalid_option_value, name, std::to_string(value));
+            }
+        };
+    };
+
+    po::options_description desc("Available options");
+    desc.add_options()("help,h", "produce help message")(
+            "runs,r",
+            po::value(&runs)->required()->notifier(validatePositive("runs")),
+            "number of runs, each run registers all providers")(
+            "providers,p",
+            po::value(&numberOfProviders)
+                    ->default_value(500)
+                    ->notifier(validatePositive("providers")),
+            "number of providers registered per run")(
+            "round-trip-time-ms,t",
+            po::value(&roundTripTimeMs)->default_value(1),
+            "time in milliseconds until the discovery stand-in replies to an add call")(
+            "sync-delay-ms,s",
+            po::value(&syncDelayMs)->default_value(20),
+            "time in milliseconds added to every fsync to simulate slow flash storage")(
+            "coalescing-window-ms,c",
+            po::value(&coalescingWindowMs)->default_value(100),
+            "time in milliseconds the background writer collects writes to the same file");
+
+    try {
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc << std::endl;
+            return EXIT_FAILURE;
+        }
+        po::notify(vm);
+
+        ProviderRegistrationTest test(runs,
+                                      numberOfProviders,
+                                      std::chrono::milliseconds(roundTripTimeMs),
+                                      std::chrono::milliseconds(syncDelayMs),
+                                      std::chrono::milliseconds(coalescingWindowMs));
+        test.registerOneByOne();
+        test.registerInBulk();
+        test.registerOneByOneOnSlowStorage(true);
+        test.registerOneByOneOnSlowStorage(false);
+    } catch (const std::exception& e) {
+        std::cerr << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,501 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef PROVIDER_REGISTRATION_TEST_H
+#define PROVIDER_REGISTRATION_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/AsyncFileWriter.h"
+#include "joynr/CapabilitiesRegistrar.h"
+#include "joynr/IDispatcher.h"
+#include "joynr/IMessageRouter.h"
+#include "joynr/IOServicePool.h"
+#include "joynr/ParticipantIdStorage.h"
+#include "joynr/ProviderRegistration.h"
+#include "joynr/Semaphore.h"
+#include "joynr/system/IDiscovery.h"
+#include "joynr/tests/performance/DefaultEchoProvider.h"
+#include "joynr/tests/performance/EchoRequestCaller.h"
+#include "joynr/types/ProviderQos.h"
+#include "joynr/types/ProviderScope.h"
+
+using namespace joynr;
+
+/**
+ * Stand-in for the local discovery of the cluster controller which acknowledges every add after
+ * a fixed round trip time. All other calls are not used by the registration.
+ */
+class DiscoveryStandIn : public system::IDiscoveryAsync
+{
+public:
+    DiscoveryStandIn(boost::asio::io_service& ioService, std::chrono::milliseconds roundTripTime)
+            : ioService(ioService), roundTripTime(roundTripTime)
+    {
+    }
+
+    std::shared_ptr<Future<void>> addAsync(
+            const types::DiscoveryEntry&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return reply(std::move(onSuccess));
+    }
+
+    std::shared_ptr<Future<void>> addAsync(
+            const types::DiscoveryEntry&,
+            const bool&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return reply(std::move(onSuccess));
+    }
+
+    std::shared_ptr<Future<void>> addAsync(
+            const types::DiscoveryEntry&,
+            const bool&,
+            const std::vector<std::string>&,
+            std::function<void()> onSuccess,
+            std::function<void(const types::DiscoveryError::Enum&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return reply(std::move(onSuccess));
+    }
+
+    std::shared_ptr<Future<void>> addToAllAsync(
+            const types::DiscoveryEntry&,
+            const bool&,
+            std::function<void()> onSuccess,
+            std::function<void(const types::DiscoveryError::Enum&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return reply(std::move(onSuccess));
+    }
+
+    std::shared_ptr<Future<types::DiscoveryEntryWithMetaInfo>> lookupAsync(
+            const std::string&,
+            std::function<void(const types::DiscoveryEntryWithMetaInfo&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<Future<types::DiscoveryEntryWithMetaInfo>> lookupAsync(
+            const std::string&,
+            const types::DiscoveryQos&,
+            const std::vector<std::string>&,
+            std::function<void(const types::DiscoveryEntryWithMetaInfo&)>,
+            std::function<void(const types::DiscoveryError::Enum&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<Future<std::vector<types::DiscoveryEntryWithMetaInfo>>> lookupAsync(
+            const std::vector<std::string>&,
+            const std::string&,
+            const types::DiscoveryQos&,
+            std::function<void(const std::vector<types::DiscoveryEntryWithMetaInfo>&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<Future<std::vector<types::DiscoveryEntryWithMetaInfo>>> lookupAsync(
+            const std::vector<std::string>&,
+            const std::string&,
+            const types::DiscoveryQos&,
+            const std::vector<std::string>&,
+            std::function<void(const std::vector<types::DiscoveryEntryWithMetaInfo>&)>,
+            std::function<void(const types::DiscoveryError::Enum&)>,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<Future<void>> removeAsync(
+            const std::string&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::JoynrRuntimeException&)>,
+            boost::optional<MessagingQos>) noexcept override
+    {
+        return reply(std::move(onSuccess));
+    }
+
+private:
+    std::shared_ptr<Future<void>> reply(std::function<void()> onSuccess)
+    {
+        auto future = std::make_shared<Future<void>>();
+        auto timer = std::make_shared<boost::asio::steady_timer>(ioService, roundTripTime);
+        timer->async_wait([timer, future, onSuccess = std::move(onSuccess)](
+                                  const boost::system::error_code&) {
+            future->onSuccess();
+            onSuccess();
+        });
+        return future;
+    }
+
+    boost::asio::io_service& ioService;
+    const std::chrono::milliseconds roundTripTime;
+};
+
+/**
+ * Stand-in for the dispatcher which only accepts the request callers.
+ */
+class DispatcherStandIn : public IDispatcher
+{
+public:
+    void addReplyCaller(const std::string&,
+                        std::shared_ptr<IReplyCaller>,
+                        const MessagingQos&) override
+    {
+    }
+
+    void addRequestCaller(const std::string&, std::shared_ptr<RequestCaller>) override
+    {
+    }
+
+    void removeRequestCaller(const std::string&) override
+    {
+    }
+
+    void receive(std::shared_ptr<ImmutableMessage>) override
+    {
+    }
+
+    void registerSubscriptionManager(std::shared_ptr<ISubscriptionManager>) override
+    {
+    }
+
+    void registerPublicationManager(std::weak_ptr<PublicationManager>) override
+    {
+    }
+
+    void init() override
+    {
+    }
+
+    void shutdown() override
+    {
+    }
+};
+
+/**
+ * Stand-in for the message router which accepts every next hop.
+ */
+class MessageRouterStandIn : public IMessageRouter
+{
+public:
+    void route(std::shared_ptr<ImmutableMessage>, std::uint32_t) override
+    {
+    }
+
+    void addNextHop(const std::string&,
+                    const std::shared_ptr<const system::RoutingTypes::Address>&,
+                    bool,
+                    const std::int64_t,
+                    const bool,
+                    std::function<void()> onSuccess,
+                    std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void addNextHops(std::vector<NextHop> nextHops,
+                     std::function<void(const std::vector<bool>&)> onResult) override
+    {
+        if (onResult) {
+            onResult(std::vector<bool>(nextHops.size(), true));
+        }
+    }
+
+    void removeNextHop(const std::string&,
+                       std::function<void()> onSuccess,
+                       std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void addMulticastReceiver(
+            const std::string&,
+            const std::string&,
+            const std::string&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void removeMulticastReceiver(
+            const std::string&,
+            const std::string&,
+            const std::string&,
+            std::function<void()> onSuccess,
+            std::function<void(const exceptions::ProviderRuntimeException&)>) override
+    {
+        if (onSuccess) {
+            onSuccess();
+        }
+    }
+
+    void sendQueuedMessages(std::shared_ptr<const system::RoutingTypes::Address>) override
+    {
+    }
+
+    void setToKnown(const std::string&) override
+    {
+    }
+};
+
+/**
+ * ParticipantIdStorage which waits until every new participantId has been synced to the storage,
+ * like the synchronous persistence without an AsyncFileWriter.
+ */
+class DurableParticipantIdStorage : public ParticipantIdStorage
+{
+public:
+    DurableParticipantIdStorage(const std::string& filename,
+                                std::shared_ptr<AsyncFileWriter> fileWriter)
+            : ParticipantIdStorage(filename, fileWriter), fileWriter(std::move(fileWriter))
+    {
+    }
+
+    void setProviderParticipantId(const std::string& domain,
+                                  const std::string& interfaceName,
+                                  std::int32_t majorVersion,
+                                  const std::string& participantId) override
+    {
+        ParticipantIdStorage::setProviderParticipantId(
+                domain, interfaceName, majorVersion, participantId);
+        fileWriter->flush();
+    }
+
+    void setProviderParticipantIds(
+            const std::vector<ProviderParticipantId>& providerParticipantIds) override
+    {
+        ParticipantIdStorage::setProviderParticipantIds(providerParticipantIds);
+        fileWriter->flush();
+    }
+
+private:
+    std::shared_ptr<AsyncFileWriter> fileWriter;
+};
+
+/**
+ * Measures the startup time of an application which registers many providers, i.e. the time
+ * until all providers are registered at the local discovery. The participantIds are persisted
+ * to a fresh file in every run. Providers registered one by one each persist their participantId
+ * with a separate fsync, a bulk registration persists all of them at once.
+ * Slow flash storage is simulated by delaying every fsync of an AsyncFileWriter by syncDelay.
+ */
+struct ProviderRegistrationTest : public PerformanceTest {
+    ProviderRegistrationTest(std::uint64_t runs,
+                             std::size_t numberOfProviders,
+                             std::chrono::milliseconds roundTripTime,
+                             std::chrono::milliseconds syncDelay,
+                             std::chrono::milliseconds coalescingWindow)
+            : runs(runs),
+              numberOfProviders(numberOfProviders),
+              syncDelay(syncDelay),
+              coalescingWindow(coalescingWindow),
+              discoveryPool(std::make_shared<IOServicePool>(1)),
+              discovery(std::make_shared<DiscoveryStandIn>(discoveryPool->getIOService(),
+                                                           roundTripTime)),
+              dispatcher(std::make_shared<DispatcherStandIn>()),
+              messageRouter(std::make_shared<MessageRouterStandIn>()),
+              providers()
+    {
+        discoveryPool->start();
+        providers.reserve(numberOfProviders);
+        for (std::size_t i = 0; i < numberOfProviders; ++i) {
+            providers.push_back(std::make_shared<tests::performance::DefaultEchoProvider>());
+        }
+    }
+
+    ~ProviderRegistrationTest()
+    {
+        discoveryPool->stop();
+        std::remove(storageFile().c_str());
+    }
+
+    /**
+     * Registers all providers without waiting in between, each with its own registration call.
+     */
+    void registerOneByOne()
+    {
+        runAndPrintAverage(runs, "registerOneByOne", [this]() {
+            registerAllOneByOne(*createCapabilitiesRegistrar(createParticipantIdStorage()));
+        });
+    }
+
+    /**
+     * Registers all providers one by one on slow storage. If awaitPersistence is set, every
+     * registration waits until its participantId has been synced, otherwise the participantIds
+     * are written in the background and synced once after all registrations.
+     */
+    void registerOneByOneOnSlowStorage(bool awaitPersistence)
+    {
+        const std::string name = std::string("registerOneByOneOnSlowStorage, ") +
+                                  (awaitPersistence ? "persistence awaited" : "background writer");
+        runAndPrintAverage(runs, name, [this, awaitPersistence]() {
+            auto fileWriter = std::make_shared<AsyncFileWriter>(coalescingWindow);
+            fileWriter->setSyncDelay(syncDelay);
+            registerAllOneByOne(*createCapabilitiesRegistrar(
+                    createParticipantIdStorage(fileWriter, awaitPersistence)));
+            fileWriter->flush();
+        });
+    }
+
+    /**
+     * Registers all providers with a single bulk registration call.
+     */
+    void registerInBulk()
+    {
+        runAndPrintAverage(runs, "registerInBulk", [this]() {
+            auto capabilitiesRegistrar = createCapabilitiesRegistrar(createParticipantIdStorage());
+            std::vector<ProviderRegistration> providerRegistrations;
+            providerRegistrations.reserve(numberOfProviders);
+            for (std::size_t i = 0; i < numberOfProviders; ++i) {
+                providerRegistrations.emplace_back(domain(i), providers[i], providerQos());
+            }
+            Semaphore registered(0);
+            std::atomic<bool> failed(false);
+            capabilitiesRegistrar->addAsync(
+                    std::move(providerRegistrations),
+                    [&registered]() { registered.notify(); },
+                    [&registered, &failed](const exceptions::JoynrRuntimeException&) {
+                        failed = true;
+                        registered.notify();
+                    });
+            waitForRegistration(registered, failed);
+        });
+    }
+
+private:
+    static const std::string& storageFile()
+    {
+        static const std::string value("provider-registration-test.persist");
+        return value;
+    }
+
+    static std::string domain(std::size_t i)
+    {
+        return "com.example.domain" + std::to_string(i);
+    }
+
+    static types::ProviderQos providerQos()
+    {
+        types::ProviderQos providerQos;
+        providerQos.setScope(types::ProviderScope::GLOBAL);
+        return providerQos;
+    }
+
+    void registerAllOneByOne(CapabilitiesRegistrar& capabilitiesRegistrar)
+    {
+        Semaphore registered(0);
+        std::atomic<bool> failed(false);
+        auto onSuccess = [&registered]() { registered.notify(); };
+        auto onError = [&registered, &failed](const exceptions::JoynrRuntimeException&) {
+            failed = true;
+            registered.notify();
+        };
+        for (std::size_t i = 0; i < numberOfProviders; ++i) {
+            capabilitiesRegistrar.addAsync(
+                    domain(i), providers[i], providerQos(), onSuccess, onError);
+        }
+        for (std::size_t i = 0; i < numberOfProviders; ++i) {
+            waitForRegistration(registered, failed);
+        }
+    }
+
+    static void waitForRegistration(Semaphore& registered, const std::atomic<bool>& failed)
+    {
+        if (!registered.waitFor(std::chrono::seconds(60))) {
+            throw std::runtime_error("registration timed out");
+        }
+        if (failed) {
+            throw std::runtime_error("registration failed");
+        }
+    }
+
+    static std::shared_ptr<ParticipantIdStorage> createParticipantIdStorage(
+            std::shared_ptr<AsyncFileWriter> fileWriter = nullptr,
+            bool awaitPersistence = false)
+    {
+        // every run persists all participantIds anew
+        std::remove(storageFile().c_str());
+        if (awaitPersistence) {
+            return std::make_shared<DurableParticipantIdStorage>(storageFile(),
+                                                                 std::move(fileWriter));
+        }
+        return std::make_shared<ParticipantIdStorage>(storageFile(), std::move(fileWriter));
+    }
+
+    std::unique_ptr<CapabilitiesRegistrar> createCapabilitiesRegistrar(
+            std::shared_ptr<ParticipantIdStorage> participantIdStorage)
+    {
+        return std::make_unique<CapabilitiesRegistrar>(
+                dispatcher,
+                discovery,
+                std::move(participantIdStorage),
+                nullptr,
+                messageRouter,
+                60 * 60 * 1000,
+                std::weak_ptr<PublicationManager>(),
+                "globalAddress");
+    }
+
+    const std::uint64_t runs;
+    const std::size_t numberOfProviders;
+    const std::chrono::milliseconds syncDelay;
+    const std::chrono::milliseconds coalescingWindow;
+    std::shared_ptr<IOServicePool> discoveryPool;
+    std::shared_ptr<DiscoveryStandIn> discovery;
+    std::shared_ptr<DispatcherStandIn> dispatcher;
+    std::shared_ptr<MessageRouterStandIn> messageRouter;
+    std::vector<std::shared_ptr<tests::performance::EchoProvider>> providers;
+};
+
+#endif // PROVIDER_REGISTRATION_TEST_H
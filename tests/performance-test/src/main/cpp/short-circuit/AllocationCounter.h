@@ -0,0 +1,47 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Counts the calls of the global operator new, which is replaced in ShortCircuitApplication.cpp.
+ */
+struct AllocationCounter {
+    static std::atomic<std::uint64_t>& allocations()
+    {
+        static std::atomic<std::uint64_t> counter(0);
+        return counter;
+    }
+
+    static std::uint64_t get()
+    {
+        return allocations().load(std::memory_order_relaxed);
+    }
+
+    static void increment()
+    {
+        allocations().fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+#endif // ALLOCATION_COUNTER_H
@@ -17,6 +17,9 @@
  * #L%
  */
 
+#include <cstdlib>
+#include <new>
+
 #include <boost/program_options.hpp>
 
 #include "joynr/system/RoutingTypes/Address.h"
@@ -30,6 +33,26 @@
 #include "../common/Enum.h"
 JOYNR_ENUM(TestCase, (SEND_STRING)(SEND_BYTEARRAY)(SEND_STRUCT));
 
+// count all heap allocations to report the allocations per call
+void* operator new(std::size_t size)
+{
+    AllocationCounter::increment();
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
 int main(int argc, char* argv[])
 {
 #ifdef JOYNR_ENABLE_DLT_LOGGING
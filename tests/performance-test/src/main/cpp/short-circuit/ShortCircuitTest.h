@@ -18,8 +18,12 @@
  */
 
 #include <algorithm>
+#include <cstdint>
+#include <iostream>
 #include <memory>
 #include <numeric>
+#include <string>
+#include <utility>
 
 #include "../common/PerformanceTest.h"
 #include "../provider/PerformanceTestEchoProvider.h"
@@ -27,6 +31,7 @@
 #include "joynr/tests/performance/EchoProxy.h"
 #include "joynr/types/ProviderQos.h"
 
+#include "AllocationCounter.h"
 #include "ShortCircuitRuntime.h"
 
 using namespace joynr;
@@ -69,7 +74,7 @@ struct ShortCircuitTest : public PerformanceTest {
             return result;
         };
         const std::string testName = "string length: " + std::to_string(length);
-        runAndPrintAverage(runs, testName, fun);
+        runAndPrintAllocations(testName, fun);
     }
 
     void roundTripStruct(std::size_t length)
@@ -84,7 +89,7 @@ struct ShortCircuitTest : public PerformanceTest {
         };
 
         const std::string testName = "byte[] size/string length: " + std::to_string(length);
-        runAndPrintAverage(runs, testName, fun);
+        runAndPrintAllocations(testName, fun);
     }
 
     void roundTripByteArray(std::size_t length)
@@ -97,10 +102,20 @@ struct ShortCircuitTest : public PerformanceTest {
         };
 
         const std::string testName = "byte[] size: " + std::to_string(length);
-        runAndPrintAverage(runs, testName, fun);
+        runAndPrintAllocations(testName, fun);
     }
 
 private:
+    // the count includes the few allocations for printing the statistics
+    template <typename Function>
+    void runAndPrintAllocations(const std::string& testName, Function&& fun)
+    {
+        const std::uint64_t allocationsBefore = AllocationCounter::get();
+        runAndPrintAverage(runs, testName, std::forward<Function>(fun));
+        const std::uint64_t allocations = AllocationCounter::get() - allocationsBefore;
+        std::cerr << "allocations/call:\t" << allocations / runs << std::endl;
+    }
+
     ByteArray getFilledVector(std::size_t length)
     {
         ByteArray data(length);
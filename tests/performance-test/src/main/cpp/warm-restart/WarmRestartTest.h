@@ -0,0 +1,105 @@
+/*
+ * #%L
+ * %%
+ * Copyright (C) 2026 BMW Car IT GmbH
+ * %%
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * #L%
+ */
+
+#ifndef WARM_RESTART_TEST_H
+#define WARM_RESTART_TEST_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "../common/PerformanceTest.h"
+#include "joynr/LocalCapabilitiesDirectoryStore.h"
+#include "joynr/TimePoint.h"
+#include "joynr/WarmRestartSnapshot.h"
+#include "joynr/system/RoutingTypes/MqttAddress.h"
+#include "joynr/types/DiscoveryEntry.h"
+#include "joynr/types/ProviderQos.h"
+#include "joynr/types/Version.h"
+
+using namespace joynr;
+
+/**
+ * Measures the cost of a warm restart of the cluster controller: writing the snapshot, reading
+ * it back at startup and restoring the global lookup cache from it. The snapshot contains
+ * numberOfEntries routing entries and as many cached discovery entries.
+ */
+struct WarmRestartTest : public PerformanceTest {
+    WarmRestartTest(std::uint64_t runs, std::size_t numberOfEntries, const std::string& fileName)
+            : runs(runs), fileName(fileName), snapshot()
+    {
+        const std::int64_t expiryDateMs = TimePoint::fromRelativeMs(3600000).toMilliseconds();
+        const std::int64_t nowMs = TimePoint::now().toMilliseconds();
+        for (std::size_t i = 0; i < numberOfEntries; ++i) {
+            const std::string participantId = "participantId-" + std::to_string(i);
+            auto address = std::make_shared<const system::RoutingTypes::MqttAddress>(
+                    "tcp://localhost:1883", "topic-" + std::to_string(i));
+            snapshot.routingEntries.push_back({participantId, address, true, expiryDateMs});
+
+            types::DiscoveryEntry entry(types::Version(1, 0),
+                                        "domain",
+                                        "interface-" + std::to_string(i),
+                                        "global-" + participantId,
+                                        types::ProviderQos(),
+                                        nowMs,
+                                        expiryDateMs,
+                                        "publicKeyId");
+            snapshot.globalCacheEntries.push_back({entry, {"joynrdefaultgbid"}, nowMs});
+        }
+    }
+
+    ~WarmRestartTest()
+    {
+        std::remove(fileName.c_str());
+    }
+
+    void save()
+    {
+        runAndPrintAverage(runs, "saveToFile", [this]() { snapshot.saveToFile(fileName); });
+    }
+
+    void load()
+    {
+        snapshot.saveToFile(fileName);
+        runAndPrintAverage(runs, "loadFromFile", [this]() {
+            if (!WarmRestartSnapshot::loadFromFile(fileName)) {
+                throw std::runtime_error("snapshot could not be loaded");
+            }
+        });
+    }
+
+    void restoreGlobalLookupCache()
+    {
+        runAndPrintAverage(runs, "restore global lookup cache", [this]() {
+            LocalCapabilitiesDirectoryStore store;
+            store.restoreWarmRestartSnapshot(snapshot);
+        });
+    }
+
+private:
+    const std::uint64_t runs;
+    const std::string fileName;
+    WarmRestartSnapshot snapshot;
+};
+
+#endif // WARM_RESTART_TEST_H
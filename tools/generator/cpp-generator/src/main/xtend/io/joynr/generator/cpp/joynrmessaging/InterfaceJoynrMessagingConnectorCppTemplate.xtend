@@ -92,6 +92,7 @@ request.setParams(
 '''
 «val interfaceName = francaIntf.joynrName»
 «val methodToErrorEnumName = francaIntf.methodToErrorEnumName()»
+«val cachedAttributes = getAttributes(francaIntf).filter[readable && notifiable]»
 «warning()»
 
 #include "«getPackagePathWithJoynrPrefix(francaIntf, "/", generateVersion)»/«interfaceName»JoynrMessagingConnector.h"
@@ -103,7 +104,10 @@ request.setParams(
 #include "joynr/Util.h"
 #include "joynr/SubscriptionStop.h"
 #include "joynr/Future.h"
+#include "joynr/PoolAllocator.h"
+#include <chrono>
 #include <cstdint>
+#include <stdexcept>
 #include "joynr/SubscriptionUtil.h"
 #include "joynr/exceptions/JoynrException.h"
 #include "joynr/exceptions/MethodInvocationException.h"
@@ -153,27 +157,78 @@ using joynr::util::safeInvokeCallback;
 		const std::string& proxyParticipantId,
 		const joynr::MessagingQos &qosSettings,
 		const joynr::types::DiscoveryEntryWithMetaInfo& providerDiscoveryEntry)
-	: joynr::AbstractJoynrMessagingConnector(messageSender, subscriptionManager, domain, INTERFACE_NAME(), proxyParticipantId, qosSettings, providerDiscoveryEntry)
+	: joynr::AbstractJoynrMessagingConnector(messageSender, subscriptionManager, domain, INTERFACE_NAME(), proxyParticipantId, qosSettings, providerDiscoveryEntry)«
+	»«FOR attribute: cachedAttributes»,
+	  _«attribute.joynrName»Cache(std::make_shared<joynr::CachedAttribute<«getTypeName(attribute, generateVersion)»>>())«
+	»«ENDFOR»
 {
 }
 
+void «className»::enableAttributeCache(std::int64_t maxAgeMs)
+{
+	if (maxAgeMs <= 0) {
+		throw std::invalid_argument("maxAgeMs of the attribute cache must be positive");
+	}
+	«IF cachedAttributes.empty»
+		JOYNR_LOG_DEBUG(logger(), "«interfaceName» has no readable and notifiable attributes to cache");
+	«ELSE»
+		disableAttributeCache();
+		const std::chrono::milliseconds maxAge(maxAgeMs);
+		«FOR attribute: cachedAttributes»
+			«val returnType = getTypeName(attribute, generateVersion)»
+			«val attributeName = attribute.joynrName»
+			{
+				joynr::SubscriptionRequest subscriptionRequest;
+				_«attributeName»Cache->enable(maxAge, subscriptionRequest.getSubscriptionId());
+				subscribeTo«attributeName.toFirstUpper»(
+						std::make_shared<joynr::CachedAttributeListener<«returnType»>>(_«attributeName»Cache),
+						joynr::CachedAttribute<«returnType»>::createSubscriptionQos(maxAge),
+						subscriptionRequest);
+			}
+		«ENDFOR»
+	«ENDIF»
+}
+
+void «className»::disableAttributeCache()
+{
+	«FOR attribute: cachedAttributes»
+		«val attributeName = attribute.joynrName»
+		{
+			const std::string subscriptionId = _«attributeName»Cache->disable();
+			if (!subscriptionId.empty()) {
+				unsubscribeFrom«attributeName.toFirstUpper»(subscriptionId);
+			}
+		}
+	«ENDFOR»
+}
+
 «FOR attribute: getAttributes(francaIntf)»
 	«val returnType = getTypeName(attribute, generateVersion)»
 	«val attributeName = attribute.joynrName»
 	«IF attribute.readable»
 		«produceSyncGetterSignature(attribute, className, generateVersion)»
 		{
+			SyncCallScope syncCallScope;
 			auto future = get«attributeName.toFirstUpper»Async(nullptr, nullptr, std::move(qos));
 			future->get(«attributeName»);
 		}
 
 		«produceAsyncGetterSignature(attribute, className, generateVersion)»
 		{
+			«IF attribute.notifiable»
+				if (auto cachedValue = _«attributeName»Cache->get()) {
+					JOYNR_LOG_TRACE(logger(), "get«attributeName.toFirstUpper» answered from the attribute cache");
+					auto future = joynr::util::makePooledShared<joynr::Future<«returnType»>>();
+					safeInvokeCallback(logger(), onSuccess, *cachedValue);
+					future->onSuccess(*cachedValue);
+					return future;
+				}
+			«ENDIF»
 			joynr::Request request;
 			// explicitly set to no parameters
 			request.setParams();
 			request.setMethodName("get«attributeName.toFirstUpper»");
-			auto future = std::make_shared<joynr::Future<«returnType»>>();
+			auto future = joynr::util::makePooledShared<joynr::Future<«returnType»>>();
 
 			std::function<void(const «returnType»&)> onSuccessWrapper = [
 					future,
@@ -222,7 +277,7 @@ using joynr::util::safeInvokeCallback;
 						"REQUEST call proxy: requestReplyId: {}, method: {}",
 						request.getRequestReplyId(),
 						request.getMethodName());
-				auto replyCaller = std::make_shared<joynr::ReplyCaller<«returnType»>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
+				auto replyCaller = joynr::util::makePooledShared<joynr::ReplyCaller<«returnType»>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
 				operationRequest(std::move(replyCaller), std::move(request), std::move(qos));
 			} catch (const std::invalid_argument& exception) {
 				auto joynrException = std::make_shared<joynr::exceptions::MethodInvocationException>(exception.what());
@@ -245,12 +300,21 @@ using joynr::util::safeInvokeCallback;
 			request.setMethodName("set«attributeName.toFirstUpper»");
 			request.setParamDatatypes({"«attribute.getJoynrTypeName(generateVersion)»"});
 			request.setParams(«attributeName»);
+			«IF attribute.readable && attribute.notifiable»
+				// publications received until the setter returns may carry the previous value,
+				// the cache is filled again by the first publication after the setter returned
+				const std::uint64_t cacheGeneration = _«attributeName»Cache->beginSet();
+			«ENDIF»
 
-			auto future = std::make_shared<joynr::Future<void>>();
+			auto future = joynr::util::makePooledShared<joynr::Future<void>>();
 
 			std::function<void()> onSuccessWrapper = [
 					future,
 					onSuccess = std::move(onSuccess),
+					«IF attribute.readable && attribute.notifiable»
+						cache = _«attributeName»Cache,
+						cacheGeneration,
+					«ENDIF»
 					requestReplyId = request.getRequestReplyId(),
 					methodName = request.getMethodName(),
 					thisSharedPtr = shared_from_this()
@@ -260,6 +324,9 @@ using joynr::util::safeInvokeCallback;
 						requestReplyId,
 						methodName
 				);
+				«IF attribute.readable && attribute.notifiable»
+					cache->endSet(cacheGeneration);
+				«ENDIF»
 				safeInvokeCallback(logger(), onSuccess);
 				future->onSuccess();
 			};
@@ -267,6 +334,10 @@ using joynr::util::safeInvokeCallback;
 			std::function<void(const std::shared_ptr<exceptions::JoynrException>& error)> onErrorWrapper = [
 					future,
 					onError = onError,
+					«IF attribute.readable && attribute.notifiable»
+						cache = _«attributeName»Cache,
+						cacheGeneration,
+					«ENDIF»
 					requestReplyId = request.getRequestReplyId(),
 					methodName = request.getMethodName()
 			] (const std::shared_ptr<exceptions::JoynrException>& error) {
@@ -285,6 +356,9 @@ using joynr::util::safeInvokeCallback;
 					methodName,
 					error->what()
 				);
+				«IF attribute.readable && attribute.notifiable»
+					cache->endSet(cacheGeneration);
+				«ENDIF»
 				safeInvokeCallback(logger(), onError, static_cast<const exceptions::JoynrRuntimeException&>(*error));
 				future->onError(error);
 			};
@@ -295,15 +369,21 @@ using joynr::util::safeInvokeCallback;
 						request.getRequestReplyId(),
 						request.getMethodName(),
 						joynr::serializer::serializeToJson(«attributeName»));
-				auto replyCaller = std::make_shared<joynr::ReplyCaller<void>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
+				auto replyCaller = joynr::util::makePooledShared<joynr::ReplyCaller<void>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
 				operationRequest(std::move(replyCaller), std::move(request), std::move(qos));
 			} catch (const std::invalid_argument& exception) {
 				auto joynrException = std::make_shared<joynr::exceptions::MethodInvocationException>(exception.what());
+				«IF attribute.readable && attribute.notifiable»
+					_«attributeName»Cache->endSet(cacheGeneration);
+				«ENDIF»
 				safeInvokeCallback(logger(), onError, *joynrException);
 				future->onError(joynrException);
 			} catch (const joynr::exceptions::JoynrRuntimeException& exception) {
 				std::shared_ptr<joynr::exceptions::JoynrRuntimeException> exceptionPtr;
 				exceptionPtr.reset(exception.clone());
+				«IF attribute.readable && attribute.notifiable»
+					_«attributeName»Cache->endSet(cacheGeneration);
+				«ENDIF»
 				safeInvokeCallback(logger(), onError, exception);
 				future->onError(exceptionPtr);
 			}
@@ -312,6 +392,7 @@ using joynr::util::safeInvokeCallback;
 
 		«produceSyncSetterSignature(attribute, className, generateVersion)»
 		{
+			SyncCallScope syncCallScope;
 			auto future = set«attributeName.toFirstUpper»Async(«attributeName», nullptr, nullptr, std::move(qos));
 			future->get();
 		}
@@ -398,6 +479,7 @@ using joynr::util::safeInvokeCallback;
 	«IF !method.fireAndForget»
 		«produceSyncMethodSignature(method, className, generateVersion)»
 		{
+			SyncCallScope syncCallScope;
 			auto future = «method.joynrName»Async(«method.commaSeperatedUntypedInputParameterList»«IF !method.inputParameters.empty», «ENDIF»«IF method.hasErrorEnum»nullptr,«ENDIF»nullptr, nullptr, std::move(qos));
 			future->get(«method.commaSeperatedUntypedOutputParameterList»);
 		}
@@ -406,7 +488,7 @@ using joynr::util::safeInvokeCallback;
 		{
 			«produceParameterSetters(method, generateVersion)»
 
-			auto future = std::make_shared<joynr::Future<«outputParameters»>>();
+			auto future = joynr::util::makePooledShared<joynr::Future<«outputParameters»>>();
 
 			std::function<void(«outputTypedConstParamList»)> onSuccessWrapper = [
 					future,
@@ -461,7 +543,7 @@ using joynr::util::safeInvokeCallback;
 			try {
 				«logMethodCall(method)»
 
-				auto replyCaller = std::make_shared<joynr::ReplyCaller<«outputParameters»>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
+				auto replyCaller = joynr::util::makePooledShared<joynr::ReplyCaller<«outputParameters»>>(std::move(onSuccessWrapper), std::move(onErrorWrapper));
 				operationRequest(std::move(replyCaller), std::move(request), std::move(qos));
 			} catch (const std::invalid_argument& exception) {
 				auto joynrException = std::make_shared<joynr::exceptions::MethodInvocationException>(exception.what());
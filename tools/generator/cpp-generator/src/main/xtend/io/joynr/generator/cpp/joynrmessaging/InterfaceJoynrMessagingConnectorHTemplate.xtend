@@ -40,6 +40,7 @@ class InterfaceJoynrMessagingConnectorHTemplate extends InterfaceTemplate{
 	override generate(boolean generateVersion)
 '''
 «val interfaceName = francaIntf.joynrName»
+«val cachedAttributes = getAttributes(francaIntf).filter[readable && notifiable]»
 «val headerGuard = ("GENERATED_INTERFACE_"+getPackagePathWithJoynrPrefix(francaIntf, "_", generateVersion)+
 	"_"+interfaceName+"JoynrMessagingConnector_h").toUpperCase»
 «warning()»
@@ -51,6 +52,7 @@ class InterfaceJoynrMessagingConnectorHTemplate extends InterfaceTemplate{
 	#include «parameterType»
 «ENDFOR»
 
+#include <cstdint>
 #include <memory>
 #include <functional>
 #include "«getPackagePathWithJoynrPrefix(francaIntf, "/", generateVersion)»/I«interfaceName»Connector.h"
@@ -59,6 +61,9 @@ class InterfaceJoynrMessagingConnectorHTemplate extends InterfaceTemplate{
 #include "joynr/SubscriptionQos.h"
 #include "joynr/OnChangeSubscriptionQos.h"
 #include "joynr/MulticastSubscriptionQos.h"
+«IF !cachedAttributes.empty»
+	#include "joynr/CachedAttribute.h"
+«ENDIF»
 
 namespace joynr {
 	class MessagingQos;
@@ -94,6 +99,10 @@ namespace exceptions
 /** @brief JoynrMessagingConnector for interface «interfaceName» */
 class «interfaceName»JoynrMessagingConnector : public I«interfaceName»Connector, virtual public joynr::AbstractJoynrMessagingConnector {
 private:
+	«FOR attribute: cachedAttributes»
+		/** @brief Cached value of attribute «attribute.joynrName», see enableAttributeCache */
+		std::shared_ptr<joynr::CachedAttribute<«attribute.getTypeName(generateVersion)»>> _«attribute.joynrName»Cache;
+	«ENDFOR»
 	«FOR attribute: getAttributes(francaIntf)»
 		«val returnType = attribute.getTypeName(generateVersion)»
 		«val attributeName = attribute.joynrName»
@@ -158,6 +167,22 @@ public:
 	/** @brief Destructor */
 	~«interfaceName»JoynrMessagingConnector() override = default;
 
+	/**
+	 * @brief Enables the attribute cache: getters of readable and notifiable attributes are
+	 * answered locally while the last publication of the provider is not older than maxAgeMs.
+	 * Every cached attribute is kept up to date by an on change subscription with keep alive
+	 * publications, so the cache should only be enabled for attributes which are read more
+	 * often than they change.
+	 * @param maxAgeMs The maximum age of a cached value in milliseconds, must be positive
+	 * @throws std::invalid_argument if maxAgeMs is not positive
+	 */
+	void enableAttributeCache(std::int64_t maxAgeMs);
+
+	/**
+	 * @brief Disables the attribute cache and stops the subscriptions keeping it up to date.
+	 */
+	void disableAttributeCache();
+
 	«produceSyncGetterDeclarations(francaIntf, false, generateVersion)»
 	«produceAsyncGetterDeclarations(francaIntf, false, generateVersion)»
 	«produceSyncSetterDeclarations(francaIntf, false, generateVersion)»
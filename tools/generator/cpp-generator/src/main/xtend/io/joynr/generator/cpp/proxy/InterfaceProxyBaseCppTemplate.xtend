@@ -41,6 +41,7 @@ class InterfaceProxyBaseCppTemplate extends InterfaceTemplate {
 «warning()»
 
 #include "«getPackagePathWithJoynrPrefix(francaIntf, "/", generateVersion)»/«className».h"
+#include "joynr/AbstractJoynrMessagingConnector.h"
 #include "joynr/ISubscriptionListener.h"
 #include "joynr/types/DiscoveryEntryWithMetaInfo.h"
 #include "joynr/JoynrMessagingConnectorFactory.h"
@@ -58,6 +59,11 @@ class InterfaceProxyBaseCppTemplate extends InterfaceTemplate {
 {
 }
 
+«className»::~«className»()
+{
+	disableAttributeCache();
+}
+
 void «className»::handleArbitrationFinished(
 		const joynr::types::DiscoveryEntryWithMetaInfo& providerDiscoveryEntry
 ) {
@@ -71,6 +77,48 @@ void «className»::handleArbitrationFinished(
 	joynr::ProxyBase::handleArbitrationFinished(providerDiscoveryEntry);
 }
 
+void «className»::startBatch()
+{
+	auto messagingConnector = std::dynamic_pointer_cast<joynr::AbstractJoynrMessagingConnector>(connector);
+	if (!messagingConnector) {
+		JOYNR_LOG_WARN(logger(), "proxy cannot start a batch for «className», "
+				 "because the communication end partner is not (yet) known");
+		return;
+	}
+	messagingConnector->startBatch();
+}
+
+void «className»::sendBatch()
+{
+	auto messagingConnector = std::dynamic_pointer_cast<joynr::AbstractJoynrMessagingConnector>(connector);
+	if (!messagingConnector) {
+		JOYNR_LOG_WARN(logger(), "proxy cannot send a batch for «className», "
+				 "because the communication end partner is not (yet) known");
+		return;
+	}
+	messagingConnector->sendBatch();
+}
+
+void «className»::enableAttributeCache(std::int64_t maxAgeMs)
+{
+	auto messagingConnector = std::dynamic_pointer_cast<«serviceName»JoynrMessagingConnector>(connector);
+	if (!messagingConnector) {
+		JOYNR_LOG_WARN(logger(), "proxy cannot enable the attribute cache of «className», "
+				 "because the communication end partner is not (yet) known");
+		return;
+	}
+	messagingConnector->enableAttributeCache(maxAgeMs);
+}
+
+void «className»::disableAttributeCache()
+{
+	// the subscriptions keeping the cache up to date hold a reference to the connector
+	auto messagingConnector = std::dynamic_pointer_cast<«serviceName»JoynrMessagingConnector>(connector);
+	if (messagingConnector) {
+		messagingConnector->disableAttributeCache();
+	}
+}
+
 «FOR attribute: getAttributes(francaIntf).filter[attribute | attribute.notifiable]»
 	«var attributeName = attribute.joynrName»
 	«produceUnsubscribeFromAttributeSignature(attribute, className)»
@@ -47,6 +47,7 @@ class InterfaceProxyBaseHTemplate extends InterfaceTemplate {
 «FOR parameterType: getDataTypeIncludesFor(francaIntf, generateVersion).addElements(includeForString)»
 	#include «parameterType»
 «ENDFOR»
+#include <cstdint>
 #include <memory>
 
 #include "joynr/ProxyBase.h"
@@ -81,6 +82,9 @@ public:
 			const joynr::MessagingQos& qosSettings
 	);
 
+	/** @brief Destructor, disables the attribute cache */
+	~«className»() override;
+
 	/**
 	 * @brief Called when arbitration is finished
 	 * @param participantId The id of the participant
@@ -90,6 +94,38 @@ public:
 			const joynr::types::DiscoveryEntryWithMetaInfo& providerDiscoveryEntry
 	) override;
 
+	/**
+	 * @brief Starts a batch: the requests of all following asynchronous method calls of the
+	 * calling thread are collected until the same thread calls sendBatch and then sent to the
+	 * provider in one message. Each call still gets its own future and callbacks.
+	 * Calls of other threads, synchronous calls, fire-and-forget methods, attributes and
+	 * subscriptions are not batched.
+	 * No batch is started if the provider does not declare the ProviderQos custom parameter
+	 * joynr::Message::CUSTOM_PARAMETER_BATCH_REQUESTS() with value "true".
+	 */
+	void startBatch();
+
+	/**
+	 * @brief Sends the requests collected since startBatch in one message and ends the batch.
+	 */
+	void sendBatch();
+
+	/**
+	 * @brief Enables the attribute cache: getters of readable and notifiable attributes are
+	 * answered locally while the last publication of the provider is not older than maxAgeMs.
+	 * Every cached attribute is kept up to date by an on change subscription with keep alive
+	 * publications, so the cache should only be enabled for attributes which are read more
+	 * often than they change. A missed keep alive publication invalidates the cached value.
+	 * @param maxAgeMs The maximum age of a cached value in milliseconds, must be positive
+	 * @throws std::invalid_argument if maxAgeMs is not positive
+	 */
+	void enableAttributeCache(std::int64_t maxAgeMs);
+
+	/**
+	 * @brief Disables the attribute cache and stops the subscriptions keeping it up to date.
+	 */
+	void disableAttributeCache();
+
 	«produceSubscribeUnsubscribeMethodDeclarations(francaIntf, false, generateVersion)»
 
 protected: